@@ -0,0 +1,160 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+import stl;
+import third_party;
+import compilation_config;
+import local_file_system;
+import profiler;
+import infinity_context;
+import memory_indexer;
+import column_index_merger;
+import column_vector;
+import data_type;
+import logical_type;
+import value;
+import index_defines;
+import default_values;
+import internal_types;
+
+using namespace infinity;
+
+// Builds the fulltext index of a jsonl corpus the way a bulk import does: the corpus is dumped in chunks by offline memory indexers,
+// then the chunks are merged. Each step runs once serially and once split into term range partitions, so the two can be compared.
+// A Wikipedia sized corpus can be produced by `wikiextractor --json`, whose lines have the same "text" field as dbpedia-entity.
+
+// Reads the "text" field of up to row_count lines into columns of DEFAULT_VECTOR_SIZE rows. Returns the number of rows read.
+SizeT ReadTextColumns(std::ifstream &input_file, SizeT row_count, Vector<SharedPtr<ColumnVector>> &columns) {
+    columns.clear();
+    SizeT rows_read = 0;
+    String line;
+    while (rows_read < row_count && std::getline(input_file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        if (rows_read % SizeT(DEFAULT_VECTOR_SIZE) == 0) {
+            columns.emplace_back(ColumnVector::Make(MakeShared<DataType>(LogicalType::kVarchar)));
+            columns.back()->Initialize();
+        }
+        nlohmann::json json = nlohmann::json::parse(line);
+        String text = json["text"];
+        columns.back()->AppendValue(Value::MakeVarchar(text));
+        ++rows_read;
+    }
+    return rows_read;
+}
+
+// Returns the seconds spent in Dump
+f64 DumpChunk(const String &index_dir,
+              const String &chunk_name,
+              RowID base_row_id,
+              const Vector<SharedPtr<ColumnVector>> &columns,
+              SizeT partition_count) {
+    MemoryIndexer indexer(index_dir, chunk_name, base_row_id, OPTION_FLAG_ALL, "standard");
+    indexer.SetDumpPartitionCount(partition_count);
+    for (const auto &column : columns) {
+        indexer.Insert(column, 0, column->Size(), true);
+    }
+    BaseProfiler profiler("Dump");
+    profiler.Begin();
+    indexer.Dump(true);
+    profiler.End();
+    return profiler.Elapsed() / 1e9;
+}
+
+f64 MergeChunks(const String &index_dir, const Vector<String> &chunk_names, const Vector<RowID> &base_row_ids, SizeT partition_count) {
+    BaseProfiler profiler("Merge");
+    profiler.Begin();
+    ColumnIndexMerger merger(index_dir, OPTION_FLAG_ALL, partition_count);
+    merger.Merge(chunk_names, base_row_ids, "merged");
+    profiler.End();
+    return profiler.Elapsed() / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    CLI::App app{"fulltext_build_benchmark"};
+    String data_path = String(test_data_path()) + "/benchmark/dbpedia-entity/corpus.jsonl";
+    String index_dir = "/var/infinity/tmp/fulltext_build_benchmark";
+    SizeT chunk_rows = 500000;
+    SizeT max_rows = SizeT(-1);
+    SizeT thread_count = std::thread::hardware_concurrency();
+    app.add_option("--data", data_path, "jsonl corpus with a text field, default is the dbpedia-entity corpus");
+    app.add_option("--index-dir", index_dir, "directory of the index files, default /var/infinity/tmp/fulltext_build_benchmark");
+    app.add_option("--chunk-rows", chunk_rows, "rows of each dumped chunk, default 500000");
+    app.add_option("--max-rows", max_rows, "rows of the corpus to index, default all");
+    app.add_option("--threads", thread_count, "size of the fulltext thread pools and number of partitions, default the number of cores");
+    try {
+        app.parse(argc, argv);
+    } catch (const CLI::ParseError &e) {
+        return app.exit(e);
+    }
+
+    std::ifstream input_file(data_path);
+    if (!input_file.is_open()) {
+        std::cout << fmt::format("Failed to open file {}\n", data_path);
+        return 1;
+    }
+    InfinityContext &context = InfinityContext::instance();
+    context.GetFulltextInvertingThreadPool().resize(thread_count);
+    context.GetFulltextCommitingThreadPool().resize(thread_count);
+    context.GetFulltextMergingThreadPool().resize(thread_count);
+
+    const Array<SizeT, 2> partition_counts = {1, thread_count};
+    LocalFileSystem fs;
+    Vector<String> index_dirs;
+    for (SizeT partition_count : partition_counts) {
+        index_dirs.emplace_back(fmt::format("{}/partition_{}", index_dir, partition_count));
+        if (fs.Exists(index_dirs.back())) {
+            fs.DeleteDirectory(index_dirs.back());
+        }
+        fs.CreateDirectory(index_dirs.back());
+    }
+
+    Vector<String> chunk_names;
+    Vector<RowID> base_row_ids;
+    Array<f64, 2> dump_seconds = {0, 0};
+    Vector<SharedPtr<ColumnVector>> columns;
+    SizeT total_rows = 0;
+    while (total_rows < max_rows) {
+        SizeT rows = ReadTextColumns(input_file, std::min(chunk_rows, max_rows - total_rows), columns);
+        if (rows == 0) {
+            break;
+        }
+        chunk_names.emplace_back(fmt::format("chunk{}", chunk_names.size()));
+        base_row_ids.emplace_back(0U, u32(total_rows));
+        for (SizeT i = 0; i < partition_counts.size(); ++i) {
+            dump_seconds[i] += DumpChunk(index_dirs[i], chunk_names.back(), base_row_ids.back(), columns, partition_counts[i]);
+        }
+        total_rows += rows;
+        std::cout << fmt::format("Dumped {} rows, serial dump {:.3f}s, {} partitions dump {:.3f}s\n",
+                                 total_rows,
+                                 dump_seconds[0],
+                                 partition_counts[1],
+                                 dump_seconds[1]);
+    }
+
+    for (SizeT i = 0; i < partition_counts.size(); ++i) {
+        f64 merge_seconds = MergeChunks(index_dirs[i], chunk_names, base_row_ids, partition_counts[i]);
+        std::cout << fmt::format("{} partitions: dump {} chunks {:.3f}s, merge {:.3f}s\n",
+                                 partition_counts[i],
+                                 chunk_names.size(),
+                                 dump_seconds[i],
+                                 merge_seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iostream>
+#include <random>
+
+import stl;
+import third_party;
+import profiler;
+import index_defines;
+import posting_field;
+import byte_slice_writer;
+import byte_slice_reader;
+
+using namespace infinity;
+
+// Encodes and decodes synthetic posting streams block by block with each posting codec, the way the posting decoders do.
+
+struct Stream {
+    String name_;
+    Vector<u32> values_;
+};
+
+// doc id deltas of a term in one of every `gap` documents on average, term frequencies and in document position deltas
+Vector<Stream> MakeStreams(SizeT value_count) {
+    std::mt19937 rng(42);
+    Vector<Stream> streams;
+    for (f64 gap : {2.0, 64.0, 4096.0}) {
+        std::geometric_distribution<u32> delta_dist(1.0 / gap);
+        Stream &stream = streams.emplace_back(Stream{fmt::format("doc id deltas, gap {}", gap), {}});
+        for (SizeT i = 0; i < value_count; ++i) {
+            stream.values_.push_back(delta_dist(rng) + 1);
+        }
+    }
+    {
+        std::geometric_distribution<u32> tf_dist(0.6);
+        Stream &stream = streams.emplace_back(Stream{"term frequencies", {}});
+        for (SizeT i = 0; i < value_count; ++i) {
+            stream.values_.push_back(tf_dist(rng) + 1);
+        }
+    }
+    {
+        std::geometric_distribution<u32> pos_dist(1.0 / 200);
+        Stream &stream = streams.emplace_back(Stream{"position deltas", {}});
+        for (SizeT i = 0; i < value_count; ++i) {
+            stream.values_.push_back(pos_dist(rng));
+        }
+    }
+    return streams;
+}
+
+void RunCodec(const String &codec_name, PostingCodec codec, const Stream &stream, SizeT round_count) {
+    const Int32Encoder *encoder = GetDocIDEncoder(codec);
+    const Vector<u32> &values = stream.values_;
+    const SizeT block_count = values.size() / MAX_DOC_PER_RECORD;
+
+    ByteSliceWriter writer;
+    BaseProfiler encode_profiler("Encode");
+    encode_profiler.Begin();
+    for (SizeT i = 0; i < block_count; ++i) {
+        encoder->Encode(writer, values.data() + i * MAX_DOC_PER_RECORD, MAX_DOC_PER_RECORD);
+    }
+    encode_profiler.End();
+
+    Vector<u32> decoded(block_count * MAX_DOC_PER_RECORD);
+    BaseProfiler decode_profiler("Decode");
+    decode_profiler.Begin();
+    for (SizeT round = 0; round < round_count; ++round) {
+        ByteSliceReader reader(writer.GetByteSliceList());
+        for (SizeT i = 0; i < block_count; ++i) {
+            encoder->Decode(decoded.data() + i * MAX_DOC_PER_RECORD, MAX_DOC_PER_RECORD, reader);
+        }
+    }
+    decode_profiler.End();
+    if (!std::equal(decoded.begin(), decoded.end(), values.begin())) {
+        std::cout << fmt::format("{} decoded {} incorrectly\n", codec_name, stream.name_);
+        return;
+    }
+
+    const f64 value_count = block_count * MAX_DOC_PER_RECORD;
+    std::cout << fmt::format("{:<16} {:<28} {:6.2f} bits/int, encode {:8.1f} Mint/s, decode {:8.1f} Mint/s\n",
+                             codec_name,
+                             stream.name_,
+                             writer.GetSize() * 8.0 / value_count,
+                             value_count / (encode_profiler.Elapsed() / 1e3),
+                             value_count * round_count / (decode_profiler.Elapsed() / 1e3));
+}
+
+int main(int argc, char *argv[]) {
+    CLI::App app{"posting_codec_benchmark"};
+    SizeT value_count = 1 << 22;
+    SizeT round_count = 20;
+    app.add_option("--values", value_count, "integers of each stream, default 4194304");
+    app.add_option("--rounds", round_count, "times each stream is decoded, default 20");
+    try {
+        app.parse(argc, argv);
+    } catch (const CLI::ParseError &e) {
+        return app.exit(e);
+    }
+
+    Vector<Stream> streams = MakeStreams(value_count);
+    const Array<Pair<String, PostingCodec>, 2> codecs = {Pair<String, PostingCodec>{"simdbp128", PostingCodec::kSIMDBitPacking},
+                                                         Pair<String, PostingCodec>{"streamvbyte", PostingCodec::kStreamVByte}};
+    for (const Stream &stream : streams) {
+        for (const auto &[codec_name, codec] : codecs) {
+            RunCodec(codec_name, codec, stream, round_count);
+        }
+    }
+    return 0;
+}
@@ -162,6 +162,12 @@ class ThriftInfinityClient:
     #                                             column_names=column_names,
     #                                             fields=fields))
 
+    def insert_columns(self, db_name: str, table_name: str, columns: list[InsertColumn]):
+        return self.client.Insert(InsertRequest(session_id=self.session_id,
+                                                db_name=db_name,
+                                                table_name=table_name,
+                                                columns=columns))
+
     def import_data(self, db_name: str, table_name: str, file_name: str, import_options):
         return self.client.Import(ImportRequest(session_id=self.session_id,
                                                 db_name=db_name,
@@ -182,6 +188,16 @@ class ThriftInfinityClient:
                                                 offset_expr=offset_expr,
                                                 ))
 
+    def prepare(self, statement_name: str, statement: str):
+        return self.client.Prepare(PrepareRequest(session_id=self.session_id,
+                                                  statement_name=statement_name,
+                                                  statement=statement))
+
+    def execute(self, statement_name: str, parameters: list[ConstantExpr]):
+        return self.client.Execute(ExecuteRequest(session_id=self.session_id,
+                                                  statement_name=statement_name,
+                                                  parameters=parameters))
+
     def explain(self, db_name: str, table_name: str, select_list, search_expr,
                 where_expr, group_by_list, limit_expr, offset_expr, explain_type):
         return self.client.Explain(ExplainRequest(session_id=self.session_id,
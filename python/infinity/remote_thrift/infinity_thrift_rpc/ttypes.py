@@ -108,6 +108,8 @@ class ElementType(object):
     ElementInt64 = 4
     ElementFloat32 = 5
     ElementFloat64 = 6
+    ElementFloat16 = 7
+    ElementBFloat16 = 8
 
     _VALUES_TO_NAMES = {
         0: "ElementBit",
@@ -117,6 +119,8 @@ class ElementType(object):
         4: "ElementInt64",
         5: "ElementFloat32",
         6: "ElementFloat64",
+        7: "ElementFloat16",
+        8: "ElementBFloat16",
     }
 
     _NAMES_TO_VALUES = {
@@ -127,6 +131,8 @@ class ElementType(object):
         "ElementInt64": 4,
         "ElementFloat32": 5,
         "ElementFloat64": 6,
+        "ElementFloat16": 7,
+        "ElementBFloat16": 8,
     }
 
 
@@ -1589,12 +1595,13 @@ class KnnExpr(object):
      - distance_type
      - topn
      - opt_params
+     - query_count
 
     """
 
 
     def __init__(self, column_expr=None, embedding_data=None, embedding_data_type=None, distance_type=None, topn=None, opt_params=[
-    ],):
+    ], query_count=1,):
         self.column_expr = column_expr
         self.embedding_data = embedding_data
         self.embedding_data_type = embedding_data_type
@@ -1604,6 +1611,7 @@ class KnnExpr(object):
             opt_params = [
             ]
         self.opt_params = opt_params
+        self.query_count = query_count
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1652,6 +1660,11 @@ class KnnExpr(object):
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.I64:
+                    self.query_count = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1689,6 +1702,10 @@ class KnnExpr(object):
                 iter125.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.query_count is not None:
+            oprot.writeFieldBegin('query_count', TType.I64, 7)
+            oprot.writeI64(self.query_count)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -2668,6 +2685,120 @@ class ColumnField(object):
         return not (self == other)
 
 
+class InsertColumn(object):
+    """
+    Attributes:
+     - column_name
+     - data_type
+     - row_count
+     - data
+     - varchar_offsets
+
+    """
+
+
+    def __init__(self, column_name=None, data_type=None, row_count=None, data=None, varchar_offsets=[
+    ],):
+        self.column_name = column_name
+        self.data_type = data_type
+        self.row_count = row_count
+        self.data = data
+        if varchar_offsets is self.thrift_spec[5][4]:
+            varchar_offsets = [
+            ]
+        self.varchar_offsets = varchar_offsets
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.column_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.data_type = DataType()
+                    self.data_type.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.row_count = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRING:
+                    self.data = iprot.readBinary()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.LIST:
+                    self.varchar_offsets = []
+                    (_etype318, _size315) = iprot.readListBegin()
+                    for _i319 in range(_size315):
+                        _elem320 = iprot.readI32()
+                        self.varchar_offsets.append(_elem320)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('InsertColumn')
+        if self.column_name is not None:
+            oprot.writeFieldBegin('column_name', TType.STRING, 1)
+            oprot.writeString(self.column_name.encode('utf-8') if sys.version_info[0] == 2 else self.column_name)
+            oprot.writeFieldEnd()
+        if self.data_type is not None:
+            oprot.writeFieldBegin('data_type', TType.STRUCT, 2)
+            self.data_type.write(oprot)
+            oprot.writeFieldEnd()
+        if self.row_count is not None:
+            oprot.writeFieldBegin('row_count', TType.I64, 3)
+            oprot.writeI64(self.row_count)
+            oprot.writeFieldEnd()
+        if self.data is not None:
+            oprot.writeFieldBegin('data', TType.STRING, 4)
+            oprot.writeBinary(self.data)
+            oprot.writeFieldEnd()
+        if self.varchar_offsets is not None:
+            oprot.writeFieldBegin('varchar_offsets', TType.LIST, 5)
+            oprot.writeListBegin(TType.I32, len(self.varchar_offsets))
+            for iter321 in self.varchar_offsets:
+                oprot.writeI32(iter321)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
 class ImportOption(object):
     """
     Attributes:
@@ -4998,13 +5129,15 @@ class InsertRequest(object):
      - column_names
      - fields
      - session_id
+     - columns
 
     """
 
 
     def __init__(self, db_name=None, table_name=None, column_names=[
     ], fields=[
-    ], session_id=None,):
+    ], session_id=None, columns=[
+    ],):
         self.db_name = db_name
         self.table_name = table_name
         if column_names is self.thrift_spec[3][4]:
@@ -5016,6 +5149,10 @@ class InsertRequest(object):
             ]
         self.fields = fields
         self.session_id = session_id
+        if columns is self.thrift_spec[6][4]:
+            columns = [
+            ]
+        self.columns = columns
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5062,6 +5199,17 @@ class InsertRequest(object):
                     self.session_id = iprot.readI64()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.LIST:
+                    self.columns = []
+                    (_etype325, _size322) = iprot.readListBegin()
+                    for _i326 in range(_size322):
+                        _elem327 = InsertColumn()
+                        _elem327.read(iprot)
+                        self.columns.append(_elem327)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5098,6 +5246,13 @@ class InsertRequest(object):
             oprot.writeFieldBegin('session_id', TType.I64, 5)
             oprot.writeI64(self.session_id)
             oprot.writeFieldEnd()
+        if self.columns is not None:
+            oprot.writeFieldBegin('columns', TType.LIST, 6)
+            oprot.writeListBegin(TType.STRUCT, len(self.columns))
+            for iter328 in self.columns:
+                iter328.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -7073,6 +7228,178 @@ class ShowBlockColumnResponse(object):
 
     def __ne__(self, other):
         return not (self == other)
+
+
+class PrepareRequest(object):
+    """
+    Attributes:
+     - session_id
+     - statement_name
+     - statement
+
+    """
+
+
+    def __init__(self, session_id=None, statement_name=None, statement=None,):
+        self.session_id = session_id
+        self.statement_name = statement_name
+        self.statement = statement
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.statement_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.statement = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('PrepareRequest')
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 1)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        if self.statement_name is not None:
+            oprot.writeFieldBegin('statement_name', TType.STRING, 2)
+            oprot.writeString(self.statement_name.encode('utf-8') if sys.version_info[0] == 2 else self.statement_name)
+            oprot.writeFieldEnd()
+        if self.statement is not None:
+            oprot.writeFieldBegin('statement', TType.STRING, 3)
+            oprot.writeString(self.statement.encode('utf-8') if sys.version_info[0] == 2 else self.statement)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class ExecuteRequest(object):
+    """
+    Attributes:
+     - session_id
+     - statement_name
+     - parameters
+
+    """
+
+
+    def __init__(self, session_id=None, statement_name=None, parameters=[
+    ],):
+        self.session_id = session_id
+        self.statement_name = statement_name
+        if parameters is self.thrift_spec[3][4]:
+            parameters = [
+            ]
+        self.parameters = parameters
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.statement_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.parameters = []
+                    (_etype332, _size329) = iprot.readListBegin()
+                    for _i333 in range(_size329):
+                        _elem334 = ConstantExpr()
+                        _elem334.read(iprot)
+                        self.parameters.append(_elem334)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('ExecuteRequest')
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 1)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        if self.statement_name is not None:
+            oprot.writeFieldBegin('statement_name', TType.STRING, 2)
+            oprot.writeString(self.statement_name.encode('utf-8') if sys.version_info[0] == 2 else self.statement_name)
+            oprot.writeFieldEnd()
+        if self.parameters is not None:
+            oprot.writeFieldBegin('parameters', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.parameters))
+            for iter335 in self.parameters:
+                iter335.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
 all_structs.append(Property)
 Property.thrift_spec = (
     None,  # 0
@@ -7181,6 +7508,7 @@ KnnExpr.thrift_spec = (
     (5, TType.I64, 'topn', None, None, ),  # 5
     (6, TType.LIST, 'opt_params', (TType.STRUCT, [InitParameter, None], False), [
     ], ),  # 6
+    (7, TType.I64, 'query_count', None, 1, ),  # 7
 )
 all_structs.append(MatchTensorExpr)
 MatchTensorExpr.thrift_spec = (
@@ -7262,6 +7590,16 @@ ColumnField.thrift_spec = (
     ], ),  # 2
     (3, TType.STRING, 'column_name', 'UTF8', None, ),  # 3
 )
+all_structs.append(InsertColumn)
+InsertColumn.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'column_name', 'UTF8', None, ),  # 1
+    (2, TType.STRUCT, 'data_type', [DataType, None], None, ),  # 2
+    (3, TType.I64, 'row_count', None, None, ),  # 3
+    (4, TType.STRING, 'data', 'BINARY', None, ),  # 4
+    (5, TType.LIST, 'varchar_offsets', (TType.I32, None, False), [
+    ], ),  # 5
+)
 all_structs.append(ImportOption)
 ImportOption.thrift_spec = (
     None,  # 0
@@ -7480,6 +7818,8 @@ InsertRequest.thrift_spec = (
     (4, TType.LIST, 'fields', (TType.STRUCT, [Field, None], False), [
     ], ),  # 4
     (5, TType.I64, 'session_id', None, None, ),  # 5
+    (6, TType.LIST, 'columns', (TType.STRUCT, [InsertColumn, None], False), [
+    ], ),  # 6
 )
 all_structs.append(ImportRequest)
 ImportRequest.thrift_spec = (
@@ -7653,5 +7993,20 @@ ShowBlockColumnResponse.thrift_spec = (
     (7, TType.I64, 'extra_file_count', None, None, ),  # 7
     (8, TType.STRING, 'extra_file_names', 'UTF8', None, ),  # 8
 )
+all_structs.append(PrepareRequest)
+PrepareRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'session_id', None, None, ),  # 1
+    (2, TType.STRING, 'statement_name', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'statement', 'UTF8', None, ),  # 3
+)
+all_structs.append(ExecuteRequest)
+ExecuteRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'session_id', None, None, ),  # 1
+    (2, TType.STRING, 'statement_name', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'parameters', (TType.STRUCT, [ConstantExpr, None], False), [
+    ], ),  # 3
+)
 fix_spec(all_structs)
 del all_structs
@@ -87,6 +87,12 @@ class InfinityThriftQueryBuilder(ABC):
         else:
             raise InfinityException(3051, f"Invalid embedding data, type should be embedded, but get {type(embedding_data)}")
 
+        # a batch of query vectors is sent flattened, the results are grouped by query in the order of the batch
+        query_count = 1
+        if len(embedding_data) > 0 and isinstance(embedding_data[0], (list, tuple)):
+            query_count = len(embedding_data)
+            embedding_data = [x for query in embedding_data for x in query]
+
         if (embedding_data_type == 'tinyint' or
             embedding_data_type == 'smallint' or
             embedding_data_type == 'int' or
@@ -137,7 +143,7 @@ class InfinityThriftQueryBuilder(ABC):
                 knn_opt_params.append(InitParameter(k, v))
 
         knn_expr = KnnExpr(column_expr=column_expr, embedding_data=data, embedding_data_type=elem_type,
-                           distance_type=dist_type, topn=topn, opt_params=knn_opt_params)
+                           distance_type=dist_type, topn=topn, opt_params=knn_opt_params, query_count=query_count)
         # print(knn_expr)
         self._search.knn_exprs.append(knn_expr)
         return self
@@ -78,6 +78,10 @@ def logic_type_to_dtype(ttype: ttypes.DataType):
                         return object
                     case ttypes.ElementType.ElementFloat64:
                         return object
+                    case ttypes.ElementType.ElementFloat16:
+                        return object
+                    case ttypes.ElementType.ElementBFloat16:
+                        return object
                     case ttypes.ElementType.ElementBit:
                         return object
                     case _:
@@ -121,6 +125,10 @@ def logic_type_to_pl_type(ttype: ttypes.DataType):
                         return pl.List
                     case ttypes.ElementType.ElementFloat64:
                         return pl.List
+                    case ttypes.ElementType.ElementFloat16:
+                        return pl.List
+                    case ttypes.ElementType.ElementBFloat16:
+                        return pl.List
                     case ttypes.ElementType.ElementBit:
                         return pl.List
                     case _:
@@ -172,6 +180,14 @@ def column_vector_to_list(column_type: ttypes.ColumnType, column_data_type: ttyp
             elif column_data_type.physical_type.embedding_type.element_type == ttypes.ElementType.ElementFloat64:
                 all_list = list(struct.unpack('<{}d'.format(len(column_vector) // 8), column_vector))
                 return [all_list[i:i + dimension] for i in range(0, len(all_list), dimension)]
+            elif column_data_type.physical_type.embedding_type.element_type == ttypes.ElementType.ElementFloat16:
+                all_list = list(struct.unpack('<{}e'.format(len(column_vector) // 2), column_vector))
+                return [all_list[i:i + dimension] for i in range(0, len(all_list), dimension)]
+            elif column_data_type.physical_type.embedding_type.element_type == ttypes.ElementType.ElementBFloat16:
+                # bfloat16 is the upper half of a float32
+                raw_list = struct.unpack('<{}H'.format(len(column_vector) // 2), column_vector)
+                all_list = [struct.unpack('<f', struct.pack('<I', x << 16))[0] for x in raw_list]
+                return [all_list[i:i + dimension] for i in range(0, len(all_list), dimension)]
             elif column_data_type.physical_type.embedding_type.element_type == ttypes.ElementType.ElementBit:
                 all_list = list(struct.unpack('<{}B'.format(len(column_vector)), column_vector))
                 result = []
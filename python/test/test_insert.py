@@ -364,9 +364,11 @@ class TestInsert(TestSdk):
         assert table_obj
         values = [{"c1": 1} for _ in range(8193)]
 
-        with pytest.raises(Exception,
-                           match=".*Insert values row count 8193 is larger than default block capacity 8192*"):
-            table_obj.insert(values)
+        # split into two blocks
+        res = table_obj.insert(values)
+        assert res.error_code == ErrorCode.OK
+        res = table_obj.output(["*"]).to_df()
+        assert len(res) == 8193
 
         res = db_obj.drop_table(
             "test_insert_exceed_block_size", ConflictType.Error)
@@ -902,3 +902,22 @@ class TestKnn(TestSdk):
 
         res = db_obj.drop_table("test_with_multiple_fusion", ConflictType.Error)
         assert res.error_code == ErrorCode.OK
+
+    def test_knn_batch(self, get_infinity_db):
+        db_obj = get_infinity_db
+        db_obj.drop_table("test_knn_batch", ConflictType.Ignore)
+        table_obj = db_obj.create_table("test_knn_batch", {"c1": {"type": "int"}, "c2": {"type": "vector,4,float"}})
+        table_obj.insert([{"c1": 2, "c2": [0.1, 0.2, 0.3, -0.2]},
+                          {"c1": 4, "c2": [0.2, 0.1, 0.3, 0.4]},
+                          {"c1": 6, "c2": [0.3, 0.2, 0.1, 0.4]},
+                          {"c1": 8, "c2": [0.4, 0.3, 0.2, 0.1]}])
+
+        # the results are grouped by query, in the order of the batch
+        res = (table_obj
+               .output(["c1"])
+               .knn("c2", [[0.3, 0.3, 0.2, 0.2], [0.1, 0.2, 0.3, -0.2]], "float", "l2", 2)
+               .to_pl())
+        assert res["c1"].to_list() == [8, 6, 2, 8]
+
+        res = db_obj.drop_table("test_knn_batch", ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
@@ -88,6 +88,10 @@ export {
     constexpr SizeT DEFAULT_OUTLINE_FILE_MAX_SIZE = 16 * 1024 * 1024;
 
     constexpr SizeT DEFAULT_CHUNK_SIZE = 10 * 1024 * 1024;
+    // CSV files are split into ranges of at least this size to be imported in parallel
+    constexpr SizeT DEFAULT_IMPORT_RANGE_SIZE = 64 * MB;
+    // JSONL files are read and parsed in chunks of this size
+    constexpr SizeT DEFAULT_JSONL_READ_SIZE = 16 * MB;
     constexpr SizeT DEFAULT_ALIGN_SIZE = sizeof(char *);
 
     constexpr SizeT MIN_CLEANUP_INTERVAL_SEC = 0; // 0 means disable the function
@@ -105,6 +109,18 @@ export {
     constexpr std::string_view DEFAULT_OPTIMIZE_INTERVAL_SEC_STR = "10s"; // 10 seconds
     constexpr SizeT MAX_OPTIMIZE_INTERVAL_SEC = 60 * 60 * 24 * 30; // 1 month
 
+    constexpr SizeT MIN_COMPACT_WORKER_COUNT = 1;
+    constexpr SizeT DEFAULT_COMPACT_WORKER_COUNT = 2;
+    constexpr SizeT MAX_COMPACT_WORKER_COUNT = 64;
+
+    constexpr SizeT MIN_COMPACT_TABLE_CONCURRENCY = 1;
+    constexpr SizeT DEFAULT_COMPACT_TABLE_CONCURRENCY = 1;
+    constexpr SizeT MAX_COMPACT_TABLE_CONCURRENCY = 16;
+
+    constexpr SizeT MIN_COMPACT_CPU_LIMIT = 1;      // percent of the cpu limit
+    constexpr SizeT DEFAULT_COMPACT_CPU_LIMIT = 25; // percent of the cpu limit
+    constexpr SizeT MAX_COMPACT_CPU_LIMIT = 100;    // percent of the cpu limit
+
     constexpr SizeT MIN_MEMINDEX_CAPACITY = DEFAULT_BLOCK_CAPACITY;           // 1 Block
     constexpr SizeT DEFAULT_MEMINDEX_CAPACITY = 128 * DEFAULT_BLOCK_CAPACITY; // 128 * 8192 = 1M rows
     constexpr SizeT MAX_MEMINDEX_CAPACITY = DEFAULT_SEGMENT_CAPACITY;         // 1 Segment
@@ -152,12 +168,17 @@ export {
     constexpr SizeT DBT_COMPACTION_C = 4;
     constexpr SizeT DBT_COMPACTION_S = DEFAULT_BLOCK_CAPACITY;
 
+    // the secondary index chunks with at most this many distinct keys also keep one compressed bitmap of the rows per key
+    constexpr u32 SECONDARY_INDEX_BITMAP_MAX_DISTINCT_KEYS = 1024;
+
     // default query option parameter
     constexpr u32 DEFAULT_FULL_TEXT_OPTION_TOP_N = 10;
     constexpr u32 DEFAULT_MATCH_TENSOR_OPTION_TOP_N = 10;
 
     constexpr SizeT DEFAULT_BUFFER_MANAGER_SIZE = 4 * 1024lu * 1024lu * 1024lu; // 4Gib
     constexpr std::string_view DEFAULT_BUFFER_MANAGER_SIZE_STR = "4GB"; // 4Gib
+    constexpr SizeT DEFAULT_RESULT_CACHE_SIZE = 0; // disabled
+    constexpr std::string_view DEFAULT_RESULT_CACHE_SIZE_STR = "0MB"; // disabled
 
     constexpr SizeT DEFAULT_LOG_FILE_SIZE = 64 * 1024lu * 1024lu; // 64MB
     constexpr std::string_view DEFAULT_LOG_FILE_SIZE_STR = "64MB"; // 64MB
@@ -186,6 +207,9 @@ export {
     constexpr std::string_view COMPACT_INTERVAL_OPTION_NAME = "compact_interval";
     constexpr std::string_view OPTIMIZE_INTERVAL_OPTION_NAME = "optimize_interval";
     constexpr std::string_view MEM_INDEX_CAPACITY_OPTION_NAME = "mem_index_capacity";
+    constexpr std::string_view COMPACT_WORKER_COUNT_OPTION_NAME = "compact_worker_count";
+    constexpr std::string_view COMPACT_TABLE_CONCURRENCY_OPTION_NAME = "compact_table_concurrency";
+    constexpr std::string_view COMPACT_CPU_LIMIT_OPTION_NAME = "compact_cpu_limit";
 
     constexpr std::string_view BUFFER_MANAGER_SIZE_OPTION_NAME = "buffer_manager_size";
     constexpr std::string_view TEMP_DIR_OPTION_NAME = "temp_dir";
@@ -197,6 +221,7 @@ export {
     constexpr std::string_view DELTA_CHECKPOINT_THRESHOLD_OPTION_NAME = "delta_checkpoint_threshold";
     constexpr std::string_view WAL_FLUSH_OPTION_NAME = "wal_flush";
     constexpr std::string_view RESOURCE_DIR_OPTION_NAME = "resource_dir";
+    constexpr std::string_view RESULT_CACHE_SIZE_OPTION_NAME = "result_cache_size";
 
     // Variable name
     constexpr std::string_view QUERY_COUNT_VAR_NAME = "query_count";        // global and session
@@ -42,6 +42,8 @@ module;
 #include "parallel_hashmap/phmap.h"
 #include "pgm/pgm_index.hpp"
 
+#include "roaring/roaring.hh"
+
 #include "oatpp/network/Server.hpp"
 #include "oatpp/network/tcp/server/ConnectionProvider.hpp"
 #include "oatpp/web/server/HttpConnectionHandler.hpp"
@@ -179,6 +181,9 @@ using FlatHashSet = phmap::flat_hash_set<T, Hash, Eq, Alloc>;
 export template <typename K, size_t Epsilon = 64, size_t EpsilonRecursive = 4, typename Floating = float>
 using PGMIndex = pgm::PGMIndex<K, Epsilon, EpsilonRecursive, Floating>;
 
+// compressed bitmap
+export using Roaring = roaring::Roaring;
+
 // Http
 export using HttpRequestHandler = oatpp::web::server::HttpRequestHandler;
 export using HttpRouter = oatpp::web::server::HttpRouter;
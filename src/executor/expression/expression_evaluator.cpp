@@ -35,6 +35,13 @@ import infinity_exception;
 import expression_type;
 import bound_cast_func;
 import logger;
+import selection;
+import in_value_set;
+import fused_expression;
+import bitmask;
+import vector_buffer;
+import logical_type;
+import data_type;
 
 namespace infinity {
 
@@ -135,10 +142,110 @@ void ExpressionEvaluator::Execute(const SharedPtr<CastExpression> &expr,
     expr->func_.function(child_output, output_column_vector, child_output->Size(), cast_parameters);
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    String error_message = "Case execution";
-    LOG_CRITICAL(error_message);
-    UnrecoverableError(error_message);
+namespace {
+
+// Copies the i-th row of source to the i-th selected row of output
+void ScatterRows(const ColumnVector &source, const Selection &rows, ColumnVector &output) {
+    const bool source_constant = source.vector_type() == ColumnVectorType::kConstant;
+    for (SizeT i = 0; i < rows.Size(); ++i) {
+        SizeT row = rows.Get(i);
+        if (source.nulls_ptr_->IsTrue(source_constant ? 0 : i)) {
+            output.CopyRow(source, row, i);
+        } else {
+            output.nulls_ptr_->SetFalse(row);
+        }
+    }
+}
+
+void SetRowsNull(const Selection &rows, ColumnVector &output) {
+    for (SizeT i = 0; i < rows.Size(); ++i) {
+        output.nulls_ptr_->SetFalse(rows.Get(i));
+    }
+}
+
+} // namespace
+
+// Each WHEN is only evaluated on the rows no previous WHEN matched, and each THEN on the rows its WHEN matched.
+void ExpressionEvaluator::Execute(const SharedPtr<CaseExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    SizeT count = 1;
+    if (output_column_vector->vector_type() != ColumnVectorType::kConstant && input_data_block_ != nullptr) {
+        count = input_data_block_->row_count();
+    }
+    output_column_vector->Finalize(count);
+    output_column_vector->nulls_ptr_->SetAllTrue();
+    if (count == 0) {
+        return;
+    }
+
+    SharedPtr<Selection> remaining_rows = MakeShared<Selection>();
+    remaining_rows->Initialize(count);
+    for (SizeT row = 0; row < count; ++row) {
+        remaining_rows->Append(row);
+    }
+
+    Vector<CaseCheck> &case_checks = expr->CaseExpr();
+    for (SizeT check_idx = 0; check_idx < case_checks.size() && remaining_rows->Size() > 0; ++check_idx) {
+        SharedPtr<ExpressionState> &when_state = state->Children()[check_idx * 2];
+        SharedPtr<ExpressionState> &then_state = state->Children()[check_idx * 2 + 1];
+        SharedPtr<ColumnVector> when_output = ExecuteOnRows(case_checks[check_idx].when_expr_, when_state, remaining_rows, count);
+
+        SizeT remaining_count = remaining_rows->Size();
+        SharedPtr<Selection> matched_rows = MakeShared<Selection>();
+        matched_rows->Initialize(remaining_count);
+        SharedPtr<Selection> unmatched_rows = MakeShared<Selection>();
+        unmatched_rows->Initialize(remaining_count);
+        const bool when_constant = when_output->vector_type() == ColumnVectorType::kConstant;
+        for (SizeT i = 0; i < remaining_count; ++i) {
+            SizeT when_idx = when_constant ? 0 : i;
+            if (when_output->nulls_ptr_->IsTrue(when_idx) && when_output->buffer_->GetCompactBit(when_idx)) {
+                matched_rows->Append(remaining_rows->Get(i));
+            } else {
+                unmatched_rows->Append(remaining_rows->Get(i));
+            }
+        }
+
+        if (matched_rows->Size() > 0) {
+            const SharedPtr<BaseExpression> &then_expr = case_checks[check_idx].then_expr_;
+            if (then_expr->Type().type() == LogicalType::kNull) {
+                SetRowsNull(*matched_rows, *output_column_vector);
+            } else {
+                SharedPtr<ColumnVector> then_output = ExecuteOnRows(then_expr, then_state, matched_rows, count);
+                ScatterRows(*then_output, *matched_rows, *output_column_vector);
+            }
+        }
+        remaining_rows = std::move(unmatched_rows);
+    }
+
+    if (remaining_rows->Size() > 0) {
+        SharedPtr<BaseExpression> &else_expr = expr->ElseExpr();
+        if (else_expr->Type().type() == LogicalType::kNull) {
+            SetRowsNull(*remaining_rows, *output_column_vector);
+        } else {
+            SharedPtr<ExpressionState> &else_state = state->Children()[case_checks.size() * 2];
+            SharedPtr<ColumnVector> else_output = ExecuteOnRows(else_expr, else_state, remaining_rows, count);
+            ScatterRows(*else_output, *remaining_rows, *output_column_vector);
+        }
+    }
+}
+
+SharedPtr<ColumnVector> ExpressionEvaluator::ExecuteOnRows(const SharedPtr<BaseExpression> &expr,
+                                                           SharedPtr<ExpressionState> &state,
+                                                           const SharedPtr<Selection> &rows,
+                                                           SizeT count) {
+    SharedPtr<ColumnVector> &output = state->OutputColumnVector();
+    if (rows->Size() == count || expr->type() == ExpressionType::kValue || input_data_block_ == nullptr || input_data_block_->column_count() == 0) {
+        Execute(expr, state, output);
+        return output;
+    }
+    // Gather the selected rows, so that expr is evaluated on them only
+    DataBlock selected_block;
+    selected_block.Init(input_data_block_, rows);
+    ExpressionEvaluator evaluator;
+    evaluator.Init(&selected_block);
+    evaluator.Execute(expr, state, output);
+    return output;
 }
 
 void ExpressionEvaluator::Execute(const SharedPtr<ColumnExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
@@ -150,6 +257,15 @@ void ExpressionEvaluator::Execute(const SharedPtr<ColumnExpression> &, SharedPtr
 void ExpressionEvaluator::Execute(const SharedPtr<FunctionExpression> &expr,
                                   SharedPtr<ExpressionState> &state,
                                   SharedPtr<ColumnVector> &output_column_vector) {
+    if (state->fused_expression_.get() != nullptr) {
+        if (input_data_block_ == nullptr) {
+            String error_message = "Input data block is NULL";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        state->fused_expression_->Execute(*input_data_block_, *output_column_vector);
+        return;
+    }
 
     SizeT argument_count = expr->arguments().size();
     Vector<SharedPtr<ColumnVector>> arguments;
@@ -197,10 +313,44 @@ void ExpressionEvaluator::Execute(const SharedPtr<ReferenceExpression> &expr,
     output_column_vector = input_data_block_->column_vectors[column_index];
 }
 
-void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &, SharedPtr<ExpressionState> &, SharedPtr<ColumnVector> &) {
-    Status status = Status::NotSupport("IN execution isn't implemented yet.");
-    LOG_ERROR(status.message());
-    RecoverableError(status);
+void ExpressionEvaluator::Execute(const SharedPtr<InExpression> &expr,
+                                  SharedPtr<ExpressionState> &state,
+                                  SharedPtr<ColumnVector> &output_column_vector) {
+    SharedPtr<ExpressionState> &left_state = state->Children()[0];
+    SharedPtr<ColumnVector> &left_output = left_state->OutputColumnVector();
+    Execute(expr->left_operand(), left_state, left_output);
+
+    if (state->in_value_set_.get() == nullptr) {
+        // The value list is constant, it's evaluated and built into a set once for all the blocks.
+        SizeT argument_count = expr->arguments().size();
+        Vector<SharedPtr<ColumnVector>> values;
+        values.reserve(argument_count);
+        for (SizeT i = 0; i < argument_count; ++i) {
+            SharedPtr<BaseExpression> &argument_expr = expr->arguments()[i];
+            if (argument_expr->Type().type() == LogicalType::kNull) {
+                values.emplace_back(nullptr);
+                continue;
+            }
+            SharedPtr<ExpressionState> &argument_state = state->Children()[i + 1];
+            SharedPtr<ColumnVector> &argument_output = argument_state->OutputColumnVector();
+            Execute(argument_expr, argument_state, argument_output);
+            if (argument_output->vector_type() != ColumnVectorType::kConstant) {
+                Status status = Status::NotSupport(fmt::format("IN list value {} isn't a constant.", argument_expr->Name()));
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+            values.emplace_back(argument_output);
+        }
+        state->in_value_set_ = InValueSet::Make(*left_output->data_type(), values);
+        if (state->in_value_set_.get() == nullptr) {
+            Status status = Status::NotSupport(fmt::format("IN on {} type isn't supported.", left_output->data_type()->ToString()));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+    }
+
+    SizeT count = left_output->vector_type() == ColumnVectorType::kConstant ? 1 : left_output->Size();
+    state->in_value_set_->Probe(*left_output, count, expr->in_type() == InType::kNotIn, *output_column_vector);
 }
 
 } // namespace infinity
@@ -29,6 +29,7 @@ import in_expression;
 import data_block;
 import column_vector;
 import expression_state;
+import selection;
 
 namespace infinity {
 
@@ -55,6 +56,12 @@ public:
     void Execute(const SharedPtr<InExpression> &expr, SharedPtr<ExpressionState> &state, SharedPtr<ColumnVector> &output_column_vector);
 
 private:
+    // Evaluates expr on the selected rows of the input only, the rows are all the count input rows if the selection is full.
+    SharedPtr<ColumnVector> ExecuteOnRows(const SharedPtr<BaseExpression> &expr,
+                                          SharedPtr<ExpressionState> &state,
+                                          const SharedPtr<Selection> &rows,
+                                          SizeT count);
+
     const DataBlock *input_data_block_{};
     bool in_aggregate_{false};
 };
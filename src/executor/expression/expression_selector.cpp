@@ -54,6 +54,15 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     return output_true_select->Size();
 }
 
+void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
+                                SharedPtr<ExpressionState> &state,
+                                const DataBlock *input_data_block,
+                                SharedPtr<Selection> &output_true_select) {
+    this->input_data_ = input_data_block;
+    SharedPtr<Selection> output_false_select = nullptr;
+    Select(expr, state, input_data_block->row_count(), nullptr, output_true_select, output_false_select);
+}
+
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
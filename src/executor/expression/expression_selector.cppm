@@ -34,6 +34,12 @@ public:
                  DataBlock *output_data_block,
                  SizeT count);
 
+    // Evaluates expr on all rows of input_data_block and appends the rows where it's true to output_true_select
+    void Select(const SharedPtr<BaseExpression> &expr,
+                SharedPtr<ExpressionState> &state,
+                const DataBlock *input_data_block,
+                SharedPtr<Selection> &output_true_select);
+
     void Select(const SharedPtr<BaseExpression> &expr,
                 SharedPtr<ExpressionState> &state,
                 SizeT count,
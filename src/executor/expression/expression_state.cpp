@@ -33,6 +33,7 @@ import function_expression;
 import in_expression;
 import reference_expression;
 import value_expression;
+import fused_expression;
 import status;
 
 import default_values;
@@ -99,13 +100,15 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<CaseExpr
     Vector<CaseCheck> &case_checks = case_expr->CaseExpr();
     for (auto &case_check : case_checks) {
         result->AddChild(case_check.when_expr_);
-        result->AddChild(case_check.then_expr_);
+        result->AddChildOrNull(case_check.then_expr_);
     }
-    result->AddChild(case_expr->ElseExpr());
+    result->AddChildOrNull(case_expr->ElseExpr());
 
     ColumnVectorType result_column_vector_type = ColumnVectorType::kConstant;
     for (SizeT idx = 0; idx < result->Children().size(); ++idx) {
-        if (result->Children()[idx]->OutputColumnVector()->vector_type() != ColumnVectorType::kConstant) {
+        // reference and NULL children have no output column vector of their own
+        auto &column_ptr = result->Children()[idx]->OutputColumnVector();
+        if (!column_ptr || column_ptr->vector_type() != ColumnVectorType::kConstant) {
             result_column_vector_type = ColumnVectorType::kFlat;
             break;
         }
@@ -149,6 +152,14 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<Function
     SharedPtr<ExpressionState> result = MakeShared<ExpressionState>();
     SharedPtr<DataType> function_expr_data_type = MakeShared<DataType>(function_expr->Type());
 
+    result->fused_expression_ = FusedExpression::Compile(*function_expr);
+    if (result->fused_expression_.get() != nullptr) {
+        // no output column vectors for the nodes of the fused expression
+        result->column_vector_ = MakeShared<ColumnVector>(function_expr_data_type);
+        result->column_vector_->Initialize(ColumnVectorType::kCompactBit, DEFAULT_VECTOR_SIZE);
+        return result;
+    }
+
     for (auto &arg : function_expr->arguments()) {
         result->AddChild(arg);
     }
@@ -202,12 +213,13 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<InExpres
     result->AddChild(in_expr->left_operand());
 
     for (auto &argument_expr : in_expr->arguments()) {
-        result->AddChild(argument_expr);
+        result->AddChildOrNull(argument_expr);
     }
 
     ColumnVectorType result_column_vector_type = ColumnVectorType::kConstant;
     for (SizeT idx = 0; idx < result->Children().size(); ++idx) {
-        if (result->Children()[idx]->OutputColumnVector()->vector_type() != ColumnVectorType::kConstant) {
+        auto &column_ptr = result->Children()[idx]->OutputColumnVector();
+        if (!column_ptr || column_ptr->vector_type() != ColumnVectorType::kConstant) {
             result_column_vector_type = ColumnVectorType::kFlat;
             break;
         }
@@ -221,4 +233,12 @@ SharedPtr<ExpressionState> ExpressionState::CreateState(const SharedPtr<InExpres
 
 void ExpressionState::AddChild(const SharedPtr<BaseExpression> &expression) { children_.emplace_back(CreateState(expression)); }
 
+void ExpressionState::AddChildOrNull(const SharedPtr<BaseExpression> &expression) {
+    if (expression->Type().type() == LogicalType::kNull) {
+        children_.emplace_back(MakeShared<ExpressionState>());
+    } else {
+        AddChild(expression);
+    }
+}
+
 } // namespace infinity
@@ -26,6 +26,8 @@ import function_expression;
 import value_expression;
 import in_expression;
 import column_vector;
+import in_value_set;
+import fused_expression;
 
 namespace infinity {
 
@@ -66,7 +68,16 @@ public:
 
     AggregateFlag agg_flag_{AggregateFlag::kUninitialized};
 
+    // Value list of an IN expression, built on the first block
+    UniquePtr<InValueSet> in_value_set_{};
+
+    // Set if the function expression is evaluated as a whole by a fused kernel, the state has no children then
+    UniquePtr<FusedExpression> fused_expression_{};
+
 private:
+    // A NULL literal has no column vector type, the evaluator sets its rows to null without evaluating it.
+    void AddChildOrNull(const SharedPtr<BaseExpression> &expression);
+
     Vector<SharedPtr<ExpressionState>> children_;
     String name_;
 
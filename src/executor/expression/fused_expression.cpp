@@ -0,0 +1,483 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+#include <type_traits>
+
+module fused_expression;
+
+import stl;
+import base_expression;
+import expression_type;
+import function_expression;
+import reference_expression;
+import cast_expression;
+import value_expression;
+import scalar_function;
+import value;
+import column_vector;
+import vector_buffer;
+import bitmask;
+import data_block;
+import data_type;
+import logical_type;
+import internal_types;
+
+namespace infinity {
+
+namespace {
+
+enum class FusedOpType : u8 {
+    kColumn,
+    kConstant,
+    kAdd,
+    kSubtract,
+    kMultiply,
+};
+
+enum class FusedCompareType : u8 {
+    kEqual,
+    kNotEqual,
+    kLess,
+    kLessEqual,
+    kGreater,
+    kGreaterEqual,
+};
+
+template <typename T>
+constexpr LogicalType kFusedLogicalType = LogicalType::kInvalid;
+template <>
+constexpr LogicalType kFusedLogicalType<TinyIntT> = LogicalType::kTinyInt;
+template <>
+constexpr LogicalType kFusedLogicalType<SmallIntT> = LogicalType::kSmallInt;
+template <>
+constexpr LogicalType kFusedLogicalType<IntegerT> = LogicalType::kInteger;
+template <>
+constexpr LogicalType kFusedLogicalType<BigIntT> = LogicalType::kBigInt;
+template <>
+constexpr LogicalType kFusedLogicalType<FloatT> = LogicalType::kFloat;
+template <>
+constexpr LogicalType kFusedLogicalType<DoubleT> = LogicalType::kDouble;
+
+i32 IntegerRank(LogicalType type) {
+    switch (type) {
+        case LogicalType::kTinyInt:
+            return 1;
+        case LogicalType::kSmallInt:
+            return 2;
+        case LogicalType::kInteger:
+            return 3;
+        case LogicalType::kBigInt:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+// Only the casts which keep every value exactly are fused, so that static_cast gives the same result as the cast function
+bool IsExactCast(LogicalType source, LogicalType target) {
+    if (source == target) {
+        return true;
+    }
+    i32 source_rank = IntegerRank(source);
+    i32 target_rank = IntegerRank(target);
+    if (source_rank > 0 && target_rank > 0) {
+        return source_rank < target_rank;
+    }
+    if (target == LogicalType::kDouble) {
+        return source == LogicalType::kFloat || (source_rank > 0 && source_rank < IntegerRank(LogicalType::kBigInt));
+    }
+    return false;
+}
+
+Optional<FusedOpType> ArithmeticOpType(const String &name) {
+    if (name == "+") {
+        return FusedOpType::kAdd;
+    }
+    if (name == "-") {
+        return FusedOpType::kSubtract;
+    }
+    if (name == "*") {
+        return FusedOpType::kMultiply;
+    }
+    return None;
+}
+
+Optional<FusedCompareType> CompareType(const String &name) {
+    if (name == "=") {
+        return FusedCompareType::kEqual;
+    }
+    if (name == "<>") {
+        return FusedCompareType::kNotEqual;
+    }
+    if (name == "<") {
+        return FusedCompareType::kLess;
+    }
+    if (name == "<=") {
+        return FusedCompareType::kLessEqual;
+    }
+    if (name == ">") {
+        return FusedCompareType::kGreater;
+    }
+    if (name == ">=") {
+        return FusedCompareType::kGreaterEqual;
+    }
+    return None;
+}
+
+bool IsBinaryFunctionOf(const FunctionExpression &expr, LogicalType type) {
+    const Vector<DataType> &parameter_types = expr.func_.parameter_types_;
+    return expr.arguments().size() == 2 && parameter_types.size() == 2 && parameter_types[0].type() == type && parameter_types[1].type() == type;
+}
+
+template <typename T>
+struct FusedOp {
+    FusedOpType type_{};
+    // kColumn: the column and its type, the values are converted to T when loaded
+    SizeT column_index_{};
+    LogicalType column_type_{LogicalType::kInvalid};
+    // kConstant
+    T constant_{};
+};
+
+template <typename SourceType, typename T>
+void LoadChunk(const ColumnVector &column, bool all_valid, SizeT offset, SizeT count, T *__restrict values, u8 *__restrict valid) {
+    const auto *data = reinterpret_cast<const SourceType *>(column.data());
+    if (column.vector_type() == ColumnVectorType::kConstant) {
+        T value = static_cast<T>(data[0]);
+        u8 value_valid = column.nulls_ptr_->IsTrue(0);
+        for (SizeT i = 0; i < count; ++i) {
+            values[i] = value;
+            valid[i] = value_valid;
+        }
+        return;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        values[i] = static_cast<T>(data[offset + i]);
+    }
+    if (all_valid) {
+        std::fill_n(valid, count, 1);
+        return;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        valid[i] = column.nulls_ptr_->IsTrue(offset + i);
+    }
+}
+
+// left = left OP right, a row becomes invalid if either operand is invalid or the operation overflows
+template <FusedOpType OP, typename T>
+void ArithmeticChunk(T *__restrict left, u8 *__restrict left_valid, const T *__restrict right, const u8 *__restrict right_valid, SizeT count) {
+    for (SizeT i = 0; i < count; ++i) {
+        T result{};
+        bool overflow = false;
+        if constexpr (std::is_integral_v<T>) {
+            if constexpr (OP == FusedOpType::kAdd) {
+                overflow = __builtin_add_overflow(left[i], right[i], &result);
+            } else if constexpr (OP == FusedOpType::kSubtract) {
+                overflow = __builtin_sub_overflow(left[i], right[i], &result);
+            } else {
+                overflow = __builtin_mul_overflow(left[i], right[i], &result);
+            }
+        } else {
+            if constexpr (OP == FusedOpType::kAdd) {
+                result = left[i] + right[i];
+            } else if constexpr (OP == FusedOpType::kSubtract) {
+                result = left[i] - right[i];
+            } else {
+                result = left[i] * right[i];
+            }
+            overflow = !std::isfinite(result);
+        }
+        left[i] = result;
+        left_valid[i] = left_valid[i] & right_valid[i] & !overflow;
+    }
+}
+
+template <FusedCompareType CMP, typename T>
+void CompareChunk(const T *__restrict left, const T *__restrict right, u8 *__restrict result, SizeT count) {
+    for (SizeT i = 0; i < count; ++i) {
+        if constexpr (CMP == FusedCompareType::kEqual) {
+            result[i] = left[i] == right[i];
+        } else if constexpr (CMP == FusedCompareType::kNotEqual) {
+            result[i] = left[i] != right[i];
+        } else if constexpr (CMP == FusedCompareType::kLess) {
+            result[i] = left[i] < right[i];
+        } else if constexpr (CMP == FusedCompareType::kLessEqual) {
+            result[i] = left[i] <= right[i];
+        } else if constexpr (CMP == FusedCompareType::kGreater) {
+            result[i] = left[i] > right[i];
+        } else {
+            result[i] = left[i] >= right[i];
+        }
+    }
+}
+
+template <typename T>
+class FusedComparison final : public FusedExpression {
+public:
+    bool Build(const FunctionExpression &expr) {
+        Optional<FusedCompareType> compare_type = CompareType(expr.ScalarFunctionName());
+        if (!compare_type.has_value() || !IsBinaryFunctionOf(expr, kFusedLogicalType<T>)) {
+            return false;
+        }
+        compare_type_ = *compare_type;
+        if (!AddOperand(*expr.arguments()[0], 0) || !AddOperand(*expr.arguments()[1], 1)) {
+            return false;
+        }
+        // a single comparison of columns gains nothing from fusion
+        return has_column_ && has_arithmetic_;
+    }
+
+    void Execute(const DataBlock &input_data_block, ColumnVector &output) override {
+        SizeT row_count = input_data_block.row_count();
+        values_.resize(register_count_ * kChunkSize);
+        valid_.resize(register_count_ * kChunkSize);
+        Vector<bool> column_all_valid(ops_.size(), false);
+        for (SizeT op_idx = 0; op_idx < ops_.size(); ++op_idx) {
+            if (ops_[op_idx].type_ == FusedOpType::kColumn) {
+                column_all_valid[op_idx] = input_data_block.column_vectors[ops_[op_idx].column_index_]->nulls_ptr_->IsAllTrue();
+            }
+        }
+
+        const auto &output_null = output.nulls_ptr_;
+        output_null->SetAllTrue();
+        u8 result[kChunkSize];
+        for (SizeT offset = 0; offset < row_count; offset += kChunkSize) {
+            SizeT count = std::min(kChunkSize, row_count - offset);
+            SizeT top = 0;
+            for (SizeT op_idx = 0; op_idx < ops_.size(); ++op_idx) {
+                const FusedOp<T> &op = ops_[op_idx];
+                switch (op.type_) {
+                    case FusedOpType::kColumn: {
+                        LoadColumn(*input_data_block.column_vectors[op.column_index_], op.column_type_, column_all_valid[op_idx], offset, count, top);
+                        ++top;
+                        break;
+                    }
+                    case FusedOpType::kConstant: {
+                        std::fill_n(Values(top), count, op.constant_);
+                        std::fill_n(Valid(top), count, 1);
+                        ++top;
+                        break;
+                    }
+                    case FusedOpType::kAdd: {
+                        --top;
+                        ArithmeticChunk<FusedOpType::kAdd>(Values(top - 1), Valid(top - 1), Values(top), Valid(top), count);
+                        break;
+                    }
+                    case FusedOpType::kSubtract: {
+                        --top;
+                        ArithmeticChunk<FusedOpType::kSubtract>(Values(top - 1), Valid(top - 1), Values(top), Valid(top), count);
+                        break;
+                    }
+                    case FusedOpType::kMultiply: {
+                        --top;
+                        ArithmeticChunk<FusedOpType::kMultiply>(Values(top - 1), Valid(top - 1), Values(top), Valid(top), count);
+                        break;
+                    }
+                }
+            }
+            // the two operands of the comparison are left in the first two registers
+            Compare(count, result);
+            const u8 *left_valid = Valid(0);
+            const u8 *right_valid = Valid(1);
+            for (SizeT i = 0; i < count; ++i) {
+                if (left_valid[i] & right_valid[i]) {
+                    output.buffer_->SetCompactBit(offset + i, result[i]);
+                } else {
+                    output_null->SetFalse(offset + i);
+                }
+            }
+        }
+        output.Finalize(row_count);
+    }
+
+private:
+    // Appends the operations computing expr to ops_, the result is left in the register at depth
+    bool AddOperand(const BaseExpression &expr, SizeT depth) {
+        register_count_ = std::max(register_count_, depth + 1);
+        switch (expr.type()) {
+            case ExpressionType::kReference: {
+                const auto &reference_expr = static_cast<const ReferenceExpression &>(expr);
+                if (reference_expr.Type().type() != kFusedLogicalType<T>) {
+                    return false;
+                }
+                AddColumn(reference_expr.column_index(), kFusedLogicalType<T>);
+                return true;
+            }
+            case ExpressionType::kValue: {
+                const auto &value_expr = static_cast<const ValueExpression &>(expr);
+                if (value_expr.Type().type() != kFusedLogicalType<T>) {
+                    return false;
+                }
+                AddConstant(value_expr.GetValue().GetValue<T>());
+                return true;
+            }
+            case ExpressionType::kCast: {
+                if (expr.Type().type() != kFusedLogicalType<T>) {
+                    return false;
+                }
+                const BaseExpression &source_expr = *expr.arguments()[0];
+                LogicalType source_type = source_expr.Type().type();
+                if (!IsExactCast(source_type, kFusedLogicalType<T>)) {
+                    return false;
+                }
+                if (source_expr.type() == ExpressionType::kReference) {
+                    AddColumn(static_cast<const ReferenceExpression &>(source_expr).column_index(), source_type);
+                    return true;
+                }
+                if (source_expr.type() == ExpressionType::kValue) {
+                    return AddCastConstant(static_cast<const ValueExpression &>(source_expr).GetValue(), source_type);
+                }
+                return false;
+            }
+            case ExpressionType::kFunction: {
+                const auto &function_expr = static_cast<const FunctionExpression &>(expr);
+                Optional<FusedOpType> op_type = ArithmeticOpType(function_expr.ScalarFunctionName());
+                if (!op_type.has_value() || !IsBinaryFunctionOf(function_expr, kFusedLogicalType<T>) ||
+                    function_expr.Type().type() != kFusedLogicalType<T>) {
+                    return false;
+                }
+                if (!AddOperand(*function_expr.arguments()[0], depth) || !AddOperand(*function_expr.arguments()[1], depth + 1)) {
+                    return false;
+                }
+                ops_.push_back({.type_ = *op_type});
+                has_arithmetic_ = true;
+                return true;
+            }
+            default: {
+                return false;
+            }
+        }
+    }
+
+    void AddColumn(SizeT column_index, LogicalType column_type) {
+        ops_.push_back({.type_ = FusedOpType::kColumn, .column_index_ = column_index, .column_type_ = column_type});
+        has_column_ = true;
+    }
+
+    void AddConstant(T constant) { ops_.push_back({.type_ = FusedOpType::kConstant, .constant_ = constant}); }
+
+    bool AddCastConstant(const Value &value, LogicalType source_type) {
+        switch (source_type) {
+            case LogicalType::kTinyInt:
+                AddConstant(static_cast<T>(value.GetValue<TinyIntT>()));
+                return true;
+            case LogicalType::kSmallInt:
+                AddConstant(static_cast<T>(value.GetValue<SmallIntT>()));
+                return true;
+            case LogicalType::kInteger:
+                AddConstant(static_cast<T>(value.GetValue<IntegerT>()));
+                return true;
+            case LogicalType::kBigInt:
+                AddConstant(static_cast<T>(value.GetValue<BigIntT>()));
+                return true;
+            case LogicalType::kFloat:
+                AddConstant(static_cast<T>(value.GetValue<FloatT>()));
+                return true;
+            case LogicalType::kDouble:
+                AddConstant(static_cast<T>(value.GetValue<DoubleT>()));
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void LoadColumn(const ColumnVector &column, LogicalType column_type, bool all_valid, SizeT offset, SizeT count, SizeT reg) {
+        switch (column_type) {
+            case LogicalType::kTinyInt:
+                return LoadChunk<TinyIntT>(column, all_valid, offset, count, Values(reg), Valid(reg));
+            case LogicalType::kSmallInt:
+                return LoadChunk<SmallIntT>(column, all_valid, offset, count, Values(reg), Valid(reg));
+            case LogicalType::kInteger:
+                return LoadChunk<IntegerT>(column, all_valid, offset, count, Values(reg), Valid(reg));
+            case LogicalType::kBigInt:
+                return LoadChunk<BigIntT>(column, all_valid, offset, count, Values(reg), Valid(reg));
+            case LogicalType::kFloat:
+                return LoadChunk<FloatT>(column, all_valid, offset, count, Values(reg), Valid(reg));
+            default:
+                return LoadChunk<DoubleT>(column, all_valid, offset, count, Values(reg), Valid(reg));
+        }
+    }
+
+    void Compare(SizeT count, u8 *result) const {
+        const T *left = Values(0);
+        const T *right = Values(1);
+        switch (compare_type_) {
+            case FusedCompareType::kEqual:
+                return CompareChunk<FusedCompareType::kEqual>(left, right, result, count);
+            case FusedCompareType::kNotEqual:
+                return CompareChunk<FusedCompareType::kNotEqual>(left, right, result, count);
+            case FusedCompareType::kLess:
+                return CompareChunk<FusedCompareType::kLess>(left, right, result, count);
+            case FusedCompareType::kLessEqual:
+                return CompareChunk<FusedCompareType::kLessEqual>(left, right, result, count);
+            case FusedCompareType::kGreater:
+                return CompareChunk<FusedCompareType::kGreater>(left, right, result, count);
+            case FusedCompareType::kGreaterEqual:
+                return CompareChunk<FusedCompareType::kGreaterEqual>(left, right, result, count);
+        }
+    }
+
+    inline T *Values(SizeT reg) { return values_.data() + reg * kChunkSize; }
+    inline const T *Values(SizeT reg) const { return values_.data() + reg * kChunkSize; }
+    inline u8 *Valid(SizeT reg) { return valid_.data() + reg * kChunkSize; }
+
+    // postfix order: the operands of an arithmetic operation are on top of the register stack when it runs
+    Vector<FusedOp<T>> ops_{};
+    FusedCompareType compare_type_{};
+    SizeT register_count_{};
+    bool has_column_{false};
+    bool has_arithmetic_{false};
+
+    // register_count_ chunks of values and their validity
+    Vector<T> values_{};
+    Vector<u8> valid_{};
+};
+
+template <typename T>
+UniquePtr<FusedExpression> CompileComparison(const FunctionExpression &expr) {
+    auto fused_expression = MakeUnique<FusedComparison<T>>();
+    if (!fused_expression->Build(expr)) {
+        return nullptr;
+    }
+    return fused_expression;
+}
+
+} // namespace
+
+UniquePtr<FusedExpression> FusedExpression::Compile(const FunctionExpression &expr) {
+    if (expr.Type().type() != LogicalType::kBoolean || expr.func_.parameter_types_.size() != 2) {
+        return nullptr;
+    }
+    switch (expr.func_.parameter_types_[0].type()) {
+        case LogicalType::kTinyInt:
+            return CompileComparison<TinyIntT>(expr);
+        case LogicalType::kSmallInt:
+            return CompileComparison<SmallIntT>(expr);
+        case LogicalType::kInteger:
+            return CompileComparison<IntegerT>(expr);
+        case LogicalType::kBigInt:
+            return CompileComparison<BigIntT>(expr);
+        case LogicalType::kFloat:
+            return CompileComparison<FloatT>(expr);
+        case LogicalType::kDouble:
+            return CompileComparison<DoubleT>(expr);
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace infinity
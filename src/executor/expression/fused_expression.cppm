@@ -0,0 +1,43 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module fused_expression;
+
+import stl;
+import function_expression;
+import column_vector;
+import data_block;
+
+namespace infinity {
+
+// A comparison of two arithmetic (+, -, *) trees of columns and constants of one numeric type, such as a * 2 + b > c.
+// The rows are evaluated in chunks of kChunkSize: each operator of the tree runs on the whole chunk before the next one, and the intermediate
+// results are kept in a few chunk sized buffers instead of a column vector per expression node.
+export class FusedExpression {
+public:
+    static constexpr SizeT kChunkSize = 256;
+
+    virtual ~FusedExpression() = default;
+
+    // Returns nullptr if the expression doesn't have that shape, it's evaluated node by node then.
+    static UniquePtr<FusedExpression> Compile(const FunctionExpression &expr);
+
+    // Writes the comparison result of all rows of input_data_block to the boolean output.
+    // As with the scalar functions, the result is null if an operand is null or an arithmetic operation overflows.
+    virtual void Execute(const DataBlock &input_data_block, ColumnVector &output) = 0;
+};
+
+} // namespace infinity
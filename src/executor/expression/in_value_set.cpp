@@ -0,0 +1,147 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <type_traits>
+
+module in_value_set;
+
+import stl;
+import column_vector;
+import data_type;
+import logical_type;
+import internal_types;
+import value;
+import bitmask;
+import vector_buffer;
+
+namespace infinity {
+
+namespace {
+
+template <typename ContainsFunc>
+void ProbeRows(const ColumnVector &input, SizeT count, bool negate, bool has_null, ColumnVector &output, ContainsFunc &&contains) {
+    const auto &input_null = input.nulls_ptr_;
+    const auto &output_null = output.nulls_ptr_;
+    const bool all_valid = input_null->IsAllTrue();
+    output_null->SetAllTrue();
+    for (SizeT i = 0; i < count; ++i) {
+        if (!all_valid && !input_null->IsTrue(i)) {
+            output_null->SetFalse(i);
+        } else if (contains(i)) {
+            output.buffer_->SetCompactBit(i, !negate);
+        } else if (has_null) {
+            output_null->SetFalse(i);
+        } else {
+            output.buffer_->SetCompactBit(i, negate);
+        }
+    }
+    output.Finalize(count);
+}
+
+// T is std::string_view for varchar, viewing the strings owned by the set.
+template <typename T>
+class TypedInValueSet final : public InValueSet {
+public:
+    void AddNull() { has_null_ = true; }
+
+    void Add(const ColumnVector &value) {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            strings_.emplace_back(value.GetValue(0).GetVarchar());
+        } else {
+            values_.emplace_back(reinterpret_cast<const T *>(value.data())[0]);
+        }
+    }
+
+    void Build() {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            // The views are taken once all the strings are added, so they aren't moved anymore.
+            values_.assign(strings_.begin(), strings_.end());
+        }
+        std::sort(values_.begin(), values_.end());
+        values_.erase(std::unique(values_.begin(), values_.end()), values_.end());
+        if (values_.size() > kSortedProbeLimit) {
+            hash_set_.reserve(values_.size());
+            hash_set_.insert(values_.begin(), values_.end());
+            use_hash_ = true;
+        }
+    }
+
+    void Probe(const ColumnVector &input, SizeT count, bool negate, ColumnVector &output) const override {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            VarcharColumnReader reader(input);
+            ProbeRows(input, count, negate, has_null_, output, [&](SizeT i) { return Contains(reader.GetString(reader[i])); });
+        } else {
+            const T *data = reinterpret_cast<const T *>(input.data());
+            ProbeRows(input, count, negate, has_null_, output, [&](SizeT i) { return Contains(data[i]); });
+        }
+    }
+
+    SizeT size() const override { return values_.size(); }
+
+    bool UseHash() const override { return use_hash_; }
+
+private:
+    inline bool Contains(const T &value) const {
+        if (use_hash_) {
+            return hash_set_.contains(value);
+        }
+        return std::binary_search(values_.begin(), values_.end(), value);
+    }
+
+    Vector<T> values_{};
+    HashSet<T> hash_set_{};
+    Vector<String> strings_{};
+    bool use_hash_{false};
+};
+
+template <typename T>
+UniquePtr<InValueSet> MakeTypedInValueSet(const Vector<SharedPtr<ColumnVector>> &values) {
+    auto value_set = MakeUnique<TypedInValueSet<T>>();
+    for (const auto &value : values) {
+        if (value.get() == nullptr || !value->nulls_ptr_->IsTrue(0)) {
+            value_set->AddNull();
+        } else {
+            value_set->Add(*value);
+        }
+    }
+    value_set->Build();
+    return value_set;
+}
+
+} // namespace
+
+UniquePtr<InValueSet> InValueSet::Make(const DataType &data_type, const Vector<SharedPtr<ColumnVector>> &values) {
+    switch (data_type.type()) {
+        case LogicalType::kTinyInt:
+            return MakeTypedInValueSet<TinyIntT>(values);
+        case LogicalType::kSmallInt:
+            return MakeTypedInValueSet<SmallIntT>(values);
+        case LogicalType::kInteger:
+            return MakeTypedInValueSet<IntegerT>(values);
+        case LogicalType::kBigInt:
+            return MakeTypedInValueSet<BigIntT>(values);
+        case LogicalType::kFloat:
+            return MakeTypedInValueSet<FloatT>(values);
+        case LogicalType::kDouble:
+            return MakeTypedInValueSet<DoubleT>(values);
+        case LogicalType::kVarchar:
+            return MakeTypedInValueSet<std::string_view>(values);
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace infinity
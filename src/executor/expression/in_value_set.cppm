@@ -0,0 +1,48 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module in_value_set;
+
+import stl;
+import column_vector;
+import data_type;
+
+namespace infinity {
+
+// The value list of an IN expression, built once and probed for every row of the left operand.
+// Short lists are probed by binary search on a sorted array, long lists by hashing.
+export class InValueSet {
+public:
+    static constexpr SizeT kSortedProbeLimit = 32;
+
+    virtual ~InValueSet() = default;
+
+    // values are constant column vectors of the type data_type, or nullptr for a NULL literal. Returns nullptr if the type isn't supported.
+    static UniquePtr<InValueSet> Make(const DataType &data_type, const Vector<SharedPtr<ColumnVector>> &values);
+
+    // Writes whether each of the first count rows of input is in the list, or isn't for NOT IN.
+    // As in SQL, the result is null if the row is null, or if it isn't found and the list has a null.
+    virtual void Probe(const ColumnVector &input, SizeT count, bool negate, ColumnVector &output) const = 0;
+
+    virtual SizeT size() const = 0;
+
+    virtual bool UseHash() const = 0;
+
+protected:
+    bool has_null_{false};
+};
+
+} // namespace infinity
@@ -166,9 +166,9 @@ bool PhysicalCompact::Execute(QueryContext *query_context, OperatorState *operat
                     if (read_size1 == 0) {
                         return;
                     }
-                    new_block->AppendBlock(input_column_vectors, row_begin, read_size1, buffer_mgr);
                     RowID new_row_id(new_segment_id, new_block->block_id() * block_capacity + new_block->row_count());
-                    remapper.AddMap(segment_id, block_id, row_begin, new_row_id);
+                    new_block->AppendBlock(input_column_vectors, row_begin, read_size1, buffer_mgr);
+                    remapper.AddMap(segment_id, block_id, row_begin, read_size1, new_row_id);
                     read_offset = row_begin + read_size1;
                 };
 
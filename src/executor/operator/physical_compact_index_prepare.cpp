@@ -26,6 +26,9 @@ import block_index;
 import txn;
 import status;
 import base_table_ref;
+import compact_state_data;
+import segment_index_entry;
+import internal_types;
 
 namespace infinity {
 
@@ -53,7 +56,8 @@ bool PhysicalCompactIndexPrepare::Execute(QueryContext *query_context, OperatorS
     }
 
     Txn *txn = query_context->GetTxn();
-    auto [segment_index_entries, status] = txn->CreateIndexPrepare(table_index_entry, new_table_ref, prepare_, false);
+    HashMap<SegmentID, IndexMergeSource> merge_sources = compact_state_data->GetIndexMergeSources();
+    auto [segment_index_entries, status] = txn->CreateIndexPrepare(table_index_entry, new_table_ref, prepare_, false, &merge_sources);
     if (!status.ok()) {
         operator_state->status_ = status;
         return true;
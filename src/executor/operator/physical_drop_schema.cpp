@@ -28,6 +28,8 @@ import status;
 import logical_type;
 import infinity_exception;
 import column_def;
+import storage;
+import result_cache;
 
 namespace infinity {
 
@@ -38,6 +40,9 @@ bool PhysicalDropSchema::Execute(QueryContext *query_context, OperatorState *ope
     Status status = txn->DropDatabase(*schema_name_, conflict_type_);
     if(!status.ok()) {
         operator_state->status_ = status;
+    } else {
+        // The cached results of the tables in the database are never hit again, free their memory now
+        query_context->storage()->result_cache()->InvalidateDatabase(*schema_name_);
     }
 
     // Generate the result
@@ -28,6 +28,8 @@ import status;
 import infinity_exception;
 import logical_type;
 import column_def;
+import storage;
+import result_cache;
 
 namespace infinity {
 
@@ -40,6 +42,9 @@ bool PhysicalDropTable::Execute(QueryContext *query_context, OperatorState *oper
 
     if(!status.ok()) {
         operator_state->status_ = status;
+    } else {
+        // The cached results of the table are never hit again, free their memory now
+        query_context->storage()->result_cache()->InvalidateTable(*schema_name_, *table_name_);
     }
 
     // Generate the result
@@ -14,6 +14,9 @@
 
 module;
 
+#include <algorithm>
+#include <numeric>
+
 module physical_filter;
 
 import stl;
@@ -29,6 +32,15 @@ import expression_selector;
 import data_block;
 import logger;
 import third_party;
+import base_expression;
+import expression_type;
+import conjunction_expression;
+import function_expression;
+import reference_expression;
+import in_expression;
+import case_expression;
+import column_vector;
+import selection;
 
 import infinity_exception;
 
@@ -55,6 +67,174 @@ void PhysicalFilter::Init() {
     //    output_ = DataTable::Make(table_def, TableType::kIntermediate);
 }
 
+namespace {
+
+void CollectConjuncts(const SharedPtr<BaseExpression> &expr, Vector<SharedPtr<BaseExpression>> &conjuncts) {
+    bool is_and = false;
+    if (expr->type() == ExpressionType::kConjunction) {
+        is_and = static_cast<const ConjunctionExpression *>(expr.get())->conjunction_type() == ConjunctionType::kAnd;
+    } else if (expr->type() == ExpressionType::kFunction) {
+        // the filter rewritten by the index scan optimizer combines the conjuncts with the "AND" function
+        is_and = static_cast<const FunctionExpression *>(expr.get())->ScalarFunctionName() == "AND";
+    }
+    if (!is_and) {
+        conjuncts.emplace_back(expr);
+        return;
+    }
+    for (const auto &argument : expr->arguments()) {
+        CollectConjuncts(argument, conjuncts);
+    }
+}
+
+void CollectColumnIds(const SharedPtr<BaseExpression> &expr, Vector<SizeT> &column_ids) {
+    switch (expr->type()) {
+        case ExpressionType::kReference: {
+            column_ids.emplace_back(static_cast<const ReferenceExpression *>(expr.get())->column_index());
+            return;
+        }
+        case ExpressionType::kIn: {
+            CollectColumnIds(static_cast<const InExpression *>(expr.get())->left_operand(), column_ids);
+            break;
+        }
+        case ExpressionType::kCase: {
+            auto *case_expr = static_cast<CaseExpression *>(expr.get());
+            for (const auto &case_check : case_expr->CaseExpr()) {
+                CollectColumnIds(case_check.when_expr_, column_ids);
+                CollectColumnIds(case_check.then_expr_, column_ids);
+            }
+            if (case_expr->ElseExpr().get() != nullptr) {
+                CollectColumnIds(case_expr->ElseExpr(), column_ids);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    for (const auto &argument : expr->arguments()) {
+        CollectColumnIds(argument, column_ids);
+    }
+}
+
+} // namespace
+
+void PhysicalFilter::SplitCondition() {
+    CollectConjuncts(condition_, conjuncts_);
+    conjunct_column_ids_.resize(conjuncts_.size());
+    for (SizeT idx = 0; idx < conjuncts_.size(); ++idx) {
+        Vector<SizeT> &column_ids = conjunct_column_ids_[idx];
+        CollectColumnIds(conjuncts_[idx], column_ids);
+        std::sort(column_ids.begin(), column_ids.end());
+        column_ids.erase(std::unique(column_ids.begin(), column_ids.end()), column_ids.end());
+    }
+}
+
+SharedPtr<Selection> PhysicalFilter::SelectConjuncts(const DataBlock *input_data_block, FilterOperatorState *filter_operator_state) const {
+    SizeT conjunct_count = conjuncts_.size();
+    Vector<FilterPredicateStats> &predicate_stats = filter_operator_state->predicate_stats_;
+    Vector<SizeT> &predicate_order = filter_operator_state->predicate_order_;
+    if (predicate_stats.empty()) {
+        predicate_stats.resize(conjunct_count);
+        predicate_order.resize(conjunct_count);
+        std::iota(predicate_order.begin(), predicate_order.end(), 0);
+    } else {
+        std::stable_sort(predicate_order.begin(), predicate_order.end(), [&](SizeT left, SizeT right) {
+            return predicate_stats[left].Rank() < predicate_stats[right].Rank();
+        });
+    }
+
+    // the conjuncts are evaluated on current_block, which is the input block or a copy of the rows of it that are still selected
+    const DataBlock *current_block = input_data_block;
+    SharedPtr<DataBlock> compacted_block{};
+    // the input row of each row of current_block, empty if current_block is the input block
+    Vector<u16> input_row_ids;
+    // the rows of current_block which pass all conjuncts evaluated so far
+    Vector<u16> selected_rows;
+    Vector<u16> true_rows;
+    for (SizeT order_idx = 0; order_idx < conjunct_count; ++order_idx) {
+        SizeT predicate_idx = predicate_order[order_idx];
+        SizeT current_row_count = current_block->row_count();
+
+        auto begin_ts = Clock::now();
+        SharedPtr<ExpressionState> conjunct_state = ExpressionState::CreateState(conjuncts_[predicate_idx]);
+        SharedPtr<Selection> true_select = MakeShared<Selection>();
+        true_select->Initialize(current_row_count);
+        ExpressionSelector selector;
+        selector.Select(conjuncts_[predicate_idx], conjunct_state, current_block, true_select);
+        FilterPredicateStats &stats = predicate_stats[predicate_idx];
+        stats.elapsed_ns_ += ElapsedFromStart(Clock::now(), begin_ts).count();
+        stats.input_rows_ += current_row_count;
+        stats.output_rows_ += true_select->Size();
+
+        true_rows.clear();
+        for (SizeT idx = 0; idx < true_select->Size(); ++idx) {
+            true_rows.emplace_back((*true_select)[idx]);
+        }
+        if (order_idx == 0) {
+            selected_rows.swap(true_rows);
+        } else {
+            auto end = std::set_intersection(selected_rows.begin(), selected_rows.end(), true_rows.begin(), true_rows.end(), selected_rows.begin());
+            selected_rows.erase(end, selected_rows.end());
+        }
+        if (selected_rows.empty()) {
+            break;
+        }
+
+        // copy the selected rows of the columns read by the remaining conjuncts once a quarter of the rows is dropped
+        if (order_idx + 1 == conjunct_count || selected_rows.size() * 4 > current_row_count * 3) {
+            continue;
+        }
+        Vector<bool> column_used(current_block->column_count(), false);
+        // the row count of a block comes from its flat columns, a block of constant columns only would have no rows
+        bool any_flat_column_used = false;
+        for (SizeT idx = order_idx + 1; idx < conjunct_count; ++idx) {
+            for (SizeT column_id : conjunct_column_ids_[predicate_order[idx]]) {
+                column_used[column_id] = true;
+                any_flat_column_used |= current_block->column_vectors[column_id]->vector_type() != ColumnVectorType::kConstant;
+            }
+        }
+        if (!any_flat_column_used) {
+            continue;
+        }
+        Selection row_select;
+        row_select.Initialize(selected_rows.size());
+        for (u16 row : selected_rows) {
+            row_select.Append(row);
+        }
+        Vector<SharedPtr<ColumnVector>> column_vectors;
+        column_vectors.reserve(current_block->column_count());
+        for (SizeT column_id = 0; column_id < current_block->column_count(); ++column_id) {
+            const ColumnVector &column_vector = *current_block->column_vectors[column_id];
+            auto new_column_vector = MakeShared<ColumnVector>(column_vector.data_type());
+            if (column_used[column_id]) {
+                new_column_vector->Initialize(column_vector, row_select);
+            } else {
+                // the column isn't read by the remaining conjuncts, an empty constant vector keeps the column positions.
+                // It has the capacity of the input, the block takes its capacity from the first column
+                new_column_vector->Initialize(ColumnVectorType::kConstant, current_block->capacity());
+            }
+            column_vectors.emplace_back(std::move(new_column_vector));
+        }
+        compacted_block = DataBlock::Make();
+        compacted_block->Init(column_vectors);
+        current_block = compacted_block.get();
+
+        for (u16 &row : selected_rows) {
+            row = input_row_ids.empty() ? row : input_row_ids[row];
+        }
+        input_row_ids.swap(selected_rows);
+        selected_rows.resize(input_row_ids.size());
+        std::iota(selected_rows.begin(), selected_rows.end(), 0);
+    }
+
+    auto output_select = MakeShared<Selection>();
+    output_select->Initialize(input_data_block->row_count());
+    for (u16 row : selected_rows) {
+        output_select->Append(input_row_ids.empty() ? row : input_row_ids[row]);
+    }
+    return output_select;
+}
+
 bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
     auto* prev_op_state = operator_state->prev_op_state_;
     auto* filter_operator_state = static_cast<FilterOperatorState *>(operator_state);
@@ -74,12 +254,19 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
         DataBlock* output_data_block = data_block.get();
         operator_state->data_block_array_.emplace_back(std::move(data_block));
 
-        SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
         DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
 
-        // selector contains a pointer to input data, which should not be shared by multiple tasks
-        ExpressionSelector selector;
-        SizeT selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        SizeT selected_count = 0;
+        if (conjuncts_.size() > 1 && input_data_block->row_count() > 0) {
+            SharedPtr<Selection> output_select = SelectConjuncts(input_data_block, filter_operator_state);
+            output_data_block->Init(input_data_block, output_select);
+            selected_count = output_select->Size();
+        } else {
+            SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
+            // selector contains a pointer to input data, which should not be shared by multiple tasks
+            ExpressionSelector selector;
+            selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        }
 
         LOG_TRACE(fmt::format("{} rows after filter", selected_count));
     }
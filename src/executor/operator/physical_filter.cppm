@@ -28,13 +28,17 @@ import load_meta;
 import infinity_exception;
 import internal_types;
 import data_type;
+import data_block;
+import selection;
 
 namespace infinity {
 
 export class PhysicalFilter : public PhysicalOperator {
 public:
     explicit PhysicalFilter(u64 id, UniquePtr<PhysicalOperator> left, SharedPtr<BaseExpression> condition, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kFilter, std::move(left), nullptr, id, load_metas), condition_(std::move(condition)) {}
+        : PhysicalOperator(PhysicalOperatorType::kFilter, std::move(left), nullptr, id, load_metas), condition_(std::move(condition)) {
+        SplitCondition();
+    }
 
     ~PhysicalFilter() override = default;
 
@@ -51,8 +55,18 @@ public:
     inline const SharedPtr<BaseExpression> &condition() const { return condition_; }
 
 private:
+    // Splits the condition into its AND-ed conjuncts and collects the columns each of them reads
+    void SplitCondition();
+
+    // Evaluates the conjuncts one by one in the order learned from the previous blocks, each conjunct only on the rows that passed the ones
+    // before it. Returns the selected rows of the input block.
+    SharedPtr<Selection> SelectConjuncts(const DataBlock *input_data_block, FilterOperatorState *filter_operator_state) const;
+
     SharedPtr<BaseExpression> condition_;
 
+    Vector<SharedPtr<BaseExpression>> conjuncts_{};
+    Vector<Vector<SizeT>> conjunct_column_ids_{};
+
     SharedPtr<DataTable> input_table_{};
 };
 
@@ -19,12 +19,18 @@ module;
 // #include "zsv/common.h"
 // }
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
 
+#include <exception>
+#include <future>
+#include <limits>
 #include <vector>
 
+#include "simdjson.h"
+
 module physical_import;
 
 import stl;
@@ -63,6 +69,7 @@ import catalog;
 import catalog_delta_entry;
 import build_fast_rough_filter_task;
 import stream_io;
+import infinity_context;
 
 namespace infinity {
 
@@ -352,21 +359,169 @@ void PhysicalImport::ImportCSR(QueryContext *query_context, ImportOperatorState
     import_op_state->result_msg_ = std::move(result_msg);
 }
 
+namespace {
+
+// zsv input of one range of a CSV file. The input ends at the end of the range, or early once another range failed.
+struct CSVRangeStream {
+    FILE *fp_{};
+    SizeT remaining_{};
+    const Atomic<bool> *abort_{};
+
+    static size_t Read(void *buffer, size_t n, size_t size, void *stream) {
+        auto *range_stream = static_cast<CSVRangeStream *>(stream);
+        if (range_stream->abort_->load()) {
+            return 0;
+        }
+        SizeT read_size = fread(buffer, 1, std::min(n * size, range_stream->remaining_), range_stream->fp_);
+        range_stream->remaining_ -= read_size;
+        return read_size / n;
+    }
+};
+
+} // namespace
+
 void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    auto import_begin = Clock::now();
+    FILE *fp = fopen(file_path_.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    DeferFn defer_close([&]() { fclose(fp); });
+    fseek(fp, 0, SEEK_END);
+    SizeT file_size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    // The file is split into ranges parsed in parallel, each into its own segments
+    Txn *txn = query_context->GetTxn();
+    ThreadPool &thread_pool = InfinityContext::instance().GetImportThreadPool();
+    SizeT range_count = std::max(SizeT(1), std::min(file_size / DEFAULT_IMPORT_RANGE_SIZE, SizeT(thread_pool.size())));
+    SizeT range_size = file_size / range_count;
+
+    std::mutex txn_mutex;
+    Atomic<bool> abort{false};
+    Vector<std::future<SizeT>> range_row_counts;
+    range_row_counts.reserve(range_count);
+    // segment_count ids are reserved for the segments of the range, the last range takes its ids from the table as it goes
+    auto import_range = [&](SizeT range_begin, SizeT range_end, SizeT segment_count) {
+        bool with_header = header_ && range_begin == 0;
+        SegmentID segment_id_begin = segment_count > 0 ? Catalog::ReserveSegmentIDs(table_entry_, segment_count) : 0;
+        SegmentID segment_id_end = segment_id_begin + segment_count;
+        range_row_counts.emplace_back(thread_pool.push([&, range_begin, range_end, segment_id_begin, segment_id_end, with_header](int) {
+            return ImportCSVRange(txn, range_begin, range_end, segment_id_begin, segment_id_end, with_header, txn_mutex, abort);
+        }));
+    };
+
+    // A range ends at the first line break after its split point that isn't inside a quoted cell. The quote state is tracked
+    // from the start of the file, and each range starts parsing as soon as its end is found.
+    // The line breaks outside quoted cells bound the rows of a range, enough segment ids are reserved for them when the range
+    // starts, so the segment ids, and with them the row ids, follow the file order.
+    SizeT range_begin = 0;
+    if (range_count > 1) {
+        Vector<char> buffer(1 << 20);
+        bool in_quote = false;
+        SizeT line_count = 0;
+        SizeT offset = 0;
+        SizeT split_point = range_size;
+        while (range_row_counts.size() + 1 < range_count && !abort.load()) {
+            SizeT read_size = fread(buffer.data(), 1, buffer.size(), fp);
+            if (read_size == 0) {
+                break;
+            }
+            const char *begin = buffer.data();
+            const char *end = begin + read_size;
+            const char *pos = begin;
+            while (pos < end && range_row_counts.size() + 1 < range_count) {
+                SizeT pos_offset = offset + (pos - begin);
+                if (pos_offset < split_point) {
+                    // before the split point only the quote parity and the line breaks outside quoted cells are tracked
+                    const char *scan_end = pos + std::min(SizeT(end - pos), split_point - pos_offset);
+                    while (pos < scan_end) {
+                        const char *quote = std::find(pos, scan_end, '"');
+                        if (!in_quote) {
+                            line_count += std::count(pos, quote, '\n');
+                        }
+                        if (quote == scan_end) {
+                            pos = scan_end;
+                            break;
+                        }
+                        in_quote = !in_quote;
+                        pos = quote + 1;
+                    }
+                    continue;
+                }
+                if (*pos == '"') {
+                    in_quote = !in_quote;
+                } else if (*pos == '\n' && !in_quote) {
+                    SizeT range_end = offset + (pos - begin) + 1;
+                    // the first segment is opened before any row and a new one as soon as a segment is full
+                    import_range(range_begin, range_end, (line_count + 1) / DEFAULT_SEGMENT_CAPACITY + 1);
+                    range_begin = range_end;
+                    split_point = range_begin + range_size;
+                    line_count = 0;
+                }
+                ++pos;
+            }
+            offset += read_size;
+        }
+    }
+    if (range_begin < file_size || range_row_counts.empty()) {
+        import_range(range_begin, file_size, 0);
+    }
+
+    SizeT row_count = 0;
+    std::exception_ptr import_exception;
+    for (auto &range_row_count : range_row_counts) {
+        try {
+            row_count += range_row_count.get();
+        } catch (...) {
+            if (!import_exception) {
+                import_exception = std::current_exception();
+            }
+        }
+    }
+    if (import_exception) {
+        std::rethrow_exception(import_exception);
+    }
+
+    f64 import_seconds = std::max(ElapsedFromStart(Clock::now(), import_begin).count() / 1e9, 1e-6);
+    LOG_INFO(fmt::format("Imported {} rows of {} bytes from {} in {} ranges, {:.3f}s, {:.2f} MB/s, {:.0f} rows/s",
+                         row_count,
+                         file_size,
+                         file_path_,
+                         range_row_counts.size(),
+                         import_seconds,
+                         file_size / import_seconds / MB,
+                         row_count / import_seconds));
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+SizeT PhysicalImport::ImportCSVRange(Txn *txn,
+                                     SizeT range_begin,
+                                     SizeT range_end,
+                                     SegmentID segment_id_begin,
+                                     SegmentID segment_id_end,
+                                     bool with_header,
+                                     std::mutex &txn_mutex,
+                                     Atomic<bool> &abort) {
     // opts, parser and parser_context points to each other.
     // opt -> parser_context
     // parser->opt
     // parser_context -> parser
     FILE *fp = fopen(file_path_.c_str(), "rb");
     if (!fp) {
+        abort.store(true);
         UnrecoverableError(strerror(errno));
     }
+    DeferFn defer_close([&]() { fclose(fp); });
+    fseek(fp, range_begin, SEEK_SET);
+    CSVRangeStream range_stream{fp, range_end - range_begin, &abort};
 
     UniquePtr<ZxvParserCtx> parser_context = nullptr;
-    Txn *txn = query_context->GetTxn();
     {
         auto *buffer_mgr = txn->buffer_mgr();
-        u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
+        SegmentID segment_id = segment_id_begin < segment_id_end ? segment_id_begin++ : Catalog::GetNextSegmentID(table_entry_);
         SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
         UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
         Vector<ColumnVector> column_vectors;
@@ -375,27 +530,37 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
             auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
             column_vectors.emplace_back(block_column_entry->GetColumnVector(buffer_mgr));
         }
-        parser_context = MakeUnique<ZxvParserCtx>(table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_);
+        parser_context =
+            MakeUnique<ZxvParserCtx>(table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_, &txn_mutex);
+        parser_context->next_segment_id_ = segment_id_begin;
+        parser_context->segment_id_end_ = segment_id_end;
     }
 
     auto opts = MakeUnique<ZsvOpts>();
-    if (header_) {
+    if (with_header) {
         opts->row_handler = CSVHeaderHandler;
     } else {
         opts->row_handler = CSVRowHandler;
     }
     opts->delimiter = delimiter_;
-    opts->stream = fp;
+    opts->read = CSVRangeStream::Read;
+    opts->stream = &range_stream;
     opts->ctx = parser_context.get();
     opts->buffsize = (1 << 20); // default buffer size 256k, we use 1M
 
     parser_context->parser_ = ZsvParser(opts.get());
 
     ZsvStatus csv_parser_status;
-    while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
-        ;
+    try {
+        while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
+            ;
+        }
+        parser_context->parser_.Finish();
+    } catch (...) {
+        // stop the other ranges
+        abort.store(true);
+        throw;
     }
-    parser_context->parser_.Finish();
 
     { // add the last segment entry
         auto segment_entry = parser_context->segment_entry_;
@@ -410,12 +575,12 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
             parser_context->column_vectors_.clear();
             std::move(*segment_entry).Cleanup();
         } else {
-            SaveSegmentData(table_entry_, txn, segment_entry);
+            SaveSegmentData(table_entry_, txn, segment_entry, &txn_mutex);
         }
     }
-    fclose(fp);
 
     if (csv_parser_status != zsv_status_no_more_input) {
+        abort.store(true);
         if (parser_context->err_msg_.get() != nullptr) {
             UnrecoverableError(*parser_context->err_msg_);
         } else {
@@ -423,148 +588,378 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
             UnrecoverableError(err_msg);
         }
     }
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", parser_context->row_count_));
-    import_op_state->result_msg_ = std::move(result_msg);
+    return parser_context->row_count_;
 }
 
-void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state) {
-    StreamIO stream_io;
-    stream_io.Init(file_path_, FileFlags::READ_FLAG);
-    DeferFn file_defer([&]() { stream_io.Close(); });
+SharedPtr<ConstantExpr> BuildConstantSparseExprFromJson(const nlohmann::json &json_object, const SparseInfo *sparse_info);
 
-    Txn *txn = query_context->GetTxn();
-    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
+namespace {
 
-    Vector<ColumnVector> column_vectors;
-    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-        column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
+// Appends the rows of a JSON / JSONL file straight from simdjson On-Demand values into the column vectors, no DOM is built.
+// Fields are matched against the columns in one pass over each object, which is a single comparison per field when the
+// fields follow the column order.
+class JSONRowImporter {
+public:
+    JSONRowImporter(TableEntry *table_entry, Txn *txn) : table_entry_(table_entry), txn_(txn), column_filled_(table_entry->ColumnCount()) {
+        u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
+        segment_entry_ = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn_);
+        NewBlock(0);
     }
 
-    SizeT row_count{0};
-    while (true) {
-        String json_str;
-        if (stream_io.ReadLine(json_str)) {
-            nlohmann::json line_json = nlohmann::json::parse(json_str);
-
-            JSONLRowHandler(line_json, column_vectors);
-            block_entry->IncreaseRowCount(1);
-            ++row_count;
-
-            if (block_entry->GetAvailableCapacity() <= 0) {
-                LOG_DEBUG(fmt::format("Block {} saved, total rows: {}", block_entry->block_id(), row_count));
-                segment_entry->AppendBlockEntry(std::move(block_entry));
-                if (segment_entry->Room() <= 0) {
-                    LOG_DEBUG(fmt::format("Segment {} saved, total rows: {}", segment_entry->segment_id(), row_count));
-                    SaveSegmentData(table_entry_, txn, segment_entry);
-                    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-                    segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-                }
+    void AppendRow(simdjson::ondemand::object row_object) {
+        if (block_entry_->GetAvailableCapacity() <= 0) {
+            LOG_DEBUG(fmt::format("Block {} saved, total rows: {}", block_entry_->block_id(), row_count_));
+            segment_entry_->AppendBlockEntry(std::move(block_entry_));
+            if (segment_entry_->Room() <= 0) {
+                LOG_DEBUG(fmt::format("Segment {} saved, total rows: {}", segment_entry_->segment_id(), row_count_));
+                PhysicalImport::SaveSegmentData(table_entry_, txn_, segment_entry_);
+                u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
+                segment_entry_ = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn_);
+            }
+            NewBlock(segment_entry_->GetNextBlockID());
+        }
 
-                block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-                column_vectors.clear();
-                for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-                    auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-                    column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
+        SizeT column_count = column_vectors_.size();
+        std::fill(column_filled_.begin(), column_filled_.end(), false);
+        SizeT next_column_idx = 0;
+        for (auto field_result : row_object) {
+            simdjson::ondemand::field field = field_result;
+            std::string_view key = field.unescaped_key(false);
+            SizeT column_idx = next_column_idx;
+            if (column_idx >= column_count || table_entry_->GetColumnDefByID(column_idx)->name_ != key) {
+                for (column_idx = 0; column_idx < column_count; ++column_idx) {
+                    if (table_entry_->GetColumnDefByID(column_idx)->name_ == key) {
+                        break;
+                    }
                 }
             }
-        } else {
-            if (block_entry->row_count() == 0) {
-                column_vectors.clear();
-                std::move(*block_entry).Cleanup();
-            } else {
-                segment_entry->AppendBlockEntry(std::move(block_entry));
+            // Fields which aren't table columns are ignored
+            if (column_idx == column_count || column_filled_[column_idx]) {
+                continue;
             }
-            if (segment_entry->row_count() == 0) {
-                std::move(*segment_entry).Cleanup();
-            } else {
-                SaveSegmentData(table_entry_, txn, segment_entry);
-                LOG_DEBUG(fmt::format("Last segment {} saved, total rows: {}", segment_entry->segment_id(), row_count));
+            AppendValue(field.value(), column_vectors_[column_idx]);
+            column_filled_[column_idx] = true;
+            next_column_idx = column_idx + 1;
+        }
+
+        for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+            if (column_filled_[column_idx]) {
+                continue;
             }
-            break;
+            const ColumnDef *column_def = table_entry_->GetColumnDefByID(column_idx);
+            if (!column_def->has_default_value()) {
+                Status status = Status::ImportFileFormatError(fmt::format("Column {} not found in JSON.", column_def->name_));
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+            auto const_expr = dynamic_cast<ConstantExpr *>(column_def->default_expr_.get());
+            column_vectors_[column_idx].AppendByConstantExpr(const_expr);
         }
+        block_entry_->IncreaseRowCount(1);
+        ++row_count_;
     }
 
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
-    import_op_state->result_msg_ = std::move(result_msg);
-}
+    // Hands the last segment over to the txn, returns the number of imported rows
+    SizeT Finish() {
+        if (block_entry_->row_count() == 0) {
+            column_vectors_.clear();
+            std::move(*block_entry_).Cleanup();
+        } else {
+            segment_entry_->AppendBlockEntry(std::move(block_entry_));
+        }
+        if (segment_entry_->row_count() == 0) {
+            std::move(*segment_entry_).Cleanup();
+        } else {
+            PhysicalImport::SaveSegmentData(table_entry_, txn_, segment_entry_);
+            LOG_DEBUG(fmt::format("Last segment {} saved, total rows: {}", segment_entry_->segment_id(), row_count_));
+        }
+        return row_count_;
+    }
 
-void PhysicalImport::ImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state) {
-    nlohmann::json json_arr;
-    {
-        LocalFileSystem fs;
-        auto [file_handler, status] = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
-        if(!status.ok()) {
-            UnrecoverableError(status.message());
+private:
+    void NewBlock(BlockID block_id) {
+        block_entry_ = BlockEntry::NewBlockEntry(segment_entry_.get(), block_id, 0, table_entry_->ColumnCount(), txn_);
+        column_vectors_.clear();
+        for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
+            auto *block_column_entry = block_entry_->GetColumnBlockEntry(i);
+            column_vectors_.emplace_back(block_column_entry->GetColumnVector(txn_->buffer_mgr()));
         }
-        DeferFn file_defer([&]() { fs.Close(*file_handler); });
+    }
 
-        SizeT file_size = fs.GetFileSize(*file_handler);
-        String json_str(file_size, 0);
-        SizeT read_n = file_handler->Read(json_str.data(), file_size);
-        if (read_n != file_size) {
-            String error_message = fmt::format("Read file size {} doesn't match with file size {}.", read_n, file_size);
-            LOG_CRITICAL(error_message);
-            UnrecoverableError(error_message);
+    void AppendValue(simdjson::ondemand::value value, ColumnVector &column_vector) {
+        switch (column_vector.data_type()->type()) {
+            case kBoolean: {
+                bool v = value.get_bool();
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kTinyInt: {
+                i8 v = NarrowInteger<i8>(value.get_int64(), column_vector);
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kSmallInt: {
+                i16 v = NarrowInteger<i16>(value.get_int64(), column_vector);
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kInteger: {
+                i32 v = NarrowInteger<i32>(value.get_int64(), column_vector);
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kBigInt: {
+                i64 v = value.get_int64();
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kFloat: {
+                float v = static_cast<double>(value.get_double());
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kDouble: {
+                double v = value.get_double();
+                column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
+                break;
+            }
+            case kVarchar: {
+                std::string_view str_view = value.get_string();
+                column_vector.AppendByStringView(str_view, ',');
+                break;
+            }
+            case kEmbedding: {
+                auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+                SizeT dim = embedding_info->Dimension();
+                switch (embedding_info->Type()) {
+                    case kElemInt8: {
+                        AppendEmbedding<i8>(value, dim, column_vector);
+                        break;
+                    }
+                    case kElemInt16: {
+                        AppendEmbedding<i16>(value, dim, column_vector);
+                        break;
+                    }
+                    case kElemInt32: {
+                        AppendEmbedding<i32>(value, dim, column_vector);
+                        break;
+                    }
+                    case kElemInt64: {
+                        AppendEmbedding<i64>(value, dim, column_vector);
+                        break;
+                    }
+                    case kElemFloat: {
+                        AppendEmbedding<float>(value, dim, column_vector);
+                        break;
+                    }
+                    case kElemDouble: {
+                        AppendEmbedding<double>(value, dim, column_vector);
+                        break;
+                    }
+                    case kElemFloat16: {
+                        AppendEmbedding<Float16T>(value, dim, column_vector);
+                        break;
+                    }
+                    case kElemBFloat16: {
+                        AppendEmbedding<BFloat16T>(value, dim, column_vector);
+                        break;
+                    }
+                    default: {
+                        String error_message = "Not implement: Embedding type.";
+                        LOG_CRITICAL(error_message);
+                        UnrecoverableError(error_message);
+                        break;
+                    }
+                }
+                break;
+            }
+            case kTensor:
+            case kTensorArray:
+            case kSparse: {
+                // Rare nested values are handed to the ConstantExpr builders as the raw text of the field
+                std::string_view raw_json;
+                switch (static_cast<simdjson::ondemand::json_type>(value.type())) {
+                    case simdjson::ondemand::json_type::array: {
+                        raw_json = value.get_array().raw_json();
+                        break;
+                    }
+                    case simdjson::ondemand::json_type::object: {
+                        raw_json = value.get_object().raw_json();
+                        break;
+                    }
+                    default: {
+                        raw_json = value.raw_json_token();
+                        break;
+                    }
+                }
+                nlohmann::json value_json = nlohmann::json::parse(raw_json);
+                SharedPtr<ConstantExpr> const_expr;
+                if (column_vector.data_type()->type() == kSparse) {
+                    const auto *sparse_info = static_cast<SparseInfo *>(column_vector.data_type()->type_info().get());
+                    const_expr = BuildConstantSparseExprFromJson(value_json, sparse_info);
+                } else {
+                    const_expr = BuildConstantExprFromJson(value_json);
+                }
+                if (const_expr.get() == nullptr) {
+                    RecoverableError(Status::ImportFileFormatError("Invalid json object."));
+                }
+                column_vector.AppendByConstantExpr(const_expr.get());
+                break;
+            }
+            default: {
+                String error_message = "Not implement: Invalid data type.";
+                LOG_CRITICAL(error_message);
+                UnrecoverableError(error_message);
+            }
         }
+    }
 
-        if (read_n == 0) {
-            auto result_msg = MakeUnique<String>(fmt::format("Empty JSON file, IMPORT 0 Rows"));
-            import_op_state->result_msg_ = std::move(result_msg);
-            return;
+    // JSON integers are parsed as i64, the ones which don't fit the column type are rejected instead of wrapped around
+    template <typename T>
+    static T NarrowInteger(i64 value, const ColumnVector &column_vector) {
+        if constexpr (sizeof(T) < sizeof(i64)) {
+            if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+                Status status = Status::ImportFileFormatError(
+                    fmt::format("Value {} is out of the range of {}.", value, column_vector.data_type()->ToString()));
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
         }
+        return static_cast<T>(value);
+    }
 
-        json_arr = nlohmann::json::parse(json_str);
+    template <typename T>
+    void AppendEmbedding(simdjson::ondemand::value value, SizeT dim, ColumnVector &column_vector) {
+        embedding_buffer_.resize(dim * sizeof(T));
+        auto *embedding = reinterpret_cast<T *>(embedding_buffer_.data());
+        SizeT embedding_dim = 0;
+        for (auto element : value.get_array()) {
+            if (embedding_dim < dim) {
+                if constexpr (std::is_integral_v<T>) {
+                    embedding[embedding_dim] = NarrowInteger<T>(element.get_int64(), column_vector);
+                } else if constexpr (std::is_same_v<T, double>) {
+                    embedding[embedding_dim] = element.get_double();
+                } else {
+                    embedding[embedding_dim] = static_cast<float>(static_cast<double>(element.get_double()));
+                }
+            }
+            ++embedding_dim;
+        }
+        if (embedding_dim != dim) {
+            Status status =
+                Status::InvalidJsonFormat(fmt::format("Attempt to import {} dimension embedding into {} dimension column.", embedding_dim, dim));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding));
     }
 
-    Txn *txn = query_context->GetTxn();
-    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
+    TableEntry *table_entry_{};
+    Txn *txn_{};
+    SharedPtr<SegmentEntry> segment_entry_{};
+    UniquePtr<BlockEntry> block_entry_{};
+    Vector<ColumnVector> column_vectors_{};
+    Vector<bool> column_filled_{};
+    Vector<char> embedding_buffer_{};
+    SizeT row_count_{};
+};
+
+void JSONFormatError(const simdjson::simdjson_error &e) {
+    Status status = Status::InvalidJsonFormat(e.what());
+    LOG_ERROR(status.message());
+    RecoverableError(status);
+}
+
+} // namespace
 
-    Vector<ColumnVector> column_vectors;
-    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-        auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-        column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
+void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    LocalFileSystem fs;
+    auto [file_handler, status] = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
     }
+    DeferFn file_defer([&]() { fs.Close(*file_handler); });
+
+    JSONRowImporter row_importer(table_entry_, query_context->GetTxn());
+    simdjson::ondemand::parser parser;
+    // The file is read in chunks cut at the last line break, the incomplete last line is carried over to the next chunk
+    String buffer;
+    SizeT buffer_size = 0;
+    bool end_of_file = false;
+    while (!end_of_file) {
+        buffer.resize(buffer_size + DEFAULT_JSONL_READ_SIZE + simdjson::SIMDJSON_PADDING);
+        i64 read_n = file_handler->Read(buffer.data() + buffer_size, DEFAULT_JSONL_READ_SIZE);
+        buffer_size += read_n;
+        end_of_file = read_n == 0;
+
+        SizeT chunk_size = buffer_size;
+        if (!end_of_file) {
+            std::string_view buffer_view(buffer.data(), buffer_size);
+            SizeT last_line_end = buffer_view.rfind('\n');
+            if (last_line_end == std::string_view::npos) {
+                // a line longer than a chunk, read on
+                continue;
+            }
+            chunk_size = last_line_end + 1;
+        }
+        // simdjson reports a chunk of blank lines as an error
+        if (std::string_view(buffer.data(), chunk_size).find_first_not_of(" \t\r\n") != std::string_view::npos) {
+            try {
+                simdjson::ondemand::document_stream rows =
+                    parser.iterate_many(buffer.data(), chunk_size, std::max(chunk_size, simdjson::ondemand::MINIMAL_BATCH_SIZE));
+                for (auto row : rows) {
+                    row_importer.AppendRow(row.get_object());
+                }
+            } catch (const simdjson::simdjson_error &e) {
+                JSONFormatError(e);
+            }
+        }
 
-    if (!json_arr.is_array()) {
-        auto result_msg = MakeUnique<String>(fmt::format("Invalid json format, IMPORT 0 rows"));
+        buffer_size -= chunk_size;
+        std::memmove(buffer.data(), buffer.data() + chunk_size, buffer_size);
+    }
+
+    SizeT row_count = row_importer.Finish();
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+void PhysicalImport::ImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    // The array is iterated On-Demand, only the file content and the structural index are held in memory.
+    // simdjson can't stream the elements of a single array, so unlike JSONL the whole file has to fit in memory.
+    simdjson::padded_string json_str;
+    if (auto error = simdjson::padded_string::load(file_path_).get(json_str); error) {
+        String error_message = fmt::format("Can't read file: {}: {}", file_path_, simdjson::error_message(error));
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+
+    if (json_str.size() == 0) {
+        auto result_msg = MakeUnique<String>(fmt::format("Empty JSON file, IMPORT 0 Rows"));
         import_op_state->result_msg_ = std::move(result_msg);
         return;
     }
 
-    SizeT row_count{0};
-    for (const auto &json_entry : json_arr) {
-        if (block_entry->GetAvailableCapacity() <= 0) {
-            LOG_DEBUG(fmt::format("Block {} saved", block_entry->block_id()));
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-            if (segment_entry->Room() <= 0) {
-                LOG_DEBUG(fmt::format("Segment {} saved", segment_entry->segment_id()));
-                SaveSegmentData(table_entry_, txn, segment_entry);
-                u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-                segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-            }
+    simdjson::ondemand::parser parser;
+    simdjson::ondemand::document json_doc;
+    simdjson::ondemand::json_type json_type{};
+    if (parser.iterate(json_str).get(json_doc) != simdjson::SUCCESS || json_doc.type().get(json_type) != simdjson::SUCCESS ||
+        json_type != simdjson::ondemand::json_type::array) {
+        auto result_msg = MakeUnique<String>(fmt::format("Invalid json format, IMPORT 0 rows"));
+        import_op_state->result_msg_ = std::move(result_msg);
+        return;
+    }
 
-            block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-            column_vectors.clear();
-            for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-                auto *block_column_entry = block_entry->GetColumnBlockEntry(i);
-                column_vectors.emplace_back(block_column_entry->GetColumnVector(txn->buffer_mgr()));
-            }
+    JSONRowImporter row_importer(table_entry_, query_context->GetTxn());
+    try {
+        for (auto row : json_doc.get_array()) {
+            row_importer.AppendRow(row.get_object());
         }
-
-        JSONLRowHandler(json_entry, column_vectors);
-        block_entry->IncreaseRowCount(1);
-        ++ row_count;
+    } catch (const simdjson::simdjson_error &e) {
+        JSONFormatError(e);
     }
 
-    segment_entry->AppendBlockEntry(std::move(block_entry));
-    SaveSegmentData(table_entry_, txn, segment_entry);
-
+    SizeT row_count = row_importer.Finish();
     auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
     import_op_state->result_msg_ = std::move(result_msg);
 }
@@ -668,8 +1063,8 @@ void PhysicalImport::CSVRowHandler(void *context) {
         // we have already used all space of the segment
         if (segment_entry->Room() <= 0) {
             LOG_DEBUG(fmt::format("Segment {} saved", segment_entry->segment_id()));
-            SaveSegmentData(table_entry, txn, segment_entry);
-            u64 segment_id = Catalog::GetNextSegmentID(parser_context->table_entry_);
+            SaveSegmentData(table_entry, txn, segment_entry, parser_context->txn_mutex_);
+            SegmentID segment_id = parser_context->NextSegmentID();
             segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn);
             parser_context->segment_entry_ = segment_entry;
         }
@@ -858,169 +1253,15 @@ SharedPtr<ConstantExpr> BuildConstantSparseExprFromJson(const nlohmann::json &js
     }
 }
 
-void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<ColumnVector> &column_vectors) {
-    for (SizeT i = 0; auto &column_vector : column_vectors) {
-        const ColumnDef *column_def = table_entry_->GetColumnDefByID(i++);
-
-        if (line_json.contains(column_def->name_)) {
-            switch (column_vector.data_type()->type()) {
-                case kBoolean: {
-                    bool v = line_json[column_def->name_];
-                    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                    break;
-                }
-                case kTinyInt: {
-                    i8 v = line_json[column_def->name_];
-                    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                    break;
-                }
-                case kSmallInt: {
-                    i16 v = line_json[column_def->name_];
-                    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                    break;
-                }
-                case kInteger: {
-                    i32 v = line_json[column_def->name_];
-                    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                    break;
-                }
-                case kBigInt: {
-                    i64 v = line_json[column_def->name_];
-                    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                    break;
-                }
-                case kFloat: {
-                    float v = line_json[column_def->name_];
-                    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                    break;
-                }
-                case kDouble: {
-                    double v = line_json[column_def->name_];
-                    column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(&v));
-                    break;
-                }
-                case kVarchar: {
-                    std::string_view str_view = line_json[column_def->name_].get<std::string_view>();
-                    column_vector.AppendByStringView(str_view, ',');
-                    break;
-                }
-                case kEmbedding: {
-                    auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
-                    SizeT dim = embedding_info->Dimension();
-                    switch (embedding_info->Type()) {
-                        case kElemInt8: {
-                            Vector<i8> &&embedding = line_json[column_def->name_].get<Vector<i8>>();
-                            SizeT embedding_dim = embedding.size();
-                            if(embedding_dim != dim) {
-                                Status status = Status::InvalidJsonFormat(fmt::format("Attempt to import {} dimension embedding into {} dimension column.", dim, embedding_dim));
-                                LOG_ERROR(status.message());
-                                RecoverableError(status);
-                            }
-                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                            break;
-                        }
-                        case kElemInt16: {
-                            Vector<i16> &&embedding = line_json[column_def->name_].get<Vector<i16>>();
-                            SizeT embedding_dim = embedding.size();
-                            if(embedding_dim != dim) {
-                                Status status = Status::InvalidJsonFormat(fmt::format("Attempt to import {} dimension embedding into {} dimension column.", dim, embedding_dim));
-                                LOG_ERROR(status.message());
-                                RecoverableError(status);
-                            }
-                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                            break;
-                        }
-                        case kElemInt32: {
-                            Vector<i32> &&embedding = line_json[column_def->name_].get<Vector<i32>>();
-                            SizeT embedding_dim = embedding.size();
-                            if(embedding_dim != dim) {
-                                Status status = Status::InvalidJsonFormat(fmt::format("Attempt to import {} dimension embedding into {} dimension column.", dim, embedding_dim));
-                                LOG_ERROR(status.message());
-                                RecoverableError(status);
-                            }
-                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                            break;
-                        }
-                        case kElemInt64: {
-                            Vector<i64> &&embedding = line_json[column_def->name_].get<Vector<i64>>();
-                            SizeT embedding_dim = embedding.size();
-                            if(embedding_dim != dim) {
-                                Status status = Status::InvalidJsonFormat(fmt::format("Attempt to import {} dimension embedding into {} dimension column.", dim, embedding_dim));
-                                LOG_ERROR(status.message());
-                                RecoverableError(status);
-                            }
-                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                            break;
-                        }
-                        case kElemFloat: {
-                            Vector<float> &&embedding = line_json[column_def->name_].get<Vector<float>>();
-                            SizeT embedding_dim = embedding.size();
-                            if(embedding_dim != dim) {
-                                Status status = Status::InvalidJsonFormat(fmt::format("Attempt to import {} dimension embedding into {} dimension column.", dim, embedding_dim));
-                                LOG_ERROR(status.message());
-                                RecoverableError(status);
-                            }
-                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                            break;
-                        }
-                        case kElemDouble: {
-                            Vector<double> &&embedding = line_json[column_def->name_].get<Vector<double>>();
-                            SizeT embedding_dim = embedding.size();
-                            if(embedding_dim != dim) {
-                                Status status = Status::InvalidJsonFormat(fmt::format("Attempt to import {} dimension embedding into {} dimension column.", dim, embedding_dim));
-                                LOG_ERROR(status.message());
-                                RecoverableError(status);
-                            }
-                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
-                            break;
-                        }
-                        default: {
-                            String error_message = "Not implement: Embedding type.";
-                            LOG_CRITICAL(error_message);
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                    }
-                    break;
-                }
-                case kTensor:
-                case kTensorArray: {
-                    // build ConstantExpr
-                    SharedPtr<ConstantExpr> const_expr = BuildConstantExprFromJson(line_json[column_def->name_]);
-                    if (const_expr.get() == nullptr) {
-                        RecoverableError(Status::ImportFileFormatError("Invalid json object."));
-                    }
-                    column_vector.AppendByConstantExpr(const_expr.get());
-                    break;
-                }
-                case kSparse: {
-                    const auto *sparse_info = static_cast<SparseInfo *>(column_vector.data_type()->type_info().get());
-                    SharedPtr<ConstantExpr> const_expr = BuildConstantSparseExprFromJson(line_json[column_def->name_], sparse_info);
-                    if (const_expr.get() == nullptr) {
-                        RecoverableError(Status::ImportFileFormatError("Invalid json object."));
-                    }
-                    column_vector.AppendByConstantExpr(const_expr.get());
-                    break;
-                }
-                default: {
-                    String error_message = "Not implement: Invalid data type.";
-                    LOG_CRITICAL(error_message);
-                    UnrecoverableError(error_message);
-                }
-            }
-        } else if (column_def->has_default_value()) {
-            auto const_expr = dynamic_cast<ConstantExpr *>(column_def->default_expr_.get());
-            column_vector.AppendByConstantExpr(const_expr);
-        } else {
-            Status status = Status::ImportFileFormatError(fmt::format("Column {} not found in JSON.", column_def->name_));
-            LOG_ERROR(status.message());
-            RecoverableError(status);
-        }
-    }
-}
-
-void PhysicalImport::SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry) {
+void PhysicalImport::SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry, std::mutex *txn_mutex) {
     segment_entry->FlushNewData();
+    BuildFastRoughFilterTask::ExecuteOnImportedSegment(segment_entry.get(), txn->buffer_mgr(), txn->BeginTS());
+    if (txn_mutex == nullptr) {
+        txn->Import(table_entry, std::move(segment_entry));
+        return;
+    }
+    // the txn local store and the index population of Import aren't thread safe
+    std::scoped_lock lock(*txn_mutex);
     txn->Import(table_entry, std::move(segment_entry));
 }
 
@@ -51,6 +51,12 @@ public:
     UniquePtr<BlockEntry> block_entry_{};
     Vector<ColumnVector> column_vectors_{};
     const char delimiter_{};
+    // serializes the segments handed over to txn_ by parallel imports
+    std::mutex *txn_mutex_{};
+    // [next_segment_id_, segment_id_end_) are reserved for the segments of this context, which keeps the segments of parallel
+    // ranges in file order. Ids are taken from the table once the reserved ones run out.
+    SegmentID next_segment_id_{};
+    SegmentID segment_id_end_{};
 
 public:
     ZxvParserCtx(TableEntry *table_entry,
@@ -58,9 +64,17 @@ public:
                  SharedPtr<SegmentEntry> segment_entry,
                  UniquePtr<BlockEntry> block_entry,
                  Vector<ColumnVector> &&column_vectors,
-                 char delimiter)
+                 char delimiter,
+                 std::mutex *txn_mutex = nullptr)
         : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), txn_(txn), segment_entry_(segment_entry), block_entry_(std::move(block_entry)),
-          column_vectors_(std::move(column_vectors)), delimiter_(delimiter) {}
+          column_vectors_(std::move(column_vectors)), delimiter_(delimiter), txn_mutex_(txn_mutex) {}
+
+    SegmentID NextSegmentID() {
+        if (next_segment_id_ < segment_id_end_) {
+            return next_segment_id_++;
+        }
+        return table_entry_->GetNextSegmentID();
+    }
 };
 
 export class PhysicalImport : public PhysicalOperator {
@@ -114,15 +128,25 @@ public:
 
     inline char delimiter() const { return delimiter_; }
 
-    static void SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry);
+    // Flushes a full segment, builds its rough filter and hands it over to txn. Concurrent callers pass the txn_mutex they share.
+    static void SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry, std::mutex *txn_mutex = nullptr);
 
 private:
+    // Parses the bytes [range_begin, range_end) of the CSV file, which start and end at row boundaries, into new segments.
+    // The segments take the reserved ids [segment_id_begin, segment_id_end) first. Returns the number of imported rows.
+    SizeT ImportCSVRange(Txn *txn,
+                         SizeT range_begin,
+                         SizeT range_end,
+                         SegmentID segment_id_begin,
+                         SegmentID segment_id_end,
+                         bool with_header,
+                         std::mutex &txn_mutex,
+                         Atomic<bool> &abort);
+
     static void CSVHeaderHandler(void *);
 
     static void CSVRowHandler(void *);
 
-    void JSONLRowHandler(const nlohmann::json &line_json, Vector<ColumnVector> &column_vectors);
-
 private:
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
@@ -16,6 +16,7 @@ module;
 
 #include <algorithm>
 #include <bit>
+#include <tuple>
 #include <vector>
 
 module physical_index_scan;
@@ -45,14 +46,14 @@ namespace infinity {
 PhysicalIndexScan::PhysicalIndexScan(u64 id,
                                      SharedPtr<BaseTableRef> base_table_ref,
                                      SharedPtr<BaseExpression> index_filter_qualified,
-                                     HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
-                                     Vector<FilterExecuteElem> &&filter_execute_command,
-                                     UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                                     const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
+                                     const Vector<FilterExecuteElem> &filter_execute_command,
+                                     SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                      SharedPtr<Vector<LoadMeta>> load_metas,
                                      bool add_row_id)
     : PhysicalOperator(PhysicalOperatorType::kIndexScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
-      index_filter_qualified_(std::move(index_filter_qualified)), column_index_map_(std::move(column_index_map)),
-      filter_execute_command_(std::move(filter_execute_command)), fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)),
+      index_filter_qualified_(std::move(index_filter_qualified)), column_index_map_(column_index_map),
+      filter_execute_command_(filter_execute_command), fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)),
       add_row_id_(add_row_id) {
     // output only one hidden column: RowID
     // create empty output_names_ and output_types_
@@ -109,7 +110,7 @@ template <typename ColumnValueType>
 struct TrunkReader {
     virtual ~TrunkReader() = default;
     virtual u32 GetResultCnt(const FilterIntervalRangeT<ColumnValueType> &interval_range) = 0;
-    virtual void OutPut(std::variant<Vector<u32>, Bitmask> &selected_rows_) = 0;
+    virtual void OutPut(Roaring &selected_rows) = 0;
 };
 
 template <typename ColumnValueType>
@@ -123,11 +124,24 @@ struct TrunkReaderT final : public TrunkReader<ColumnValueType> {
     TrunkReaderT(const u32 segment_row_count, const SharedPtr<ChunkIndexEntry> &chunk_index_entry)
         : segment_row_count_(segment_row_count), chunk_index_entry_(chunk_index_entry) {}
     u32 GetResultCnt(const FilterIntervalRangeT<ColumnValueType> &interval_range) override {
-        static_assert(std::is_same_v<KeyType, typename FilterIntervalRangeT<ColumnValueType>::T>);
         BufferHandle index_handle_head = chunk_index_entry_->GetIndex();
         auto index = static_cast<const SecondaryIndexData *>(index_handle_head.GetData());
         u32 index_data_num = index->GetChunkRowCount();
-        auto [begin_val, end_val] = interval_range.GetRange();
+        KeyType begin_val = {};
+        KeyType end_val = {};
+        if constexpr (std::is_same_v<ColumnValueType, VarcharT>) {
+            // the keys are the ordinals of the strings in the dictionary of the chunk
+            auto [begin_key, end_key] = interval_range.GetRange();
+            auto [begin_ordinal, end_ordinal] = index->SearchDictionary(begin_key, end_key);
+            if (begin_ordinal >= end_ordinal) {
+                return 0;
+            }
+            begin_val = begin_ordinal;
+            end_val = end_ordinal - 1;
+        } else {
+            static_assert(std::is_same_v<KeyType, typename FilterIntervalRangeT<ColumnValueType>::T>);
+            std::tie(begin_val, end_val) = interval_range.GetRange();
+        }
         // 1. search PGM and get approximate search range
         // result:
         //    1. size_t pos_;         ///< The approximate position of the key.
@@ -257,10 +271,19 @@ struct TrunkReaderT final : public TrunkReader<ColumnValueType> {
         const u32 result_size = end_pos - begin_pos;
         return result_size;
     }
-    void OutPut(std::variant<Vector<u32>, Bitmask> &selected_rows_) override {
+    void OutPut(Roaring &selected_rows) override {
         const u32 begin_pos = begin_pos_;
         const u32 end_pos = end_pos_;
         const u32 result_size = end_pos - begin_pos;
+        if (result_size == 0) {
+            return;
+        }
+        BufferHandle index_handle_head = chunk_index_entry_->GetIndex();
+        auto index = static_cast<const SecondaryIndexData *>(index_handle_head.GetData());
+        if (index->HasValueBitmaps()) {
+            // low cardinality chunk: union the bitmaps of the keys in range, the pairs are not read
+            return index->UnionValueBitmaps(begin_pos, end_pos, selected_rows);
+        }
         u32 begin_part_id = begin_pos / 8192;
         u32 begin_part_offset = begin_pos % 8192;
         auto index_handle_b = chunk_index_entry_->GetIndexPartAt(begin_part_id);
@@ -272,31 +295,19 @@ struct TrunkReaderT final : public TrunkReader<ColumnValueType> {
         };
         auto begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
         // output result
-        std::visit(Overload{[&](Vector<u32> &selected_rows) {
-                                for (u32 i = 0; i < result_size; ++i) {
-                                    if (begin_part_offset == begin_part_size) {
-                                        index_handle_b = chunk_index_entry_->GetIndexPartAt(++begin_part_id);
-                                        index_data_b = index_handle_b.GetData();
-                                        begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-                                        begin_part_offset = 0;
-                                    }
-                                    selected_rows.push_back(index_offset_b_ptr(begin_part_offset));
-                                    ++begin_part_offset;
-                                }
-                            },
-                            [&](Bitmask &bitmask) {
-                                for (u32 i = 0; i < result_size; ++i) {
-                                    if (begin_part_offset == begin_part_size) {
-                                        index_handle_b = chunk_index_entry_->GetIndexPartAt(++begin_part_id);
-                                        index_data_b = index_handle_b.GetData();
-                                        begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
-                                        begin_part_offset = 0;
-                                    }
-                                    bitmask.SetTrue(index_offset_b_ptr(begin_part_offset));
-                                    ++begin_part_offset;
-                                }
-                            }},
-                   selected_rows_);
+        Vector<u32> offsets;
+        offsets.reserve(result_size);
+        for (u32 i = 0; i < result_size; ++i) {
+            if (begin_part_offset == begin_part_size) {
+                index_handle_b = chunk_index_entry_->GetIndexPartAt(++begin_part_id);
+                index_data_b = index_handle_b.GetData();
+                begin_part_size = chunk_index_entry_->GetPartRowCount(begin_part_id);
+                begin_part_offset = 0;
+            }
+            offsets.push_back(index_offset_b_ptr(begin_part_offset));
+            ++begin_part_offset;
+        }
+        selected_rows.addMany(offsets.size(), offsets.data());
     }
 };
 
@@ -310,38 +321,36 @@ struct TrunkReaderM final : public TrunkReader<ColumnValueType> {
         : segment_row_count_(segment_row_count), memory_secondary_index_(memory_secondary_index) {}
     u32 GetResultCnt(const FilterIntervalRangeT<ColumnValueType> &interval_range) override {
         auto [begin_val, end_val] = interval_range.GetRange();
-        Tuple<u32, KeyType, KeyType> arg_tuple = {segment_row_count_, begin_val, end_val};
-        result_cache_ = memory_secondary_index_->RangeQuery(&arg_tuple);
+        if constexpr (std::is_same_v<ColumnValueType, VarcharT>) {
+            Tuple<u32, std::string_view, Optional<std::string_view>> arg_tuple = {segment_row_count_, begin_val, end_val};
+            result_cache_ = memory_secondary_index_->RangeQuery(&arg_tuple);
+        } else {
+            Tuple<u32, KeyType, KeyType> arg_tuple = {segment_row_count_, begin_val, end_val};
+            result_cache_ = memory_secondary_index_->RangeQuery(&arg_tuple);
+        }
         return result_cache_.first;
     }
-    void OutPut(std::variant<Vector<u32>, Bitmask> &selected_rows_) override {
-        std::visit(Overload{[&](Vector<u32> &selected_rows, const Vector<u32> &result) {
-                                selected_rows.insert(selected_rows.end(), result.begin(), result.end());
-                            },
-                            [](Vector<u32> &, const Bitmask &) {
-                                String error_message = "TrunkReaderM::OutPut(): result count error.";
-                                LOG_CRITICAL(error_message);
-                                UnrecoverableError(error_message);
-                            },
-                            [&](Bitmask &bitmask, const Vector<u32> &result) {
-                                for (const auto offset : result) {
-                                    bitmask.SetTrue(offset);
+    void OutPut(Roaring &selected_rows) override {
+        std::visit(Overload{[&](const Vector<u32> &result) { selected_rows.addMany(result.size(), result.data()); },
+                            [&](const Bitmask &result) {
+                                Vector<u32> offsets;
+                                offsets.reserve(result_cache_.first);
+                                for (u32 segment_offset = 0; segment_offset < segment_row_count_; ++segment_offset) {
+                                    if (result.IsTrue(segment_offset)) {
+                                        offsets.push_back(segment_offset);
+                                    }
                                 }
-                            },
-                            [&](Bitmask &bitmask, const Bitmask &result) { bitmask.MergeOr(result); }},
-                   selected_rows_,
+                                selected_rows.addMany(offsets.size(), offsets.data());
+                            }},
                    result_cache_.second);
     }
 };
 
-// Vector<u32>: selected rows in segment (used when selected_num <= (segment_row_cnt / 32)), i.e. size(Vector) <= size(Bitmask)
-// Bitmask: selected rows in segment (used when selected_num > (segment_row_cnt / 32))
+// selected rows in segment, kept compressed while the results of the ranges are combined with "AND", "OR" and "NOT"
 struct FilterResult {
-    using SelectedRows = std::variant<Vector<u32>, Bitmask>;
-
     const u32 segment_row_count_{};        // count of rows in segment, include deleted rows
     const u32 segment_row_actual_count_{}; // count of rows in segment, exclude deleted rows
-    SelectedRows selected_rows_;           // default to Vector<u32>()
+    Roaring selected_rows_;                // default to empty
 
     explicit FilterResult(u32 segment_row_count, u32 segment_row_actual_count)
         : segment_row_count_(segment_row_count), segment_row_actual_count_(segment_row_actual_count) {}
@@ -353,110 +362,33 @@ struct FilterResult {
     // NOTICE: this number can only be used to output logs, because it may keep reducing
     [[nodiscard]] inline u32 SegmentRowActualCount() const { return segment_row_actual_count_; }
 
-    // result after consider if_reverse_select_
-    [[nodiscard]] inline u32 SelectedNum() const {
-        return std::visit(Overload{[](const Vector<u32> &selected_rows) -> u32 { return selected_rows.size(); },
-                                   [](const Bitmask &bitmask) -> u32 { return bitmask.CountTrue(); }},
-                          selected_rows_);
-    }
+    [[nodiscard]] inline u32 SelectedNum() const { return selected_rows_.cardinality(); }
 
-    inline void MergeOr(FilterResult &other) {
-        // merge selected_rows_
-        std::visit(Overload{[](Bitmask &left_bitmask, const Bitmask &right_bitmask) { left_bitmask.MergeOr(right_bitmask); },
-                            [](Bitmask &left_bitmask, const Vector<u32> &right_selected_rows) {
-                                for (auto offset : right_selected_rows) {
-                                    left_bitmask.SetTrue(offset);
-                                }
-                            },
-                            [&](Vector<u32> &left_selected_rows, Bitmask &right_bitmask) {
-                                for (auto offset : left_selected_rows) {
-                                    right_bitmask.SetTrue(offset);
-                                }
-                                std::swap(selected_rows_, other.selected_rows_);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Vector<u32> &right_selected_rows) {
-                                const u32 left_size = left_selected_rows.size();
-                                const u32 right_size = right_selected_rows.size();
-                                u32 i = 0, j = 0;
-                                Vector<u32> merged_selected_rows;
-                                merged_selected_rows.reserve(left_size + right_size);
-                                while (i < left_size and j < right_size) {
-                                    if (left_selected_rows[i] < right_selected_rows[j]) {
-                                        merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                        ++i;
-                                    } else if (left_selected_rows[i] > right_selected_rows[j]) {
-                                        merged_selected_rows.emplace_back(right_selected_rows[j]);
-                                        ++j;
-                                    } else {
-                                        merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                        ++i;
-                                        ++j;
-                                    }
-                                }
-                                while (i < left_size) {
-                                    merged_selected_rows.emplace_back(left_selected_rows[i]);
-                                    ++i;
-                                }
-                                while (j < right_size) {
-                                    merged_selected_rows.emplace_back(right_selected_rows[j]);
-                                    ++j;
-                                }
-                                std::swap(merged_selected_rows, left_selected_rows);
-                            }},
-                   selected_rows_,
-                   other.selected_rows_);
-    }
+    inline void MergeOr(const FilterResult &other) { selected_rows_ |= other.selected_rows_; }
 
-    inline void MergeAnd(FilterResult &other) {
-        // merge selected_rows_
-        std::visit(Overload{[](Bitmask &left_bitmask, const Bitmask &right_bitmask) { left_bitmask.Merge(right_bitmask); },
-                            [&](Bitmask &left_bitmask, Vector<u32> &right_selected_rows) {
-                                // apply left bitmask as filter on right vector
-                                u32 new_right_size = 0;
-                                for (auto offset : right_selected_rows) {
-                                    if (left_bitmask.IsTrue(offset)) {
-                                        right_selected_rows[new_right_size++] = offset;
-                                    }
-                                }
-                                // possible: new_right_size = 0
-                                right_selected_rows.resize(new_right_size);
-                                std::swap(selected_rows_, other.selected_rows_);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Bitmask &right_bitmask) {
-                                // apply right bitmask as filter on left vector
-                                u32 new_left_size = 0;
-                                for (auto offset : left_selected_rows) {
-                                    if (right_bitmask.IsTrue(offset)) {
-                                        left_selected_rows[new_left_size++] = offset;
-                                    }
-                                }
-                                // possible: new_left_size = 0
-                                left_selected_rows.resize(new_left_size);
-                            },
-                            [](Vector<u32> &left_selected_rows, const Vector<u32> &right_selected_rows) {
-                                // apply right vector as filter on left vector
-                                const u32 right_size = right_selected_rows.size();
-                                u32 i = 0;
-                                u32 new_left_size = 0;
-                                for (u32 offset : left_selected_rows) {
-                                    while (i < right_size and right_selected_rows[i] < offset) {
-                                        ++i;
-                                    }
-                                    if (i < right_size and right_selected_rows[i] == offset) {
-                                        left_selected_rows[new_left_size++] = offset;
-                                        ++i;
-                                    }
-                                }
-                                // possible: new_left_size = 0
-                                left_selected_rows.resize(new_left_size);
-                            }},
-                   selected_rows_,
-                   other.selected_rows_);
-    }
+    inline void MergeAnd(const FilterResult &other) { selected_rows_ &= other.selected_rows_; }
+
+    // deleted rows are still selected, they are removed by the delete filter on output
+    inline void Not() { selected_rows_.flip(0, SegmentRowCount()); }
+
+    inline void SetEmptyResult() { selected_rows_ = Roaring(); }
 
-    inline void SetEmptyResult() {
-        // use empty vector
-        selected_rows_.emplace<Vector<u32>>();
+    // Vector<u32>: used when selected_num <= (segment_row_cnt / 32), i.e. size(Vector) <= size(Bitmask)
+    // Bitmask: used when selected_num > (segment_row_cnt / 32)
+    [[nodiscard]] std::variant<Vector<u32>, Bitmask> ToSelectedRows() const {
+        const u32 selected_num = SelectedNum();
+        if (selected_num <= 1024 or selected_num <= (std::bit_ceil(SegmentRowCount()) / 32)) {
+            Vector<u32> selected_rows(selected_num);
+            selected_rows_.toUint32Array(selected_rows.data());
+            return selected_rows;
+        }
+        Bitmask bitmask;
+        bitmask.Initialize(std::bit_ceil(SegmentRowCount()));
+        bitmask.SetAllFalse();
+        for (u32 segment_offset : selected_rows_) {
+            bitmask.SetTrue(segment_offset);
+        }
+        return bitmask;
     }
 
     template <typename ColumnValueType>
@@ -473,27 +405,13 @@ struct FilterResult {
         if (memory_secondary_index) {
             trunk_readers.emplace_back(MakeUnique<TrunkReaderM<ColumnValueType>>(segment_row_count, memory_secondary_index));
         }
-        u32 result_size = 0;
+        SetEmptyResult();
         for (auto &trunk_reader : trunk_readers) {
-            result_size += trunk_reader->GetResultCnt(interval_range);
-        }
-        // use array or bitmask for result
-        // use array when result_size <= 1024 or size of array (u32 type) <= size of bitmask
-        const bool use_array = result_size <= 1024 or result_size <= (std::bit_ceil(SegmentRowCount()) / 32);
-        // output result
-        if (use_array) {
-            auto &vec = selected_rows_.emplace<Vector<u32>>();
-            vec.reserve(result_size);
-        } else {
-            auto &bitmask = selected_rows_.emplace<Bitmask>();
-            bitmask.Initialize(std::bit_ceil(SegmentRowCount()));
-            bitmask.SetAllFalse();
-        }
-        for (auto &trunk_reader : trunk_readers) {
-            trunk_reader->OutPut(selected_rows_);
+            if (trunk_reader->GetResultCnt(interval_range) > 0) {
+                trunk_reader->OutPut(selected_rows_);
+            }
         }
-        std::visit(Overload{[](Vector<u32> &selected_rows) { std::sort(selected_rows.begin(), selected_rows.end()); }, [](Bitmask &) {}},
-                   selected_rows_);
+        selected_rows_.runOptimize();
     }
 
     inline void ExecuteSingleRange(const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
@@ -545,65 +463,31 @@ struct FilterResult {
         append_data_block();
         // 2. output
         // delete_filter: return false if the row is deleted
-        std::visit(Overload{[&](const Bitmask &bitmask) {
-                                u32 output_block_row_id = 0;
-                                DataBlock *output_block_ptr = output_data_blocks.back().get();
-                                // TODO: 64 bit in a loop?
-                                const u32 segment_row_count = SegmentRowCount();
-                                for (u32 segment_offset = 0; segment_offset < segment_row_count; ++segment_offset) {
-                                    if (bitmask.IsTrue(segment_offset)) {
-                                        if (!delete_filter(segment_offset)) {
-                                            // deleted
-                                            ++invalid_rows;
-                                            continue;
-                                        }
-                                        if (output_block_row_id == block_capacity) {
-                                            output_block_ptr->Finalize();
-                                            append_data_block();
-                                            output_block_ptr = output_data_blocks.back().get();
-                                            output_block_row_id = 0;
-                                        }
-                                        RowID row_id(segment_id, segment_offset);
-                                        output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
-                                        ++output_block_row_id;
-                                        ++output_rows;
-                                    }
-                                }
-                                output_block_ptr->Finalize();
-                                if (output_rows + invalid_rows != selected_row_num) {
-                                    String error_message = "FilterResult::Output(): output row num error.";
-                                    LOG_CRITICAL(error_message);
-                                    UnrecoverableError(error_message);
-                                }
-                            },
-                            [&](const Vector<u32> &selected_rows) {
-                                u32 output_block_row_id = 0;
-                                DataBlock *output_block_ptr = output_data_blocks.back().get();
-                                for (u32 segment_offset : selected_rows) {
-                                    if (!delete_filter(segment_offset)) {
-                                        // deleted
-                                        ++invalid_rows;
-                                        continue;
-                                    }
-                                    if (output_block_row_id == block_capacity) {
-                                        output_block_ptr->Finalize();
-                                        append_data_block();
-                                        output_block_ptr = output_data_blocks.back().get();
-                                        output_block_row_id = 0;
-                                    }
-                                    RowID row_id(segment_id, segment_offset);
-                                    output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
-                                    ++output_block_row_id;
-                                    ++output_rows;
-                                }
-                                output_block_ptr->Finalize();
-                                if (output_rows + invalid_rows != selected_row_num) {
-                                    String error_message = "FilterResult::Output(): output row num error.";
-                                    LOG_CRITICAL(error_message);
-                                    UnrecoverableError(error_message);
-                                }
-                            }},
-                   selected_rows_);
+        u32 output_block_row_id = 0;
+        DataBlock *output_block_ptr = output_data_blocks.back().get();
+        for (u32 segment_offset : selected_rows_) {
+            if (!delete_filter(segment_offset)) {
+                // deleted
+                ++invalid_rows;
+                continue;
+            }
+            if (output_block_row_id == block_capacity) {
+                output_block_ptr->Finalize();
+                append_data_block();
+                output_block_ptr = output_data_blocks.back().get();
+                output_block_row_id = 0;
+            }
+            RowID row_id(segment_id, segment_offset);
+            output_block_ptr->AppendValueByPtr(0, (ptr_t)&row_id);
+            ++output_block_row_id;
+            ++output_rows;
+        }
+        output_block_ptr->Finalize();
+        if (output_rows + invalid_rows != selected_row_num) {
+            String error_message = "FilterResult::Output(): output row num error.";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
         LOG_INFO(fmt::format("FilterResult::Output(): output rows: {}, invalid candidate rows: {}", output_rows, invalid_rows));
     }
 };
@@ -643,6 +527,16 @@ FilterResult SolveSecondaryIndexFilterInner(const Vector<FilterExecuteElem> &fil
                                         }
                                         break;
                                     }
+                                    case FilterExecuteCombineType::kNot: {
+                                        if (!result_stack.empty()) {
+                                            result_stack.back().Not();
+                                        } else {
+                                            String error_message = "SolveSecondaryIndexFilterInner(): filter result stack error.";
+                                            LOG_CRITICAL(error_message);
+                                            UnrecoverableError(error_message);
+                                        }
+                                        break;
+                                    }
                                 }
                             },
                             [&](const FilterExecuteSingleRange &single_range) {
@@ -672,7 +566,8 @@ std::variant<Vector<u32>, Bitmask> SolveSecondaryIndexFilter(const Vector<Filter
     }
     auto result =
         SolveSecondaryIndexFilterInner(filter_execute_command, column_index_map, segment_id, segment_row_count, segment_row_actual_count, txn);
-    return std::move(result.selected_rows_);
+    // the rows are decompressed only once, after all the ranges are combined
+    return result.ToSelectedRows();
 }
 
 void PhysicalIndexScan::ExecuteInternal(QueryContext *query_context, IndexScanOperatorState *index_scan_operator_state) const {
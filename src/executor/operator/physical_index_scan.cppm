@@ -52,9 +52,9 @@ public:
     explicit PhysicalIndexScan(u64 id,
                                SharedPtr<BaseTableRef> base_table_ref,
                                SharedPtr<BaseExpression> index_filter_qualified,
-                               HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
-                               Vector<FilterExecuteElem> &&filter_execute_command,
-                               UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                               const HashMap<ColumnID, TableIndexEntry *> &column_index_map,
+                               const Vector<FilterExecuteElem> &filter_execute_command,
+                               SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                SharedPtr<Vector<LoadMeta>> load_metas,
                                bool add_row_id = true);
 
@@ -101,7 +101,7 @@ private:
     // Commands used in ExecuteInternal()
     Vector<FilterExecuteElem> filter_execute_command_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
     bool add_row_id_{};
     mutable Vector<SizeT> column_ids_{};
@@ -28,9 +28,16 @@ import physical_operator_type;
 import operator_state;
 import expression_state;
 import data_block;
+import column_vector;
 import third_party;
 import expression_evaluator;
 import base_expression;
+import value_expression;
+import expression_type;
+import cast_function;
+import bound_cast_func;
+import value;
+import logical_type;
 import default_values;
 import status;
 import infinity_exception;
@@ -43,6 +50,24 @@ namespace infinity {
 void PhysicalInsert::Init() {}
 
 bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    SizeT inserted_row_count = column_data_.empty() ? ExecuteValues(query_context) : ExecuteColumns(query_context);
+
+    UniquePtr<String> result_msg = MakeUnique<String>(fmt::format("INSERTED {} Rows", inserted_row_count));
+    if (operator_state == nullptr) {
+        // Generate the result table
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        SharedPtr<TableDef> result_table_def_ptr = MakeShared<TableDef>(MakeShared<String>("default_db"), MakeShared<String>("Tables"), column_defs);
+        output_ = MakeShared<DataTable>(result_table_def_ptr, TableType::kDataTable);
+        output_->SetResultMsg(std::move(result_msg));
+    } else {
+        InsertOperatorState *insert_operator_state = static_cast<InsertOperatorState *>(operator_state);
+        insert_operator_state->result_msg_ = std::move(result_msg);
+    }
+    operator_state->SetComplete();
+    return true;
+}
+
+SizeT PhysicalInsert::ExecuteValues(QueryContext *query_context) {
     SizeT row_count = value_list_.size();
     SizeT column_count = value_list_[0].size();
     SizeT table_collection_column_count = table_entry_->ColumnCount();
@@ -51,14 +76,6 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
         LOG_CRITICAL(error_message);
         UnrecoverableError(error_message);
     }
-    if (row_count > DEFAULT_BLOCK_CAPACITY) {
-        // Fixme: insert batch can larger than 8192, but currently we limit it.
-        Status status = Status::UnexpectedError(fmt::format("Insert values row count {} is larger than default block capacity {}.", row_count, DEFAULT_BLOCK_CAPACITY));
-        LOG_ERROR(status.message());
-        RecoverableError(status);
-        //        UnrecoverableError(
-        //            fmt::format("Insert values row count {} is larger than default block capacity {}.", row_count, DEFAULT_BLOCK_CAPACITY));
-    }
 
     // Prepare the output block
     Vector<SharedPtr<DataType>> output_types;
@@ -70,40 +87,125 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
         output_types.emplace_back(MakeShared<DataType>(data_type));
     }
 
-    SharedPtr<DataBlock> output_block = DataBlock::Make();
-    output_block->Init(output_types);
     SharedPtr<DataBlock> output_block_tmp = DataBlock::Make();
     output_block_tmp->Init(output_types);
 
     ExpressionEvaluator evaluator;
     evaluator.Init(nullptr);
-    // Each cell's expression of a column may differ. So we have to evaluate each cell instead of column here.
-    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
-        for (SizeT expr_idx = 0; expr_idx < column_count; ++expr_idx) {
-            const SharedPtr<BaseExpression> &expr = value_list_[row_idx][expr_idx];
-            SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
-            evaluator.Execute(expr, expr_state, output_block_tmp->column_vectors[expr_idx]);
+    auto *txn = query_context->GetTxn();
+    for (SizeT block_begin = 0; block_begin < row_count; block_begin += DEFAULT_BLOCK_CAPACITY) {
+        SizeT block_end = std::min(row_count, block_begin + DEFAULT_BLOCK_CAPACITY);
+        SharedPtr<DataBlock> output_block = DataBlock::Make();
+        output_block->Init(output_types);
+        // Each cell's expression of a column may differ. So we have to evaluate each cell instead of column here.
+        for (SizeT row_idx = block_begin; row_idx < block_end; ++row_idx) {
+            for (SizeT expr_idx = 0; expr_idx < column_count; ++expr_idx) {
+                const SharedPtr<BaseExpression> &expr = value_list_[row_idx][expr_idx];
+                SharedPtr<ColumnVector> &column_vector = output_block->column_vectors[expr_idx];
+                if (expr->type() == ExpressionType::kValue) {
+                    // A literal of the column type needs no expression state
+                    static_cast<ValueExpression *>(expr.get())->AppendToChunk(column_vector);
+                    continue;
+                }
+                SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
+                evaluator.Execute(expr, expr_state, output_block_tmp->column_vectors[expr_idx]);
+                column_vector->AppendWith(*output_block_tmp->column_vectors[expr_idx], 0, 1);
+            }
+        }
+        output_block->Finalize();
+        txn->Append(table_entry_, output_block);
+    }
+    return row_count;
+}
+
+SizeT PhysicalInsert::ExecuteColumns(QueryContext *query_context) {
+    SizeT column_count = column_data_.size();
+    Vector<SharedPtr<DataType>> output_types;
+    output_types.reserve(column_count);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        output_types.emplace_back(table_entry_->GetColumnDefByID(column_idx)->column_type_);
+    }
+
+    // The default values are evaluated once for all rows
+    Map<SizeT, Value> default_values;
+    ExpressionEvaluator evaluator;
+    evaluator.Init(nullptr);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        const SharedPtr<BaseExpression> &expr = column_defaults_[column_idx];
+        if (expr.get() == nullptr) {
+            continue;
+        }
+        SharedPtr<ColumnVector> default_column = ColumnVector::Make(output_types[column_idx]);
+        default_column->Initialize(output_types[column_idx]->type() == LogicalType::kBoolean ? ColumnVectorType::kCompactBit : ColumnVectorType::kFlat);
+        SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
+        evaluator.Execute(expr, expr_state, default_column);
+        default_values.emplace(column_idx, default_column->GetValue(0));
+    }
+
+    Vector<Optional<BoundCastFunc>> casts(column_count);
+    for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+        const InsertColumnData *column_data = column_data_[column_idx];
+        if (column_data != nullptr && *column_data->data_type_ != *output_types[column_idx]) {
+            casts[column_idx] = CastFunction::GetBoundFunc(*column_data->data_type_, *output_types[column_idx]);
         }
-        output_block->AppendWith(output_block_tmp);
     }
-    output_block->Finalize();
 
     auto *txn = query_context->GetTxn();
-    txn->Append(table_entry_, output_block);
+    for (SizeT block_begin = 0; block_begin < row_count_; block_begin += DEFAULT_BLOCK_CAPACITY) {
+        SizeT block_row_count = std::min(row_count_ - block_begin, SizeT(DEFAULT_BLOCK_CAPACITY));
+        SharedPtr<DataBlock> output_block = DataBlock::Make();
+        output_block->Init(output_types);
+        for (SizeT column_idx = 0; column_idx < column_count; ++column_idx) {
+            SharedPtr<ColumnVector> &column_vector = output_block->column_vectors[column_idx];
+            const InsertColumnData *column_data = column_data_[column_idx];
+            if (column_data == nullptr) {
+                const Value &default_value = default_values.at(column_idx);
+                for (SizeT row_idx = 0; row_idx < block_row_count; ++row_idx) {
+                    column_vector->AppendValue(default_value);
+                }
+            } else if (!casts[column_idx].has_value()) {
+                CopyColumnData(*column_data, block_begin, block_row_count, *column_vector);
+            } else {
+                SharedPtr<ColumnVector> source_vector = ColumnVector::Make(column_data->data_type_);
+                source_vector->Initialize(column_data->data_type_->type() == LogicalType::kBoolean ? ColumnVectorType::kCompactBit
+                                                                                                   : ColumnVectorType::kFlat);
+                CopyColumnData(*column_data, block_begin, block_row_count, *source_vector);
+                CastParameters cast_parameters;
+                casts[column_idx]->function(source_vector, column_vector, block_row_count, cast_parameters);
+            }
+        }
+        output_block->Finalize();
+        txn->Append(table_entry_, output_block);
+    }
+    return row_count_;
+}
 
-    UniquePtr<String> result_msg = MakeUnique<String>(fmt::format("INSERTED {} Rows", output_block->row_count()));
-    if (operator_state == nullptr) {
-        // Generate the result table
-        Vector<SharedPtr<ColumnDef>> column_defs;
-        SharedPtr<TableDef> result_table_def_ptr = MakeShared<TableDef>(MakeShared<String>("default_db"), MakeShared<String>("Tables"), column_defs);
-        output_ = MakeShared<DataTable>(result_table_def_ptr, TableType::kDataTable);
-        output_->SetResultMsg(std::move(result_msg));
-    } else {
-        InsertOperatorState *insert_operator_state = static_cast<InsertOperatorState *>(operator_state);
-        insert_operator_state->result_msg_ = std::move(result_msg);
+void PhysicalInsert::CopyColumnData(const InsertColumnData &column_data, SizeT row_offset, SizeT row_count, ColumnVector &column_vector) {
+    const char *data = column_data.data_.data();
+    switch (column_data.data_type_->type()) {
+        case LogicalType::kBoolean: {
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                column_vector.buffer_->SetCompactBit(row_idx, data[row_offset + row_idx] != 0);
+            }
+            column_vector.Finalize(row_count);
+            break;
+        }
+        case LogicalType::kVarchar: {
+            const Vector<u32> &offsets = column_data.varchar_offsets_;
+            for (SizeT row_idx = row_offset; row_idx < row_offset + row_count; ++row_idx) {
+                std::string_view value(data + offsets[row_idx], offsets[row_idx + 1] - offsets[row_idx]);
+                column_vector.AppendByStringView(value, ',');
+            }
+            break;
+        }
+        default: {
+            // Fixed width values and embeddings are stored as they are packed
+            SizeT value_size = column_data.data_type_->Size();
+            std::memcpy(column_vector.data(), data + row_offset * value_size, row_count * value_size);
+            column_vector.Finalize(row_count);
+            break;
+        }
     }
-    operator_state->SetComplete();
-    return true;
 }
 
 } // namespace infinity
@@ -29,6 +29,8 @@ import table_entry;
 import internal_types;
 import data_type;
 import logger;
+import insert_statement;
+import column_vector;
 
 namespace infinity {
 
@@ -42,6 +44,16 @@ public:
         : PhysicalOperator(PhysicalOperatorType::kInsert, nullptr, nullptr, id, load_metas), table_entry_(table_entry),
           table_index_(table_index), value_list_(std::move(value_list)) {}
 
+    explicit PhysicalInsert(u64 id,
+                            TableEntry *table_entry,
+                            u64 table_index,
+                            Vector<const InsertColumnData *> column_data,
+                            Vector<SharedPtr<BaseExpression>> column_defaults,
+                            SizeT row_count,
+                            SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kInsert, nullptr, nullptr, id, load_metas), table_entry_(table_entry),
+          table_index_(table_index), column_data_(std::move(column_data)), column_defaults_(std::move(column_defaults)), row_count_(row_count) {}
+
     ~PhysicalInsert() override = default;
 
     void Init() override;
@@ -64,10 +76,23 @@ public:
     }
 
 private:
+    // Evaluate the value expressions into blocks of at most DEFAULT_BLOCK_CAPACITY rows
+    SizeT ExecuteValues(QueryContext *query_context);
+
+    // Copy the column buffers into blocks, casting a whole column vector at a time where the types differ
+    SizeT ExecuteColumns(QueryContext *query_context);
+
+    static void CopyColumnData(const InsertColumnData &column_data, SizeT row_offset, SizeT row_count, ColumnVector &column_vector);
+
     TableEntry *table_entry_{};
     u64 table_index_{};
     Vector<Vector<SharedPtr<BaseExpression>>> value_list_{};
 
+    // Columnar insert
+    Vector<const InsertColumnData *> column_data_{};
+    Vector<SharedPtr<BaseExpression>> column_defaults_{};
+    SizeT row_count_{};
+
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
 };
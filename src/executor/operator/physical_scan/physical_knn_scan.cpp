@@ -15,6 +15,7 @@
 module;
 
 #include <string>
+#include <type_traits>
 
 module physical_knn_scan;
 
@@ -66,6 +67,10 @@ import block_entry;
 import segment_index_entry;
 import segment_entry;
 import abstract_hnsw;
+import embedding_info;
+import data_type;
+import mlas_matrix_multiply;
+import vector_distance;
 
 namespace infinity {
 
@@ -196,7 +201,8 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
     TableEntry *table_entry = base_table_ref_->table_entry_ptr_;
     Map<u32, SharedPtr<SegmentIndexEntry>> index_entry_map;
 
-    {
+    // The memory indexes are recovered after the startup, the blocks are searched by brute force until then
+    if (table_entry->MemIndexReady()) {
         auto map_guard = table_entry->IndexMetaMap();
         for (auto &[index_name, table_index_meta] : *map_guard) {
             auto [table_index_entry, status] = table_index_meta->GetEntryNolock(txn_id, begin_ts);
@@ -270,52 +276,73 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         const BlockEntry *block_entry = block_column_entry->block_entry();
         const auto block_id = block_entry->block_id();
         const SegmentID segment_id = block_entry->GetSegmentEntry()->segment_id();
-        if (auto it = common_query_filter_->filter_result_.find(segment_id); it != common_query_filter_->filter_result_.end()) {
+        const auto row_count = block_entry->row_count();
+        Bitmask bitmask;
+        if (!common_query_filter_->BlockFilterResult(segment_id, block_id, row_count, bitmask)) {
+            // the filter excludes all rows of the block, skip reading its embeddings
+            ++operator_state->skip_stats_.skipped_blocks_;
+        } else {
             LOG_TRACE(fmt::format("KnnScan: {} brute force {}/{} not skipped after common_query_filter",
                                   knn_scan_function_data->task_id_,
                                   block_column_idx + 1,
                                   brute_task_n));
-            const auto row_count = block_entry->row_count();
             BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
 
-            // filter for segment
-            const std::variant<Vector<u32>, Bitmask> &filter_result = it->second;
-            Bitmask bitmask;
-            bitmask.Initialize(std::bit_ceil(row_count));
-            const u32 block_start_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-            const u32 block_end_offset = block_start_offset + row_count;
-            if (std::holds_alternative<Vector<u32>>(filter_result)) {
-                const Vector<u32> &filter_result_vector = std::get<Vector<u32>>(filter_result);
-                const auto it1 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_start_offset);
-                const auto it2 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_end_offset);
-                bitmask.SetAllFalse();
-                for (auto it = it1; it < it2; ++it) {
-                    bitmask.SetTrue(*it - block_start_offset);
-                }
-            } else {
-                u32 u64_start_offset = block_start_offset / 64;
-                u32 u64_end_offset = (block_end_offset - 1) / 64;
-                if (const u64 *filter_data = std::get<Bitmask>(filter_result).GetData(); filter_data) {
-                    bitmask.SetAllFalse();
-                    u64 *data = bitmask.GetData();
-                    for (u32 i = u64_start_offset; i <= u64_end_offset; ++i) {
-                        data[i - u64_start_offset] = filter_data[i];
-                    }
-                }
-            }
             block_entry->SetDeleteBitmask(begin_ts, bitmask);
 
             ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
 
-            auto data = reinterpret_cast<const DataType *>(column_vector.data());
-            merge_heap->Search(query,
-                               data,
-                               knn_scan_shared_data->dimension_,
-                               dist_func->dist_func_,
-                               row_count,
-                               block_entry->segment_id(),
-                               block_entry->block_id(),
-                               bitmask);
+            auto BruteForceSearch = [&]<typename ColumnDataType>(auto column_dist_func) {
+                auto data = reinterpret_cast<const ColumnDataType *>(column_vector.data());
+                if constexpr (std::is_same_v<ColumnDataType, f32> && std::is_same_v<DataType, f32>) {
+                    if (knn_scan_shared_data->query_count_ > 1) {
+                        // a batch of queries scores the block with one GEMM instead of query_count scans
+                        const SizeT query_n = knn_scan_shared_data->query_count_;
+                        const SizeT dimension = knn_scan_shared_data->dimension_;
+                        auto dist_matrix = MakeUniqueForOverwrite<f32[]>(query_n * row_count);
+                        matrixA_multiply_transpose_matrixB_output_to_C(query, data, query_n, row_count, dimension, dist_matrix.get());
+                        if (knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kL2) {
+                            // |q - x|^2 = |q|^2 + |x|^2 - 2 <q, x>
+                            auto query_norms = MakeUniqueForOverwrite<f32[]>(query_n);
+                            auto data_norms = MakeUniqueForOverwrite<f32[]>(row_count);
+                            L2NormsSquares(query_norms.get(), query, dimension, query_n);
+                            L2NormsSquares(data_norms.get(), data, dimension, row_count);
+                            for (SizeT i = 0; i < query_n; ++i) {
+                                f32 *dist_i = dist_matrix.get() + i * row_count;
+                                for (SizeT j = 0; j < row_count; ++j) {
+                                    dist_i[j] = std::max(0.0f, query_norms[i] + data_norms[j] - 2 * dist_i[j]);
+                                }
+                            }
+                        }
+                        merge_heap->Search(dist_matrix.get(), row_count, block_entry->segment_id(), block_entry->block_id(), bitmask);
+                        return;
+                    }
+                }
+                merge_heap->Search(query,
+                                   data,
+                                   knn_scan_shared_data->dimension_,
+                                   column_dist_func,
+                                   row_count,
+                                   block_entry->segment_id(),
+                                   block_entry->block_id(),
+                                   bitmask);
+            };
+            // the query is always f32, the column may store half precision elements
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(block_column_entry->column_type()->type_info().get());
+            switch (embedding_info->Type()) {
+                case kElemFloat16: {
+                    BruteForceSearch.template operator()<Float16T>(dist_func->f16_dist_func_);
+                    break;
+                }
+                case kElemBFloat16: {
+                    BruteForceSearch.template operator()<BFloat16T>(dist_func->bf16_dist_func_);
+                    break;
+                }
+                default: {
+                    BruteForceSearch.template operator()<DataType>(dist_func->dist_func_);
+                    break;
+                }
+            }
         }
     } else if (u64 index_idx = knn_scan_shared_data->current_index_idx_++; index_idx < index_task_n) {
         LOG_TRACE(fmt::format("KnnScan: {} index {}/{}", knn_scan_function_data->task_id_, index_idx + 1, index_task_n));
@@ -332,7 +359,10 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         } else {
             segment_entry = iter->second.segment_entry_;
         }
-        if (auto it = common_query_filter_->filter_result_.find(segment_id); it != common_query_filter_->filter_result_.end()) {
+        if (auto it = common_query_filter_->filter_result_.find(segment_id); it == common_query_filter_->filter_result_.end()) {
+            // the filter excludes all rows of the segment, skip searching its index
+            ++operator_state->skip_stats_.skipped_segments_;
+        } else {
             LOG_TRACE(fmt::format("KnnScan: {} index {}/{} not skipped after common_query_filter",
                                   knn_scan_function_data->task_id_,
                                   index_idx + 1,
@@ -366,16 +396,17 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                         ann_ivfflat_query.Begin();
                         ann_ivfflat_query.Search(index, segment_id, n_probes, std::forward<OptionalFilter>(filter)...);
                         ann_ivfflat_query.EndWithoutSort();
-                        auto dists = ann_ivfflat_query.GetDistances();
-                        auto row_ids = ann_ivfflat_query.GetIDs();
-                        // TODO: now only work for one query
-                        // FIXME: cant work for multiple queries
-                        auto result_count = std::lower_bound(dists,
-                                                             dists + knn_scan_shared_data->topk_,
-                                                             AnnIVFFlatType::InvalidValue(),
-                                                             AnnIVFFlatType::CompareDist) -
-                                            dists;
-                        merge_heap->Search(dists, row_ids, result_count);
+                        // the results of every query fill the front of its topk slots, the rest hold the invalid value
+                        for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                            auto dists = ann_ivfflat_query.GetDistanceByIdx(query_idx);
+                            auto row_ids = ann_ivfflat_query.GetIDByIdx(query_idx);
+                            auto result_count = std::lower_bound(dists,
+                                                                 dists + knn_scan_shared_data->topk_,
+                                                                 AnnIVFFlatType::InvalidValue(),
+                                                                 AnnIVFFlatType::CompareDist) -
+                                                dists;
+                            merge_heap->Search(query_idx, dists, row_ids, result_count);
+                        }
                     };
                     auto IVFFlatScan = [&]<typename... OptionalFilter>(OptionalFilter &&...filter) {
                         switch (knn_scan_shared_data->knn_distance_type_) {
@@ -426,7 +457,6 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                             }
                         }
 
-                        i64 result_n = -1;
                         for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
                             const DataType *query =
                                 static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * knn_scan_shared_data->dimension_;
@@ -460,13 +490,8 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                                 }
                             }
 
-                            if (result_n < 0) {
-                                result_n = result_n1;
-                            } else if (result_n != (i64)result_n1) {
-                                String error_message = "KnnScan: result_n mismatch";
-                                LOG_CRITICAL(error_message);
-                                UnrecoverableError(error_message);
-                            }
+                            // the filtered searches of the queries in a batch can find different numbers of results
+                            i64 result_n = result_n1;
 
                             switch (knn_scan_shared_data->knn_distance_type_) {
                                 case KnnDistanceType::kInvalid: {
@@ -499,7 +524,7 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                                     UnrecoverableError(error_message);
                                 } // this is for debug
                             }
-                            merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
+                            merge_heap->Search(query_idx, d_ptr.get(), row_ids.get(), result_n);
                         }
                     };
 
@@ -531,17 +556,18 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         // all task Complete
 
         merge_heap->End();
-        i64 result_n = std::min(knn_scan_shared_data->topk_, merge_heap->total_count());
 
         SizeT query_n = knn_scan_shared_data->query_count_;
         Vector<char *> result_dists_list;
         Vector<RowID *> row_ids_list;
+        Vector<i64> result_n_list;
         for (SizeT query_id = 0; query_id < query_n; ++query_id) {
             result_dists_list.emplace_back(reinterpret_cast<char *>(merge_heap->GetDistancesByIdx(query_id)));
             row_ids_list.emplace_back(merge_heap->GetIDsByIdx(query_id));
+            result_n_list.emplace_back(std::min(knn_scan_shared_data->topk_, merge_heap->total_count(query_id)));
         }
 
-        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n, query_context, operator_state);
+        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n_list, query_context, operator_state);
         operator_state->SetComplete();
     }
 }
@@ -48,6 +48,8 @@ import merge_knn;
 import match_sparse_scan_function_data;
 import fix_heap;
 import global_block_id;
+import bitmask;
+import txn;
 
 namespace infinity {
 
@@ -171,6 +173,12 @@ void PhysicalMatchSparseScan::ExecuteInner(QueryContext *query_context, MatchSpa
     SizeT query_n = match_sparse_expr_->query_n_;
     SizeT topn = match_sparse_expr_->topn_;
 
+    Txn *txn = query_context->GetTxn();
+    if (!common_query_filter_->TryFinishBuild(txn)) {
+        // not ready, abort and wait for next time
+        return;
+    }
+
     MatchSparseScanFunctionData &function_data = match_sparse_scan_state->match_sparse_scan_function_data_;
     if (function_data.merge_knn_base_.get() == nullptr) {
         auto merge_knn = MakeUnique<MergeKnn<DataType, C>>(query_n, topn);
@@ -192,26 +200,34 @@ void PhysicalMatchSparseScan::ExecuteInner(QueryContext *query_context, MatchSpa
         const BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
         LOG_DEBUG(fmt::format("MatchSparseScan: segment_id: {}, block_id: {}", segment_id, block_id));
 
-        auto *block_column_entry = block_entry->GetColumnBlockEntry(search_column_id_);
-        auto column_vector = block_column_entry->GetColumnVector(buffer_mgr);
+        Bitmask bitmask;
+        if (!common_query_filter_->BlockFilterResult(segment_id, block_id, row_cnt, bitmask)) {
+            // the filter excludes all rows of the block, skip reading its sparse vectors
+            ++match_sparse_scan_state->skip_stats_.skipped_blocks_;
+        } else {
+            block_entry->SetDeleteBitmask(txn->BeginTS(), bitmask);
+            auto *block_column_entry = block_entry->GetColumnBlockEntry(search_column_id_);
+            auto column_vector = block_column_entry->GetColumnVector(buffer_mgr);
 
-        CalculateOnColumnVector<DataType, IdxType, CompareMin>(column_vector, segment_id, block_id, row_cnt, function_data);
+            CalculateOnColumnVector<DataType, IdxType, CompareMin>(column_vector, segment_id, block_id, row_cnt, bitmask, function_data);
+        }
     }
     if (block_ids_idx >= block_ids.size()) {
         LOG_DEBUG(fmt::format("MatchSparseScan: {} task finished", block_ids_idx));
 
         auto *merge_heap = static_cast<MergeKnn<DataType, C> *>(function_data.merge_knn_base_.get());
         merge_heap->End();
-        i64 result_n = std::min(topn, (SizeT)merge_heap->total_count());
 
         Vector<char *> result_dists_list;
         Vector<RowID *> row_ids_list;
+        Vector<i64> result_n_list;
         for (SizeT query_id = 0; query_id < query_n; ++query_id) {
             result_dists_list.push_back(reinterpret_cast<char *>(merge_heap->GetDistancesByIdx(query_id)));
             row_ids_list.push_back(merge_heap->GetIDsByIdx(query_id));
+            result_n_list.emplace_back(std::min(topn, (SizeT)merge_heap->total_count(query_id)));
         }
 
-        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n, query_context, match_sparse_scan_state);
+        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n_list, query_context, match_sparse_scan_state);
 
         match_sparse_scan_state->SetComplete();
     }
@@ -222,6 +238,7 @@ void PhysicalMatchSparseScan::CalculateOnColumnVector(const ColumnVector &column
                                                       SegmentID segment_id,
                                                       BlockID block_id,
                                                       BlockOffset row_cnt,
+                                                      const Bitmask &bitmask,
                                                       MatchSparseScanFunctionData &function_data) {
     auto *dist_func = static_cast<SparseDistance<DataType, IdxType> *>(function_data.sparse_distance_.get());
     auto *merge_heap = static_cast<MergeKnn<DataType, C> *>(function_data.merge_knn_base_.get());
@@ -237,6 +254,9 @@ void PhysicalMatchSparseScan::CalculateOnColumnVector(const ColumnVector &column
         const auto *data_begin = reinterpret_cast<const SparseT *>(column_vector.data());
         FixHeapManager *heap_mgr = column_vector.buffer_->fix_heap_mgr_.get();
         for (BlockOffset i = 0; i < row_cnt; ++i) {
+            if (!bitmask.IsTrue(i)) {
+                continue;
+            }
             const auto *data = data_begin + i;
             const auto &[nnz, chunk_id, chunk_offset] = *data;
             const char *sparse_ptr = heap_mgr->GetRawPtrFromChunk(chunk_id, chunk_offset);
@@ -29,6 +29,7 @@ import physical_scan_base;
 import sparse_info;
 import match_sparse_expr;
 import match_sparse_scan_function_data;
+import bitmask;
 
 namespace infinity {
 struct LoadMeta;
@@ -63,7 +64,12 @@ private:
     void ExecuteInner(QueryContext *query_context, MatchSparseScanOperatorState *operator_state);
 
     template <typename DataType, typename IdxType, template <typename, typename> typename C>
-    void CalculateOnColumnVector(const ColumnVector &column_vector, SegmentID segment_id, BlockID block_id, BlockOffset row_cnt, MatchSparseScanFunctionData &function_data);
+    void CalculateOnColumnVector(const ColumnVector &column_vector,
+                                 SegmentID segment_id,
+                                 BlockID block_id,
+                                 BlockOffset row_cnt,
+                                 const Bitmask &bitmask,
+                                 MatchSparseScanFunctionData &function_data);
 
 private:
     u64 table_index_ = 0;
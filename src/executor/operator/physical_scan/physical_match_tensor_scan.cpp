@@ -15,6 +15,7 @@
 module;
 
 #include <string>
+#include <type_traits>
 #include <vector>
 module physical_match_tensor_scan;
 
@@ -58,7 +59,7 @@ import type_info;
 import embedding_info;
 import buffer_manager;
 import match_tensor_scan_function_data;
-import mlas_matrix_multiply;
+import maxsim_simd_funcs;
 import physical_fusion;
 import filter_value_type_classification;
 
@@ -172,34 +173,12 @@ void PhysicalMatchTensorScan::ExecuteInner(QueryContext *query_context, MatchTen
         ++block_ids_idx;
         const auto [segment_id, block_id] = block_ids[task_id];
         const BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
-        if (auto it_filter = common_query_filter_->filter_result_.find(segment_id); it_filter != common_query_filter_->filter_result_.end()) {
-            // not skipped after common_query_filter
-            const u32 row_count = block_entry->row_count();
-            // filter for segment
-            const std::variant<Vector<u32>, Bitmask> &filter_result = it_filter->second;
-            Bitmask bitmask;
-            bitmask.Initialize(std::bit_ceil(row_count));
-            const u32 block_start_offset = block_id * DEFAULT_BLOCK_CAPACITY;
-            const u32 block_end_offset = block_start_offset + row_count;
-            if (std::holds_alternative<Vector<u32>>(filter_result)) {
-                const Vector<u32> &filter_result_vector = std::get<Vector<u32>>(filter_result);
-                const auto it1 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_start_offset);
-                const auto it2 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_end_offset);
-                bitmask.SetAllFalse();
-                for (auto it = it1; it < it2; ++it) {
-                    bitmask.SetTrue(*it - block_start_offset);
-                }
-            } else {
-                u32 u64_start_offset = block_start_offset / 64;
-                u32 u64_end_offset = (block_end_offset - 1) / 64;
-                if (const u64 *filter_data = std::get<Bitmask>(filter_result).GetData(); filter_data) {
-                    bitmask.SetAllFalse();
-                    u64 *data = bitmask.GetData();
-                    for (u32 i = u64_start_offset; i <= u64_end_offset; ++i) {
-                        data[i - u64_start_offset] = filter_data[i];
-                    }
-                }
-            }
+        const u32 row_count = block_entry->row_count();
+        Bitmask bitmask;
+        if (!common_query_filter_->BlockFilterResult(segment_id, block_id, row_count, bitmask)) {
+            // the filter excludes all rows of the block, skip reading its tensors
+            ++operator_state->skip_stats_.skipped_blocks_;
+        } else {
             block_entry->SetDeleteBitmask(begin_ts, bitmask);
             auto *block_column_entry = block_entry->GetColumnBlockEntry(search_column_id);
             auto column_vector = block_column_entry->GetColumnVector(buffer_mgr);
@@ -262,157 +241,30 @@ void PhysicalMatchTensorScan::ExecuteInner(QueryContext *query_context, MatchTen
 }
 
 template <typename TensorElemT, typename QueryElemT>
-struct MaxSimOp;
-
-template <>
-struct MaxSimOp<float, float> {
-    static float Score(const char *query_tensor_ptr,
-                       const char *target_tensor_ptr,
-                       const u32 query_embedding_num,
-                       const u32 target_embedding_num,
-                       const u32 basic_embedding_dimension) {
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        matrixA_multiply_transpose_matrixB_output_to_C(reinterpret_cast<const float *>(query_tensor_ptr),
-                                                       reinterpret_cast<const float *>(target_tensor_ptr),
-                                                       query_embedding_num,
-                                                       target_embedding_num,
-                                                       basic_embedding_dimension,
-                                                       output_ptr.get());
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            const float *query_ip_ptr = output_ptr.get() + query_i * target_embedding_num;
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 k = 0; k < target_embedding_num; ++k) {
-                max_score_i = std::max(max_score_i, query_ip_ptr[k]);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
-    }
-};
-
-template <typename TensorElemT, typename QueryElemT>
-    requires(!std::is_same_v<TensorElemT, bool> && !std::is_same_v<QueryElemT, bool>)
-struct MaxSimOp<TensorElemT, QueryElemT> {
-    static float Score(const char *raw_query_tensor_ptr,
-                       const char *raw_target_tensor_ptr,
-                       const u32 query_embedding_num,
-                       const u32 target_embedding_num,
-                       const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const QueryElemT *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const TensorElemT *>(raw_target_tensor_ptr);
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * basic_embedding_dimension;
-                const auto target_ptr = target_tensor_ptr + target_j * basic_embedding_dimension;
-                float score_ij = 0.0f;
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    score_ij += static_cast<float>(query_ptr[k]) * static_cast<float>(target_ptr[k]);
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
-    }
-};
-
-template <>
-struct MaxSimOp<bool, bool> {
-    static float Score(const char *raw_query_tensor_ptr,
-                       const char *raw_target_tensor_ptr,
-                       const u32 query_embedding_num,
-                       const u32 target_embedding_num,
-                       const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const u8 *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const u8 *>(raw_target_tensor_ptr);
-        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            u32 max_score_i = 0;
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * unit_embedding_bytes;
-                const auto target_ptr = target_tensor_ptr + target_j * unit_embedding_bytes;
-                u32 score_ij = 0;
-                auto is_true = [](const u8 *ptr, const u32 k) -> bool { return ptr[k / 8] & (1u << (k % 8)); };
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    if (is_true(query_ptr, k) && is_true(target_ptr, k)) {
-                        ++score_ij;
-                    }
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
-    }
-};
-
-template <typename QueryElemT>
-struct MaxSimOp<bool, QueryElemT> {
-    static float Score(const char *raw_query_tensor_ptr,
-                       const char *raw_target_tensor_ptr,
-                       const u32 query_embedding_num,
-                       const u32 target_embedding_num,
-                       const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const QueryElemT *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const u8 *>(raw_target_tensor_ptr);
-        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * basic_embedding_dimension;
-                const auto target_ptr = target_tensor_ptr + target_j * unit_embedding_bytes;
-                float score_ij = 0.0f;
-                auto is_true = [](const u8 *ptr, const u32 k) -> bool { return ptr[k / 8] & (1u << (k % 8)); };
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    if (is_true(target_ptr, k)) {
-                        score_ij += static_cast<float>(query_ptr[k]);
-                    }
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
-        }
-        return maxsim_score;
-    }
-};
-
-template <typename TensorElemT>
-struct MaxSimOp<TensorElemT, bool> {
+struct MaxSimOp {
     static float Score(const char *raw_query_tensor_ptr,
                        const char *raw_target_tensor_ptr,
                        const u32 query_embedding_num,
                        const u32 target_embedding_num,
                        const u32 basic_embedding_dimension) {
-        const auto query_tensor_ptr = reinterpret_cast<const u8 *>(raw_query_tensor_ptr);
-        const auto target_tensor_ptr = reinterpret_cast<const TensorElemT *>(raw_target_tensor_ptr);
-        const auto unit_embedding_bytes = basic_embedding_dimension / 8;
-        auto output_ptr = MakeUniqueForOverwrite<float[]>(query_embedding_num * target_embedding_num);
-        float maxsim_score = 0.0f;
-        for (u32 query_i = 0; query_i < query_embedding_num; ++query_i) {
-            float max_score_i = std::numeric_limits<float>::lowest();
-            for (u32 target_j = 0; target_j < target_embedding_num; ++target_j) {
-                const auto query_ptr = query_tensor_ptr + query_i * unit_embedding_bytes;
-                const auto target_ptr = target_tensor_ptr + target_j * basic_embedding_dimension;
-                float score_ij = 0.0f;
-                auto is_true = [](const u8 *ptr, const u32 k) -> bool { return ptr[k / 8] & (1u << (k % 8)); };
-                for (u32 k = 0; k < basic_embedding_dimension; ++k) {
-                    if (is_true(query_ptr, k)) {
-                        score_ij += static_cast<float>(target_ptr[k]);
-                    }
-                }
-                max_score_i = std::max(max_score_i, score_ij);
-            }
-            maxsim_score += max_score_i;
+        // bit tensors are stored as packed bits
+        using QueryT = std::conditional_t<std::is_same_v<QueryElemT, bool>, u8, QueryElemT>;
+        using TargetT = std::conditional_t<std::is_same_v<TensorElemT, bool>, u8, TensorElemT>;
+        const auto query_tensor_ptr = reinterpret_cast<const QueryT *>(raw_query_tensor_ptr);
+        const auto target_tensor_ptr = reinterpret_cast<const TargetT *>(raw_target_tensor_ptr);
+        if constexpr (std::is_same_v<TensorElemT, float> && std::is_same_v<QueryElemT, float>) {
+            return MaxSimF32(query_tensor_ptr, target_tensor_ptr, query_embedding_num, target_embedding_num, basic_embedding_dimension);
+        } else if constexpr (std::is_same_v<TensorElemT, i8> && std::is_same_v<QueryElemT, i8>) {
+            return MaxSimI8(query_tensor_ptr, target_tensor_ptr, query_embedding_num, target_embedding_num, basic_embedding_dimension);
+        } else if constexpr (std::is_same_v<TensorElemT, bool> && std::is_same_v<QueryElemT, bool>) {
+            return MaxSimBit(query_tensor_ptr, target_tensor_ptr, query_embedding_num, target_embedding_num, basic_embedding_dimension);
+        } else if constexpr (std::is_same_v<TensorElemT, bool>) {
+            return MaxSimDenseBit(query_tensor_ptr, target_tensor_ptr, query_embedding_num, target_embedding_num, basic_embedding_dimension);
+        } else if constexpr (std::is_same_v<QueryElemT, bool>) {
+            return MaxSimBitDense(query_tensor_ptr, target_tensor_ptr, query_embedding_num, target_embedding_num, basic_embedding_dimension);
+        } else {
+            return MaxSimGeneric(query_tensor_ptr, target_tensor_ptr, query_embedding_num, target_embedding_num, basic_embedding_dimension);
         }
-        return maxsim_score;
     }
 };
 
@@ -442,7 +294,9 @@ struct CalcutateScoreOfTensorArrayRow {
         FixHeapManager *tensor_array_heap_mgr = column_vector.buffer_->fix_heap_mgr_.get();
         FixHeapManager *tensor_heap_mgr = column_vector.buffer_->fix_heap_mgr_1_.get();
         const auto [tensor_num, tensor_array_chunk_id, tensor_array_chunk_offset] = tensor_array_ptr[block_offset];
-        Vector<TensorT> tensors(tensor_num);
+        // reused by all rows scored on this thread
+        static thread_local Vector<TensorT> tensors;
+        tensors.resize(tensor_num);
         tensor_array_heap_mgr->ReadFromHeap(reinterpret_cast<char *>(tensors.data()),
                                             tensor_array_chunk_id,
                                             tensor_array_chunk_offset,
@@ -577,6 +431,13 @@ void ElemTypeDispatch(Params &parameter_pack, EmbeddingDataType type_enum, Args.
         case EmbeddingDataType::kElemDouble: {
             return ElemTypeDispatch<ExecuteT, AddTypeList<Typelist, TypeList<double>>>(parameter_pack, extra_types...);
         }
+        case EmbeddingDataType::kElemFloat16:
+        case EmbeddingDataType::kElemBFloat16: {
+            Status status = Status::NotSupport("Half precision tensor element type is not supported in MatchTensor.");
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+            return;
+        }
         case EmbeddingDataType::kElemInvalid: {
             const auto error_message = "Invalid embedding data type!";
             LOG_CRITICAL(error_message);
@@ -115,20 +115,31 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
     auto dists = reinterpret_cast<DataType *>(dist_column.data());
     auto row_ids = reinterpret_cast<RowID *>(row_id_column.data());
     SizeT row_n = input_data.row_count();
-    merge_knn->Search(dists, row_ids, row_n);
+    // every scan task outputs its results grouped by query in one data block, each query has the same count.
+    // A query with fewer results than the others is padded at the end of its group with invalid row ids.
+    SizeT query_n = merge_knn_data.query_count_;
+    SizeT row_n_per_query = row_n / query_n;
+    for (SizeT query_id = 0; query_id < query_n; ++query_id) {
+        const RowID *query_row_ids = row_ids + query_id * row_n_per_query;
+        SizeT result_n = row_n_per_query;
+        while (result_n > 0 && query_row_ids[result_n - 1].segment_id_ == INVALID_SEGMENT_ID) {
+            --result_n;
+        }
+        merge_knn->Search(query_id, dists + query_id * row_n_per_query, query_row_ids, result_n);
+    }
 
     if (merge_knn_state->input_complete_) {
         merge_knn->End(); // reorder the heap
-        i64 result_n = std::min(merge_knn_data.topk_, merge_knn->total_count());
 
-        SizeT query_n = merge_knn_data.query_count_;
         Vector<char *> result_dists_list;
         Vector<RowID *> row_ids_list;
+        Vector<i64> result_n_list;
         for (SizeT query_id = 0; query_id < query_n; ++query_id) {
             result_dists_list.emplace_back(reinterpret_cast<char *>(merge_knn->GetDistancesByIdx(query_id)));
             row_ids_list.emplace_back(merge_knn->GetIDsByIdx(query_id));
+            result_n_list.emplace_back(std::min(merge_knn_data.topk_, merge_knn->total_count(query_id)));
         }
-        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n, query_context, merge_knn_state);
+        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n_list, query_context, merge_knn_state);
         merge_knn_state->SetComplete();
     }
 }
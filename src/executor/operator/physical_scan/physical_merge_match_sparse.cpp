@@ -132,15 +132,16 @@ void PhysicalMergeMatchSparse::ExecuteInner(QueryContext *query_context, MergeMa
 
     if (operator_state->input_complete_) {
         merge_knn->End(); // reorder the heap
-        i64 result_n = std::min(topn, (SizeT)merge_knn->total_count());
 
         Vector<char *> result_dists_list;
         Vector<RowID *> row_ids_list;
+        Vector<i64> result_n_list;
         for (SizeT query_id = 0; query_id < query_n; ++query_id) {
             result_dists_list.emplace_back(reinterpret_cast<char *>(merge_knn->GetDistancesByIdx(query_id)));
             row_ids_list.emplace_back(merge_knn->GetIDsByIdx(query_id));
+            result_n_list.emplace_back(std::min(topn, (SizeT)merge_knn->total_count(query_id)));
         }
-        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n, query_context, operator_state);
+        this->SetOutput(result_dists_list, row_ids_list, sizeof(DataType), result_n_list, query_context, operator_state);
         operator_state->SetComplete();
     }
 }
@@ -80,33 +80,64 @@ BlockIndex *PhysicalScanBase::GetBlockIndex() const { return base_table_ref_->bl
 void PhysicalScanBase::SetOutput(const Vector<char *> &raw_result_dists_list,
                                  const Vector<RowID *> &row_ids_list,
                                  SizeT result_size,
-                                 i64 result_n,
+                                 const Vector<i64> &result_n_list,
                                  QueryContext *query_context,
                                  OperatorState *operator_state) {
     BlockIndex *block_index = base_table_ref_->block_index_.get();
     SizeT query_n = raw_result_dists_list.size();
+    i64 padded_result_n = late_materialize_ ? *std::max_element(result_n_list.begin(), result_n_list.end()) : 0;
 
+    SizeT total_data_row_count = 0;
+    for (i64 result_n : result_n_list) {
+        total_data_row_count += late_materialize_ ? padded_result_n : result_n;
+    }
     {
-        SizeT total_data_row_count = query_n * result_n;
         SizeT row_idx = 0;
         do {
             auto data_block = DataBlock::MakeUniquePtr();
             data_block->Init(*GetOutputTypes());
+            if (late_materialize_) {
+                // empty constant vectors keep the column positions of the columns read by the merge operator
+                for (SizeT i = 0; i < base_table_ref_->column_ids_.size(); ++i) {
+                    auto placeholder = ColumnVector::Make(data_block->column_vectors[i]->data_type());
+                    placeholder->Initialize(ColumnVectorType::kConstant);
+                    data_block->column_vectors[i] = std::move(placeholder);
+                }
+            }
             operator_state->data_block_array_.emplace_back(std::move(data_block));
             row_idx += DEFAULT_BLOCK_CAPACITY;
         } while (row_idx < total_data_row_count);
     }
     auto *buffer_mgr = query_context->storage()->buffer_manager();
 
+    // the results of a query are ordered by score, not by position, the columns of every block are read once and kept for its other results
+    SizeT column_n = late_materialize_ ? 0 : base_table_ref_->column_ids_.size();
+    HashMap<BlockEntry *, Vector<ColumnVector>> block_columns;
+
     SizeT output_block_row_id = 0;
     SizeT output_block_idx = 0;
     DataBlock *output_block_ptr = operator_state->data_block_array_[output_block_idx].get();
     for (SizeT query_idx = 0; query_idx < query_n; ++query_idx) {
         char *raw_result_dists = raw_result_dists_list[query_idx];
         RowID *row_ids = row_ids_list[query_idx];
-        for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
-            SizeT id = query_n * query_idx + top_idx;
-
+        i64 result_n = result_n_list[query_idx];
+        i64 output_n = late_materialize_ ? padded_result_n : result_n;
+        for (i64 top_idx = 0; top_idx < output_n; ++top_idx) {
+            if (output_block_row_id == DEFAULT_BLOCK_CAPACITY) {
+                output_block_ptr->Finalize();
+                ++output_block_idx;
+                output_block_ptr = operator_state->data_block_array_[output_block_idx].get();
+                output_block_row_id = 0;
+            }
+            SizeT dist_column_idx = base_table_ref_->column_ids_.size();
+            if (top_idx >= result_n) {
+                // the merge operator drops the padding rows by their invalid row id, their distance is never read
+                RowID padding_row_id;
+                output_block_ptr->AppendValueByPtr(dist_column_idx, raw_result_dists);
+                output_block_ptr->AppendValueByPtr(dist_column_idx + 1, (ptr_t)&padding_row_id);
+                ++output_block_row_id;
+                continue;
+            }
             SegmentID segment_id = row_ids[top_idx].segment_id_;
             SegmentOffset segment_offset = row_ids[top_idx].segment_offset_;
             BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
@@ -119,23 +150,22 @@ void PhysicalScanBase::SetOutput(const Vector<char *> &raw_result_dists_list,
                 UnrecoverableError(error_message);
             }
 
-            if (output_block_row_id == DEFAULT_BLOCK_CAPACITY) {
-                output_block_ptr->Finalize();
-                ++output_block_idx;
-                output_block_ptr = operator_state->data_block_array_[output_block_idx].get();
-                output_block_row_id = 0;
-            }
-
-            SizeT column_n = base_table_ref_->column_ids_.size();
-            for (SizeT i = 0; i < column_n; ++i) {
-                SizeT column_id = base_table_ref_->column_ids_[i];
-                auto *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
-                ColumnVector &&column_vector = block_column_entry->GetColumnVector(buffer_mgr);
-
-                output_block_ptr->column_vectors[i]->AppendWith(column_vector, block_offset, 1);
+            if (column_n > 0) {
+                auto [iter, inserted] = block_columns.try_emplace(block_entry);
+                Vector<ColumnVector> &column_vectors = iter->second;
+                if (inserted) {
+                    column_vectors.reserve(column_n);
+                    for (SizeT i = 0; i < column_n; ++i) {
+                        SizeT column_id = base_table_ref_->column_ids_[i];
+                        column_vectors.emplace_back(block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr));
+                    }
+                }
+                for (SizeT i = 0; i < column_n; ++i) {
+                    output_block_ptr->column_vectors[i]->AppendWith(column_vectors[i], block_offset, 1);
+                }
             }
-            output_block_ptr->AppendValueByPtr(column_n, raw_result_dists + id * result_size);
-            output_block_ptr->AppendValueByPtr(column_n + 1, (ptr_t)&row_ids[id]);
+            output_block_ptr->AppendValueByPtr(dist_column_idx, raw_result_dists + top_idx * result_size);
+            output_block_ptr->AppendValueByPtr(dist_column_idx + 1, (ptr_t)&row_ids[top_idx]);
 
             ++output_block_row_id;
         }
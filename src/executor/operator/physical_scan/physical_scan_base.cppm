@@ -44,16 +44,25 @@ public:
 
     virtual BlockIndex *GetBlockIndex() const;
 
+    // Set when a merge operator follows the scan tasks: the merge reads the columns of the final results by row id,
+    // so the tasks only output the scores and row ids of their candidates.
+    void set_late_materialize(bool late_materialize) { late_materialize_ = late_materialize; }
+
 protected:
+    // result_n_list holds the result count of every query. The output of a scan task read by a merge operator has the same
+    // number of rows for every query, the queries with fewer results are padded with invalid row ids.
     void SetOutput(const Vector<char *> &raw_result_dists_list,
                    const Vector<RowID *> &row_ids_list,
                    SizeT result_size,
-                   i64 result_n,
+                   const Vector<i64> &result_n_list,
                    QueryContext *query_context,
                    OperatorState *operator_state);
 
 public:
     SharedPtr<BaseTableRef> base_table_ref_{};
+
+protected:
+    bool late_materialize_{false};
 };
 
 } // namespace infinity
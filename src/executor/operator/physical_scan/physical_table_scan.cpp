@@ -141,6 +141,7 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
                 LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, block_ids.size(): {}, skipped after apply FastRoughFilter",
                                       block_ids_idx,
                                       block_ids->size()));
+                ++table_scan_operator_state->skip_stats_.skipped_blocks_;
                 ++block_ids_idx;
                 continue;
             } else {
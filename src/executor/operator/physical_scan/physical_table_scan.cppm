@@ -39,7 +39,7 @@ export class PhysicalTableScan : public PhysicalScanBase {
 public:
     explicit PhysicalTableScan(u64 id,
                                SharedPtr<BaseTableRef> base_table_ref,
-                               UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
+                               SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator,
                                SharedPtr<Vector<LoadMeta>> load_metas,
                                bool add_row_id = false)
         : PhysicalScanBase(id, PhysicalOperatorType::kTableScan, nullptr, nullptr, base_table_ref, load_metas),
@@ -77,7 +77,7 @@ private:
     void ExecuteInternal(QueryContext *query_context, TableScanOperatorState *table_scan_operator_state);
 
 private:
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
     bool add_row_id_;
     mutable Vector<SizeT> column_ids_;
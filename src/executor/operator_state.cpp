@@ -26,6 +26,38 @@ import third_party;
 
 namespace infinity {
 
+f64 FilterPredicateStats::Rank() const {
+    if (input_rows_ == 0) {
+        return std::numeric_limits<f64>::lowest();
+    }
+    f64 cost_per_row = static_cast<f64>(elapsed_ns_) / input_rows_;
+    f64 drop_rate = 1.0 - static_cast<f64>(output_rows_) / input_rows_;
+    // a conjunct that drops no rows goes last
+    return drop_rate > 0 ? cost_per_row / drop_rate : std::numeric_limits<f64>::max();
+}
+
+String FilterOperatorState::ProfileInfo() const {
+    if (predicate_stats_.size() <= 1) {
+        return {};
+    }
+    String info;
+    for (SizeT predicate_idx : predicate_order_) {
+        const FilterPredicateStats &stats = predicate_stats_[predicate_idx];
+        if (!info.empty()) {
+            info += ", ";
+        }
+        info += fmt::format("#{}(InputRows: {}, OutputRows: {}, ElapsedTime: {})", predicate_idx, stats.input_rows_, stats.output_rows_, stats.elapsed_ns_);
+    }
+    return info;
+}
+
+String ScanSkipStats::ToString() const {
+    if (skipped_blocks_ == 0 && skipped_segments_ == 0) {
+        return {};
+    }
+    return fmt::format("SkippedBlocks: {}, SkippedSegments: {}", skipped_blocks_, skipped_segments_);
+}
+
 void QueueSourceState::MarkCompletedTask(u64 fragment_id) {
     auto it = num_tasks_.find(fragment_id);
     if (it != num_tasks_.end()) {
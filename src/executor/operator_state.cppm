@@ -63,6 +63,9 @@ export struct OperatorState {
     inline void SetComplete() { complete_ = true; }
 
     inline bool Complete() const { return complete_; }
+
+    // Operator specific runtime information shown in the query profile
+    virtual String ProfileInfo() const { return {}; }
 };
 
 // Aggregate
@@ -98,18 +101,32 @@ export struct UnionAllOperatorState : public OperatorState {
     inline explicit UnionAllOperatorState() : OperatorState(PhysicalOperatorType::kUnionAll) {}
 };
 
+// Blocks and segments a scan task didn't read because the filter excludes all of their rows
+export struct ScanSkipStats {
+    u64 skipped_blocks_{};
+    u64 skipped_segments_{};
+
+    [[nodiscard]] String ToString() const;
+};
+
 // TableScan
 export struct TableScanOperatorState : public OperatorState {
     inline explicit TableScanOperatorState() : OperatorState(PhysicalOperatorType::kTableScan) {}
 
+    String ProfileInfo() const override { return skip_stats_.ToString(); }
+
     UniquePtr<TableScanFunctionData> table_scan_function_data_{};
+    ScanSkipStats skip_stats_{};
 };
 
 // MatchTensorScan
 export struct MatchTensorScanOperatorState : public OperatorState {
     inline explicit MatchTensorScanOperatorState() : OperatorState(PhysicalOperatorType::kMatchTensorScan) {}
 
+    String ProfileInfo() const override { return skip_stats_.ToString(); }
+
     UniquePtr<MatchTensorScanFunctionData> match_tensor_scan_function_data_{};
+    ScanSkipStats skip_stats_{};
 };
 
 // MergeMatchTensor
@@ -126,7 +143,10 @@ export struct MergeMatchTensorOperatorState : public OperatorState {
 export struct MatchSparseScanOperatorState : public OperatorState {
     inline explicit MatchSparseScanOperatorState() : OperatorState(PhysicalOperatorType::kMatchSparseScan) {}
 
+    String ProfileInfo() const override { return skip_stats_.ToString(); }
+
     MatchSparseScanFunctionData match_sparse_scan_function_data_{};
+    ScanSkipStats skip_stats_{};
 };
 
 // MergeMatchSparse
@@ -142,8 +162,11 @@ export struct MergeMatchSparseOperatorState : public OperatorState {
 export struct KnnScanOperatorState : public OperatorState {
     inline explicit KnnScanOperatorState() : OperatorState(PhysicalOperatorType::kKnnScan) {}
 
+    String ProfileInfo() const override { return skip_stats_.ToString(); }
+
     //    Vector<SharedPtr<DataBlock>> output_data_blocks_{};
     UniquePtr<KnnScanFunctionData> knn_scan_function_data_{};
+    ScanSkipStats skip_stats_{};
 };
 
 // Merge Knn
@@ -156,8 +179,26 @@ export struct MergeKnnOperatorState : public OperatorState {
 };
 
 // Filter
+// Runtime statistics of one conjunct of the filter condition
+export struct FilterPredicateStats {
+    u64 input_rows_{};
+    u64 output_rows_{};
+    i64 elapsed_ns_{};
+
+    // Expected cost to drop one row, the conjuncts are evaluated in ascending order of it.
+    // A conjunct which was never evaluated ranks first, so that it gets measured.
+    [[nodiscard]] f64 Rank() const;
+};
+
 export struct FilterOperatorState : public OperatorState {
     inline explicit FilterOperatorState() : OperatorState(PhysicalOperatorType::kFilter) {}
+
+    String ProfileInfo() const override;
+
+    // Indexed by the position of the conjunct in the filter condition
+    Vector<FilterPredicateStats> predicate_stats_{};
+    // The conjunct positions in the order of the evaluation of the last block
+    Vector<SizeT> predicate_order_{};
 };
 
 // IndexScan
@@ -71,23 +71,39 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
         }
 
         auto row_column_id = input_block->column_count() - 1;
-
-        for (SizeT j = 0; j < row_count; ++j) {
-            // If late materialization needs to be optional, then this needs to be modified
-            RowID row_id = input_block->GetValue(row_column_id, j).value_.row;
-            u32 segment_id = row_id.segment_id_;
-            u32 segment_offset = row_id.segment_offset_;
+        // If late materialization needs to be optional, then this needs to be modified
+        const auto *row_ids = reinterpret_cast<const RowID *>(input_block->column_vectors[row_column_id]->data());
+
+        // The rows coming from a scan are in storage order: the adjacent rows of one block are copied with one append per column.
+        // The rows coming from a top-k are in key order: the columns of a block are read once and kept for its later rows.
+        HashMap<const BlockEntry *, Vector<ColumnVector>> block_columns;
+        for (SizeT j = 0; j < row_count;) {
+            u32 segment_id = row_ids[j].segment_id_;
+            u32 segment_offset = row_ids[j].segment_offset_;
             u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
             u16 block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
 
+            SizeT run_length = 1;
+            while (j + run_length < row_count && row_ids[j + run_length].segment_id_ == segment_id &&
+                   row_ids[j + run_length].segment_offset_ == segment_offset + run_length &&
+                   block_offset + run_length < DEFAULT_BLOCK_CAPACITY) {
+                ++run_length;
+            }
+
             const BlockEntry *block_entry = table_ref->block_index_->GetBlockEntry(segment_id, block_id);
+            auto [iter, inserted] = block_columns.try_emplace(block_entry);
+            Vector<ColumnVector> &column_vectors = iter->second;
+            if (inserted) {
+                column_vectors.reserve(load_column_count);
+                for (SizeT k = 0; k < load_column_count; ++k) {
+                    BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(load_metas[k].binding_.column_idx);
+                    column_vectors.emplace_back(block_column_ptr->GetColumnVector(query_context->storage()->buffer_manager()));
+                }
+            }
             for (SizeT k = 0; k < load_column_count; ++k) {
-                auto binding = load_metas[k].binding_;
-                BlockColumnEntry *block_column_ptr = block_entry->GetColumnBlockEntry(binding.column_idx);
-
-                ColumnVector column_vector = block_column_ptr->GetColumnVector(query_context->storage()->buffer_manager());
-                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vector, block_offset, 1);
+                input_block->column_vectors[load_metas[k].index_]->AppendWith(column_vectors[k], block_offset, run_length);
             }
+            j += run_length;
         }
     }
 }
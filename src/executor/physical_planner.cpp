@@ -496,6 +496,15 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildDropView(const SharedPtr<Logic
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildInsert(const SharedPtr<LogicalNode> &logical_operator) const {
 
     SharedPtr<LogicalInsert> logical_insert_ptr = dynamic_pointer_cast<LogicalInsert>(logical_operator);
+    if (!logical_insert_ptr->column_data().empty()) {
+        return MakeUnique<PhysicalInsert>(logical_operator->node_id(),
+                                          logical_insert_ptr->table_entry(),
+                                          logical_insert_ptr->table_index(),
+                                          logical_insert_ptr->column_data(),
+                                          logical_insert_ptr->column_defaults(),
+                                          logical_insert_ptr->row_count(),
+                                          logical_operator->load_metas());
+    }
     return MakeUnique<PhysicalInsert>(logical_operator->node_id(),
                                       logical_insert_ptr->table_entry(),
                                       logical_insert_ptr->table_index(),
@@ -878,7 +887,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTableScan(const SharedPtr<Logi
     SharedPtr<LogicalTableScan> logical_table_scan = static_pointer_cast<LogicalTableScan>(logical_operator);
     return MakeUnique<PhysicalTableScan>(logical_operator->node_id(),
                                          logical_table_scan->base_table_ref_,
-                                         std::move(logical_table_scan->fast_rough_filter_evaluator_),
+                                         logical_table_scan->fast_rough_filter_evaluator_,
                                          logical_operator->load_metas(),
                                          logical_table_scan->add_row_id_);
 }
@@ -888,9 +897,9 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIndexScan(const SharedPtr<Logi
     return MakeUnique<PhysicalIndexScan>(logical_operator->node_id(),
                                          logical_index_scan->base_table_ref_,
                                          logical_index_scan->index_filter_qualified_,
-                                         std::move(logical_index_scan->column_index_map_),
-                                         std::move(logical_index_scan->filter_execute_command_),
-                                         std::move(logical_index_scan->fast_rough_filter_evaluator_),
+                                         logical_index_scan->column_index_map_,
+                                         logical_index_scan->filter_execute_command_,
+                                         logical_index_scan->fast_rough_filter_evaluator_,
                                          logical_operator->load_metas(),
                                          logical_index_scan->add_row_id_);
 }
@@ -970,6 +979,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildMatchSparseScan(const SharedPt
     if (match_sparse_scan_op->TaskletCount() == 1) {
         return match_sparse_scan_op;
     }
+    match_sparse_scan_op->set_late_materialize(true);
     auto merge_match_sparse_op =
         MakeUnique<PhysicalMergeMatchSparse>(query_context_ptr_->GetNextNodeID(),
                                              std::move(match_sparse_scan_op),
@@ -1020,6 +1030,7 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildKnn(const SharedPtr<LogicalNod
     if (knn_scan_op->TaskletCount() == 1) {
         return knn_scan_op;
     } else {
+        knn_scan_op->set_late_materialize(true);
         return MakeUnique<PhysicalMergeKnn>(query_context_ptr_->GetNextNodeID(),
                                             logical_knn_scan->base_table_ref_,
                                             std::move(knn_scan_op),
@@ -65,6 +65,8 @@ public:
 
     inline Vector<SharedPtr<BaseExpression>> &arguments() { return arguments_; }
 
+    inline const Vector<SharedPtr<BaseExpression>> &arguments() const { return arguments_; }
+
     SourcePosition source_position_{};
     String alias_{};
 
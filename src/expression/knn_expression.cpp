@@ -56,11 +56,12 @@ KnnExpression::KnnExpression(EmbeddingDataType embedding_data_type,
                              EmbeddingT query_embedding,
                              Vector<SharedPtr<BaseExpression>> arguments,
                              i64 topn,
-                             Vector<InitParameter *> *opt_params)
+                             Vector<InitParameter *> *opt_params,
+                             i64 query_count)
     : BaseExpression(ExpressionType::kKnn, std::move(arguments)), dimension_(dimension), embedding_data_type_(embedding_data_type),
       distance_type_(knn_distance_type), query_embedding_(std::move(query_embedding)),
-      topn_(topn) // Should call move constructor, otherwise there will be memory leak.
-{
+      topn_(topn), // Should call move constructor, otherwise there will be memory leak.
+      query_count_(query_count) {
     if (opt_params) {
         for (auto &param : *opt_params) {
             opt_params_.emplace_back(*param);
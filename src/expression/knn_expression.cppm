@@ -37,7 +37,8 @@ public:
                   EmbeddingT query_embedding,
                   Vector<SharedPtr<BaseExpression>> arguments,
                   i64 topn,
-                  Vector<InitParameter *> *opt_params);
+                  Vector<InitParameter *> *opt_params,
+                  i64 query_count = 1);
 
     inline DataType Type() const override { return DataType(LogicalType::kFloat); }
 
@@ -50,6 +51,8 @@ public:
     const EmbeddingT query_embedding_;
     const i64 topn_;
     Vector<InitParameter> opt_params_;
+    // query_embedding_ holds query_count_ embeddings, the results are output grouped by query
+    const i64 query_count_{1};
 };
 
 } // namespace infinity
\ No newline at end of file
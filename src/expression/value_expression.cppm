@@ -40,6 +40,9 @@ public:
 
     const Value &GetValue() const { return value_; }
 
+    // Overwrites the '?' parameter bound to this expression when a prepared plan is executed again
+    void SetValue(Value value) { value_ = std::move(value); }
+
 private:
     Value value_;
 };
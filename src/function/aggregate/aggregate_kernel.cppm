@@ -0,0 +1,164 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <type_traits>
+
+export module aggregate_kernel;
+
+import stl;
+import bitmask;
+import bitmask_buffer;
+
+namespace infinity {
+
+// Batch kernels of the aggregate functions.
+// Every kernel reads `count` values: input[0, count) if selection is nullptr, otherwise input[selection[0]], ..., input[selection[count - 1]].
+// The dense loops have no branches and no calls, so the compiler turns them into SIMD code for every numeric type.
+
+// number of independent partial sums kept by the floating point kernels, floating point addition isn't associative
+// so the compiler won't vectorize a single accumulator by itself
+constexpr SizeT kAggregateLanes = 8;
+
+export template <typename AccType, typename ValueType>
+inline AccType BatchSum(const ValueType *__restrict input, SizeT count, const u32 *__restrict selection) {
+    AccType sum = 0;
+    if (selection != nullptr) {
+        for (SizeT i = 0; i < count; ++i) {
+            sum += input[selection[i]];
+        }
+        return sum;
+    }
+    SizeT i = 0;
+    if constexpr (std::is_floating_point_v<AccType>) {
+        AccType lanes[kAggregateLanes]{};
+        for (; i + kAggregateLanes <= count; i += kAggregateLanes) {
+            for (SizeT lane = 0; lane < kAggregateLanes; ++lane) {
+                lanes[lane] += input[i + lane];
+            }
+        }
+        for (SizeT lane = 0; lane < kAggregateLanes; ++lane) {
+            sum += lanes[lane];
+        }
+    }
+    for (; i < count; ++i) {
+        sum += input[i];
+    }
+    return sum;
+}
+
+export template <typename ValueType>
+inline ValueType BatchMin(const ValueType *__restrict input, SizeT count, const u32 *__restrict selection, ValueType init) {
+    ValueType value = init;
+    if (selection != nullptr) {
+        for (SizeT i = 0; i < count; ++i) {
+            value = input[selection[i]] < value ? input[selection[i]] : value;
+        }
+        return value;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        value = input[i] < value ? input[i] : value;
+    }
+    return value;
+}
+
+export template <typename ValueType>
+inline ValueType BatchMax(const ValueType *__restrict input, SizeT count, const u32 *__restrict selection, ValueType init) {
+    ValueType value = init;
+    if (selection != nullptr) {
+        for (SizeT i = 0; i < count; ++i) {
+            value = value < input[selection[i]] ? input[selection[i]] : value;
+        }
+        return value;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        value = value < input[i] ? input[i] : value;
+    }
+    return value;
+}
+
+// Scatter kernels for grouped aggregation: the i-th value is accumulated into the slot group_ids[i] (group_ids[selection[i]] with a selection).
+// The slots are plain arrays indexed by group id, one array per aggregate, so the loops stay free of hashing and calls.
+
+export template <typename AccType, typename ValueType>
+inline void ScatterSum(AccType *__restrict sums, const u32 *__restrict group_ids, const ValueType *__restrict input, SizeT count, const u32 *selection) {
+    if (selection != nullptr) {
+        for (SizeT i = 0; i < count; ++i) {
+            sums[group_ids[selection[i]]] += input[selection[i]];
+        }
+        return;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        sums[group_ids[i]] += input[i];
+    }
+}
+
+export inline void ScatterCount(i64 *__restrict counts, const u32 *__restrict group_ids, SizeT count, const u32 *selection) {
+    if (selection != nullptr) {
+        for (SizeT i = 0; i < count; ++i) {
+            ++counts[group_ids[selection[i]]];
+        }
+        return;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        ++counts[group_ids[i]];
+    }
+}
+
+export template <typename ValueType>
+inline void ScatterMin(ValueType *__restrict values, const u32 *__restrict group_ids, const ValueType *__restrict input, SizeT count, const u32 *selection) {
+    for (SizeT i = 0; i < count; ++i) {
+        SizeT row = selection != nullptr ? selection[i] : i;
+        ValueType &value = values[group_ids[row]];
+        value = input[row] < value ? input[row] : value;
+    }
+}
+
+export template <typename ValueType>
+inline void ScatterMax(ValueType *__restrict values, const u32 *__restrict group_ids, const ValueType *__restrict input, SizeT count, const u32 *selection) {
+    for (SizeT i = 0; i < count; ++i) {
+        SizeT row = selection != nullptr ? selection[i] : i;
+        ValueType &value = values[group_ids[row]];
+        value = value < input[row] ? input[row] : value;
+    }
+}
+
+// Writes the indexes of the non-null rows in [0, row_count) to selection and returns how many there are.
+export inline SizeT BuildValidSelection(const Bitmask &nulls, SizeT row_count, u32 *selection) {
+    const u64 *data = nulls.GetData();
+    SizeT valid_count = 0;
+    if (data == nullptr) {
+        for (SizeT i = 0; i < row_count; ++i) {
+            selection[valid_count++] = i;
+        }
+        return valid_count;
+    }
+    SizeT unit_count = BitmaskBuffer::UnitCount(row_count);
+    for (SizeT unit_idx = 0; unit_idx < unit_count; ++unit_idx) {
+        u64 unit = data[unit_idx];
+        SizeT base = unit_idx * BitmaskBuffer::UNIT_BITS;
+        if (SizeT rest = row_count - base; rest < BitmaskBuffer::UNIT_BITS) {
+            unit &= (u64(1) << rest) - 1;
+        }
+        while (unit != 0) {
+            selection[valid_count++] = base + std::countr_zero(unit);
+            unit &= unit - 1;
+        }
+    }
+    return valid_count;
+}
+
+} // namespace infinity
@@ -22,6 +22,7 @@ import status;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import logical_type;
@@ -87,6 +88,11 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBatch(const TinyIntT *__restrict input, SizeT count, const u32 *selection) {
+        this->count_ += count;
+        value_ += BatchSum<i64>(input, count, selection);
+    }
+
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT count) {
         this->count_ += count;
         value_ += (input[idx] * count);
@@ -122,6 +128,11 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBatch(const SmallIntT *__restrict input, SizeT count, const u32 *selection) {
+        this->count_ += count;
+        value_ += BatchSum<i64>(input, count, selection);
+    }
+
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -158,6 +169,11 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBatch(const IntegerT *__restrict input, SizeT count, const u32 *selection) {
+        this->count_ += count;
+        value_ += BatchSum<i64>(input, count, selection);
+    }
+
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -194,6 +210,11 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBatch(const BigIntT *__restrict input, SizeT count, const u32 *selection) {
+        this->count_ += count;
+        value_ += BatchSum<i64>(input, count, selection);
+    }
+
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -230,6 +251,11 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBatch(const FloatT *__restrict input, SizeT count, const u32 *selection) {
+        this->count_ += count;
+        value_ += BatchSum<DoubleT>(input, count, selection);
+    }
+
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
@@ -266,6 +292,11 @@ public:
         value_ += input[idx];
     }
 
+    inline void UpdateBatch(const DoubleT *__restrict input, SizeT count, const u32 *selection) {
+        this->count_ += count;
+        value_ += BatchSum<DoubleT>(input, count, selection);
+    }
+
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT count) {
         // TODO: Need to check overflow.
         this->count_ += count;
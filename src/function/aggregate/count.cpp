@@ -36,8 +36,13 @@ public:
 
     void Initialize() { this->count_ = 0; }
 
+    // COUNT(*) is bound to the first column, so the null rows are counted as well
+    static constexpr bool kSkipNulls = false;
+
     void Update(ValueType *__restrict, SizeT) { count_++; }
 
+    inline void UpdateBatch(ValueType *__restrict, SizeT count, const u32 *) { count_ += count; }
+
     inline void ConstantUpdate(ValueType *__restrict, SizeT, SizeT count) { count_ += count; }
 
     inline ptr_t Finalize() { return (ptr_t)&count_; }
@@ -22,6 +22,7 @@ import logical_type;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import status;
@@ -92,6 +93,8 @@ public:
 
     void Update(const TinyIntT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBatch(const TinyIntT *__restrict input, SizeT count, const u32 *selection) { value_ = BatchMin(input, count, selection, value_); }
+
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -108,6 +111,8 @@ public:
 
     void Update(const SmallIntT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBatch(const SmallIntT *__restrict input, SizeT count, const u32 *selection) { value_ = BatchMin(input, count, selection, value_); }
+
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT ) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -124,6 +129,8 @@ public:
 
     void Update(const IntegerT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBatch(const IntegerT *__restrict input, SizeT count, const u32 *selection) { value_ = BatchMin(input, count, selection, value_); }
+
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -140,6 +147,8 @@ public:
 
     void Update(const BigIntT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBatch(const BigIntT *__restrict input, SizeT count, const u32 *selection) { value_ = BatchMin(input, count, selection, value_); }
+
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -175,6 +184,8 @@ public:
 
     void Update(const FloatT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBatch(const FloatT *__restrict input, SizeT count, const u32 *selection) { value_ = BatchMin(input, count, selection, value_); }
+
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -191,6 +202,8 @@ public:
 
     void Update(const DoubleT *__restrict input, SizeT idx) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
+    void UpdateBatch(const DoubleT *__restrict input, SizeT count, const u32 *selection) { value_ = BatchMin(input, count, selection, value_); }
+
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT) { value_ = input[idx] < value_ ? input[idx] : value_; }
 
     inline ptr_t Finalize() { return (ptr_t)&value_; }
@@ -22,6 +22,7 @@ import status;
 import infinity_exception;
 import aggregate_function;
 import aggregate_function_set;
+import aggregate_kernel;
 
 import third_party;
 import logical_type;
@@ -74,6 +75,8 @@ public:
 
     inline void Update(const TinyIntT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBatch(const TinyIntT *__restrict input, SizeT count, const u32 *selection) { sum_ += BatchSum<i64>(input, count, selection); }
+
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -90,6 +93,8 @@ public:
 
     inline void Update(const SmallIntT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBatch(const SmallIntT *__restrict input, SizeT count, const u32 *selection) { sum_ += BatchSum<i64>(input, count, selection); }
+
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -106,6 +111,8 @@ public:
 
     inline void Update(const IntegerT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBatch(const IntegerT *__restrict input, SizeT count, const u32 *selection) { sum_ += BatchSum<i64>(input, count, selection); }
+
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -122,6 +129,8 @@ public:
 
     inline void Update(const BigIntT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBatch(const BigIntT *__restrict input, SizeT count, const u32 *selection) { sum_ += BatchSum<i64>(input, count, selection); }
+
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -138,6 +147,8 @@ public:
 
     inline void Update(const FloatT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBatch(const FloatT *__restrict input, SizeT count, const u32 *selection) { sum_ += BatchSum<DoubleT>(input, count, selection); }
+
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -154,6 +165,8 @@ public:
 
     inline void Update(const DoubleT *__restrict input, SizeT idx) { sum_ += input[idx]; }
 
+    inline void UpdateBatch(const DoubleT *__restrict input, SizeT count, const u32 *selection) { sum_ += BatchSum<DoubleT>(input, count, selection); }
+
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT count) { sum_ += input[idx] * count; }
 
     inline ptr_t Finalize() { return (ptr_t)&sum_; }
@@ -23,12 +23,14 @@ import function;
 import function_data;
 import column_vector;
 import vector_buffer;
+import bitmask;
 import infinity_exception;
 import base_expression;
 import data_type;
 import logical_type;
 import internal_types;
 import logger;
+import aggregate_kernel;
 
 namespace infinity {
 
@@ -36,6 +38,22 @@ using AggregateInitializeFuncType = std::function<void(ptr_t)>;
 using AggregateUpdateFuncType = std::function<void(ptr_t, const SharedPtr<ColumnVector> &)>;
 using AggregateFinalizeFuncType = std::function<ptr_t(ptr_t)>;
 
+// A state with UpdateBatch(input, count, selection) consumes a whole vector per call instead of one row per Update() call.
+template <typename AggregateState, typename InputType>
+concept BatchAggregateState = requires(AggregateState *state, InputType *input, SizeT count, const u32 *selection) {
+    state->UpdateBatch(input, count, selection);
+};
+
+// The null rows are skipped unless the state sets kSkipNulls to false, e.g. COUNT(*) which is bound to the first column.
+template <typename AggregateState>
+constexpr bool AggregateSkipNulls() {
+    if constexpr (requires { AggregateState::kSkipNulls; }) {
+        return AggregateState::kSkipNulls;
+    } else {
+        return true;
+    }
+}
+
 class AggregateOperation {
 public:
     template <typename AggregateState>
@@ -68,8 +86,19 @@ public:
             case ColumnVectorType::kFlat: {
                 SizeT row_count = input_column_vector->Size();
                 auto *input_ptr = (InputType *)(input_column_vector->data());
-                for (SizeT idx = 0; idx < row_count; ++idx) {
-                    ((AggregateState *)state)->Update(input_ptr, idx);
+                if constexpr (BatchAggregateState<AggregateState, InputType>) {
+                    const Bitmask &nulls = *input_column_vector->nulls_ptr_;
+                    if (!AggregateSkipNulls<AggregateState>() || nulls.IsAllTrue()) {
+                        ((AggregateState *)state)->UpdateBatch(input_ptr, row_count, nullptr);
+                    } else {
+                        Vector<u32> selection(row_count);
+                        SizeT valid_count = BuildValidSelection(nulls, row_count, selection.data());
+                        ((AggregateState *)state)->UpdateBatch(input_ptr, valid_count, selection.data());
+                    }
+                } else {
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        ((AggregateState *)state)->Update(input_ptr, idx);
+                    }
                 }
                 break;
             }
@@ -89,6 +89,12 @@ export inline BoundCastFunc BindEmbeddingCast(const DataType &source, const Data
         case EmbeddingDataType::kElemDouble: {
             return BindEmbeddingCast<DoubleT>(target_info);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return BindEmbeddingCast<Float16T>(target_info);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return BindEmbeddingCast<BFloat16T>(target_info);
+        }
         default: {
             String error_message = fmt::format("Can't cast from {} to Embedding type", target.ToString());
             LOG_CRITICAL(error_message);
@@ -122,6 +128,12 @@ inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
         case EmbeddingDataType::kElemDouble: {
             return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, DoubleT, EmbeddingTryCastToFixlen>);
         }
+        case EmbeddingDataType::kElemFloat16: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, Float16T, EmbeddingTryCastToFixlen>);
+        }
+        case EmbeddingDataType::kElemBFloat16: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, BFloat16T, EmbeddingTryCastToFixlen>);
+        }
         default: {
             String error_message = fmt::format("Can't cast from Embedding type to {}", target->ToString());
             LOG_CRITICAL(error_message);
@@ -131,10 +143,39 @@ inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
     return BoundCastFunc(nullptr);
 }
 
+template <typename T>
+constexpr bool IsHalfFloatElem = std::is_same_v<T, Float16T> || std::is_same_v<T, BFloat16T>;
+
 struct EmbeddingTryCastToFixlen {
     template <typename SourceElemType, typename TargetElemType>
     static inline bool Run(const SourceElemType *source, TargetElemType *target, SizeT len) {
-        if constexpr (std::is_same_v<TargetElemType, bool>) {
+        if constexpr (IsHalfFloatElem<SourceElemType>) {
+            // widen to float first, half precision values always fit
+            if constexpr (std::is_same_v<TargetElemType, FloatT> || std::is_same_v<TargetElemType, DoubleT> || IsHalfFloatElem<TargetElemType>) {
+                for (SizeT i = 0; i < len; ++i) {
+                    target[i] = static_cast<TargetElemType>(static_cast<FloatT>(source[i]));
+                }
+                return true;
+            } else {
+                auto widened = MakeUniqueForOverwrite<FloatT[]>(len);
+                for (SizeT i = 0; i < len; ++i) {
+                    widened[i] = static_cast<FloatT>(source[i]);
+                }
+                return Run(widened.get(), target, len);
+            }
+        } else if constexpr (IsHalfFloatElem<TargetElemType>) {
+            if constexpr (std::is_same_v<SourceElemType, bool>) {
+                const auto *src = reinterpret_cast<const u8 *>(source);
+                for (SizeT i = 0; i < len; ++i) {
+                    target[i] = TargetElemType((src[i / 8] & (1u << (i % 8))) ? 1.0f : 0.0f);
+                }
+            } else {
+                for (SizeT i = 0; i < len; ++i) {
+                    target[i] = TargetElemType(static_cast<FloatT>(source[i]));
+                }
+            }
+            return true;
+        } else if constexpr (std::is_same_v<TargetElemType, bool>) {
             if constexpr (!(std::is_same_v<SourceElemType, TinyIntT> || std::is_same_v<SourceElemType, SmallIntT> ||
                             std::is_same_v<SourceElemType, IntegerT> || std::is_same_v<SourceElemType, BigIntT> ||
                             std::is_same_v<SourceElemType, FloatT> || std::is_same_v<SourceElemType, DoubleT>)) {
@@ -14,6 +14,10 @@
 
 module;
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 module like;
 
 import stl;
@@ -26,102 +30,253 @@ import scalar_function_set;
 import third_party;
 import internal_types;
 import data_type;
+import data_block;
+import column_vector;
+import bitmask;
 import logger;
 
 namespace infinity {
 
-bool LikeOperator(const ptr_t left_ptr, SizeT left_len, const ptr_t right_ptr, SizeT right_len) {
-    SizeT left_idx{0}, right_idx{0};
-
-    while (right_idx < right_len) {
-        char left_char = left_ptr[left_idx];
-        char right_char = right_ptr[right_idx];
-        if (right_char == '_' or (left_char == right_char)) {
-            ++left_idx;
-            ++right_idx;
-        } else if (right_char == '%') {
-            ++right_idx;
-
-            // If there are more than one %
-            while (right_idx < right_len && right_ptr[right_idx] == '%') {
-                ++right_idx;
+SizeT SIMDFind(std::string_view str, std::string_view needle) {
+    const SizeT str_len = str.size();
+    const SizeT needle_len = needle.size();
+    if (needle_len == 0) {
+        return 0;
+    }
+    if (needle_len > str_len) {
+        return std::string_view::npos;
+    }
+    if (needle_len == 1) {
+        const void *found = std::memchr(str.data(), needle[0], str_len);
+        return found == nullptr ? std::string_view::npos : static_cast<const char *>(found) - str.data();
+    }
+    SizeT i = 0;
+#if defined(__SSE2__)
+    // Compare the first and the last byte of the needle at 16 positions at once, and only memcmp the positions where both are equal.
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+    for (; i + needle_len + 15 <= str_len; i += 16) {
+        const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str.data() + i));
+        const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str.data() + i + needle_len - 1));
+        u32 mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0) {
+            u32 offset = __builtin_ctz(mask);
+            if (std::memcmp(str.data() + i + offset + 1, needle.data() + 1, needle_len - 2) == 0) {
+                return i + offset;
             }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    return str.find(needle, i);
+}
 
-            // % is the last character
-            if (right_idx == right_len) {
-                return true;
+LikeMatcher::LikeMatcher(std::string_view pattern) {
+    Vector<std::string_view> parts;
+    SizeT part_start = 0;
+    for (SizeT i = 0; i <= pattern.size(); ++i) {
+        if (i == pattern.size() || pattern[i] == '%') {
+            parts.emplace_back(pattern.substr(part_start, i - part_start));
+            part_start = i + 1;
+        }
+    }
+    has_percent_ = parts.size() > 1;
+    head_ = MakeSegment(parts.front());
+    if (has_percent_) {
+        tail_ = MakeSegment(parts.back());
+        for (SizeT i = 1; i + 1 < parts.size(); ++i) {
+            if (!parts[i].empty()) {
+                middle_.emplace_back(MakeSegment(parts[i]));
             }
+        }
+    }
+    min_length_ = head_.text_.size() + tail_.text_.size();
+    for (const Segment &segment : middle_) {
+        min_length_ += segment.text_.size();
+    }
+    literal_prefix_ = head_.text_.substr(0, head_.text_.find('_'));
+
+    if (!has_percent_) {
+        kind_ = head_.has_wildcard_ ? LikeMatcherKind::kGeneral : LikeMatcherKind::kExact;
+    } else if (!middle_.empty()) {
+        bool contains = middle_.size() == 1 && !middle_[0].has_wildcard_ && head_.text_.empty() && tail_.text_.empty();
+        kind_ = contains ? LikeMatcherKind::kContains : LikeMatcherKind::kGeneral;
+    } else if (!head_.has_wildcard_ && tail_.text_.empty()) {
+        kind_ = LikeMatcherKind::kPrefix;
+    } else if (head_.text_.empty() && !tail_.has_wildcard_) {
+        kind_ = LikeMatcherKind::kSuffix;
+    } else {
+        kind_ = LikeMatcherKind::kGeneral;
+    }
+}
 
-            // Check any left part is matched with rest of right part.
-            while (left_idx < left_len) {
-                if (LikeOperator(&left_ptr[left_idx], left_len - left_idx, &right_ptr[right_idx], right_len - right_idx)) {
-                    return true;
-                }
-                ++left_idx;
-            }
+LikeMatcher::Segment LikeMatcher::MakeSegment(std::string_view text) {
+    return Segment{String(text), text.find('_') != std::string_view::npos};
+}
 
-            // Not matched
-            return false;
-        } else {
+bool LikeMatcher::MatchAt(const char *str, const Segment &segment, SizeT length) {
+    if (!segment.has_wildcard_) {
+        return std::memcmp(str, segment.text_.data(), length) == 0;
+    }
+    for (SizeT i = 0; i < length; ++i) {
+        if (segment.text_[i] != '_' && segment.text_[i] != str[i]) {
             return false;
         }
     }
+    return true;
+}
 
-    while (right_idx < right_len && right_ptr[right_idx] == '%') {
-        ++right_idx;
+SizeT LikeMatcher::Find(std::string_view str, const Segment &segment) {
+    if (!segment.has_wildcard_) {
+        return SIMDFind(str, segment.text_);
+    }
+    const SizeT length = segment.text_.size();
+    for (SizeT i = 0; i + length <= str.size(); ++i) {
+        if (MatchAt(str.data() + i, segment, length)) {
+            return i;
+        }
     }
+    return std::string_view::npos;
+}
 
-    return left_idx == left_len && right_idx == right_len;
+bool LikeMatcher::MayMatch(const char *prefix, SizeT prefix_len, SizeT length) const {
+    if (has_percent_ ? length < min_length_ : length != min_length_) {
+        return false;
+    }
+    return MatchAt(prefix, head_, std::min(prefix_len, head_.text_.size()));
 }
 
-struct LikeFunction {
-    template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        String error_message = "Not implement: LikeFunction";
-        LOG_CRITICAL(error_message);
-        UnrecoverableError(error_message);
+bool LikeMatcher::Match(std::string_view str) const {
+    switch (kind_) {
+        case LikeMatcherKind::kExact: {
+            return str == head_.text_;
+        }
+        case LikeMatcherKind::kPrefix: {
+            return str.starts_with(head_.text_);
+        }
+        case LikeMatcherKind::kSuffix: {
+            return str.ends_with(tail_.text_);
+        }
+        case LikeMatcherKind::kContains: {
+            return SIMDFind(str, middle_[0].text_) != std::string_view::npos;
+        }
+        case LikeMatcherKind::kGeneral: {
+            return MatchGeneral(str);
+        }
     }
-};
+    return false;
+}
 
-template <>
-inline void LikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    String error_message = "Not implement";
-    LOG_CRITICAL(error_message);
-    UnrecoverableError(error_message);
+bool LikeMatcher::MatchGeneral(std::string_view str) const {
+    if (!MayMatch(str.data(), str.size(), str.size())) {
+        return false;
+    }
+    if (!has_percent_) {
+        return true;
+    }
+    const SizeT tail_start = str.size() - tail_.text_.size();
+    if (!MatchAt(str.data() + tail_start, tail_, tail_.text_.size())) {
+        return false;
+    }
+    // Taking the leftmost occurrence of each middle segment leaves the most room to the following ones
+    SizeT begin = head_.text_.size();
+    for (const Segment &segment : middle_) {
+        SizeT pos = Find(str.substr(begin, tail_start - begin), segment);
+        if (pos == std::string_view::npos) {
+            return false;
+        }
+        begin += pos + segment.text_.size();
+    }
+    return true;
+}
 
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
+namespace {
 
-//    result = LikeOperator(left_ptr, left_len, right_ptr, right_len);
+// Most rows are rejected by the length and the prefix inlined in the varchar, without reading the heap.
+inline bool MatchVarchar(const LikeMatcher &matcher, const VarcharT &varchar, VarcharColumnReader &reader) {
+    if (!varchar.IsInlined()) {
+        if (!matcher.MayMatch(varchar.vector_.prefix_, VARCHAR_PREFIX_LEN, varchar.length_)) {
+            return false;
+        }
+        if (matcher.DecidedByPrefix(VARCHAR_PREFIX_LEN)) {
+            return true;
+        }
+    }
+    return matcher.Match(reader.GetString(varchar));
 }
 
-struct NotLikeFunction {
-    template <typename TA, typename TB, typename TC>
-    static inline void Run(TA, TB, TC &) {
-        String error_message = "Not implement";
-        LOG_CRITICAL(error_message);
-        UnrecoverableError(error_message);
+} // namespace
 
+template <bool NEGATE>
+struct LikeFunction {
+    static void Execute(const DataBlock &input, SharedPtr<ColumnVector> &output) {
+        if (input.column_count() != 2) {
+            String error_message = "Like function: input column count isn't two.";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        if (!input.Finalized()) {
+            String error_message = "Input data block is finalized";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        const SharedPtr<ColumnVector> &left = input.column_vectors[0];
+        const SharedPtr<ColumnVector> &right = input.column_vectors[1];
+        auto check_vector_type_valid = [](ColumnVectorType vector_type) {
+            return vector_type == ColumnVectorType::kFlat || vector_type == ColumnVectorType::kConstant;
+        };
+        if (!check_vector_type_valid(left->vector_type()) || !check_vector_type_valid(right->vector_type())) {
+            String error_message = "Invalid input ColumnVectorType. Support only kFlat and kConstant.";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        const bool left_constant = left->vector_type() == ColumnVectorType::kConstant;
+        const bool right_constant = right->vector_type() == ColumnVectorType::kConstant;
+        const SizeT count = left_constant && right_constant ? 1 : input.row_count();
+
+        SharedPtr<Bitmask> &result_null = output->nulls_ptr_;
+        if ((left_constant && !left->nulls_ptr_->IsAllTrue()) || (right_constant && !right->nulls_ptr_->IsAllTrue())) {
+            result_null->SetAllFalse();
+            output->Finalize(count);
+            return;
+        }
+        if (!left_constant) {
+            result_null->DeepCopy(*left->nulls_ptr_);
+            if (!right_constant) {
+                result_null->Merge(*right->nulls_ptr_);
+            }
+        } else if (!right_constant) {
+            result_null->DeepCopy(*right->nulls_ptr_);
+        } else {
+            result_null->SetAllTrue();
+        }
+        const bool all_valid = result_null->IsAllTrue();
+
+        VarcharColumnReader left_reader(*left);
+        VarcharColumnReader right_reader(*right);
+        BooleanColumnWriter result_writer(output);
+        if (right_constant) {
+            // The usual case: the pattern is compiled once for the whole block
+            LikeMatcher matcher(right_reader.GetString(right_reader[0]));
+            for (SizeT i = 0; i < count; ++i) {
+                if (all_valid || result_null->IsTrue(i)) {
+                    bool match = MatchVarchar(matcher, left_reader[left_constant ? 0 : i], left_reader);
+                    result_writer[i].SetValue(match != NEGATE);
+                }
+            }
+        } else {
+            for (SizeT i = 0; i < count; ++i) {
+                if (all_valid || result_null->IsTrue(i)) {
+                    LikeMatcher matcher(right_reader.GetString(right_reader[i]));
+                    bool match = MatchVarchar(matcher, left_reader[left_constant ? 0 : i], left_reader);
+                    result_writer[i].SetValue(match != NEGATE);
+                }
+            }
+        }
+        output->Finalize(count);
     }
 };
 
-template <>
-inline void NotLikeFunction::Run(VarcharT &, VarcharT &, bool &) {
-    String error_message = "Not implement";
-    LOG_CRITICAL(error_message);
-    UnrecoverableError(error_message);
-
-
-//    ptr_t left_ptr = left.GetDataPtr();
-//    SizeT left_len = left.GetDataLen();
-//    ptr_t right_ptr = right.GetDataPtr();
-//    SizeT right_len = right.GetDataLen();
-
-//    result = !LikeOperator(left_ptr, left_len, right_ptr, right_len);
-}
-
 void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     String func_name = "like";
 
@@ -130,7 +285,7 @@ void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     ScalarFunction varchar_like_function(func_name,
                                          {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                          DataType(kBoolean),
-                                         &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, LikeFunction>);
+                                         &LikeFunction<false>::Execute);
     function_set_ptr->AddFunction(varchar_like_function);
 
     Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
@@ -144,10 +299,10 @@ void RegisterNotLikeFunction(const UniquePtr<Catalog> &catalog_ptr) {
     ScalarFunction varchar_not_like_function(func_name,
                                              {DataType(LogicalType::kVarchar), DataType(LogicalType::kVarchar)},
                                              DataType(kBoolean),
-                                             &ScalarFunction::BinaryFunction<VarcharT, VarcharT, BooleanT, NotLikeFunction>);
+                                             &LikeFunction<true>::Execute);
     function_set_ptr->AddFunction(varchar_not_like_function);
 
     Catalog::AddFunctionSet(catalog_ptr.get(), function_set_ptr);
 }
 
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
@@ -26,4 +26,57 @@ export void RegisterLikeFunction(const UniquePtr<Catalog> &catalog_ptr);
 
 export void RegisterNotLikeFunction(const UniquePtr<Catalog> &catalog_ptr);
 
+export enum class LikeMatcherKind : u8 {
+    kExact,    // abc
+    kPrefix,   // abc%
+    kSuffix,   // %abc
+    kContains, // %abc%
+    kGeneral,  // anything else, e.g. a_c or a%b%c
+};
+
+// A LIKE pattern compiled once for a batch of rows. '%' matches any sequence of bytes and '_' matches a single byte.
+// The pattern is split on '%' into a head anchored at the start, a tail anchored at the end and the segments in between.
+export class LikeMatcher {
+public:
+    explicit LikeMatcher(std::string_view pattern);
+
+    // Decides from the length and the first prefix_len bytes of a string whether it may match. False means it can't.
+    bool MayMatch(const char *prefix, SizeT prefix_len, SizeT length) const;
+
+    // Whether MayMatch alone decides the match of strings whose first prefix_len bytes are known
+    bool DecidedByPrefix(SizeT prefix_len) const { return kind_ == LikeMatcherKind::kPrefix && head_.text_.size() <= prefix_len; }
+
+    bool Match(std::string_view str) const;
+
+    LikeMatcherKind kind() const { return kind_; }
+
+    // The bytes every matching string starts with, used to prune by value ranges
+    const String &LiteralPrefix() const { return literal_prefix_; }
+
+private:
+    struct Segment {
+        String text_{};
+        bool has_wildcard_{false};
+    };
+
+    static Segment MakeSegment(std::string_view text);
+
+    static bool MatchAt(const char *str, const Segment &segment, SizeT length);
+
+    static SizeT Find(std::string_view str, const Segment &segment);
+
+    bool MatchGeneral(std::string_view str) const;
+
+    LikeMatcherKind kind_{LikeMatcherKind::kGeneral};
+    bool has_percent_{false};
+    SizeT min_length_{0};
+    Segment head_{};
+    Segment tail_{};
+    Vector<Segment> middle_{};
+    String literal_prefix_{};
+};
+
+// Finds needle in str with a SIMD scan of its first and last bytes. Returns std::string_view::npos if not found.
+export SizeT SIMDFind(std::string_view str, std::string_view needle);
+
 } // namespace infinity
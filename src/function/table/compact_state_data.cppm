@@ -35,39 +35,63 @@ import logger;
 namespace infinity {
 
 export class RowIDRemap {
-    using RowIDMap = HashMap<GlobalBlockID, Vector<Pair<BlockOffset, RowID>>, GlobalBlockIDHash>;
+    // A range of `row_count_` rows starting at `block_offset_` is moved to the rows starting at `new_row_id_`
+    struct RowRange {
+        BlockOffset block_offset_;
+        BlockOffset row_count_;
+        RowID new_row_id_;
+    };
+    using RowIDMap = HashMap<GlobalBlockID, Vector<RowRange>, GlobalBlockIDHash>;
 
 public:
     RowIDRemap(SizeT block_capacity = DEFAULT_BLOCK_CAPACITY) : block_capacity_(block_capacity) {}
 
-    void AddMap(SegmentID segment_id, BlockID block_id, BlockOffset block_offset, RowID new_row_id) {
+    void AddMap(SegmentID segment_id, BlockID block_id, BlockOffset block_offset, BlockOffset row_count, RowID new_row_id) {
         std::lock_guard lock(mutex_);
         auto &block_vec = row_id_map_[GlobalBlockID(segment_id, block_id)];
-        block_vec.emplace_back(block_offset, new_row_id);
+        block_vec.push_back(RowRange{block_offset, row_count, new_row_id});
     }
 
-    RowID GetNewRowID(SegmentID segment_id, BlockID block_id, BlockOffset block_offset) const {
-        auto &block_vec = row_id_map_.at(GlobalBlockID(segment_id, block_id));
-        auto iter =
-            std::upper_bound(block_vec.begin(),
-                             block_vec.end(),
-                             block_offset,
-                             [](BlockOffset block_offset, const Pair<BlockOffset, RowID> &pair) { return block_offset < pair.first; } // NOLINT
-            );
+    // Returns None if the row is not moved, i.e. it was deleted before the compaction
+    Optional<RowID> FindNewRowID(SegmentID segment_id, BlockID block_id, BlockOffset block_offset) const {
+        auto map_iter = row_id_map_.find(GlobalBlockID(segment_id, block_id));
+        if (map_iter == row_id_map_.end()) {
+            return None;
+        }
+        const auto &block_vec = map_iter->second;
+        auto iter = std::upper_bound(block_vec.begin(),
+                                     block_vec.end(),
+                                     block_offset,
+                                     [](BlockOffset block_offset, const RowRange &range) { return block_offset < range.block_offset_; } // NOLINT
+        );
         if (iter == block_vec.begin()) {
+            return None;
+        }
+        --iter;
+        if (block_offset >= iter->block_offset_ + iter->row_count_) {
+            return None;
+        }
+        RowID rtn = iter->new_row_id_;
+        rtn.segment_offset_ += block_offset - iter->block_offset_;
+        return rtn;
+    }
+
+    RowID GetNewRowID(SegmentID segment_id, BlockID block_id, BlockOffset block_offset) const {
+        Optional<RowID> new_row_id = FindNewRowID(segment_id, block_id, block_offset);
+        if (!new_row_id.has_value()) {
             String error_message = "RowID not found";
             LOG_CRITICAL(error_message);
             UnrecoverableError(error_message);
         }
-        --iter;
-        RowID rtn = iter->second;
-        rtn.segment_offset_ += iter->first - block_offset;
-        return rtn;
+        return *new_row_id;
     }
 
     void AddMap(RowID old_row_id, RowID new_row_id) {
-        std::lock_guard lock(mutex_);
-        AddMap(old_row_id.segment_id_, old_row_id.segment_offset_ / block_capacity_, old_row_id.segment_offset_ % block_capacity_, new_row_id);
+        AddMap(old_row_id.segment_id_, old_row_id.segment_offset_ / block_capacity_, old_row_id.segment_offset_ % block_capacity_, 1, new_row_id);
+    }
+
+    Optional<RowID> FindNewRowID(RowID old_row_id) const {
+        return FindNewRowID(old_row_id.segment_id_, old_row_id.segment_offset_ / block_capacity_, old_row_id.segment_offset_ % block_capacity_);
     }
 
     RowID GetNewRowID(RowID old_row_id) const {
@@ -121,6 +145,23 @@ public:
 
     BaseTableRef *GetNewTableRef() const { return new_table_ref_.get(); }
 
+    // The segments each new segment is compacted from, with the new offsets of their rows. Valid as long as this object is.
+    HashMap<SegmentID, IndexMergeSource> GetIndexMergeSources() const {
+        HashMap<SegmentID, IndexMergeSource> merge_sources;
+        for (const auto &segment_data : segment_data_list_) {
+            SegmentID new_segment_id = segment_data.new_segment_->segment_id();
+            auto new_offset = [this, new_segment_id](SegmentID old_segment_id, SegmentOffset old_offset) -> Optional<SegmentOffset> {
+                Optional<RowID> new_row_id = remapper_.FindNewRowID(RowID(old_segment_id, old_offset));
+                if (!new_row_id.has_value() || new_row_id->segment_id_ != new_segment_id) {
+                    return None;
+                }
+                return new_row_id->segment_offset_;
+            };
+            merge_sources.emplace(new_segment_id, IndexMergeSource{segment_data.old_segments_, std::move(new_offset)});
+        }
+        return merge_sources;
+    }
+
 public:
     Vector<CompactSegmentData> segment_data_list_;
     RowIDRemap remapper_{};
@@ -50,10 +50,14 @@ KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     switch (dist_type) {
         case KnnDistanceType::kL2: {
             dist_func_ = L2Distance<f32, f32, f32, SizeT>;
+            f16_dist_func_ = L2Distance<f32, f32, Float16T, SizeT>;
+            bf16_dist_func_ = L2Distance<f32, f32, BFloat16T, SizeT>;
             break;
         }
         case KnnDistanceType::kInnerProduct: {
             dist_func_ = IPDistance<f32, f32, f32, SizeT>;
+            f16_dist_func_ = IPDistance<f32, f32, Float16T, SizeT>;
+            bf16_dist_func_ = IPDistance<f32, f32, BFloat16T, SizeT>;
             break;
         }
         default: {
@@ -100,8 +100,13 @@ public:
 
 public:
     using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    using F16DistFunc = DataType (*)(const DataType *, const Float16T *, SizeT);
+    using BF16DistFunc = DataType (*)(const DataType *, const BFloat16T *, SizeT);
 
     DistFunc dist_func_{};
+    // used when the column stores half precision elements
+    F16DistFunc f16_dist_func_{};
+    BF16DistFunc bf16_dist_func_{};
 };
 
 template <>
@@ -317,6 +317,39 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             UnrecoverableError(status.message());
         }
 
+        // Compact Worker Count
+        i64 compact_worker_count = DEFAULT_COMPACT_WORKER_COUNT;
+        UniquePtr<IntegerOption> compact_worker_count_option =
+            MakeUnique<IntegerOption>(COMPACT_WORKER_COUNT_OPTION_NAME, compact_worker_count, MAX_COMPACT_WORKER_COUNT, MIN_COMPACT_WORKER_COUNT);
+        status = global_options_.AddOption(std::move(compact_worker_count_option));
+        if(!status.ok()) {
+            LOG_CRITICAL(status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Compact Table Concurrency
+        i64 compact_table_concurrency = DEFAULT_COMPACT_TABLE_CONCURRENCY;
+        UniquePtr<IntegerOption> compact_table_concurrency_option =
+            MakeUnique<IntegerOption>(COMPACT_TABLE_CONCURRENCY_OPTION_NAME,
+                                      compact_table_concurrency,
+                                      MAX_COMPACT_TABLE_CONCURRENCY,
+                                      MIN_COMPACT_TABLE_CONCURRENCY);
+        status = global_options_.AddOption(std::move(compact_table_concurrency_option));
+        if(!status.ok()) {
+            LOG_CRITICAL(status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Compact CPU Limit
+        i64 compact_cpu_limit = DEFAULT_COMPACT_CPU_LIMIT;
+        UniquePtr<IntegerOption> compact_cpu_limit_option =
+            MakeUnique<IntegerOption>(COMPACT_CPU_LIMIT_OPTION_NAME, compact_cpu_limit, MAX_COMPACT_CPU_LIMIT, MIN_COMPACT_CPU_LIMIT);
+        status = global_options_.AddOption(std::move(compact_cpu_limit_option));
+        if(!status.ok()) {
+            LOG_CRITICAL(status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Buffer Manager Size
         i64 buffer_manager_size = DEFAULT_BUFFER_MANAGER_SIZE;
         UniquePtr<IntegerOption> buffer_manager_size_option =
@@ -336,6 +369,16 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             UnrecoverableError(status.message());
         }
 
+        // Result Cache Size
+        i64 result_cache_size = DEFAULT_RESULT_CACHE_SIZE;
+        UniquePtr<IntegerOption> result_cache_size_option =
+            MakeUnique<IntegerOption>(RESULT_CACHE_SIZE_OPTION_NAME, result_cache_size, std::numeric_limits<i64>::max(), 0);
+        status = global_options_.AddOption(std::move(result_cache_size_option));
+        if(!status.ok()) {
+            LOG_CRITICAL(status.message());
+            UnrecoverableError(status.message());
+        }
+
         // WAL Dir
         String wal_dir = "/var/infinity/wal";
         UniquePtr<StringOption> wal_dir_option = MakeUnique<StringOption>(WAL_DIR_OPTION_NAME, wal_dir);
@@ -1000,7 +1043,10 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                             }
 
                             UniquePtr<IntegerOption> compact_interval_option =
-                                MakeUnique<IntegerOption>(COMPACT_INTERVAL_OPTION_NAME, compact_interval, MAX_COMPACT_INTERVAL_SEC, MIN_COMPACT_INTERVAL_SEC);
+                                MakeUnique<IntegerOption>(COMPACT_INTERVAL_OPTION_NAME,
+                                                          compact_interval,
+                                                          MAX_COMPACT_INTERVAL_SEC,
+                                                          MIN_COMPACT_INTERVAL_SEC);
                             if (!compact_interval_option->Validate()) {
                                 return Status::InvalidConfig(fmt::format("Invalid compact interval: {}", compact_interval));
                             }
@@ -1054,6 +1100,75 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kCompactWorkerCount: {
+                            // Compact Worker Count
+                            i64 compact_worker_count = DEFAULT_COMPACT_WORKER_COUNT;
+                            if(elem.second.is_integer()) {
+                                compact_worker_count = elem.second.value_or(compact_worker_count);
+                            } else {
+                                return Status::InvalidConfig("'compact_worker_count' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> compact_worker_count_option =
+                                MakeUnique<IntegerOption>(COMPACT_WORKER_COUNT_OPTION_NAME,
+                                                          compact_worker_count,
+                                                          MAX_COMPACT_WORKER_COUNT,
+                                                          MIN_COMPACT_WORKER_COUNT);
+                            if (!compact_worker_count_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid compact worker count: {}", compact_worker_count));
+                            }
+                            Status status = global_options_.AddOption(std::move(compact_worker_count_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kCompactTableConcurrency: {
+                            // Compact Table Concurrency
+                            i64 compact_table_concurrency = DEFAULT_COMPACT_TABLE_CONCURRENCY;
+                            if(elem.second.is_integer()) {
+                                compact_table_concurrency = elem.second.value_or(compact_table_concurrency);
+                            } else {
+                                return Status::InvalidConfig("'compact_table_concurrency' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> compact_table_concurrency_option =
+                                MakeUnique<IntegerOption>(COMPACT_TABLE_CONCURRENCY_OPTION_NAME,
+                                                          compact_table_concurrency,
+                                                          MAX_COMPACT_TABLE_CONCURRENCY,
+                                                          MIN_COMPACT_TABLE_CONCURRENCY);
+                            if (!compact_table_concurrency_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid compact table concurrency: {}", compact_table_concurrency));
+                            }
+                            Status status = global_options_.AddOption(std::move(compact_table_concurrency_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kCompactCPULimit: {
+                            // Compact CPU Limit
+                            i64 compact_cpu_limit = DEFAULT_COMPACT_CPU_LIMIT;
+                            if(elem.second.is_integer()) {
+                                compact_cpu_limit = elem.second.value_or(compact_cpu_limit);
+                            } else {
+                                return Status::InvalidConfig("'compact_cpu_limit' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> compact_cpu_limit_option =
+                                MakeUnique<IntegerOption>(COMPACT_CPU_LIMIT_OPTION_NAME,
+                                                          compact_cpu_limit,
+                                                          MAX_COMPACT_CPU_LIMIT,
+                                                          MIN_COMPACT_CPU_LIMIT);
+                            if (!compact_cpu_limit_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid compact cpu limit: {}", compact_cpu_limit));
+                            }
+                            Status status = global_options_.AddOption(std::move(compact_cpu_limit_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'storage' field", var_name));
                         }
@@ -1114,6 +1229,45 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                     }
                 }
 
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactWorkerCount) == nullptr) {
+                    // Compact Worker Count
+                    i64 compact_worker_count = DEFAULT_COMPACT_WORKER_COUNT;
+                    UniquePtr<IntegerOption> compact_worker_count_option =
+                        MakeUnique<IntegerOption>(COMPACT_WORKER_COUNT_OPTION_NAME,
+                                                  compact_worker_count,
+                                                  MAX_COMPACT_WORKER_COUNT,
+                                                  MIN_COMPACT_WORKER_COUNT);
+                    Status status = global_options_.AddOption(std::move(compact_worker_count_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactTableConcurrency) == nullptr) {
+                    // Compact Table Concurrency
+                    i64 compact_table_concurrency = DEFAULT_COMPACT_TABLE_CONCURRENCY;
+                    UniquePtr<IntegerOption> compact_table_concurrency_option =
+                        MakeUnique<IntegerOption>(COMPACT_TABLE_CONCURRENCY_OPTION_NAME,
+                                                  compact_table_concurrency,
+                                                  MAX_COMPACT_TABLE_CONCURRENCY,
+                                                  MIN_COMPACT_TABLE_CONCURRENCY);
+                    Status status = global_options_.AddOption(std::move(compact_table_concurrency_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kCompactCPULimit) == nullptr) {
+                    // Compact CPU Limit
+                    i64 compact_cpu_limit = DEFAULT_COMPACT_CPU_LIMIT;
+                    UniquePtr<IntegerOption> compact_cpu_limit_option =
+                        MakeUnique<IntegerOption>(COMPACT_CPU_LIMIT_OPTION_NAME, compact_cpu_limit, MAX_COMPACT_CPU_LIMIT, MIN_COMPACT_CPU_LIMIT);
+                    Status status = global_options_.AddOption(std::move(compact_cpu_limit_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
             } else {
                 return Status::InvalidConfig("No 'storage' section in configure file.");
             }
@@ -1164,6 +1318,25 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                             global_options_.AddOption(std::move(temp_dir_option));
                             break;
                         }
+                        case GlobalOptionIndex::kResultCacheSize: {
+                            i64 result_cache_size = DEFAULT_RESULT_CACHE_SIZE;
+                            if(elem.second.is_string()) {
+                                String result_cache_size_str = elem.second.value_or(DEFAULT_RESULT_CACHE_SIZE_STR.data());
+                                auto res = ParseByteSize(result_cache_size_str, result_cache_size);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'result_cache_size' field isn't string, such as \"256MB\"");
+                            }
+                            UniquePtr<IntegerOption> result_cache_size_option =
+                                MakeUnique<IntegerOption>(RESULT_CACHE_SIZE_OPTION_NAME, result_cache_size, std::numeric_limits<i64>::max(), 0);
+                            if (!result_cache_size_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid result cache size: {}", result_cache_size));
+                            }
+                            global_options_.AddOption(std::move(result_cache_size_option));
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'buffer' field", var_name));
                         }
@@ -1191,6 +1364,17 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                     }
                 }
 
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kResultCacheSize) == nullptr) {
+                    // Result Cache Size
+                    i64 result_cache_size = DEFAULT_RESULT_CACHE_SIZE;
+                    UniquePtr<IntegerOption> result_cache_size_option =
+                        MakeUnique<IntegerOption>(RESULT_CACHE_SIZE_OPTION_NAME, result_cache_size, std::numeric_limits<i64>::max(), 0);
+                    Status status = global_options_.AddOption(std::move(result_cache_size_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
             } else {
                 return Status::InvalidConfig("No 'buffer' section in configure file.");
             }
@@ -1626,6 +1810,21 @@ i64 Config::MemIndexCapacity() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexCapacity);
 }
 
+i64 Config::CompactWorkerCount() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kCompactWorkerCount);
+}
+
+i64 Config::CompactTableConcurrency() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kCompactTableConcurrency);
+}
+
+i64 Config::CompactCPULimit() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kCompactCPULimit);
+}
+
 // Buffer
 i64 Config::BufferManagerSize() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -1637,6 +1836,11 @@ String Config::TempDir() {
     return global_options_.GetStringValue(GlobalOptionIndex::kTempDir);
 }
 
+i64 Config::ResultCacheSize() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kResultCacheSize);
+}
+
 // WAL
 String Config::WALDir() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -1724,10 +1928,14 @@ void Config::PrintAll() {
     fmt::print(" - compact_interval: {}\n", Utility::FormatTimeInfo(CompactInterval()));
     fmt::print(" - optimize_index_interval: {}\n", Utility::FormatTimeInfo(OptimizeIndexInterval()));
     fmt::print(" - memindex_capacity: {}\n", Utility::FormatByteSize(MemIndexCapacity()));
+    fmt::print(" - compact_worker_count: {}\n", CompactWorkerCount());
+    fmt::print(" - compact_table_concurrency: {}\n", CompactTableConcurrency());
+    fmt::print(" - compact_cpu_limit: {}%\n", CompactCPULimit());
 
     // Buffer manager
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
     fmt::print(" - temp_dir: {}\n", TempDir());
+    fmt::print(" - result_cache_size: {}\n", Utility::FormatByteSize(ResultCacheSize()));
 
     // WAL
     fmt::print(" - wal_dir: {}\n", WALDir());
@@ -71,11 +71,19 @@ public:
 
     i64 MemIndexCapacity();
 
+    i64 CompactWorkerCount();
+
+    i64 CompactTableConcurrency();
+
+    i64 CompactCPULimit();
+
     // Buffer
     i64 BufferManagerSize();
 
     String TempDir();
 
+    i64 ResultCacheSize();
+
     // WAL
     String WALDir();
 
@@ -47,6 +47,7 @@ import insert_statement;
 import copy_statement;
 import delete_statement;
 import optimize_statement;
+import execute_statement;
 
 import create_schema_info;
 import drop_schema_info;
@@ -415,6 +416,32 @@ QueryResult Infinity::ShowTable(const String &db_name, const String &table_name)
     return result;
 }
 
+QueryResult Infinity::Prepare(const String &statement_name, const String &statement) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    QueryResult result = query_context_ptr->Prepare(statement_name, statement);
+    return result;
+}
+
+QueryResult Infinity::Execute(const String &statement_name, Vector<ParsedExpr *> *parameters) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    UniquePtr<ExecuteStatement> execute_statement = MakeUnique<ExecuteStatement>();
+    execute_statement->name_ = statement_name;
+    ToLower(execute_statement->name_);
+    execute_statement->parameters_ = parameters;
+    QueryResult result = query_context_ptr->Execute(execute_statement.get());
+    return result;
+}
+
 QueryResult Infinity::ShowColumns(const String &db_name, const String &table_name) {
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
@@ -678,6 +705,23 @@ QueryResult Infinity::Insert(const String &db_name, const String &table_name, Ve
     return result;
 }
 
+QueryResult Infinity::InsertColumns(const String &db_name, const String &table_name, Vector<InsertColumnData> *column_data) {
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    UniquePtr<InsertStatement> insert_statement = MakeUnique<InsertStatement>();
+
+    insert_statement->schema_name_ = db_name;
+    insert_statement->table_name_ = table_name;
+    insert_statement->column_data_ = column_data;
+
+    QueryResult result = query_context_ptr->QueryStatement(insert_statement.get());
+    return result;
+}
+
 QueryResult Infinity::Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options) {
 
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
@@ -764,8 +808,12 @@ QueryResult Infinity::Explain(const String &db_name,
     return result;
 }
 
-QueryResult
-Infinity::Search(const String &db_name, const String &table_name, SearchExpr *search_expr, ParsedExpr *filter, Vector<ParsedExpr *> *output_columns) {
+QueryResult Infinity::Search(const String &db_name,
+                             const String &table_name,
+                             SearchExpr *search_expr,
+                             ParsedExpr *filter,
+                             Vector<ParsedExpr *> *output_columns,
+                             const String *query_text) {
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
                             InfinityContext::instance().task_scheduler(),
@@ -782,7 +830,7 @@ Infinity::Search(const String &db_name, const String &table_name, SearchExpr *se
     select_statement->where_expr_ = filter;
     select_statement->search_expr_ = search_expr;
 
-    QueryResult result = query_context_ptr->QueryStatement(select_statement.get());
+    QueryResult result = query_context_ptr->QueryStatement(select_statement.get(), query_text);
     return result;
 }
 
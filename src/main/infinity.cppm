@@ -32,6 +32,7 @@ import create_index_info;
 import update_statement;
 import explain_statement;
 import command_statement;
+import insert_statement;
 
 namespace infinity {
 
@@ -88,6 +89,11 @@ public:
     // For embedded sqllogictest
     QueryResult Query(const String &query_text);
 
+    // Prepared statements, the statement is a single SELECT whose parameters are '?'
+    QueryResult Prepare(const String &statement_name, const String &statement);
+
+    QueryResult Execute(const String &statement_name, Vector<ParsedExpr *> *parameters);
+
     // Database related functions
     QueryResult CreateTable(const String &db_name,
                             const String &table_name,
@@ -137,6 +143,9 @@ public:
 
     QueryResult Insert(const String &db_name, const String &table_name, Vector<String> *columns, Vector<Vector<ParsedExpr *> *> *values);
 
+    // Inserts column buffers straight into the table blocks, without building an expression per value
+    QueryResult InsertColumns(const String &db_name, const String &table_name, Vector<InsertColumnData> *column_data);
+
     QueryResult Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options);
 
     QueryResult Delete(const String &db_name, const String &table_name, ParsedExpr *filter);
@@ -150,8 +159,13 @@ public:
                         ParsedExpr *filter,
                         Vector<ParsedExpr *> *output_columns);
 
-    QueryResult
-    Search(const String &db_name, const String &table_name, SearchExpr *search_expr, ParsedExpr *filter, Vector<ParsedExpr *> *output_columns);
+    // query_text identifies the request for the result cache, requests without it are never cached
+    QueryResult Search(const String &db_name,
+                       const String &table_name,
+                       SearchExpr *search_expr,
+                       ParsedExpr *filter,
+                       Vector<ParsedExpr *> *output_columns,
+                       const String *query_text = nullptr);
 
     QueryResult Optimize(const String &db_name, const String &table_name);
 
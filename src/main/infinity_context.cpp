@@ -58,6 +58,8 @@ void InfinityContext::Init(const SharedPtr<String> &config_path) {
 
         inverting_thread_pool_.resize(config_->CPULimit());
         commiting_thread_pool_.resize(config_->CPULimit());
+        merging_thread_pool_.resize(config_->CPULimit());
+        import_thread_pool_.resize(config_->CPULimit());
         initialized_ = true;
     }
 }
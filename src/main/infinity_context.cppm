@@ -41,6 +41,8 @@ public:
 
     [[nodiscard]] inline ThreadPool &GetFulltextInvertingThreadPool() { return inverting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetFulltextCommitingThreadPool() { return commiting_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetFulltextMergingThreadPool() { return merging_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetImportThreadPool() { return import_thread_pool_; }
 
     void Init(const SharedPtr<String> &config_path);
 
@@ -59,6 +61,9 @@ private:
     // For fulltext index
     ThreadPool inverting_thread_pool_{4};
     ThreadPool commiting_thread_pool_{2};
+    ThreadPool merging_thread_pool_{4};
+    // For parallel import
+    ThreadPool import_thread_pool_{4};
 
     bool initialized_{false};
 };
@@ -62,6 +62,10 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(DELTA_CHECKPOINT_THRESHOLD_OPTION_NAME)] = GlobalOptionIndex::kDeltaCheckpointThreshold;
     name2index_[String(WAL_FLUSH_OPTION_NAME)] = GlobalOptionIndex::kFlushMethodAtCommit;
     name2index_[String(RESOURCE_DIR_OPTION_NAME)] = GlobalOptionIndex::kResourcePath;
+    name2index_[String(RESULT_CACHE_SIZE_OPTION_NAME)] = GlobalOptionIndex::kResultCacheSize;
+    name2index_[String(COMPACT_WORKER_COUNT_OPTION_NAME)] = GlobalOptionIndex::kCompactWorkerCount;
+    name2index_[String(COMPACT_TABLE_CONCURRENCY_OPTION_NAME)] = GlobalOptionIndex::kCompactTableConcurrency;
+    name2index_[String(COMPACT_CPU_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kCompactCPULimit;
 }
 
 Status GlobalOptions::AddOption(UniquePtr<BaseOption> option) {
@@ -141,7 +141,11 @@ export enum class GlobalOptionIndex {
     kDeltaCheckpointThreshold = 26,
     kFlushMethodAtCommit = 27,
     kResourcePath = 28,
-    kInvalid = 29
+    kResultCacheSize = 29,
+    kCompactWorkerCount = 30,
+    kCompactTableConcurrency = 31,
+    kCompactCPULimit = 32,
+    kInvalid = 33
 };
 
 export struct GlobalOptions {
@@ -124,7 +124,14 @@ void TaskProfiler::StopOperator(const OperatorState *operator_state) {
         output_rows += output_data_block->Finalized() ? output_data_block->row_count() : 0;
     }
 
-    OperatorInformation info(active_operator_->GetName(), profiler_.GetBegin(), profiler_.GetEnd(), profiler_.Elapsed(), input_rows, output_data_size, output_rows);
+    OperatorInformation info(active_operator_->GetName(),
+                             profiler_.GetBegin(),
+                             profiler_.GetEnd(),
+                             profiler_.Elapsed(),
+                             input_rows,
+                             output_data_size,
+                             output_rows,
+                             operator_state->ProfileInfo());
 
     timings_.push_back(std::move(info));
     active_operator_ = nullptr;
@@ -236,8 +243,11 @@ void QueryProfiler::ExecuteRender(std::stringstream &ss) const {
                        << ": ElapsedTime: " << op.elapsed_
                        << ", InputRows: " << op.input_rows_
                        << ", OutputRows: " << op.output_rows_
-                       << ", OutputDataSize: " << op.output_data_size_
-                       << std::endl;
+                       << ", OutputDataSize: " << op.output_data_size_;
+                    if (!op.extra_info_.empty()) {
+                        ss << ", " << op.extra_info_;
+                    }
+                    ss << std::endl;
                 }
                 times ++;
             }
@@ -305,6 +315,9 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
                     json_info["input_rows"] = op.input_rows_;
                     json_info["output_rows"] = op.output_rows_;
                     json_info["output_data_size"] = op.output_data_size_;
+                    if (!op.extra_info_.empty()) {
+                        json_info["extra_info"] = op.extra_info_;
+                    }
                     json_operators["infos"].push_back(json_info);
                 }
                 times ++;
@@ -85,17 +85,18 @@ struct OperatorInformation {
 
     OperatorInformation(const OperatorInformation& other)
         : name_(other.name_), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
+          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_), extra_info_(other.extra_info_) {
 
     }
 
     OperatorInformation(OperatorInformation&& other)
         : name_(std::move(other.name_)), start_(other.start_), end_(other.end_), elapsed_(other.elapsed_), input_rows_(other.input_rows_),
-          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_) {
+          output_data_size_(other.output_data_size_), output_rows_(other.output_rows_), extra_info_(std::move(other.extra_info_)) {
     }
 
-    OperatorInformation(String name, i64 start, i64 end, i64 elapsed, u16 input_rows, i32 output_data_size, u16 output_rows)
-        : name_(std::move(name)), start_(start), end_(end), elapsed_(elapsed), input_rows_(input_rows), output_data_size_(output_data_size), output_rows_(output_rows) {
+    OperatorInformation(String name, i64 start, i64 end, i64 elapsed, u16 input_rows, i32 output_data_size, u16 output_rows, String extra_info = {})
+        : name_(std::move(name)), start_(start), end_(end), elapsed_(elapsed), input_rows_(input_rows), output_data_size_(output_data_size), output_rows_(output_rows),
+          extra_info_(std::move(extra_info)) {
     }
 
     OperatorInformation& operator=(OperatorInformation&& other) {
@@ -107,6 +108,7 @@ struct OperatorInformation {
             input_rows_ = other.input_rows_;
             output_rows_ = other.output_rows_;
             output_data_size_ = other.output_data_size_;
+            extra_info_ = std::move(other.extra_info_);
         }
         return *this;
     }
@@ -119,6 +121,8 @@ struct OperatorInformation {
     u16 input_rows_ {};
     i32 output_data_size_ {};
     u16 output_rows_ {};
+    // operator specific information, see OperatorState::ProfileInfo()
+    String extra_info_ {};
 };
 
 export struct TaskBinding {
@@ -16,6 +16,7 @@ module;
 
 #include <sstream>
 #include <csignal>
+#include <cctype>
 //#include "gperftools/profiler.h"
 
 module query_context;
@@ -52,9 +53,70 @@ import parser_result;
 import parser_assert;
 import plan_fragment;
 import bg_query_state;
+import prepare_statement;
+import execute_statement;
+import parsed_expr;
+import data_table;
+import select_statement;
+import table_reference;
+import table_entry;
+import result_cache;
+import constant_expr;
+import catalog;
+import logical_fusion;
+import logical_node_visitor;
+import logical_table_scan;
+import logical_index_scan;
+import logical_knn_scan;
+import logical_match_tensor_scan;
+import logical_match_sparse_scan;
+import common_query_filter;
+import base_expression;
+import column_expression;
+import value_expression;
+import knn_expression;
+import expression_type;
+import expression_binder;
+import filter_expression_push_down;
+import secondary_index_scan_execute_expression;
+import fast_rough_filter;
+import block_index;
+import internal_types;
 
 namespace infinity {
 
+namespace {
+
+// Two queries differing only in whitespace or keyword case get the same result cache key, quoted text is kept as it is.
+String NormalizeQueryText(const String &query) {
+    String normalized;
+    normalized.reserve(query.size());
+    char quote = 0;
+    for (char c : query) {
+        if (quote != 0) {
+            normalized.push_back(c);
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+            normalized.push_back(c);
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
+            if (!normalized.empty() && normalized.back() != ' ') {
+                normalized.push_back(' ');
+            }
+        } else {
+            normalized.push_back(static_cast<char>(ToLower(c)));
+        }
+    }
+    while (!normalized.empty() && (normalized.back() == ' ' || normalized.back() == ';')) {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+} // namespace
+
 QueryContext::QueryContext(BaseSession *session) : session_ptr_(session){};
 
 QueryContext::~QueryContext() { UnInit(); }
@@ -100,8 +162,19 @@ QueryResult QueryContext::Query(const String &query) {
     }
     StopProfile(QueryPhase::kParser);
     for (BaseStatement *statement : *parsed_result->statements_ptr_) {
-        QueryResult query_result = QueryStatement(statement);
-        return query_result;
+        switch (statement->type_) {
+            case StatementType::kPrepare: {
+                return HandlePrepare(std::move(parsed_result));
+            }
+            case StatementType::kExecute: {
+                return HandleExecute(static_cast<const ExecuteStatement *>(statement));
+            }
+            default: {
+                String query_text = NormalizeQueryText(query);
+                QueryResult query_result = QueryStatement(statement, &query_text);
+                return query_result;
+            }
+        }
     }
 
     String error_message = "Not reachable";
@@ -110,12 +183,368 @@ QueryResult QueryContext::Query(const String &query) {
     return QueryResult::UnusedResult();
 }
 
-QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
+QueryResult QueryContext::Prepare(const String &statement_name, const String &statement) {
+    QueryResult query_result;
+    UniquePtr<ParserResult> parsed_result = MakeUnique<ParserResult>();
+    parser_->Parse(statement, parsed_result.get());
+    if (parsed_result->IsError()) {
+        query_result.status_ = Status::SyntaxError(parsed_result->error_message_);
+        return query_result;
+    }
+    if (parsed_result->statements_ptr_->size() != 1 || (*parsed_result->statements_ptr_)[0]->type_ != StatementType::kSelect) {
+        query_result.status_ = Status::SyntaxError(fmt::format("Prepared statement: {} isn't a single SELECT", statement_name));
+        return query_result;
+    }
+
+    auto prepared_statement = MakeShared<PreparedStatement>();
+    prepared_statement->name_ = statement_name;
+    ToLower(prepared_statement->name_);
+    prepared_statement->statement_ = (*parsed_result->statements_ptr_)[0];
+    prepared_statement->parameter_count_ = parsed_result->parameter_count_;
+    prepared_statement->parser_result_ = std::move(parsed_result);
+    session_ptr_->AddPreparedStatement(std::move(prepared_statement));
+
+    query_result.result_table_ = DataTable::MakeEmptyResultTable();
+    query_result.root_operator_type_ = LogicalNodeType::kPrepare;
+    return query_result;
+}
+QueryResult QueryContext::HandlePrepare(UniquePtr<ParserResult> parsed_result) {
+    // Only the parsed statement is kept. Binding and planning depend on the catalog snapshot of the executing
+    // transaction, so they are done by the EXECUTE, which keeps the plan for the next one, see GetPreparedPlan.
+    auto *prepare_statement = static_cast<const PrepareStatement *>((*parsed_result->statements_ptr_)[0]);
+    auto prepared_statement = MakeShared<PreparedStatement>();
+    prepared_statement->name_ = prepare_statement->name_;
+    prepared_statement->statement_ = prepare_statement->statement_;
+    prepared_statement->parameter_count_ = prepare_statement->parameter_count_;
+    prepared_statement->parser_result_ = std::move(parsed_result);
+    session_ptr_->AddPreparedStatement(std::move(prepared_statement));
+
+    QueryResult query_result;
+    query_result.result_table_ = DataTable::MakeEmptyResultTable();
+    query_result.root_operator_type_ = LogicalNodeType::kPrepare;
+    return query_result;
+}
+
+QueryResult QueryContext::HandleExecute(const ExecuteStatement *execute_statement) {
+    QueryResult query_result;
+    SharedPtr<PreparedStatement> prepared_statement = session_ptr_->GetPreparedStatement(execute_statement->name_);
+    if (prepared_statement.get() == nullptr) {
+        query_result.status_ = Status::NotSupport(fmt::format("Prepared statement: {} doesn't exist", execute_statement->name_));
+        return query_result;
+    }
+
+    SizeT parameter_count = execute_statement->parameters_ == nullptr ? 0 : execute_statement->parameters_->size();
+    if (parameter_count != prepared_statement->parameter_count_) {
+        query_result.status_ = Status::SyntaxError(fmt::format("Prepared statement: {} expects {} parameters, but {} are given",
+                                                               prepared_statement->name_,
+                                                               prepared_statement->parameter_count_,
+                                                               parameter_count));
+        return query_result;
+    }
+    for (SizeT i = 0; i < parameter_count; ++i) {
+        if ((*execute_statement->parameters_)[i]->type_ != ParsedExprType::kConstant) {
+            query_result.status_ = Status::SyntaxError(fmt::format("Parameter ${} of prepared statement: {} isn't a constant",
+                                                                   i + 1,
+                                                                   prepared_statement->name_));
+            return query_result;
+        }
+    }
+
+    ++prepared_statement->execute_count_;
+    prepared_parameters_ = execute_statement->parameters_;
+    prepared_statement_ = prepared_statement.get();
+    // The binder fills the expressions of the slots, the serialized value tells whether a fixed parameter is the same
+    parameter_slots_.resize(parameter_count);
+    for (SizeT i = 0; i < parameter_count; ++i) {
+        const auto *constant_expr = static_cast<const ConstantExpr *>((*execute_statement->parameters_)[i]);
+        PreparedParameterSlot &slot = parameter_slots_[i];
+        slot.literal_type_ = constant_expr->literal_type_;
+        slot.value_key_.resize(constant_expr->GetSizeInBytes());
+        char *ptr = slot.value_key_.data();
+        constant_expr->WriteAdv(ptr);
+    }
+    query_result = QueryStatement(prepared_statement->statement_);
+    prepared_statement_ = nullptr;
+    parameter_slots_.clear();
+    bound_tables_.clear();
+    prepared_parameters_ = nullptr;
+    return query_result;
+}
+
+TableEntry *QueryContext::GetResultCacheTable(const BaseStatement *statement, const String *query_text, String &result_cache_key) {
+    if (query_text == nullptr || !storage_->result_cache()->Enabled() || statement->type_ != StatementType::kSelect) {
+        return nullptr;
+    }
+    const auto *select_statement = static_cast<const SelectStatement *>(statement);
+    if (select_statement->search_expr_ == nullptr || select_statement->nested_select_ != nullptr || select_statement->with_exprs_ != nullptr ||
+        select_statement->table_ref_ == nullptr || select_statement->table_ref_->type_ != TableRefType::kTable) {
+        return nullptr;
+    }
+    const auto *table_ref = static_cast<const TableReference *>(select_statement->table_ref_);
+    const String &db_name = table_ref->db_name_.empty() ? schema_name() : table_ref->db_name_;
+    auto [table_entry, status] = GetTxn()->GetTableByName(db_name, table_ref->table_name_);
+    if (!status.ok()) {
+        // Let the binder report the error
+        return nullptr;
+    }
+    result_cache_key = ResultCache::MakeKey(db_name, table_ref->table_name_, *query_text);
+    return table_entry;
+}
+
+namespace {
+
+// The match operator consumes the query tree of its logical node, so such a plan can't be built twice
+bool PlanReusable(const SharedPtr<LogicalNode> &logical_node) {
+    if (logical_node.get() == nullptr) {
+        return true;
+    }
+    if (logical_node->operator_type() == LogicalNodeType::kMatch) {
+        return false;
+    }
+    if (logical_node->operator_type() == LogicalNodeType::kFusion) {
+        for (const auto &child : static_cast<const LogicalFusion *>(logical_node.get())->other_children_) {
+            if (!PlanReusable(child)) {
+                return false;
+            }
+        }
+    }
+    return PlanReusable(logical_node->left_node()) && PlanReusable(logical_node->right_node());
+}
+
+// Collects the values and the KNN query embeddings evaluated by the plan, they can be overwritten by the next EXECUTE. The rough
+// filter sources and the original filters of the scans aren't visited: the index filters pushed down from them may be rewritten
+// from the values, such as a LIKE pattern, so a parameter reached only through them can't be overwritten.
+class PreparedParameterVisitor : public LogicalNodeVisitor {
+public:
+    void VisitNode(LogicalNode &op) final {
+        VisitNodeChildren(op);
+        VisitNodeExpression(op);
+        switch (op.operator_type()) {
+            case LogicalNodeType::kIndexScan: {
+                auto &index_scan = static_cast<LogicalIndexScan &>(op);
+                VisitExpression(index_scan.index_filter_qualified_);
+                break;
+            }
+            case LogicalNodeType::kKnnScan: {
+                auto &knn_scan = static_cast<LogicalKnnScan &>(op);
+                SharedPtr<BaseExpression> knn_expression = knn_scan.knn_expression_;
+                VisitExpression(knn_expression);
+                VisitCommonQueryFilter(knn_scan.common_query_filter_.get());
+                break;
+            }
+            case LogicalNodeType::kMatchTensorScan: {
+                VisitCommonQueryFilter(static_cast<LogicalMatchTensorScan &>(op).common_query_filter_.get());
+                break;
+            }
+            case LogicalNodeType::kMatchSparseScan: {
+                VisitCommonQueryFilter(static_cast<LogicalMatchSparseScan &>(op).common_query_filter_.get());
+                break;
+            }
+            case LogicalNodeType::kFusion: {
+                for (auto &child : static_cast<LogicalFusion &>(op).other_children_) {
+                    VisitNode(*child);
+                }
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+
+    SharedPtr<BaseExpression> VisitReplace(const SharedPtr<ColumnExpression> &expression) final { return expression; }
+
+    SharedPtr<BaseExpression> VisitReplace(const SharedPtr<ValueExpression> &expression) final {
+        expressions_.insert(expression.get());
+        return nullptr;
+    }
+
+    SharedPtr<BaseExpression> VisitReplace(const SharedPtr<KnnExpression> &expression) final {
+        expressions_.insert(expression.get());
+        return nullptr;
+    }
+
+    HashSet<const BaseExpression *> expressions_{};
+
+private:
+    void VisitCommonQueryFilter(CommonQueryFilter *common_query_filter) {
+        if (common_query_filter != nullptr and common_query_filter->secondary_index_filter_qualified_) {
+            VisitExpression(common_query_filter->secondary_index_filter_qualified_);
+        }
+    }
+};
+
+void ResetCommonQueryFilter(CommonQueryFilter *common_query_filter, TxnTimeStamp begin_ts) {
+    if (common_query_filter != nullptr) {
+        common_query_filter->ResetForPreparedPlan(begin_ts);
+    }
+}
+
+// The filters built by the optimizer from the values are built again, and the filter results of the last txn are dropped
+void ResetPreparedPlan(LogicalNode *logical_node, TxnTimeStamp begin_ts) {
+    if (logical_node == nullptr) {
+        return;
+    }
+    switch (logical_node->operator_type()) {
+        case LogicalNodeType::kTableScan: {
+            auto *table_scan = static_cast<LogicalTableScan *>(logical_node);
+            if (table_scan->fast_rough_filter_source_) {
+                table_scan->fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(table_scan->fast_rough_filter_source_);
+            }
+            break;
+        }
+        case LogicalNodeType::kIndexScan: {
+            auto *index_scan = static_cast<LogicalIndexScan *>(logical_node);
+            if (index_scan->fast_rough_filter_source_) {
+                index_scan->fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(index_scan->fast_rough_filter_source_);
+            }
+            index_scan->filter_execute_command_ = BuildSecondaryIndexScanCommand(index_scan->index_filter_qualified_);
+            break;
+        }
+        case LogicalNodeType::kKnnScan: {
+            ResetCommonQueryFilter(static_cast<LogicalKnnScan *>(logical_node)->common_query_filter_.get(), begin_ts);
+            break;
+        }
+        case LogicalNodeType::kMatchTensorScan: {
+            ResetCommonQueryFilter(static_cast<LogicalMatchTensorScan *>(logical_node)->common_query_filter_.get(), begin_ts);
+            break;
+        }
+        case LogicalNodeType::kMatchSparseScan: {
+            ResetCommonQueryFilter(static_cast<LogicalMatchSparseScan *>(logical_node)->common_query_filter_.get(), begin_ts);
+            break;
+        }
+        case LogicalNodeType::kFusion: {
+            for (const auto &child : static_cast<LogicalFusion *>(logical_node)->other_children_) {
+                ResetPreparedPlan(child.get(), begin_ts);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    ResetPreparedPlan(logical_node->left_node().get(), begin_ts);
+    ResetPreparedPlan(logical_node->right_node().get(), begin_ts);
+}
+
+} // namespace
+
+bool QueryContext::GetPreparedPlan(Vector<SharedPtr<LogicalNode>> &logical_plans) {
+    PreparedPlan *plan = prepared_statement_->plan_.get();
+    if (plan == nullptr || plan->catalog_version_ != catalog_version_) {
+        return false;
+    }
+    // Every parameter is bound again before any is overwritten, the plan isn't reused if one doesn't fit
+    SizeT parameter_count = parameter_slots_.size();
+    ExpressionBinder expression_binder(this);
+    Vector<SharedPtr<BaseExpression>> values(parameter_count);
+    Vector<Vector<UniquePtr<char[]>>> embeddings(parameter_count);
+    for (SizeT i = 0; i < parameter_count; ++i) {
+        const PreparedParameterSlot &slot = plan->parameter_slots_[i];
+        const PreparedParameterSlot &given_slot = parameter_slots_[i];
+        if (slot.literal_type_ != given_slot.literal_type_ || (slot.fixed_ && slot.value_key_ != given_slot.value_key_)) {
+            return false;
+        }
+        const auto *constant_expr = static_cast<const ConstantExpr *>((*prepared_parameters_)[i]);
+        if (!slot.value_expressions_.empty()) {
+            values[i] = expression_binder.BuildValueExpr(*constant_expr, nullptr, 0, false);
+            if (values[i]->type() != ExpressionType::kValue) {
+                return false;
+            }
+            for (const ValueExpression *value_expression : slot.value_expressions_) {
+                if (value_expression->Type() != values[i]->Type()) {
+                    return false;
+                }
+            }
+        }
+        for (const auto &[knn_expression, embedding_type] : slot.knn_expressions_) {
+            EmbeddingDataType data_type{};
+            i64 dimension{};
+            i64 query_count{};
+            UniquePtr<char[]> embedding{};
+            if (!ExpressionBinder::BuildParameterEmbedding(*constant_expr,
+                                                           embedding_type,
+                                                           knn_expression->distance_type_,
+                                                           data_type,
+                                                           dimension,
+                                                           query_count,
+                                                           embedding) ||
+                data_type != knn_expression->embedding_data_type_ || dimension != knn_expression->dimension_ ||
+                query_count != knn_expression->query_count_) {
+                return false;
+            }
+            embeddings[i].push_back(std::move(embedding));
+        }
+    }
+
+    for (SizeT i = 0; i < parameter_count; ++i) {
+        PreparedParameterSlot &slot = plan->parameter_slots_[i];
+        for (ValueExpression *value_expression : slot.value_expressions_) {
+            value_expression->SetValue(static_cast<const ValueExpression *>(values[i].get())->GetValue());
+        }
+        for (SizeT j = 0; j < slot.knn_expressions_.size(); ++j) {
+            KnnExpression *knn_expression = slot.knn_expressions_[j].first;
+            SizeT embedding_size = EmbeddingT::EmbeddingSize(knn_expression->embedding_data_type_, knn_expression->dimension_) * knn_expression->query_count_;
+            std::memcpy(knn_expression->query_embedding_.ptr, embeddings[i][j].get(), embedding_size);
+        }
+        slot.value_key_ = parameter_slots_[i].value_key_;
+    }
+    // The table references of the plans share the block indexes, they are replaced by the snapshots of this txn
+    Txn *txn = GetTxn();
+    for (const auto &[table_entry, block_index] : plan->block_indexes_) {
+        *block_index = std::move(*table_entry->GetBlockIndex(txn));
+    }
+    for (const auto &logical_plan : plan->logical_plans_) {
+        ResetPreparedPlan(logical_plan.get(), txn->BeginTS());
+    }
+    logical_plans = plan->logical_plans_;
+    current_max_node_id_ = plan->max_node_id_;
+    ++prepared_statement_->plan_hit_count_;
+    return true;
+}
+
+void QueryContext::PutPreparedPlan(const Vector<SharedPtr<LogicalNode>> &logical_plans) {
+    prepared_statement_->plan_.reset();
+    for (const auto &logical_plan : logical_plans) {
+        if (!PlanReusable(logical_plan)) {
+            return;
+        }
+    }
+    PreparedParameterVisitor visitor;
+    for (const auto &logical_plan : logical_plans) {
+        visitor.VisitNode(*logical_plan);
+    }
+    auto plan = MakeUnique<PreparedPlan>();
+    plan->catalog_version_ = catalog_version_;
+    plan->parameter_slots_ = std::move(parameter_slots_);
+    for (PreparedParameterSlot &slot : plan->parameter_slots_) {
+        // A parameter bound into nothing the plan can overwrite
+        slot.fixed_ = slot.value_expressions_.empty() && slot.knn_expressions_.empty();
+        for (const ValueExpression *value_expression : slot.value_expressions_) {
+            slot.fixed_ = slot.fixed_ || !visitor.expressions_.contains(value_expression);
+        }
+        for (const auto &[knn_expression, _] : slot.knn_expressions_) {
+            slot.fixed_ = slot.fixed_ || !visitor.expressions_.contains(knn_expression);
+        }
+    }
+    plan->block_indexes_ = std::move(bound_tables_);
+    plan->logical_plans_ = logical_plans;
+    plan->max_node_id_ = current_max_node_id_;
+    prepared_statement_->plan_ = std::move(plan);
+}
+
+QueryResult QueryContext::QueryStatement(const BaseStatement *statement, const String *query_text) {
     QueryResult query_result;
     Vector<SharedPtr<LogicalNode>> logical_plans{};
     Vector<UniquePtr<PhysicalOperator>> physical_plans{};
     SharedPtr<PlanFragment> plan_fragment{};
     UniquePtr<Notifier> notifier{};
+    TableEntry *cache_table_entry{};
+    u64 cache_data_version{};
+    String result_cache_key;
+    // The plan of an EXECUTE is kept only when it's run by its own txn, the uncommitted schema changes of an explicit txn aren't
+    // in the catalog version
+    bool use_prepared_plan = prepared_statement_ != nullptr && statement->type_ == StatementType::kSelect && GetTxn() == nullptr;
 
 //    ProfilerStart("Query");
 //    BaseProfiler profiler;
@@ -128,26 +557,55 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
 //                        statement->ToString()));
         RecordQueryProfiler(statement->type_);
 
-        // Build unoptimized logical plan for each SQL statement.
-        StartProfile(QueryPhase::kLogicalPlan);
-        SharedPtr<BindContext> bind_context;
-        auto status = logical_planner_->Build(statement, bind_context);
-        // FIXME
-        if (!status.ok()) {
-            LOG_ERROR(status.message());
-            RecoverableError(status);
+        cache_table_entry = GetResultCacheTable(statement, query_text, result_cache_key);
+        if (cache_table_entry != nullptr) {
+            TxnTimeStamp data_commit_ts{};
+            std::tie(cache_data_version, data_commit_ts) = cache_table_entry->GetDataVersion();
+            if (GetTxn()->BeginTS() <= data_commit_ts) {
+                // The snapshot of this txn doesn't include the latest write to the table
+                cache_table_entry = nullptr;
+            } else if (storage_->result_cache()->Get(result_cache_key,
+                                                     cache_table_entry->commit_ts_,
+                                                     cache_data_version,
+                                                     query_result.result_table_,
+                                                     query_result.root_operator_type_)) {
+                this->CommitTxn();
+                session_ptr_->IncreaseQueryCount();
+                session_manager_->IncreaseQueryCount();
+                return query_result;
+            }
         }
 
-        current_max_node_id_ = bind_context->GetNewLogicalNodeId();
-        logical_plans = logical_planner_->LogicalPlans();
-        StopProfile(QueryPhase::kLogicalPlan);
-//        LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
-        // Apply optimized rule to the logical plan
-        StartProfile(QueryPhase::kOptimizer);
-        for (auto &logical_plan : logical_plans) {
-            optimizer_->optimize(logical_plan, statement->type_);
+        if (use_prepared_plan) {
+            // Read after the txn begins: a schema change taking its commit ts before the begin ts has increased the version
+            catalog_version_ = storage_->catalog()->catalog_version();
+        }
+        if (!use_prepared_plan || !GetPreparedPlan(logical_plans)) {
+            // Build unoptimized logical plan for each SQL statement.
+            StartProfile(QueryPhase::kLogicalPlan);
+            SharedPtr<BindContext> bind_context;
+            auto status = logical_planner_->Build(statement, bind_context);
+            // FIXME
+            if (!status.ok()) {
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+
+            current_max_node_id_ = bind_context->GetNewLogicalNodeId();
+            logical_plans = logical_planner_->LogicalPlans();
+            StopProfile(QueryPhase::kLogicalPlan);
+//            LOG_WARN(fmt::format("Before optimizer cost: {}", profiler.ElapsedToString()));
+            // Apply optimized rule to the logical plan
+            StartProfile(QueryPhase::kOptimizer);
+            for (auto &logical_plan : logical_plans) {
+                optimizer_->optimize(logical_plan, statement->type_);
+            }
+            StopProfile(QueryPhase::kOptimizer);
+
+            if (use_prepared_plan) {
+                PutPreparedPlan(logical_plans);
+            }
         }
-        StopProfile(QueryPhase::kOptimizer);
 
         // Build physical plan
         StartProfile(QueryPhase::kPhysicalPlan);
@@ -177,6 +635,14 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
         scheduler_->Schedule(plan_fragment.get(), statement);
         query_result.result_table_ = plan_fragment->GetResult();
         query_result.root_operator_type_ = logical_plans.back()->operator_type();
+        if (cache_table_entry != nullptr && cache_table_entry->GetDataVersion().first == cache_data_version) {
+            // No write to the table started committing while the query was running
+            storage_->result_cache()->Put(result_cache_key,
+                                          cache_table_entry->commit_ts_,
+                                          cache_data_version,
+                                          query_result.result_table_,
+                                          query_result.root_operator_type_);
+        }
         StopProfile(QueryPhase::kExecution);
 //        LOG_WARN(fmt::format("Before commit cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kCommit);
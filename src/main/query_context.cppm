@@ -29,16 +29,24 @@ import optimizer;
 import status;
 import query_result;
 import base_statement;
+import parser_result;
+import parsed_expr;
+import execute_statement;
 
 export module query_context;
 
 namespace infinity {
 
 class LogicalPlanner;
+class LogicalNode;
+struct TableEntry;
 class PhysicalPlanner;
 class FragmentBuilder;
 class TaskScheduler;
 struct BGQueryState;
+struct BlockIndex;
+class ValueExpression;
+class KnnExpression;
 
 export class QueryContext {
 
@@ -64,7 +72,40 @@ public:
 
     QueryResult Query(const String &query);
 
-    QueryResult QueryStatement(const BaseStatement *statement);
+    // query_text is the normalized text of the statement. If it's given, the result of a single table search may be served from and
+    // stored into the result cache.
+    QueryResult QueryStatement(const BaseStatement *statement, const String *query_text = nullptr);
+
+    // PREPARE and EXECUTE given by the API rather than the SQL text, statement is a single SELECT whose parameters are '?'
+    QueryResult Prepare(const String &statement_name, const String &statement);
+
+    inline QueryResult Execute(const ExecuteStatement *execute_statement) { return HandleExecute(execute_statement); }
+
+    // Parameters given by the EXECUTE being run, bound in place of the '?' of the prepared statement
+    [[nodiscard]] inline const Vector<ParsedExpr *> *prepared_parameters() const { return prepared_parameters_; }
+
+    // An EXECUTE is being run, its plan may be kept for the next one
+    [[nodiscard]] inline bool executing_prepared() const { return prepared_statement_ != nullptr; }
+
+    // Records a table bound by the plan of the EXECUTE being run, its block index is taken again when the plan is reused
+    inline void AddBoundTable(TableEntry *table_entry, SharedPtr<BlockIndex> block_index) {
+        if (prepared_statement_ != nullptr) {
+            bound_tables_.emplace_back(table_entry, std::move(block_index));
+        }
+    }
+
+    // Records an expression bound from the parameter, it's overwritten when the plan is reused, see GetPreparedPlan
+    inline void AddParameterExpression(SizeT parameter_index, ValueExpression *value_expression) {
+        if (prepared_statement_ != nullptr) {
+            parameter_slots_[parameter_index].value_expressions_.push_back(value_expression);
+        }
+    }
+
+    inline void AddParameterKnnExpression(SizeT parameter_index, KnnExpression *knn_expression, const String &embedding_type) {
+        if (prepared_statement_ != nullptr) {
+            parameter_slots_[parameter_index].knn_expressions_.emplace_back(knn_expression, embedding_type);
+        }
+    }
 
     bool ExecuteBGStatement(BaseStatement *statement, BGQueryState &state);
 
@@ -130,6 +171,16 @@ public:
     }
 
 private:
+    QueryResult HandlePrepare(UniquePtr<ParserResult> parsed_result);
+
+    QueryResult HandleExecute(const ExecuteStatement *execute_statement);
+
+    TableEntry *GetResultCacheTable(const BaseStatement *statement, const String *query_text, String &result_cache_key);
+
+    bool GetPreparedPlan(Vector<SharedPtr<LogicalNode>> &logical_plans);
+
+    void PutPreparedPlan(const Vector<SharedPtr<LogicalNode>> &logical_plans);
+
     inline void CreateQueryProfiler() {
         if (is_enable_profiling()) {
             query_profiler_ = MakeShared<QueryProfiler>(true);
@@ -178,6 +229,12 @@ private:
 
     u64 catalog_version_{};
 
+    const Vector<ParsedExpr *> *prepared_parameters_{};
+    // Set while an EXECUTE is run, see GetPreparedPlan
+    PreparedStatement *prepared_statement_{};
+    Vector<PreparedParameterSlot> parameter_slots_{};
+    Vector<Pair<TableEntry *, SharedPtr<BlockIndex>>> bound_tables_{};
+
     // User / Tenant information
     String tenant_name_;
     String user_name_;
@@ -22,9 +22,53 @@ import config;
 import options;
 import profiler;
 import catalog;
+import parser_result;
+import base_statement;
+import constant_expr;
 
 namespace infinity {
 
+class LogicalNode;
+struct TableEntry;
+struct BlockIndex;
+class ValueExpression;
+class KnnExpression;
+
+// The expressions bound from one '?' of a prepared statement, they are overwritten by the next EXECUTE.
+export struct PreparedParameterSlot {
+    LiteralType literal_type_{};
+    // The parameter also went somewhere the plan can't overwrite, the plan is reused only with the same value
+    bool fixed_{false};
+    String value_key_{};
+    Vector<ValueExpression *> value_expressions_{};
+    // The query embeddings of KNN, with the element type named by the statement
+    Vector<Pair<KnnExpression *, String>> knn_expressions_{};
+};
+
+// The optimized plans built by an EXECUTE, reused by the next EXECUTE while no schema change has committed since. The
+// parameters are rebound into the slots, the filters built from them by the optimizer are built again. The per-txn state
+// is rebuilt too: the block indexes of the tables and the filter results of KNN.
+export struct PreparedPlan {
+    u64 catalog_version_{};
+    Vector<PreparedParameterSlot> parameter_slots_{};
+    // The tables bound by the plans and their block indexes, shared by the table references of the plans
+    Vector<Pair<TableEntry *, SharedPtr<BlockIndex>>> block_indexes_{};
+    Vector<SharedPtr<LogicalNode>> logical_plans_{};
+    u64 max_node_id_{};
+};
+
+// A statement registered by PREPARE. The parser result owns the statement tree, so it is parsed once and
+// only the '?' parameters are bound again on each EXECUTE, unless the plan of the last EXECUTE is still valid.
+export struct PreparedStatement {
+    String name_{};
+    UniquePtr<ParserResult> parser_result_{};
+    const BaseStatement *statement_{};
+    SizeT parameter_count_{};
+    u64 execute_count_{};
+    UniquePtr<PreparedPlan> plan_{};
+    u64 plan_hit_count_{};
+};
+
 export enum class SessionType {
     kLocal,
     kRemote,
@@ -64,6 +108,21 @@ public:
 
     bool GetProfile() const { return enable_profile_; }
 
+    // PREPARE with an existing name replaces the old statement
+    void AddPreparedStatement(SharedPtr<PreparedStatement> prepared_statement) {
+        String name = prepared_statement->name_;
+        prepared_statements_[name] = std::move(prepared_statement);
+    }
+
+    SharedPtr<PreparedStatement> GetPreparedStatement(const String &name) const {
+        if (auto iter = prepared_statements_.find(name); iter != prepared_statements_.end()) {
+            return iter->second;
+        }
+        return nullptr;
+    }
+
+    bool DropPreparedStatement(const String &name) { return prepared_statements_.erase(name) > 0; }
+
 protected:
     std::time_t connected_time_;
 
@@ -83,6 +142,9 @@ protected:
     u64 rollbacked_txn_count_{0};
 
     bool enable_profile_{false};
+
+    // Sessions are served by one thread at a time, no lock is needed
+    HashMap<String, SharedPtr<PreparedStatement>> prepared_statements_{};
 };
 
 export class LocalSession : public BaseSession {
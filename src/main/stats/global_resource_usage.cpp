@@ -11,24 +11,154 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+
 module;
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 import stl;
 
 module global_resource_usage;
 
 namespace infinity {
 
+namespace {
+
+struct ThreadResourceCounters {
+    Array<ai64, kResourceCounterCount> object_counts_{};
+    Array<ai64, kResourceCounterCount> raw_memory_counts_{};
+};
+
+struct ResourceCounterRegistry {
+    std::mutex mutex_{};
+    Vector<ThreadResourceCounters *> thread_counters_{};
+    // counts of the exited threads, and of the objects destroyed by a thread after its own counters
+    ThreadResourceCounters retired_counters_{};
+};
+
+ResourceCounterRegistry &Registry() {
+    // never destroyed: objects destroyed by the static destructors still decrement their counters
+    static auto *registry = new ResourceCounterRegistry();
+    return *registry;
+}
+
+// set when the counters of the thread are gone, it has no destructor so it outlives every thread_local object
+thread_local bool thread_counters_retired = false;
+
+struct ThreadCounterHolder {
+    ThreadCounterHolder() {
+        ResourceCounterRegistry &registry = Registry();
+        std::scoped_lock lock(registry.mutex_);
+        registry.thread_counters_.push_back(&counters_);
+    }
+
+    ~ThreadCounterHolder() {
+        ResourceCounterRegistry &registry = Registry();
+        std::scoped_lock lock(registry.mutex_);
+        for (SizeT i = 0; i < kResourceCounterCount; ++i) {
+            registry.retired_counters_.object_counts_[i].fetch_add(counters_.object_counts_[i].load(std::memory_order_relaxed),
+                                                                   std::memory_order_relaxed);
+            registry.retired_counters_.raw_memory_counts_[i].fetch_add(counters_.raw_memory_counts_[i].load(std::memory_order_relaxed),
+                                                                       std::memory_order_relaxed);
+        }
+        std::erase(registry.thread_counters_, &counters_);
+        thread_counters_retired = true;
+    }
+
+    ThreadResourceCounters counters_{};
+};
+
+ThreadResourceCounters *LocalCounters() {
+    if (thread_counters_retired) [[unlikely]] {
+        return nullptr;
+    }
+    thread_local ThreadCounterHolder holder;
+    return &holder.counters_;
+}
+
+// Only the owner thread writes its counters, a relaxed load and store is enough and other threads still read whole values.
+template <Array<ai64, kResourceCounterCount> ThreadResourceCounters::*Counters>
+inline void AddToCounter(ResourceCounter counter, i64 delta) {
+    const auto idx = static_cast<SizeT>(counter);
+    ThreadResourceCounters *counters = LocalCounters();
+    if (counters == nullptr) [[unlikely]] {
+        (Registry().retired_counters_.*Counters)[idx].fetch_add(delta, std::memory_order_relaxed);
+        return;
+    }
+    ai64 &value = (counters->*Counters)[idx];
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+template <Array<ai64, kResourceCounterCount> ThreadResourceCounters::*Counters>
+i64 SumCounter(SizeT begin_idx, SizeT end_idx) {
+    ResourceCounterRegistry &registry = Registry();
+    std::scoped_lock lock(registry.mutex_);
+    i64 sum = 0;
+    for (SizeT i = begin_idx; i < end_idx; ++i) {
+        sum += (registry.retired_counters_.*Counters)[i].load(std::memory_order_relaxed);
+        for (ThreadResourceCounters *thread_counters : registry.thread_counters_) {
+            sum += (thread_counters->*Counters)[i].load(std::memory_order_relaxed);
+        }
+    }
+    return sum;
+}
+
+void ResetCounters() {
+    ResourceCounterRegistry &registry = Registry();
+    std::scoped_lock lock(registry.mutex_);
+    auto reset = [](ThreadResourceCounters &counters) {
+        for (SizeT i = 0; i < kResourceCounterCount; ++i) {
+            counters.object_counts_[i].store(0, std::memory_order_relaxed);
+            counters.raw_memory_counts_[i].store(0, std::memory_order_relaxed);
+        }
+    };
+    reset(registry.retired_counters_);
+    for (ThreadResourceCounters *thread_counters : registry.thread_counters_) {
+        reset(*thread_counters);
+    }
+}
+
+} // namespace
+
 atomic_bool GlobalResourceUsage::initialized_ = false;
 
-i64 GlobalResourceUsage::object_count_ = 0;
-HashMap<String, i64> GlobalResourceUsage::object_map_;
+void GlobalResourceUsage::Init() {
+    if (initialized_) {
+        return;
+    }
+    ResetCounters();
+    initialized_ = true;
+}
+
+void GlobalResourceUsage::UnInit() {
+    if (initialized_) {
+        ResetCounters();
+        initialized_ = false;
+    }
+}
+
+void GlobalResourceUsage::IncrObjectCount(ResourceCounter counter) { AddToCounter<&ThreadResourceCounters::object_counts_>(counter, 1); }
+
+void GlobalResourceUsage::DecrObjectCount(ResourceCounter counter) { AddToCounter<&ThreadResourceCounters::object_counts_>(counter, -1); }
+
+i64 GlobalResourceUsage::GetObjectCount() { return SumCounter<&ThreadResourceCounters::object_counts_>(0, kResourceCounterCount); }
+
+i64 GlobalResourceUsage::GetObjectCount(ResourceCounter counter) {
+    const auto idx = static_cast<SizeT>(counter);
+    return SumCounter<&ThreadResourceCounters::object_counts_>(idx, idx + 1);
+}
+
+void GlobalResourceUsage::IncrRawMemCount(ResourceCounter counter) { AddToCounter<&ThreadResourceCounters::raw_memory_counts_>(counter, 1); }
 
-i64 GlobalResourceUsage::raw_memory_count_ = 0;
-HashMap<String, i64> GlobalResourceUsage::raw_memory_map_;
+void GlobalResourceUsage::DecrRawMemCount(ResourceCounter counter) { AddToCounter<&ThreadResourceCounters::raw_memory_counts_>(counter, -1); }
 
-std::mutex GlobalResourceUsage::object_mutex_{};
+i64 GlobalResourceUsage::GetRawMemoryCount() { return SumCounter<&ThreadResourceCounters::raw_memory_counts_>(0, kResourceCounterCount); }
 
-std::mutex GlobalResourceUsage::raw_memory_mutex_{};
+i64 GlobalResourceUsage::GetRawMemoryCount(ResourceCounter counter) {
+    const auto idx = static_cast<SizeT>(counter);
+    return SumCounter<&ThreadResourceCounters::raw_memory_counts_>(idx, idx + 1);
+}
 
 } // namespace infinity
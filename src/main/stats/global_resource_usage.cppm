@@ -20,79 +20,52 @@ export module global_resource_usage;
 
 namespace infinity {
 
+// The objects and raw memory allocations counted by GlobalResourceUsage
+export enum class ResourceCounter : u8 {
+    kColumnVector,
+    kVectorBuffer,
+    kVectorHeapChunk,
+    kHeapChunk,
+    kStringHeapMgr,
+    kFixHeapManager,
+    kSelection,
+    kSelectionData,
+    kBitmask,
+    kBitmaskBuffer,
+    kValue,
+    kAllocator,
+
+    kInvalid,
+};
+
+export constexpr SizeT kResourceCounterCount = static_cast<SizeT>(ResourceCounter::kInvalid);
+
+// The counters are updated on construction and destruction of hot objects, so every thread counts into its own slots
+// without locking or atomic read-modify-write. The slots of all threads are only summed up when a count is read.
 export class GlobalResourceUsage {
 public:
-    static inline void Init() {
-        if (initialized_) {
-            return;
-        }
-        object_count_ = 0;
-        raw_memory_count_ = 0;
-        initialized_ = true;
-    }
-
-    static inline void UnInit() {
-        if (initialized_) {
-            object_count_ = 0;
-            raw_memory_count_ = 0;
-            initialized_ = false;
-        }
-    }
-
-    static inline void IncrObjectCount(const String &key) {
-        std::unique_lock<std::mutex> unique_locker(object_mutex_);
-        ++object_map_[key];
-        ++object_count_;
-    }
-
-    static void DecrObjectCount(const String &key) {
-        std::unique_lock<std::mutex> unique_locker(object_mutex_);
-        --object_map_[key];
-        --object_count_;
-    }
-
-    static i64 GetObjectCount() {
-        std::unique_lock<std::mutex> unique_locker(object_mutex_);
-        return object_count_;
-    }
-
-    static i64 GetObjectCount(const String &key) {
-        std::unique_lock<std::mutex> unique_locker(object_mutex_);
-        return object_map_[key];
-    }
-
-    static void IncrRawMemCount(const String &key) {
-        std::unique_lock<std::mutex> unique_locker(raw_memory_mutex_);
-        ++raw_memory_count_;
-        ++raw_memory_map_[key];
-    }
-
-    static void DecrRawMemCount(const String &key) {
-        std::unique_lock<std::mutex> unique_locker(raw_memory_mutex_);
-        --raw_memory_count_;
-        --raw_memory_map_[key];
-    }
-
-    static i64 GetRawMemoryCount() {
-        std::unique_lock<std::mutex> unique_locker(raw_memory_mutex_);
-        return raw_memory_count_;
-    }
-
-    static i64 GetRawMemoryCount(const String &key) {
-        std::unique_lock<std::mutex> unique_locker(raw_memory_mutex_);
-        return raw_memory_map_[key];
-    }
+    static void Init();
 
-private:
-    static atomic_bool initialized_;
+    static void UnInit();
+
+    static void IncrObjectCount(ResourceCounter counter);
+
+    static void DecrObjectCount(ResourceCounter counter);
 
-    static std::mutex object_mutex_;
-    static i64 object_count_;
-    static HashMap<String, i64> object_map_;
+    static i64 GetObjectCount();
 
-    static std::mutex raw_memory_mutex_;
-    static i64 raw_memory_count_;
-    static HashMap<String, i64> raw_memory_map_;
+    static i64 GetObjectCount(ResourceCounter counter);
+
+    static void IncrRawMemCount(ResourceCounter counter);
+
+    static void DecrRawMemCount(ResourceCounter counter);
+
+    static i64 GetRawMemoryCount();
+
+    static i64 GetRawMemoryCount(ResourceCounter counter);
+
+private:
+    static atomic_bool initialized_;
 };
 
 } // namespace infinity
@@ -38,6 +38,10 @@ void VarUtil::InitVariablesMap() {
     global_name_map_["bg_task_count"] = GlobalVariable::kBackgroundTaskCount;
     global_name_map_["running_bg_task"] = GlobalVariable::kRunningBGTask;
     global_name_map_["running_compact_task"] = GlobalVariable::kRunningCompactTask;
+    global_name_map_["result_cache_usage"] = GlobalVariable::kResultCacheUsage;
+    global_name_map_["result_cache_hit_rate"] = GlobalVariable::kResultCacheHitRate;
+    global_name_map_["object_count"] = GlobalVariable::kObjectCount;
+    global_name_map_["raw_memory_count"] = GlobalVariable::kRawMemoryCount;
 
     session_name_map_["query_count"] = SessionVariable::kQueryCount;
     session_name_map_["total_commit_count"] = SessionVariable::kTotalCommitCount;
@@ -40,6 +40,10 @@ export enum class GlobalVariable {
     kBackgroundTaskCount,       // global
     kRunningBGTask,             // global
     kRunningCompactTask,        // global
+    kResultCacheUsage,          // global
+    kResultCacheHitRate,        // global
+    kObjectCount,               // global
+    kRawMemoryCount,            // global
     kInvalid,
 };
 
@@ -300,6 +300,13 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
                         object_width = 8;
                         break;
                     }
+                    case kElemFloat16:
+                    case kElemBFloat16: {
+                        // no half precision type in postgres, report as float4 array
+                        object_id = 1021;
+                        object_width = 2;
+                        break;
+                    }
                     case kElemInvalid: {
                         String error_message = "Invalid embedding data type";
                         LOG_CRITICAL(error_message);
@@ -405,6 +412,10 @@ void Connection::SendQueryResponse(const QueryResult &query_result) {
             message = *query_result.result_table_->result_msg();
             break;
         }
+        case LogicalNodeType::kPrepare: {
+            message = "PREPARE";
+            break;
+        }
 
         default: {
             message = fmt::format("SELECT {}", std::to_string(query_result.result_table_->row_count()));
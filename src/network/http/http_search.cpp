@@ -14,6 +14,7 @@
 
 module;
 
+#include <cstring>
 #include <string>
 
 module http_search;
@@ -191,7 +192,9 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
             search_exprs = nullptr;
         }
 
-        const QueryResult result = infinity_ptr->Search(db_name, table_name, search_expr, filter, output_columns);
+        // json objects keep their keys sorted, so the dump is the same for equivalent request bodies
+        String query_text = input_json.dump();
+        const QueryResult result = infinity_ptr->Search(db_name, table_name, search_expr, filter, output_columns, &query_text);
 
         output_columns = nullptr;
         filter = nullptr;
@@ -412,9 +415,21 @@ KnnExpr *HTTPSearch::ParseKnn(const nlohmann::json &knn_json_object, HTTPStatus
                 return nullptr;
             }
 
-            auto [dimension, embedding_ptr] = ParseVector(field_json_obj.value(), knn_expr->embedding_data_type_, http_status, response);
-            knn_expr->dimension_ = dimension;
-            knn_expr->embedding_data_ptr_ = embedding_ptr;
+            const auto &query_json = field_json_obj.value();
+            if (query_json.is_array() && !query_json.empty() && query_json[0].is_array()) {
+                // A batch of query vectors, the results are grouped by query in the order of the batch
+                auto [dimension, query_count, embedding_ptr] = ParseVectorBatch(query_json, knn_expr->embedding_data_type_, http_status, response);
+                if (embedding_ptr == nullptr) {
+                    return nullptr;
+                }
+                knn_expr->dimension_ = dimension;
+                knn_expr->query_count_ = query_count;
+                knn_expr->embedding_data_ptr_ = embedding_ptr;
+            } else {
+                auto [dimension, embedding_ptr] = ParseVector(query_json, knn_expr->embedding_data_type_, http_status, response);
+                knn_expr->dimension_ = dimension;
+                knn_expr->embedding_data_ptr_ = embedding_ptr;
+            }
         } else if (IsEqual(key, "element_type")) {
             ;
         } else if (IsEqual(key, "top_k")) {
@@ -593,4 +608,38 @@ HTTPSearch::ParseVector(const nlohmann::json &json_object, EmbeddingDataType ele
     }
 }
 
+Tuple<i64, i64, void *>
+HTTPSearch::ParseVectorBatch(const nlohmann::json &json_object, EmbeddingDataType elem_type, HTTPStatus &http_status, nlohmann::json &response) {
+    // ParseVector only accepts float vectors
+    SizeT query_count = json_object.size();
+    i64 dimension = 0;
+    f32 *batch_data_ptr = nullptr;
+    DeferFn defer_free_batch([&]() {
+        if (batch_data_ptr != nullptr) {
+            delete[] batch_data_ptr;
+            batch_data_ptr = nullptr;
+        }
+    });
+    for (SizeT query_idx = 0; query_idx < query_count; ++query_idx) {
+        auto [query_dimension, query_ptr] = ParseVector(json_object[query_idx], elem_type, http_status, response);
+        if (query_ptr == nullptr) {
+            return {0, 0, nullptr};
+        }
+        UniquePtr<f32[]> query_data(static_cast<f32 *>(query_ptr));
+        if (query_idx == 0) {
+            dimension = query_dimension;
+            batch_data_ptr = new f32[query_count * dimension];
+        } else if (query_dimension != dimension) {
+            response["error_code"] = ErrorCode::kInvalidEmbeddingDataType;
+            response["error_message"] = fmt::format("Query vector {} has dimension {}, but the first one has {}", query_idx, query_dimension, dimension);
+            return {0, 0, nullptr};
+        }
+        std::memcpy(batch_data_ptr + query_idx * dimension, query_data.get(), dimension * sizeof(f32));
+    }
+
+    f32 *res = batch_data_ptr;
+    batch_data_ptr = nullptr;
+    return {dimension, query_count, res};
+}
+
 } // namespace infinity
@@ -46,6 +46,10 @@ public:
 
     static Tuple<i64, void *>
     ParseVector(const nlohmann::json &json_object, EmbeddingDataType elem_type, HTTPStatus &http_status, nlohmann::json &response);
+
+    // Parses [[...], [...], ...] into one buffer of query_count vectors, returns the dimension and the query_count
+    static Tuple<i64, i64, void *>
+    ParseVectorBatch(const nlohmann::json &json_object, EmbeddingDataType elem_type, HTTPStatus &http_status, nlohmann::json &response);
 };
 
 } // namespace infinity
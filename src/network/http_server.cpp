@@ -53,6 +53,7 @@ import decimal_info;
 import status;
 import constant_expr;
 import command_statement;
+import insert_statement;
 
 namespace {
 
@@ -323,6 +324,10 @@ public:
                     e_data_type = EmbeddingDataType::kElemFloat;
                 } else if (etype == "double") {
                     e_data_type = EmbeddingDataType::kElemDouble;
+                } else if (etype == "float16") {
+                    e_data_type = EmbeddingDataType::kElemFloat16;
+                } else if (etype == "bfloat16") {
+                    e_data_type = EmbeddingDataType::kElemBFloat16;
                 } else {
                     e_data_type = EmbeddingDataType::kElemInvalid;
                 }
@@ -644,6 +649,119 @@ public:
     }
 };
 
+// Packs the JSON values of a column into a column buffer: integers as bigint, floats as double, strings as varchar and
+// arrays as embeddings of float or bigint elements. A column of numbers or of embeddings is packed as floats if any of
+// its numbers is a float. The engine casts the buffer to the column type a block at a time.
+// Returns the error message if the values can't be packed.
+String PackInsertColumn(const nlohmann::json &values_json, InsertColumnData &column_data) {
+    SizeT row_count = values_json.size();
+    column_data.row_count_ = row_count;
+    const auto &first_json = values_json[0];
+    bool has_float = false;
+    for (const auto &value_json : values_json) {
+        if (value_json.is_array()) {
+            for (const auto &elem_json : value_json) {
+                has_float = has_float || elem_json.is_number_float();
+            }
+        } else {
+            has_float = has_float || value_json.is_number_float();
+        }
+    }
+    auto value_type = first_json.type();
+    if (has_float && first_json.is_number()) {
+        value_type = nlohmann::json::value_t::number_float;
+    }
+    switch (value_type) {
+        case nlohmann::json::value_t::boolean: {
+            column_data.data_type_ = MakeShared<DataType>(LogicalType::kBoolean);
+            column_data.data_.reserve(row_count);
+            for (const auto &value_json : values_json) {
+                if (!value_json.is_boolean()) {
+                    return fmt::format("Column: {} expect type BOOL", column_data.column_name_);
+                }
+                column_data.data_.push_back(value_json.template get<bool>());
+            }
+            break;
+        }
+        case nlohmann::json::value_t::number_integer:
+        case nlohmann::json::value_t::number_unsigned: {
+            column_data.data_type_ = MakeShared<DataType>(LogicalType::kBigInt);
+            column_data.data_.resize(row_count * sizeof(BigIntT));
+            auto *values = reinterpret_cast<BigIntT *>(column_data.data_.data());
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                const auto &value_json = values_json[row_idx];
+                if (!value_json.is_number_integer()) {
+                    return fmt::format("Column: {} expect type INTEGER", column_data.column_name_);
+                }
+                values[row_idx] = value_json.template get<BigIntT>();
+            }
+            break;
+        }
+        case nlohmann::json::value_t::number_float: {
+            column_data.data_type_ = MakeShared<DataType>(LogicalType::kDouble);
+            column_data.data_.resize(row_count * sizeof(DoubleT));
+            auto *values = reinterpret_cast<DoubleT *>(column_data.data_.data());
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                const auto &value_json = values_json[row_idx];
+                if (!value_json.is_number()) {
+                    return fmt::format("Column: {} expect type FLOAT", column_data.column_name_);
+                }
+                values[row_idx] = value_json.template get<DoubleT>();
+            }
+            break;
+        }
+        case nlohmann::json::value_t::string: {
+            column_data.data_type_ = MakeShared<DataType>(LogicalType::kVarchar);
+            column_data.varchar_offsets_.reserve(row_count + 1);
+            column_data.varchar_offsets_.push_back(0);
+            for (const auto &value_json : values_json) {
+                if (!value_json.is_string()) {
+                    return fmt::format("Column: {} expect type STRING", column_data.column_name_);
+                }
+                const auto &string_value = value_json.template get_ref<const String &>();
+                column_data.data_.insert(column_data.data_.end(), string_value.begin(), string_value.end());
+                column_data.varchar_offsets_.push_back(column_data.data_.size());
+            }
+            break;
+        }
+        case nlohmann::json::value_t::array: {
+            SizeT dimension = first_json.size();
+            if (dimension == 0) {
+                return fmt::format("Column: {} has empty embedding data", column_data.column_name_);
+            }
+            column_data.data_type_ =
+                MakeShared<DataType>(LogicalType::kEmbedding, EmbeddingInfo::Make(has_float ? EmbeddingDataType::kElemFloat : EmbeddingDataType::kElemInt64, dimension));
+            column_data.data_.resize(row_count * column_data.data_type_->Size());
+            auto *float_values = reinterpret_cast<FloatT *>(column_data.data_.data());
+            auto *integer_values = reinterpret_cast<BigIntT *>(column_data.data_.data());
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                const auto &embedding_json = values_json[row_idx];
+                if (!embedding_json.is_array() || embedding_json.size() != dimension) {
+                    return fmt::format("Column: {} expect embeddings of dimension {}", column_data.column_name_, dimension);
+                }
+                for (SizeT idx = 0; idx < dimension; ++idx) {
+                    const auto &elem_json = embedding_json[idx];
+                    if (has_float && elem_json.is_number()) {
+                        float_values[row_idx * dimension + idx] = elem_json.template get<FloatT>();
+                    } else if (!has_float && elem_json.is_number_integer()) {
+                        integer_values[row_idx * dimension + idx] = elem_json.template get<BigIntT>();
+                    } else {
+                        return fmt::format("Column: {} expect embedding elements of type {}", column_data.column_name_, has_float ? "FLOAT" : "INTEGER");
+                    }
+                }
+            }
+            break;
+        }
+        case nlohmann::json::value_t::object:
+        case nlohmann::json::value_t::binary:
+        case nlohmann::json::value_t::null:
+        case nlohmann::json::value_t::discarded: {
+            return fmt::format("Column: {} has values of unsupported type", column_data.column_name_);
+        }
+    }
+    return {};
+}
+
 class InsertHandler final : public HttpRequestHandler {
 public:
     SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
@@ -657,6 +775,55 @@ public:
         try {
             nlohmann::json http_body_json = nlohmann::json::parse(data_body);
 
+            if (http_body_json.is_object()) {
+                // Columnar body: {"columns": {"c1": [1, 2], "c2": [[0.1, 0.2], [0.3, 0.4]]}}
+                const auto &columns_json = http_body_json["columns"];
+                if (!columns_json.is_object() || columns_json.empty()) {
+                    json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                    json_response["error_message"] = fmt::format("Invalid json format: {}", data_body);
+                    return ResponseFactory::createResponse(http_status, json_response.dump());
+                }
+
+                Vector<InsertColumnData> *column_data = new Vector<InsertColumnData>();
+                DeferFn defer_free_column_data([&]() {
+                    if (column_data != nullptr) {
+                        delete column_data;
+                        column_data = nullptr;
+                    }
+                });
+                column_data->reserve(columns_json.size());
+                for (const auto &item : columns_json.items()) {
+                    const auto &values_json = item.value();
+                    if (!values_json.is_array() || values_json.empty()) {
+                        json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                        json_response["error_message"] = fmt::format("Column: {} expect an array of values", item.key());
+                        return ResponseFactory::createResponse(http_status, json_response.dump());
+                    }
+                    InsertColumnData &column = column_data->emplace_back();
+                    column.column_name_ = item.key();
+                    String error_message = PackInsertColumn(values_json, column);
+                    if (!error_message.empty()) {
+                        json_response["error_code"] = ErrorCode::kDataTypeMismatch;
+                        json_response["error_message"] = error_message;
+                        return ResponseFactory::createResponse(http_status, json_response.dump());
+                    }
+                }
+
+                auto database_name = request->getPathVariable("database_name");
+                auto table_name = request->getPathVariable("table_name");
+                auto result = infinity->InsertColumns(database_name, table_name, column_data);
+                column_data = nullptr;
+                if (result.IsOk()) {
+                    json_response["error_code"] = 0;
+                    http_status = HTTPStatus::CODE_200;
+                } else {
+                    json_response["error_code"] = result.ErrorCode();
+                    json_response["error_message"] = result.ErrorMsg();
+                    http_status = HTTPStatus::CODE_500;
+                }
+                return ResponseFactory::createResponse(http_status, json_response.dump());
+            }
+
             SizeT row_count = http_body_json.size();
             if (http_body_json.is_array() && row_count > 0) {
 
@@ -2208,6 +2375,253 @@ public:
     }
 };
 
+// A prepared statement lives in the session which prepared it, but an HTTP request doesn't keep its session. So each
+// statement prepared by HTTP keeps a connection of its own, and its executions are serialized since they share the plan.
+struct HTTPPreparedStatement {
+    SharedPtr<Infinity> infinity_{};
+    std::mutex mutex_{};
+};
+
+std::mutex http_prepared_statements_mutex;
+HashMap<String, SharedPtr<HTTPPreparedStatement>> http_prepared_statements;
+
+SharedPtr<HTTPPreparedStatement> GetHTTPPreparedStatement(String statement_name) {
+    ToLower(statement_name);
+    std::lock_guard<std::mutex> lock(http_prepared_statements_mutex);
+    auto iter = http_prepared_statements.find(statement_name);
+    return iter == http_prepared_statements.end() ? nullptr : iter->second;
+}
+
+// Returns nullptr and sets error_message if the json value can't be a parameter
+ConstantExpr *GetParameterFromJson(const nlohmann::json &value, String &error_message) {
+    switch (value.type()) {
+        case nlohmann::json::value_t::boolean: {
+            auto *const_expr = new ConstantExpr(LiteralType::kBoolean);
+            const_expr->bool_value_ = value.template get<bool>();
+            return const_expr;
+        }
+        case nlohmann::json::value_t::number_integer: {
+            auto *const_expr = new ConstantExpr(LiteralType::kInteger);
+            const_expr->integer_value_ = value.template get<i64>();
+            return const_expr;
+        }
+        case nlohmann::json::value_t::number_unsigned: {
+            auto *const_expr = new ConstantExpr(LiteralType::kInteger);
+            const_expr->integer_value_ = value.template get<u64>();
+            return const_expr;
+        }
+        case nlohmann::json::value_t::number_float: {
+            auto *const_expr = new ConstantExpr(LiteralType::kDouble);
+            const_expr->double_value_ = value.template get<f64>();
+            return const_expr;
+        }
+        case nlohmann::json::value_t::string: {
+            auto *const_expr = new ConstantExpr(LiteralType::kString);
+            const_expr->str_value_ = strdup(value.template get<std::string>().c_str());
+            return const_expr;
+        }
+        case nlohmann::json::value_t::array: {
+            // The query vector of KNN, the type of the first element decides the array type
+            if (value.empty()) {
+                error_message = fmt::format("Empty array parameter: {}", value.dump());
+                return nullptr;
+            }
+            bool is_integer = value[0].is_number_integer();
+            auto *const_expr = new ConstantExpr(is_integer ? LiteralType::kIntegerArray : LiteralType::kDoubleArray);
+            for (const auto &elem : value) {
+                if (is_integer && elem.is_number_integer()) {
+                    const_expr->long_array_.emplace_back(elem.template get<i64>());
+                } else if (!is_integer && elem.is_number()) {
+                    const_expr->double_array_.emplace_back(elem.template get<double>());
+                } else {
+                    delete const_expr;
+                    error_message = fmt::format("Mixed element types of array parameter: {}", value.dump());
+                    return nullptr;
+                }
+            }
+            return const_expr;
+        }
+        default: {
+            error_message = fmt::format("Invalid parameter: {}", value.dump());
+            return nullptr;
+        }
+    }
+}
+
+class PrepareHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto statement_name = request->getPathVariable("statement_name");
+        String data_body = request->readBodyToString();
+
+        nlohmann::json json_response;
+        HTTPStatus http_status = HTTPStatus::CODE_500;
+
+        try {
+            nlohmann::json http_body_json = nlohmann::json::parse(data_body);
+            if (!http_body_json.is_object() || !http_body_json["statement"].is_string()) {
+                json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                json_response["error_message"] = fmt::format("Invalid json format: {}", data_body);
+                return ResponseFactory::createResponse(http_status, json_response.dump());
+            }
+            String statement = http_body_json["statement"];
+
+            auto prepared_statement = MakeShared<HTTPPreparedStatement>();
+            prepared_statement->infinity_ = Infinity::RemoteConnect();
+            auto result = prepared_statement->infinity_->Prepare(statement_name, statement);
+            if (result.IsOk()) {
+                ToLower(statement_name);
+                SharedPtr<HTTPPreparedStatement> old_statement;
+                {
+                    std::lock_guard<std::mutex> lock(http_prepared_statements_mutex);
+                    auto &slot = http_prepared_statements[statement_name];
+                    old_statement = std::move(slot);
+                    slot = std::move(prepared_statement);
+                }
+                if (old_statement.get() != nullptr) {
+                    std::lock_guard<std::mutex> lock(old_statement->mutex_);
+                    old_statement->infinity_->RemoteDisconnect();
+                }
+                json_response["error_code"] = 0;
+                http_status = HTTPStatus::CODE_200;
+            } else {
+                prepared_statement->infinity_->RemoteDisconnect();
+                json_response["error_code"] = result.ErrorCode();
+                json_response["error_message"] = result.ErrorMsg();
+            }
+        } catch (nlohmann::json::exception &e) {
+            json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+            json_response["error_message"] = e.what();
+        }
+
+        return ResponseFactory::createResponse(http_status, json_response.dump());
+    }
+};
+
+class ExecuteHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto statement_name = request->getPathVariable("statement_name");
+        String data_body = request->readBodyToString();
+
+        nlohmann::json json_response;
+        HTTPStatus http_status = HTTPStatus::CODE_500;
+
+        SharedPtr<HTTPPreparedStatement> prepared_statement = GetHTTPPreparedStatement(statement_name);
+        if (prepared_statement.get() == nullptr) {
+            json_response["error_code"] = ErrorCode::kNotSupported;
+            json_response["error_message"] = fmt::format("Prepared statement: {} doesn't exist", statement_name);
+            return ResponseFactory::createResponse(http_status, json_response.dump());
+        }
+
+        try {
+            // {"parameters": [1, "text", [0.1, 0.2, 0.3]]}, in the order of the '?' of the statement
+            Vector<ParsedExpr *> *parameters = new Vector<ParsedExpr *>();
+            DeferFn defer_free_parameters([&]() {
+                if (parameters != nullptr) {
+                    for (auto &parameter : *parameters) {
+                        delete parameter;
+                        parameter = nullptr;
+                    }
+                    delete parameters;
+                    parameters = nullptr;
+                }
+            });
+
+            if (!data_body.empty()) {
+                nlohmann::json http_body_json = nlohmann::json::parse(data_body);
+                if (!http_body_json.is_object()) {
+                    json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                    json_response["error_message"] = fmt::format("Invalid json format: {}", data_body);
+                    return ResponseFactory::createResponse(http_status, json_response.dump());
+                }
+                if (http_body_json.contains("parameters")) {
+                    const auto &parameters_json = http_body_json["parameters"];
+                    if (!parameters_json.is_array()) {
+                        json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                        json_response["error_message"] = "Parameters should be array";
+                        return ResponseFactory::createResponse(http_status, json_response.dump());
+                    }
+                    parameters->reserve(parameters_json.size());
+                    for (const auto &parameter_json : parameters_json) {
+                        String error_message;
+                        ConstantExpr *parameter = GetParameterFromJson(parameter_json, error_message);
+                        if (parameter == nullptr) {
+                            json_response["error_code"] = ErrorCode::kInvalidExpression;
+                            json_response["error_message"] = error_message;
+                            return ResponseFactory::createResponse(http_status, json_response.dump());
+                        }
+                        parameters->emplace_back(parameter);
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(prepared_statement->mutex_);
+            auto result = prepared_statement->infinity_->Execute(statement_name, parameters);
+            parameters = nullptr;
+            if (result.IsOk()) {
+                SizeT block_rows = result.result_table_->DataBlockCount();
+                for (SizeT block_id = 0; block_id < block_rows; ++block_id) {
+                    DataBlock *data_block = result.result_table_->GetDataBlockById(block_id).get();
+                    auto row_count = data_block->row_count();
+                    auto column_cnt = result.result_table_->ColumnCount();
+
+                    for (SizeT row = 0; row < row_count; ++row) {
+                        nlohmann::json json_result_row;
+                        for (SizeT col = 0; col < column_cnt; ++col) {
+                            Value value = data_block->GetValue(col, row);
+                            const String &column_name = result.result_table_->GetColumnNameById(col);
+                            json_result_row[column_name] = value.ToString();
+                        }
+                        json_response["output"].push_back(json_result_row);
+                    }
+                }
+                json_response["error_code"] = 0;
+                http_status = HTTPStatus::CODE_200;
+            } else {
+                json_response["error_code"] = result.ErrorCode();
+                json_response["error_message"] = result.ErrorMsg();
+            }
+        } catch (nlohmann::json::exception &e) {
+            json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+            json_response["error_message"] = e.what();
+        }
+
+        return ResponseFactory::createResponse(http_status, json_response.dump());
+    }
+};
+
+class DeallocateHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto statement_name = request->getPathVariable("statement_name");
+        ToLower(statement_name);
+
+        nlohmann::json json_response;
+        HTTPStatus http_status = HTTPStatus::CODE_500;
+
+        SharedPtr<HTTPPreparedStatement> prepared_statement;
+        {
+            std::lock_guard<std::mutex> lock(http_prepared_statements_mutex);
+            auto iter = http_prepared_statements.find(statement_name);
+            if (iter != http_prepared_statements.end()) {
+                prepared_statement = std::move(iter->second);
+                http_prepared_statements.erase(iter);
+            }
+        }
+        if (prepared_statement.get() == nullptr) {
+            json_response["error_code"] = ErrorCode::kNotSupported;
+            json_response["error_message"] = fmt::format("Prepared statement: {} doesn't exist", statement_name);
+            return ResponseFactory::createResponse(http_status, json_response.dump());
+        }
+
+        std::lock_guard<std::mutex> lock(prepared_statement->mutex_);
+        prepared_statement->infinity_->RemoteDisconnect();
+        json_response["error_code"] = 0;
+        http_status = HTTPStatus::CODE_200;
+        return ResponseFactory::createResponse(http_status, json_response.dump());
+    }
+};
 
 } // namespace
 
@@ -2241,6 +2655,11 @@ void HTTPServer::Start(u16 port) {
     // DQL
     router->route("GET", "/databases/{database_name}/tables/{table_name}/docs", MakeShared<SelectHandler>());
 
+    // prepared statement
+    router->route("POST", "/prepared_statements/{statement_name}", MakeShared<PrepareHandler>());
+    router->route("POST", "/prepared_statements/{statement_name}/execute", MakeShared<ExecuteHandler>());
+    router->route("DELETE", "/prepared_statements/{statement_name}", MakeShared<DeallocateHandler>());
+
     // index
     router->route("GET", "/databases/{database_name}/tables/{table_name}/indexes", MakeShared<ListTableIndexesHandler>());
     router->route("GET", "/databases/{database_name}/tables/{table_name}/indexes/{index_name}", MakeShared<ShowTableIndexDetailHandler>());
@@ -51,6 +51,8 @@ class InfinityServiceIf {
   virtual void CreateIndex(CommonResponse& _return, const CreateIndexRequest& request) = 0;
   virtual void DropIndex(CommonResponse& _return, const DropIndexRequest& request) = 0;
   virtual void ShowIndex(ShowIndexResponse& _return, const ShowIndexRequest& request) = 0;
+  virtual void Prepare(CommonResponse& _return, const PrepareRequest& request) = 0;
+  virtual void Execute(SelectResponse& _return, const ExecuteRequest& request) = 0;
 };
 
 class InfinityServiceIfFactory {
@@ -167,6 +169,12 @@ class InfinityServiceNull : virtual public InfinityServiceIf {
   void ShowIndex(ShowIndexResponse& /* _return */, const ShowIndexRequest& /* request */) override {
     return;
   }
+  void Prepare(CommonResponse& /* _return */, const PrepareRequest& /* request */) override {
+    return;
+  }
+  void Execute(SelectResponse& /* _return */, const ExecuteRequest& /* request */) override {
+    return;
+  }
 };
 
 typedef struct _InfinityService_Connect_args__isset {
@@ -3185,6 +3193,214 @@ class InfinityService_ShowIndex_presult {
 
 };
 
+typedef struct _InfinityService_Prepare_args__isset {
+  _InfinityService_Prepare_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_Prepare_args__isset;
+
+class InfinityService_Prepare_args {
+ public:
+
+  InfinityService_Prepare_args(const InfinityService_Prepare_args&);
+  InfinityService_Prepare_args& operator=(const InfinityService_Prepare_args&);
+  InfinityService_Prepare_args() noexcept {
+  }
+
+  virtual ~InfinityService_Prepare_args() noexcept;
+  PrepareRequest request;
+
+  _InfinityService_Prepare_args__isset __isset;
+
+  void __set_request(const PrepareRequest& val);
+
+  bool operator == (const InfinityService_Prepare_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_Prepare_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_Prepare_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_Prepare_pargs {
+ public:
+
+
+  virtual ~InfinityService_Prepare_pargs() noexcept;
+  const PrepareRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_Prepare_result__isset {
+  _InfinityService_Prepare_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_Prepare_result__isset;
+
+class InfinityService_Prepare_result {
+ public:
+
+  InfinityService_Prepare_result(const InfinityService_Prepare_result&);
+  InfinityService_Prepare_result& operator=(const InfinityService_Prepare_result&);
+  InfinityService_Prepare_result() noexcept {
+  }
+
+  virtual ~InfinityService_Prepare_result() noexcept;
+  CommonResponse success;
+
+  _InfinityService_Prepare_result__isset __isset;
+
+  void __set_success(const CommonResponse& val);
+
+  bool operator == (const InfinityService_Prepare_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_Prepare_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_Prepare_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_Prepare_presult__isset {
+  _InfinityService_Prepare_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_Prepare_presult__isset;
+
+class InfinityService_Prepare_presult {
+ public:
+
+
+  virtual ~InfinityService_Prepare_presult() noexcept;
+  CommonResponse* success;
+
+  _InfinityService_Prepare_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _InfinityService_Execute_args__isset {
+  _InfinityService_Execute_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_Execute_args__isset;
+
+class InfinityService_Execute_args {
+ public:
+
+  InfinityService_Execute_args(const InfinityService_Execute_args&);
+  InfinityService_Execute_args& operator=(const InfinityService_Execute_args&);
+  InfinityService_Execute_args() noexcept {
+  }
+
+  virtual ~InfinityService_Execute_args() noexcept;
+  ExecuteRequest request;
+
+  _InfinityService_Execute_args__isset __isset;
+
+  void __set_request(const ExecuteRequest& val);
+
+  bool operator == (const InfinityService_Execute_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_Execute_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_Execute_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_Execute_pargs {
+ public:
+
+
+  virtual ~InfinityService_Execute_pargs() noexcept;
+  const ExecuteRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_Execute_result__isset {
+  _InfinityService_Execute_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_Execute_result__isset;
+
+class InfinityService_Execute_result {
+ public:
+
+  InfinityService_Execute_result(const InfinityService_Execute_result&);
+  InfinityService_Execute_result& operator=(const InfinityService_Execute_result&);
+  InfinityService_Execute_result() noexcept {
+  }
+
+  virtual ~InfinityService_Execute_result() noexcept;
+  SelectResponse success;
+
+  _InfinityService_Execute_result__isset __isset;
+
+  void __set_success(const SelectResponse& val);
+
+  bool operator == (const InfinityService_Execute_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_Execute_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_Execute_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_Execute_presult__isset {
+  _InfinityService_Execute_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_Execute_presult__isset;
+
+class InfinityService_Execute_presult {
+ public:
+
+
+  virtual ~InfinityService_Execute_presult() noexcept;
+  SelectResponse* success;
+
+  _InfinityService_Execute_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class InfinityServiceClient : virtual public InfinityServiceIf {
  public:
   InfinityServiceClient(std::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -3297,6 +3513,12 @@ class InfinityServiceClient : virtual public InfinityServiceIf {
   void ShowIndex(ShowIndexResponse& _return, const ShowIndexRequest& request) override;
   void send_ShowIndex(const ShowIndexRequest& request);
   void recv_ShowIndex(ShowIndexResponse& _return);
+  void Prepare(CommonResponse& _return, const PrepareRequest& request) override;
+  void send_Prepare(const PrepareRequest& request);
+  void recv_Prepare(CommonResponse& _return);
+  void Execute(SelectResponse& _return, const ExecuteRequest& request) override;
+  void send_Execute(const ExecuteRequest& request);
+  void recv_Execute(SelectResponse& _return);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -3341,6 +3563,8 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_CreateIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_DropIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ShowIndex(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_Prepare(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_Execute(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   InfinityServiceProcessor(::std::shared_ptr<InfinityServiceIf> iface) :
     iface_(iface) {
@@ -3373,6 +3597,8 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["CreateIndex"] = &InfinityServiceProcessor::process_CreateIndex;
     processMap_["DropIndex"] = &InfinityServiceProcessor::process_DropIndex;
     processMap_["ShowIndex"] = &InfinityServiceProcessor::process_ShowIndex;
+    processMap_["Prepare"] = &InfinityServiceProcessor::process_Prepare;
+    processMap_["Execute"] = &InfinityServiceProcessor::process_Execute;
   }
 
   virtual ~InfinityServiceProcessor() {}
@@ -3691,6 +3917,26 @@ class InfinityServiceMultiface : virtual public InfinityServiceIf {
     return;
   }
 
+  void Prepare(CommonResponse& _return, const PrepareRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->Prepare(_return, request);
+    }
+    ifaces_[i]->Prepare(_return, request);
+    return;
+  }
+
+  void Execute(SelectResponse& _return, const ExecuteRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->Execute(_return, request);
+    }
+    ifaces_[i]->Execute(_return, request);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -3810,6 +4056,12 @@ class InfinityServiceConcurrentClient : virtual public InfinityServiceIf {
   void ShowIndex(ShowIndexResponse& _return, const ShowIndexRequest& request) override;
   int32_t send_ShowIndex(const ShowIndexRequest& request);
   void recv_ShowIndex(ShowIndexResponse& _return, const int32_t seqid);
+  void Prepare(CommonResponse& _return, const PrepareRequest& request) override;
+  int32_t send_Prepare(const PrepareRequest& request);
+  void recv_Prepare(CommonResponse& _return, const int32_t seqid);
+  void Execute(SelectResponse& _return, const ExecuteRequest& request) override;
+  int32_t send_Execute(const ExecuteRequest& request);
+  void recv_Execute(SelectResponse& _return, const int32_t seqid);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
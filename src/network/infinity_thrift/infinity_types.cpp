@@ -133,7 +133,9 @@ int _kElementTypeValues[] = {
   ElementType::ElementInt32,
   ElementType::ElementInt64,
   ElementType::ElementFloat32,
-  ElementType::ElementFloat64
+  ElementType::ElementFloat64,
+  ElementType::ElementFloat16,
+  ElementType::ElementBFloat16
 };
 const char* _kElementTypeNames[] = {
   "ElementBit",
@@ -142,9 +144,11 @@ const char* _kElementTypeNames[] = {
   "ElementInt32",
   "ElementInt64",
   "ElementFloat32",
-  "ElementFloat64"
+  "ElementFloat64",
+  "ElementFloat16",
+  "ElementBFloat16"
 };
-const std::map<int, const char*> _ElementType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(7, _kElementTypeValues, _kElementTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
+const std::map<int, const char*> _ElementType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(9, _kElementTypeValues, _kElementTypeNames), ::apache::thrift::TEnumIterator(-1, nullptr, nullptr));
 
 std::ostream& operator<<(std::ostream& out, const ElementType::type& val) {
   std::map<int, const char*>::const_iterator it = _ElementType_VALUES_TO_NAMES.find(val);
@@ -2812,6 +2816,10 @@ void KnnExpr::__set_topn(const int64_t val) {
 void KnnExpr::__set_opt_params(const std::vector<InitParameter> & val) {
   this->opt_params = val;
 }
+
+void KnnExpr::__set_query_count(const int64_t val) {
+  this->query_count = val;
+}
 std::ostream& operator<<(std::ostream& out, const KnnExpr& obj)
 {
   obj.printTo(out);
@@ -2904,6 +2912,14 @@ uint32_t KnnExpr::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->query_count);
+          this->__isset.query_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2953,6 +2969,10 @@ uint32_t KnnExpr::write(::apache::thrift::protocol::TProtocol* oprot) const {
   }
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("query_count", ::apache::thrift::protocol::T_I64, 7);
+  xfer += oprot->writeI64(this->query_count);
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -2966,6 +2986,7 @@ void swap(KnnExpr &a, KnnExpr &b) {
   swap(a.distance_type, b.distance_type);
   swap(a.topn, b.topn);
   swap(a.opt_params, b.opt_params);
+  swap(a.query_count, b.query_count);
   swap(a.__isset, b.__isset);
 }
 
@@ -2976,6 +2997,7 @@ KnnExpr::KnnExpr(const KnnExpr& other143) {
   distance_type = other143.distance_type;
   topn = other143.topn;
   opt_params = other143.opt_params;
+  query_count = other143.query_count;
   __isset = other143.__isset;
 }
 KnnExpr& KnnExpr::operator=(const KnnExpr& other144) {
@@ -2985,6 +3007,7 @@ KnnExpr& KnnExpr::operator=(const KnnExpr& other144) {
   distance_type = other144.distance_type;
   topn = other144.topn;
   opt_params = other144.opt_params;
+  query_count = other144.query_count;
   __isset = other144.__isset;
   return *this;
 }
@@ -2997,6 +3020,7 @@ void KnnExpr::printTo(std::ostream& out) const {
   out << ", " << "distance_type=" << to_string(distance_type);
   out << ", " << "topn=" << to_string(topn);
   out << ", " << "opt_params=" << to_string(opt_params);
+  out << ", " << "query_count=" << to_string(query_count);
   out << ")";
 }
 
@@ -4629,6 +4653,198 @@ void ColumnField::printTo(std::ostream& out) const {
 }
 
 
+InsertColumn::~InsertColumn() noexcept {
+}
+
+
+void InsertColumn::__set_column_name(const std::string& val) {
+  this->column_name = val;
+}
+
+void InsertColumn::__set_data_type(const DataType& val) {
+  this->data_type = val;
+}
+
+void InsertColumn::__set_row_count(const int64_t val) {
+  this->row_count = val;
+}
+
+void InsertColumn::__set_data(const std::string& val) {
+  this->data = val;
+}
+
+void InsertColumn::__set_varchar_offsets(const std::vector<int32_t> & val) {
+  this->varchar_offsets = val;
+}
+std::ostream& operator<<(std::ostream& out, const InsertColumn& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t InsertColumn::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->column_name);
+          this->__isset.column_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->data_type.read(iprot);
+          this->__isset.data_type = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->row_count);
+          this->__isset.row_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->data);
+          this->__isset.data = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->varchar_offsets.clear();
+            uint32_t _size421;
+            ::apache::thrift::protocol::TType _etype424;
+            xfer += iprot->readListBegin(_etype424, _size421);
+            this->varchar_offsets.resize(_size421);
+            uint32_t _i425;
+            for (_i425 = 0; _i425 < _size421; ++_i425)
+            {
+              xfer += iprot->readI32(this->varchar_offsets[_i425]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.varchar_offsets = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t InsertColumn::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("InsertColumn");
+
+  xfer += oprot->writeFieldBegin("column_name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->column_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("data_type", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->data_type.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("row_count", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->row_count);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeBinary(this->data);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("varchar_offsets", ::apache::thrift::protocol::T_LIST, 5);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->varchar_offsets.size()));
+    std::vector<int32_t> ::const_iterator _iter426;
+    for (_iter426 = this->varchar_offsets.begin(); _iter426 != this->varchar_offsets.end(); ++_iter426)
+    {
+      xfer += oprot->writeI32((*_iter426));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(InsertColumn &a, InsertColumn &b) {
+  using ::std::swap;
+  swap(a.column_name, b.column_name);
+  swap(a.data_type, b.data_type);
+  swap(a.row_count, b.row_count);
+  swap(a.data, b.data);
+  swap(a.varchar_offsets, b.varchar_offsets);
+  swap(a.__isset, b.__isset);
+}
+
+InsertColumn::InsertColumn(const InsertColumn& other427) {
+  column_name = other427.column_name;
+  data_type = other427.data_type;
+  row_count = other427.row_count;
+  data = other427.data;
+  varchar_offsets = other427.varchar_offsets;
+  __isset = other427.__isset;
+}
+InsertColumn& InsertColumn::operator=(const InsertColumn& other428) {
+  column_name = other428.column_name;
+  data_type = other428.data_type;
+  row_count = other428.row_count;
+  data = other428.data;
+  varchar_offsets = other428.varchar_offsets;
+  __isset = other428.__isset;
+  return *this;
+}
+void InsertColumn::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "InsertColumn(";
+  out << "column_name=" << to_string(column_name);
+  out << ", " << "data_type=" << to_string(data_type);
+  out << ", " << "row_count=" << to_string(row_count);
+  out << ", " << "data=" << to_string(data);
+  out << ", " << "varchar_offsets=" << to_string(varchar_offsets);
+  out << ")";
+}
+
+
 ImportOption::~ImportOption() noexcept {
 }
 
@@ -8548,6 +8764,10 @@ void InsertRequest::__set_fields(const std::vector<Field> & val) {
 void InsertRequest::__set_session_id(const int64_t val) {
   this->session_id = val;
 }
+
+void InsertRequest::__set_columns(const std::vector<InsertColumn> & val) {
+  this->columns = val;
+}
 std::ostream& operator<<(std::ostream& out, const InsertRequest& obj)
 {
   obj.printTo(out);
@@ -8640,6 +8860,26 @@ uint32_t InsertRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->columns.clear();
+            uint32_t _size429;
+            ::apache::thrift::protocol::TType _etype432;
+            xfer += iprot->readListBegin(_etype432, _size429);
+            this->columns.resize(_size429);
+            uint32_t _i433;
+            for (_i433 = 0; _i433 < _size429; ++_i433)
+            {
+              xfer += this->columns[_i433].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.columns = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -8693,6 +8933,18 @@ uint32_t InsertRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
   xfer += oprot->writeI64(this->session_id);
   xfer += oprot->writeFieldEnd();
 
+  xfer += oprot->writeFieldBegin("columns", ::apache::thrift::protocol::T_LIST, 6);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->columns.size()));
+    std::vector<InsertColumn> ::const_iterator _iter434;
+    for (_iter434 = this->columns.begin(); _iter434 != this->columns.end(); ++_iter434)
+    {
+      xfer += (*_iter434).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -8705,6 +8957,7 @@ void swap(InsertRequest &a, InsertRequest &b) {
   swap(a.column_names, b.column_names);
   swap(a.fields, b.fields);
   swap(a.session_id, b.session_id);
+  swap(a.columns, b.columns);
   swap(a.__isset, b.__isset);
 }
 
@@ -8714,6 +8967,7 @@ InsertRequest::InsertRequest(const InsertRequest& other320) {
   column_names = other320.column_names;
   fields = other320.fields;
   session_id = other320.session_id;
+  columns = other320.columns;
   __isset = other320.__isset;
 }
 InsertRequest& InsertRequest::operator=(const InsertRequest& other321) {
@@ -8722,6 +8976,7 @@ InsertRequest& InsertRequest::operator=(const InsertRequest& other321) {
   column_names = other321.column_names;
   fields = other321.fields;
   session_id = other321.session_id;
+  columns = other321.columns;
   __isset = other321.__isset;
   return *this;
 }
@@ -8733,6 +8988,7 @@ void InsertRequest::printTo(std::ostream& out) const {
   out << ", " << "column_names=" << to_string(column_names);
   out << ", " << "fields=" << to_string(fields);
   out << ", " << "session_id=" << to_string(session_id);
+  out << ", " << "columns=" << to_string(columns);
   out << ")";
 }
 
@@ -12078,4 +12334,288 @@ void ShowBlockColumnResponse::printTo(std::ostream& out) const {
   out << ")";
 }
 
+
+PrepareRequest::~PrepareRequest() noexcept {
+}
+
+
+void PrepareRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+
+void PrepareRequest::__set_statement_name(const std::string& val) {
+  this->statement_name = val;
+}
+
+void PrepareRequest::__set_statement(const std::string& val) {
+  this->statement = val;
+}
+std::ostream& operator<<(std::ostream& out, const PrepareRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t PrepareRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->statement_name);
+          this->__isset.statement_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->statement);
+          this->__isset.statement = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t PrepareRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("PrepareRequest");
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("statement_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->statement_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("statement", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString(this->statement);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(PrepareRequest &a, PrepareRequest &b) {
+  using ::std::swap;
+  swap(a.session_id, b.session_id);
+  swap(a.statement_name, b.statement_name);
+  swap(a.statement, b.statement);
+  swap(a.__isset, b.__isset);
+}
+
+PrepareRequest::PrepareRequest(const PrepareRequest& other435) {
+  session_id = other435.session_id;
+  statement_name = other435.statement_name;
+  statement = other435.statement;
+  __isset = other435.__isset;
+}
+PrepareRequest& PrepareRequest::operator=(const PrepareRequest& other436) {
+  session_id = other436.session_id;
+  statement_name = other436.statement_name;
+  statement = other436.statement;
+  __isset = other436.__isset;
+  return *this;
+}
+void PrepareRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "PrepareRequest(";
+  out << "session_id=" << to_string(session_id);
+  out << ", " << "statement_name=" << to_string(statement_name);
+  out << ", " << "statement=" << to_string(statement);
+  out << ")";
+}
+
+
+ExecuteRequest::~ExecuteRequest() noexcept {
+}
+
+
+void ExecuteRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+
+void ExecuteRequest::__set_statement_name(const std::string& val) {
+  this->statement_name = val;
+}
+
+void ExecuteRequest::__set_parameters(const std::vector<ConstantExpr> & val) {
+  this->parameters = val;
+}
+std::ostream& operator<<(std::ostream& out, const ExecuteRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ExecuteRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->statement_name);
+          this->__isset.statement_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->parameters.clear();
+            uint32_t _size437;
+            ::apache::thrift::protocol::TType _etype440;
+            xfer += iprot->readListBegin(_etype440, _size437);
+            this->parameters.resize(_size437);
+            uint32_t _i441;
+            for (_i441 = 0; _i441 < _size437; ++_i441)
+            {
+              xfer += this->parameters[_i441].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.parameters = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ExecuteRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ExecuteRequest");
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("statement_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->statement_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("parameters", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->parameters.size()));
+    std::vector<ConstantExpr> ::const_iterator _iter442;
+    for (_iter442 = this->parameters.begin(); _iter442 != this->parameters.end(); ++_iter442)
+    {
+      xfer += (*_iter442).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ExecuteRequest &a, ExecuteRequest &b) {
+  using ::std::swap;
+  swap(a.session_id, b.session_id);
+  swap(a.statement_name, b.statement_name);
+  swap(a.parameters, b.parameters);
+  swap(a.__isset, b.__isset);
+}
+
+ExecuteRequest::ExecuteRequest(const ExecuteRequest& other443) {
+  session_id = other443.session_id;
+  statement_name = other443.statement_name;
+  parameters = other443.parameters;
+  __isset = other443.__isset;
+}
+ExecuteRequest& ExecuteRequest::operator=(const ExecuteRequest& other444) {
+  session_id = other444.session_id;
+  statement_name = other444.statement_name;
+  parameters = other444.parameters;
+  __isset = other444.__isset;
+  return *this;
+}
+void ExecuteRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ExecuteRequest(";
+  out << "session_id=" << to_string(session_id);
+  out << ", " << "statement_name=" << to_string(statement_name);
+  out << ", " << "parameters=" << to_string(parameters);
+  out << ")";
+}
+
 } // namespace
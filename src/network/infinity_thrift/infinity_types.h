@@ -81,7 +81,9 @@ struct ElementType {
     ElementInt32 = 3,
     ElementInt64 = 4,
     ElementFloat32 = 5,
-    ElementFloat64 = 6
+    ElementFloat64 = 6,
+    ElementFloat16 = 7,
+    ElementBFloat16 = 8
   };
 };
 
@@ -265,6 +267,8 @@ class Field;
 
 class ColumnField;
 
+class InsertColumn;
+
 class ImportOption;
 
 class ConnectRequest;
@@ -351,6 +355,10 @@ class ShowBlockColumnRequest;
 
 class ShowBlockColumnResponse;
 
+class PrepareRequest;
+
+class ExecuteRequest;
+
 typedef struct _Property__isset {
   _Property__isset() : key(false), value(false) {}
   bool key :1;
@@ -1196,13 +1204,14 @@ void swap(ConstantExpr &a, ConstantExpr &b);
 std::ostream& operator<<(std::ostream& out, const ConstantExpr& obj);
 
 typedef struct _KnnExpr__isset {
-  _KnnExpr__isset() : column_expr(false), embedding_data(false), embedding_data_type(false), distance_type(false), topn(false), opt_params(true) {}
+  _KnnExpr__isset() : column_expr(false), embedding_data(false), embedding_data_type(false), distance_type(false), topn(false), opt_params(true), query_count(true) {}
   bool column_expr :1;
   bool embedding_data :1;
   bool embedding_data_type :1;
   bool distance_type :1;
   bool topn :1;
   bool opt_params :1;
+  bool query_count :1;
 } _KnnExpr__isset;
 
 class KnnExpr : public virtual ::apache::thrift::TBase {
@@ -1213,7 +1222,8 @@ class KnnExpr : public virtual ::apache::thrift::TBase {
   KnnExpr() noexcept
           : embedding_data_type(static_cast<ElementType::type>(0)),
             distance_type(static_cast<KnnDistanceType::type>(0)),
-            topn(0) {
+            topn(0),
+            query_count(1LL) {
 
   }
 
@@ -1232,6 +1242,7 @@ class KnnExpr : public virtual ::apache::thrift::TBase {
   KnnDistanceType::type distance_type;
   int64_t topn;
   std::vector<InitParameter>  opt_params;
+  int64_t query_count;
 
   _KnnExpr__isset __isset;
 
@@ -1247,6 +1258,8 @@ class KnnExpr : public virtual ::apache::thrift::TBase {
 
   void __set_opt_params(const std::vector<InitParameter> & val);
 
+  void __set_query_count(const int64_t val);
+
   bool operator == (const KnnExpr & rhs) const
   {
     if (!(column_expr == rhs.column_expr))
@@ -1261,6 +1274,8 @@ class KnnExpr : public virtual ::apache::thrift::TBase {
       return false;
     if (!(opt_params == rhs.opt_params))
       return false;
+    if (!(query_count == rhs.query_count))
+      return false;
     return true;
   }
   bool operator != (const KnnExpr &rhs) const {
@@ -1909,6 +1924,76 @@ void swap(ColumnField &a, ColumnField &b);
 
 std::ostream& operator<<(std::ostream& out, const ColumnField& obj);
 
+typedef struct _InsertColumn__isset {
+  _InsertColumn__isset() : column_name(false), data_type(false), row_count(false), data(false), varchar_offsets(true) {}
+  bool column_name :1;
+  bool data_type :1;
+  bool row_count :1;
+  bool data :1;
+  bool varchar_offsets :1;
+} _InsertColumn__isset;
+
+class InsertColumn : public virtual ::apache::thrift::TBase {
+ public:
+
+  InsertColumn(const InsertColumn&);
+  InsertColumn& operator=(const InsertColumn&);
+  InsertColumn() noexcept
+               : column_name(),
+                 row_count(0),
+                 data() {
+
+  }
+
+  virtual ~InsertColumn() noexcept;
+  std::string column_name;
+  DataType data_type;
+  int64_t row_count;
+  std::string data;
+  std::vector<int32_t>  varchar_offsets;
+
+  _InsertColumn__isset __isset;
+
+  void __set_column_name(const std::string& val);
+
+  void __set_data_type(const DataType& val);
+
+  void __set_row_count(const int64_t val);
+
+  void __set_data(const std::string& val);
+
+  void __set_varchar_offsets(const std::vector<int32_t> & val);
+
+  bool operator == (const InsertColumn & rhs) const
+  {
+    if (!(column_name == rhs.column_name))
+      return false;
+    if (!(data_type == rhs.data_type))
+      return false;
+    if (!(row_count == rhs.row_count))
+      return false;
+    if (!(data == rhs.data))
+      return false;
+    if (!(varchar_offsets == rhs.varchar_offsets))
+      return false;
+    return true;
+  }
+  bool operator != (const InsertColumn &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InsertColumn & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(InsertColumn &a, InsertColumn &b);
+
+std::ostream& operator<<(std::ostream& out, const InsertColumn& obj);
+
 typedef struct _ImportOption__isset {
   _ImportOption__isset() : delimiter(false), copy_from(false), has_header(false), copy_file_type(false) {}
   bool delimiter :1;
@@ -3513,12 +3598,13 @@ void swap(DropTableRequest &a, DropTableRequest &b);
 std::ostream& operator<<(std::ostream& out, const DropTableRequest& obj);
 
 typedef struct _InsertRequest__isset {
-  _InsertRequest__isset() : db_name(false), table_name(false), column_names(true), fields(true), session_id(false) {}
+  _InsertRequest__isset() : db_name(false), table_name(false), column_names(true), fields(true), session_id(false), columns(true) {}
   bool db_name :1;
   bool table_name :1;
   bool column_names :1;
   bool fields :1;
   bool session_id :1;
+  bool columns :1;
 } _InsertRequest__isset;
 
 class InsertRequest : public virtual ::apache::thrift::TBase {
@@ -3540,6 +3626,7 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
   std::vector<std::string>  column_names;
   std::vector<Field>  fields;
   int64_t session_id;
+  std::vector<InsertColumn>  columns;
 
   _InsertRequest__isset __isset;
 
@@ -3553,6 +3640,8 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
 
   void __set_session_id(const int64_t val);
 
+  void __set_columns(const std::vector<InsertColumn> & val);
+
   bool operator == (const InsertRequest & rhs) const
   {
     if (!(db_name == rhs.db_name))
@@ -3565,6 +3654,8 @@ class InsertRequest : public virtual ::apache::thrift::TBase {
       return false;
     if (!(session_id == rhs.session_id))
       return false;
+    if (!(columns == rhs.columns))
+      return false;
     return true;
   }
   bool operator != (const InsertRequest &rhs) const {
@@ -4857,6 +4948,120 @@ void swap(ShowBlockColumnResponse &a, ShowBlockColumnResponse &b);
 
 std::ostream& operator<<(std::ostream& out, const ShowBlockColumnResponse& obj);
 
+typedef struct _PrepareRequest__isset {
+  _PrepareRequest__isset() : session_id(false), statement_name(false), statement(false) {}
+  bool session_id :1;
+  bool statement_name :1;
+  bool statement :1;
+} _PrepareRequest__isset;
+
+class PrepareRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  PrepareRequest(const PrepareRequest&);
+  PrepareRequest& operator=(const PrepareRequest&);
+  PrepareRequest() noexcept
+                 : session_id(0),
+                   statement_name(),
+                   statement() {
+  }
+
+  virtual ~PrepareRequest() noexcept;
+  int64_t session_id;
+  std::string statement_name;
+  std::string statement;
+
+  _PrepareRequest__isset __isset;
+
+  void __set_session_id(const int64_t val);
+
+  void __set_statement_name(const std::string& val);
+
+  void __set_statement(const std::string& val);
+
+  bool operator == (const PrepareRequest & rhs) const
+  {
+    if (!(session_id == rhs.session_id))
+      return false;
+    if (!(statement_name == rhs.statement_name))
+      return false;
+    if (!(statement == rhs.statement))
+      return false;
+    return true;
+  }
+  bool operator != (const PrepareRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const PrepareRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(PrepareRequest &a, PrepareRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const PrepareRequest& obj);
+
+typedef struct _ExecuteRequest__isset {
+  _ExecuteRequest__isset() : session_id(false), statement_name(false), parameters(true) {}
+  bool session_id :1;
+  bool statement_name :1;
+  bool parameters :1;
+} _ExecuteRequest__isset;
+
+class ExecuteRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  ExecuteRequest(const ExecuteRequest&);
+  ExecuteRequest& operator=(const ExecuteRequest&);
+  ExecuteRequest() noexcept
+                 : session_id(0),
+                   statement_name() {
+
+  }
+
+  virtual ~ExecuteRequest() noexcept;
+  int64_t session_id;
+  std::string statement_name;
+  std::vector<ConstantExpr>  parameters;
+
+  _ExecuteRequest__isset __isset;
+
+  void __set_session_id(const int64_t val);
+
+  void __set_statement_name(const std::string& val);
+
+  void __set_parameters(const std::vector<ConstantExpr> & val);
+
+  bool operator == (const ExecuteRequest & rhs) const
+  {
+    if (!(session_id == rhs.session_id))
+      return false;
+    if (!(statement_name == rhs.statement_name))
+      return false;
+    if (!(parameters == rhs.parameters))
+      return false;
+    return true;
+  }
+  bool operator != (const ExecuteRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ExecuteRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ExecuteRequest &a, ExecuteRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const ExecuteRequest& obj);
+
 } // namespace
 
 #endif
@@ -15,6 +15,7 @@
 module;
 
 #include <cstring>
+#include <sstream>
 #include <vector>
 
 module infinity_thrift_service;
@@ -49,6 +50,7 @@ import match_expr;
 import fusion_expr;
 import parsed_expr;
 import update_statement;
+import insert_statement;
 import search_expr;
 import explain_statement;
 import create_index_info;
@@ -266,6 +268,23 @@ void InfinityThriftService::Insert(infinity_thrift_rpc::CommonResponse &response
         return;
     }
 
+    if (!request.columns.empty()) {
+        // Columnar insert, the column buffers are copied into the table blocks as they are packed
+        auto column_data = new Vector<InsertColumnData>();
+        column_data->reserve(request.columns.size());
+        for (const auto &column : request.columns) {
+            InsertColumnData &data = column_data->emplace_back();
+            data.column_name_ = column.column_name;
+            data.data_type_ = GetColumnTypeFromProto(column.data_type);
+            data.row_count_ = column.row_count;
+            data.data_.assign(column.data.begin(), column.data.end());
+            data.varchar_offsets_.assign(column.varchar_offsets.begin(), column.varchar_offsets.end());
+        }
+        auto result = infinity->InsertColumns(request.db_name, request.table_name, column_data);
+        ProcessQueryResult(response, result);
+        return;
+    }
+
     if (request.fields.empty()) {
         ProcessStatus(response, Status::InsertWithoutValues());
         return;
@@ -551,7 +570,21 @@ void InfinityThriftService::Select(infinity_thrift_rpc::SelectResponse &response
     //
     // auto start3 = std::chrono::steady_clock::now();
 
-    const QueryResult result = infinity->Search(request.db_name, request.table_name, search_expr, filter, output_columns);
+    // Everything but the session id identifies the request for the result cache
+    std::ostringstream query_text_stream;
+    for (const auto &select_expr : request.select_list) {
+        select_expr.printTo(query_text_stream);
+    }
+    query_text_stream << '|';
+    if (request.__isset.search_expr) {
+        request.search_expr.printTo(query_text_stream);
+    }
+    query_text_stream << '|';
+    if (request.__isset.where_expr) {
+        request.where_expr.printTo(query_text_stream);
+    }
+    String query_text = query_text_stream.str();
+    const QueryResult result = infinity->Search(request.db_name, request.table_name, search_expr, filter, output_columns, &query_text);
 
     // auto end3 = std::chrono::steady_clock::now();
     //
@@ -901,7 +934,7 @@ void InfinityThriftService::ShowTable(infinity_thrift_rpc::ShowTableResponse &re
     if (result.IsOk()) {
         SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(0);
         auto row_count = data_block->row_count();
-        if (row_count != 6) {
+        if (row_count != 7) {
             String error_message = "ShowTable: query result is invalid.";
             LOG_CRITICAL(error_message);
             UnrecoverableError(error_message);
@@ -1189,6 +1222,58 @@ void InfinityThriftService::ShowIndex(infinity_thrift_rpc::ShowIndexResponse &re
     }
 }
 
+void InfinityThriftService::Prepare(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::PrepareRequest &request) {
+    auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
+    if (!infinity_status.ok()) {
+        ProcessStatus(response, infinity_status);
+        return;
+    }
+
+    auto result = infinity->Prepare(request.statement_name, request.statement);
+    ProcessQueryResult(response, result);
+}
+
+void InfinityThriftService::Execute(infinity_thrift_rpc::SelectResponse &response, const infinity_thrift_rpc::ExecuteRequest &request) {
+    auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
+    if (!infinity_status.ok()) {
+        ProcessStatus(response, infinity_status);
+        return;
+    }
+
+    Status constant_status;
+    auto parameters = new Vector<ParsedExpr *>();
+    parameters->reserve(request.parameters.size());
+    for (auto &parameter : request.parameters) {
+        auto parsed_expr = GetConstantFromProto(constant_status, parameter);
+        if (!constant_status.ok()) {
+            for (auto &parameter_ptr : *parameters) {
+                delete parameter_ptr;
+                parameter_ptr = nullptr;
+            }
+            delete parameters;
+            parameters = nullptr;
+
+            if (parsed_expr != nullptr) {
+                delete parsed_expr;
+                parsed_expr = nullptr;
+            }
+
+            ProcessStatus(response, constant_status);
+            return;
+        }
+        parameters->emplace_back(parsed_expr);
+    }
+
+    const QueryResult result = infinity->Execute(request.statement_name, parameters);
+    if (result.IsOk()) {
+        auto &columns = response.column_fields;
+        columns.resize(result.result_table_->ColumnCount());
+        ProcessDataBlocks(result, response, columns);
+    } else {
+        ProcessQueryResult(response, result);
+    }
+}
+
 void InfinityThriftService::ShowSegments(infinity_thrift_rpc::SelectResponse &response, const infinity_thrift_rpc::ShowSegmentsRequest &request) {
     auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
     if (!infinity_status.ok()) {
@@ -1538,6 +1623,10 @@ EmbeddingDataType InfinityThriftService::GetEmbeddingDataTypeFromProto(const inf
             return EmbeddingDataType::kElemFloat;
         case infinity_thrift_rpc::ElementType::ElementFloat64:
             return EmbeddingDataType::kElemDouble;
+        case infinity_thrift_rpc::ElementType::ElementFloat16:
+            return EmbeddingDataType::kElemFloat16;
+        case infinity_thrift_rpc::ElementType::ElementBFloat16:
+            return EmbeddingDataType::kElemBFloat16;
         default:
             return EmbeddingDataType::kElemInvalid;
     }
@@ -1711,6 +1800,18 @@ Tuple<KnnExpr *, Status> InfinityThriftService::GetKnnExprFromProto(const infini
         return {nullptr, status};
     }
 
+    // A batch of query_count embeddings is sent flattened into embedding_data
+    if (expr.query_count <= 0 || dimension % expr.query_count != 0) {
+        delete knn_expr;
+        knn_expr = nullptr;
+        return {nullptr,
+                Status::InvalidParameterValue("query_count",
+                                              std::to_string(expr.query_count),
+                                              fmt::format("{} embedding elements can't be split into query_count embeddings", dimension))};
+    }
+    knn_expr->query_count_ = expr.query_count;
+    knn_expr->dimension_ = dimension / expr.query_count;
+
     knn_expr->topn_ = expr.topn;
     if (knn_expr->topn_ <= 0) {
         delete knn_expr;
@@ -1998,6 +2099,10 @@ infinity_thrift_rpc::ElementType::type InfinityThriftService::EmbeddingDataTypeT
             return infinity_thrift_rpc::ElementType::ElementFloat32;
         case EmbeddingDataType::kElemDouble:
             return infinity_thrift_rpc::ElementType::ElementFloat64;
+        case EmbeddingDataType::kElemFloat16:
+            return infinity_thrift_rpc::ElementType::ElementFloat16;
+        case EmbeddingDataType::kElemBFloat16:
+            return infinity_thrift_rpc::ElementType::ElementBFloat16;
         case EmbeddingDataType::kElemInvalid: {
             String error_message = fmt::format("Invalid embedding element data type: {}", embedding_info.ToString());
             LOG_CRITICAL(error_message);
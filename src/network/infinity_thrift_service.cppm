@@ -126,6 +126,10 @@ public:
 
     void ShowIndex(infinity_thrift_rpc::ShowIndexResponse &response, const infinity_thrift_rpc::ShowIndexRequest &request) final;
 
+    void Prepare(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::PrepareRequest &request) final;
+
+    void Execute(infinity_thrift_rpc::SelectResponse &response, const infinity_thrift_rpc::ExecuteRequest &request) final;
+
 private:
 
 
@@ -53,6 +53,8 @@ export using infinity_thrift_rpc::CreateIndexRequest;
 export using infinity_thrift_rpc::DropIndexRequest;
 export using infinity_thrift_rpc::ListIndexRequest;
 export using infinity_thrift_rpc::ShowIndexRequest;
+export using infinity_thrift_rpc::PrepareRequest;
+export using infinity_thrift_rpc::ExecuteRequest;
 export using infinity_thrift_rpc::ListDatabaseResponse;
 export using infinity_thrift_rpc::ListTableResponse;
 export using infinity_thrift_rpc::ShowDatabaseResponse;
@@ -53,6 +53,8 @@ KnnExpr::~KnnExpr() {
                 delete[] data_ptr;
                 break;
             }
+            case EmbeddingDataType::kElemFloat16:
+            case EmbeddingDataType::kElemBFloat16:
             case EmbeddingDataType::kElemInt16: {
                 int16_t *data_ptr = reinterpret_cast<int16_t *>(embedding_data_ptr_);
                 delete[] data_ptr;
@@ -115,8 +117,51 @@ bool KnnExpr::InitDistanceType(const char *distance_type) {
     return true;
 }
 
+bool KnnExpr::InitBatchEmbedding(const char *data_type, const ConstantExpr *query_vecs) {
+    // [[...], [...], ...] searches a batch of query embeddings, they are flattened into one array
+    const auto &sub_arrays = query_vecs->sub_array_array_;
+    bool has_double = false;
+    for (const auto &sub_array : sub_arrays) {
+        if (sub_array->literal_type_ == LiteralType::kDoubleArray) {
+            has_double = true;
+        } else if (sub_array->literal_type_ != LiteralType::kIntegerArray) {
+            return false;
+        }
+    }
+    ConstantExpr flat_query_vec(has_double ? LiteralType::kDoubleArray : LiteralType::kIntegerArray);
+    size_t query_dimension = 0;
+    for (const auto &sub_array : sub_arrays) {
+        size_t sub_dimension = sub_array->double_array_.size() + sub_array->long_array_.size();
+        if (has_double) {
+            flat_query_vec.double_array_.insert(flat_query_vec.double_array_.end(), sub_array->double_array_.begin(), sub_array->double_array_.end());
+            flat_query_vec.double_array_.insert(flat_query_vec.double_array_.end(), sub_array->long_array_.begin(), sub_array->long_array_.end());
+        } else {
+            flat_query_vec.long_array_.insert(flat_query_vec.long_array_.end(), sub_array->long_array_.begin(), sub_array->long_array_.end());
+        }
+        if (query_dimension == 0) {
+            query_dimension = sub_dimension;
+        } else if (query_dimension != sub_dimension) {
+            return false;
+        }
+    }
+    if (query_dimension == 0 or !InitEmbedding(data_type, &flat_query_vec)) {
+        return false;
+    }
+    if (size_t(dimension_) != query_dimension * sub_arrays.size()) {
+        return false;
+    }
+    query_count_ = sub_arrays.size();
+    dimension_ = query_dimension;
+    return true;
+}
+
 bool KnnExpr::InitEmbedding(const char *data_type, const ConstantExpr *query_vec) {
-    if (strcmp(data_type, "float") == 0 and distance_type_ != infinity::KnnDistanceType::kHamming) {
+    if (query_vec->literal_type_ == LiteralType::kSubArrayArray) {
+        return InitBatchEmbedding(data_type, query_vec);
+    }
+    // half precision columns are searched with a float query, the narrowing only applies to the stored data
+    bool float_query = strcmp(data_type, "float") == 0 or strcmp(data_type, "float16") == 0 or strcmp(data_type, "bfloat16") == 0;
+    if (float_query and distance_type_ != infinity::KnnDistanceType::kHamming) {
         embedding_data_type_ = infinity::EmbeddingDataType::kElemFloat;
         if (!(query_vec->double_array_.empty())) {
             dimension_ = query_vec->double_array_.size();
@@ -41,6 +41,9 @@ public:
 
     bool InitEmbedding(const char *data_type, const ConstantExpr *query_vec);
 
+private:
+    bool InitBatchEmbedding(const char *data_type, const ConstantExpr *query_vecs);
+
 public:
     static std::string KnnDistanceType2Str(KnnDistanceType knn_distance_type);
 
@@ -50,10 +53,16 @@ public:
     ParsedExpr *column_expr_{};
     void *embedding_data_ptr_{}; // Pointer to the embedding data ,the data type include float, int ,char ...., so we use void* here
     int64_t dimension_{};
+    // Number of query embeddings searched together, embedding_data_ptr_ holds query_count_ * dimension_ elements
+    int64_t query_count_{1};
     EmbeddingDataType embedding_data_type_{EmbeddingDataType::kElemInvalid};
     KnnDistanceType distance_type_{KnnDistanceType::kInvalid};
     int64_t topn_{};
     std::vector<InitParameter *> *opt_params_{};
+
+    // Set when the query embedding is a '?' of a prepared statement, InitEmbedding is deferred to EXECUTE
+    int64_t query_parameter_index_{-1};
+    std::string query_parameter_type_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -300,119 +300,122 @@ enum yysymbol_kind_t
   YYSYMBOL_186_ = 186,                     /* '.'  */
   YYSYMBOL_187_ = 187,                     /* ';'  */
   YYSYMBOL_188_ = 188,                     /* ','  */
-  YYSYMBOL_189_ = 189,                     /* ':'  */
-  YYSYMBOL_YYACCEPT = 190,                 /* $accept  */
-  YYSYMBOL_input_pattern = 191,            /* input_pattern  */
-  YYSYMBOL_statement_list = 192,           /* statement_list  */
-  YYSYMBOL_statement = 193,                /* statement  */
-  YYSYMBOL_explainable_statement = 194,    /* explainable_statement  */
-  YYSYMBOL_create_statement = 195,         /* create_statement  */
-  YYSYMBOL_table_element_array = 196,      /* table_element_array  */
-  YYSYMBOL_table_element = 197,            /* table_element  */
-  YYSYMBOL_table_column = 198,             /* table_column  */
-  YYSYMBOL_column_type = 199,              /* column_type  */
-  YYSYMBOL_column_constraints = 200,       /* column_constraints  */
-  YYSYMBOL_column_constraint = 201,        /* column_constraint  */
-  YYSYMBOL_default_expr = 202,             /* default_expr  */
-  YYSYMBOL_table_constraint = 203,         /* table_constraint  */
-  YYSYMBOL_identifier_array = 204,         /* identifier_array  */
-  YYSYMBOL_delete_statement = 205,         /* delete_statement  */
-  YYSYMBOL_insert_statement = 206,         /* insert_statement  */
-  YYSYMBOL_optional_identifier_array = 207, /* optional_identifier_array  */
-  YYSYMBOL_explain_statement = 208,        /* explain_statement  */
-  YYSYMBOL_explain_type = 209,             /* explain_type  */
-  YYSYMBOL_update_statement = 210,         /* update_statement  */
-  YYSYMBOL_update_expr_array = 211,        /* update_expr_array  */
-  YYSYMBOL_update_expr = 212,              /* update_expr  */
-  YYSYMBOL_drop_statement = 213,           /* drop_statement  */
-  YYSYMBOL_copy_statement = 214,           /* copy_statement  */
-  YYSYMBOL_select_statement = 215,         /* select_statement  */
-  YYSYMBOL_select_with_paren = 216,        /* select_with_paren  */
-  YYSYMBOL_select_without_paren = 217,     /* select_without_paren  */
-  YYSYMBOL_select_clause_with_modifier = 218, /* select_clause_with_modifier  */
-  YYSYMBOL_select_clause_without_modifier_paren = 219, /* select_clause_without_modifier_paren  */
-  YYSYMBOL_select_clause_without_modifier = 220, /* select_clause_without_modifier  */
-  YYSYMBOL_order_by_clause = 221,          /* order_by_clause  */
-  YYSYMBOL_order_by_expr_list = 222,       /* order_by_expr_list  */
-  YYSYMBOL_order_by_expr = 223,            /* order_by_expr  */
-  YYSYMBOL_order_by_type = 224,            /* order_by_type  */
-  YYSYMBOL_limit_expr = 225,               /* limit_expr  */
-  YYSYMBOL_offset_expr = 226,              /* offset_expr  */
-  YYSYMBOL_distinct = 227,                 /* distinct  */
-  YYSYMBOL_from_clause = 228,              /* from_clause  */
-  YYSYMBOL_search_clause = 229,            /* search_clause  */
-  YYSYMBOL_where_clause = 230,             /* where_clause  */
-  YYSYMBOL_having_clause = 231,            /* having_clause  */
-  YYSYMBOL_group_by_clause = 232,          /* group_by_clause  */
-  YYSYMBOL_set_operator = 233,             /* set_operator  */
-  YYSYMBOL_table_reference = 234,          /* table_reference  */
-  YYSYMBOL_table_reference_unit = 235,     /* table_reference_unit  */
-  YYSYMBOL_table_reference_name = 236,     /* table_reference_name  */
-  YYSYMBOL_table_name = 237,               /* table_name  */
-  YYSYMBOL_table_alias = 238,              /* table_alias  */
-  YYSYMBOL_with_clause = 239,              /* with_clause  */
-  YYSYMBOL_with_expr_list = 240,           /* with_expr_list  */
-  YYSYMBOL_with_expr = 241,                /* with_expr  */
-  YYSYMBOL_join_clause = 242,              /* join_clause  */
-  YYSYMBOL_join_type = 243,                /* join_type  */
-  YYSYMBOL_show_statement = 244,           /* show_statement  */
-  YYSYMBOL_flush_statement = 245,          /* flush_statement  */
-  YYSYMBOL_optimize_statement = 246,       /* optimize_statement  */
-  YYSYMBOL_command_statement = 247,        /* command_statement  */
-  YYSYMBOL_compact_statement = 248,        /* compact_statement  */
-  YYSYMBOL_expr_array = 249,               /* expr_array  */
-  YYSYMBOL_expr_array_list = 250,          /* expr_array_list  */
-  YYSYMBOL_expr_alias = 251,               /* expr_alias  */
-  YYSYMBOL_expr = 252,                     /* expr  */
-  YYSYMBOL_operand = 253,                  /* operand  */
-  YYSYMBOL_extra_match_tensor_option = 254, /* extra_match_tensor_option  */
-  YYSYMBOL_match_tensor_expr = 255,        /* match_tensor_expr  */
-  YYSYMBOL_match_vector_expr = 256,        /* match_vector_expr  */
-  YYSYMBOL_match_sparse_expr = 257,        /* match_sparse_expr  */
-  YYSYMBOL_match_text_expr = 258,          /* match_text_expr  */
-  YYSYMBOL_query_expr = 259,               /* query_expr  */
-  YYSYMBOL_fusion_expr = 260,              /* fusion_expr  */
-  YYSYMBOL_sub_search = 261,               /* sub_search  */
-  YYSYMBOL_sub_search_array = 262,         /* sub_search_array  */
-  YYSYMBOL_function_expr = 263,            /* function_expr  */
-  YYSYMBOL_conjunction_expr = 264,         /* conjunction_expr  */
-  YYSYMBOL_between_expr = 265,             /* between_expr  */
-  YYSYMBOL_in_expr = 266,                  /* in_expr  */
-  YYSYMBOL_case_expr = 267,                /* case_expr  */
-  YYSYMBOL_case_check_array = 268,         /* case_check_array  */
-  YYSYMBOL_cast_expr = 269,                /* cast_expr  */
-  YYSYMBOL_subquery_expr = 270,            /* subquery_expr  */
-  YYSYMBOL_column_expr = 271,              /* column_expr  */
-  YYSYMBOL_constant_expr = 272,            /* constant_expr  */
-  YYSYMBOL_common_array_expr = 273,        /* common_array_expr  */
-  YYSYMBOL_subarray_array_expr = 274,      /* subarray_array_expr  */
-  YYSYMBOL_unclosed_subarray_array_expr = 275, /* unclosed_subarray_array_expr  */
-  YYSYMBOL_sparse_array_expr = 276,        /* sparse_array_expr  */
-  YYSYMBOL_long_sparse_array_expr = 277,   /* long_sparse_array_expr  */
-  YYSYMBOL_unclosed_long_sparse_array_expr = 278, /* unclosed_long_sparse_array_expr  */
-  YYSYMBOL_double_sparse_array_expr = 279, /* double_sparse_array_expr  */
-  YYSYMBOL_unclosed_double_sparse_array_expr = 280, /* unclosed_double_sparse_array_expr  */
-  YYSYMBOL_empty_array_expr = 281,         /* empty_array_expr  */
-  YYSYMBOL_int_sparse_ele = 282,           /* int_sparse_ele  */
-  YYSYMBOL_float_sparse_ele = 283,         /* float_sparse_ele  */
-  YYSYMBOL_array_expr = 284,               /* array_expr  */
-  YYSYMBOL_long_array_expr = 285,          /* long_array_expr  */
-  YYSYMBOL_unclosed_long_array_expr = 286, /* unclosed_long_array_expr  */
-  YYSYMBOL_double_array_expr = 287,        /* double_array_expr  */
-  YYSYMBOL_unclosed_double_array_expr = 288, /* unclosed_double_array_expr  */
-  YYSYMBOL_interval_expr = 289,            /* interval_expr  */
-  YYSYMBOL_copy_option_list = 290,         /* copy_option_list  */
-  YYSYMBOL_copy_option = 291,              /* copy_option  */
-  YYSYMBOL_file_path = 292,                /* file_path  */
-  YYSYMBOL_if_exists = 293,                /* if_exists  */
-  YYSYMBOL_if_not_exists = 294,            /* if_not_exists  */
-  YYSYMBOL_semicolon = 295,                /* semicolon  */
-  YYSYMBOL_if_not_exists_info = 296,       /* if_not_exists_info  */
-  YYSYMBOL_with_index_param_list = 297,    /* with_index_param_list  */
-  YYSYMBOL_optional_table_properties_list = 298, /* optional_table_properties_list  */
-  YYSYMBOL_index_param_list = 299,         /* index_param_list  */
-  YYSYMBOL_index_param = 300,              /* index_param  */
-  YYSYMBOL_index_info_list = 301           /* index_info_list  */
+  YYSYMBOL_189_ = 189,                     /* '?'  */
+  YYSYMBOL_190_ = 190,                     /* ':'  */
+  YYSYMBOL_YYACCEPT = 191,                 /* $accept  */
+  YYSYMBOL_input_pattern = 192,            /* input_pattern  */
+  YYSYMBOL_statement_list = 193,           /* statement_list  */
+  YYSYMBOL_statement = 194,                /* statement  */
+  YYSYMBOL_explainable_statement = 195,    /* explainable_statement  */
+  YYSYMBOL_prepare_statement = 196,        /* prepare_statement  */
+  YYSYMBOL_execute_statement = 197,        /* execute_statement  */
+  YYSYMBOL_create_statement = 198,         /* create_statement  */
+  YYSYMBOL_table_element_array = 199,      /* table_element_array  */
+  YYSYMBOL_table_element = 200,            /* table_element  */
+  YYSYMBOL_table_column = 201,             /* table_column  */
+  YYSYMBOL_column_type = 202,              /* column_type  */
+  YYSYMBOL_column_constraints = 203,       /* column_constraints  */
+  YYSYMBOL_column_constraint = 204,        /* column_constraint  */
+  YYSYMBOL_default_expr = 205,             /* default_expr  */
+  YYSYMBOL_table_constraint = 206,         /* table_constraint  */
+  YYSYMBOL_identifier_array = 207,         /* identifier_array  */
+  YYSYMBOL_delete_statement = 208,         /* delete_statement  */
+  YYSYMBOL_insert_statement = 209,         /* insert_statement  */
+  YYSYMBOL_optional_identifier_array = 210, /* optional_identifier_array  */
+  YYSYMBOL_explain_statement = 211,        /* explain_statement  */
+  YYSYMBOL_explain_type = 212,             /* explain_type  */
+  YYSYMBOL_update_statement = 213,         /* update_statement  */
+  YYSYMBOL_update_expr_array = 214,        /* update_expr_array  */
+  YYSYMBOL_update_expr = 215,              /* update_expr  */
+  YYSYMBOL_drop_statement = 216,           /* drop_statement  */
+  YYSYMBOL_copy_statement = 217,           /* copy_statement  */
+  YYSYMBOL_select_statement = 218,         /* select_statement  */
+  YYSYMBOL_select_with_paren = 219,        /* select_with_paren  */
+  YYSYMBOL_select_without_paren = 220,     /* select_without_paren  */
+  YYSYMBOL_select_clause_with_modifier = 221, /* select_clause_with_modifier  */
+  YYSYMBOL_select_clause_without_modifier_paren = 222, /* select_clause_without_modifier_paren  */
+  YYSYMBOL_select_clause_without_modifier = 223, /* select_clause_without_modifier  */
+  YYSYMBOL_order_by_clause = 224,          /* order_by_clause  */
+  YYSYMBOL_order_by_expr_list = 225,       /* order_by_expr_list  */
+  YYSYMBOL_order_by_expr = 226,            /* order_by_expr  */
+  YYSYMBOL_order_by_type = 227,            /* order_by_type  */
+  YYSYMBOL_limit_expr = 228,               /* limit_expr  */
+  YYSYMBOL_offset_expr = 229,              /* offset_expr  */
+  YYSYMBOL_distinct = 230,                 /* distinct  */
+  YYSYMBOL_from_clause = 231,              /* from_clause  */
+  YYSYMBOL_search_clause = 232,            /* search_clause  */
+  YYSYMBOL_where_clause = 233,             /* where_clause  */
+  YYSYMBOL_having_clause = 234,            /* having_clause  */
+  YYSYMBOL_group_by_clause = 235,          /* group_by_clause  */
+  YYSYMBOL_set_operator = 236,             /* set_operator  */
+  YYSYMBOL_table_reference = 237,          /* table_reference  */
+  YYSYMBOL_table_reference_unit = 238,     /* table_reference_unit  */
+  YYSYMBOL_table_reference_name = 239,     /* table_reference_name  */
+  YYSYMBOL_table_name = 240,               /* table_name  */
+  YYSYMBOL_table_alias = 241,              /* table_alias  */
+  YYSYMBOL_with_clause = 242,              /* with_clause  */
+  YYSYMBOL_with_expr_list = 243,           /* with_expr_list  */
+  YYSYMBOL_with_expr = 244,                /* with_expr  */
+  YYSYMBOL_join_clause = 245,              /* join_clause  */
+  YYSYMBOL_join_type = 246,                /* join_type  */
+  YYSYMBOL_show_statement = 247,           /* show_statement  */
+  YYSYMBOL_flush_statement = 248,          /* flush_statement  */
+  YYSYMBOL_optimize_statement = 249,       /* optimize_statement  */
+  YYSYMBOL_command_statement = 250,        /* command_statement  */
+  YYSYMBOL_compact_statement = 251,        /* compact_statement  */
+  YYSYMBOL_expr_array = 252,               /* expr_array  */
+  YYSYMBOL_expr_array_list = 253,          /* expr_array_list  */
+  YYSYMBOL_expr_alias = 254,               /* expr_alias  */
+  YYSYMBOL_expr = 255,                     /* expr  */
+  YYSYMBOL_operand = 256,                  /* operand  */
+  YYSYMBOL_extra_match_tensor_option = 257, /* extra_match_tensor_option  */
+  YYSYMBOL_match_tensor_expr = 258,        /* match_tensor_expr  */
+  YYSYMBOL_match_vector_expr = 259,        /* match_vector_expr  */
+  YYSYMBOL_match_sparse_expr = 260,        /* match_sparse_expr  */
+  YYSYMBOL_match_text_expr = 261,          /* match_text_expr  */
+  YYSYMBOL_query_expr = 262,               /* query_expr  */
+  YYSYMBOL_fusion_expr = 263,              /* fusion_expr  */
+  YYSYMBOL_sub_search = 264,               /* sub_search  */
+  YYSYMBOL_sub_search_array = 265,         /* sub_search_array  */
+  YYSYMBOL_function_expr = 266,            /* function_expr  */
+  YYSYMBOL_conjunction_expr = 267,         /* conjunction_expr  */
+  YYSYMBOL_between_expr = 268,             /* between_expr  */
+  YYSYMBOL_in_expr = 269,                  /* in_expr  */
+  YYSYMBOL_case_expr = 270,                /* case_expr  */
+  YYSYMBOL_case_check_array = 271,         /* case_check_array  */
+  YYSYMBOL_cast_expr = 272,                /* cast_expr  */
+  YYSYMBOL_subquery_expr = 273,            /* subquery_expr  */
+  YYSYMBOL_column_expr = 274,              /* column_expr  */
+  YYSYMBOL_constant_expr = 275,            /* constant_expr  */
+  YYSYMBOL_common_array_expr = 276,        /* common_array_expr  */
+  YYSYMBOL_subarray_array_expr = 277,      /* subarray_array_expr  */
+  YYSYMBOL_unclosed_subarray_array_expr = 278, /* unclosed_subarray_array_expr  */
+  YYSYMBOL_sparse_array_expr = 279,        /* sparse_array_expr  */
+  YYSYMBOL_long_sparse_array_expr = 280,   /* long_sparse_array_expr  */
+  YYSYMBOL_unclosed_long_sparse_array_expr = 281, /* unclosed_long_sparse_array_expr  */
+  YYSYMBOL_double_sparse_array_expr = 282, /* double_sparse_array_expr  */
+  YYSYMBOL_unclosed_double_sparse_array_expr = 283, /* unclosed_double_sparse_array_expr  */
+  YYSYMBOL_empty_array_expr = 284,         /* empty_array_expr  */
+  YYSYMBOL_int_sparse_ele = 285,           /* int_sparse_ele  */
+  YYSYMBOL_float_sparse_ele = 286,         /* float_sparse_ele  */
+  YYSYMBOL_array_expr = 287,               /* array_expr  */
+  YYSYMBOL_long_array_expr = 288,          /* long_array_expr  */
+  YYSYMBOL_unclosed_long_array_expr = 289, /* unclosed_long_array_expr  */
+  YYSYMBOL_double_array_expr = 290,        /* double_array_expr  */
+  YYSYMBOL_unclosed_double_array_expr = 291, /* unclosed_double_array_expr  */
+  YYSYMBOL_interval_expr = 292,            /* interval_expr  */
+  YYSYMBOL_copy_option_list = 293,         /* copy_option_list  */
+  YYSYMBOL_copy_option = 294,              /* copy_option  */
+  YYSYMBOL_file_path = 295,                /* file_path  */
+  YYSYMBOL_if_exists = 296,                /* if_exists  */
+  YYSYMBOL_if_not_exists = 297,            /* if_not_exists  */
+  YYSYMBOL_semicolon = 298,                /* semicolon  */
+  YYSYMBOL_if_not_exists_info = 299,       /* if_not_exists_info  */
+  YYSYMBOL_with_index_param_list = 300,    /* with_index_param_list  */
+  YYSYMBOL_optional_table_properties_list = 301, /* optional_table_properties_list  */
+  YYSYMBOL_index_param_list = 302,         /* index_param_list  */
+  YYSYMBOL_index_param = 303,              /* index_param  */
+  YYSYMBOL_index_info_list = 304           /* index_info_list  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -426,7 +429,7 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
 #endif
 
-#line 430 "parser.cpp"
+#line 433 "parser.cpp"
 
 #ifdef short
 # undef short
@@ -750,18 +753,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  84
+#define YYFINAL  90
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   1062
+#define YYLAST   1102
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  190
+#define YYNTOKENS  191
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  112
+#define YYNNTS  114
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  414
+#define YYNRULES  423
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  871
+#define YYNSTATES  898
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   428
@@ -783,8 +786,8 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,   181,     2,     2,
      184,   185,   179,   177,   188,   178,   186,   180,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   189,   187,
-     175,   174,   176,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   190,   187,
+     175,   174,   176,   189,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,   182,     2,   183,     2,     2,     2,     2,     2,     2,
@@ -827,48 +830,49 @@ static const yytype_uint8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   492,   492,   496,   502,   509,   510,   511,   512,   513,
-     514,   515,   516,   517,   518,   519,   520,   521,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
-     541,   558,   574,   603,   619,   637,   666,   670,   676,   679,
-     685,   733,   769,   770,   771,   772,   773,   774,   775,   776,
-     777,   778,   779,   780,   781,   782,   783,   784,   785,   786,
-     787,   790,   792,   793,   794,   795,   798,   799,   800,   801,
-     802,   803,   804,   805,   806,   807,   808,   809,   810,   811,
-     812,   813,   814,   815,   816,   817,   818,   819,   820,   821,
-     822,   823,   824,   825,   826,   827,   828,   829,   830,   831,
-     832,   833,   834,   835,   836,   837,   856,   860,   870,   873,
-     876,   879,   883,   886,   891,   896,   903,   909,   919,   935,
-     969,   982,   985,   992,   998,  1001,  1004,  1007,  1010,  1013,
-    1016,  1019,  1026,  1039,  1043,  1048,  1061,  1074,  1089,  1104,
-    1119,  1142,  1183,  1228,  1231,  1234,  1243,  1253,  1256,  1260,
-    1265,  1287,  1290,  1295,  1311,  1314,  1318,  1322,  1327,  1333,
-    1336,  1339,  1343,  1347,  1349,  1353,  1355,  1358,  1362,  1365,
-    1369,  1374,  1378,  1381,  1385,  1388,  1392,  1395,  1399,  1402,
-    1405,  1408,  1416,  1419,  1434,  1434,  1436,  1450,  1459,  1464,
-    1473,  1478,  1483,  1489,  1496,  1499,  1503,  1506,  1511,  1523,
-    1530,  1544,  1547,  1550,  1553,  1556,  1559,  1562,  1568,  1572,
-    1576,  1580,  1584,  1591,  1595,  1599,  1603,  1609,  1615,  1621,
-    1632,  1643,  1654,  1666,  1678,  1691,  1705,  1716,  1730,  1746,
-    1767,  1771,  1775,  1783,  1797,  1803,  1808,  1814,  1820,  1828,
-    1834,  1840,  1846,  1852,  1860,  1866,  1872,  1878,  1884,  1892,
-    1898,  1905,  1922,  1926,  1931,  1935,  1962,  1968,  1972,  1973,
-    1974,  1975,  1976,  1978,  1981,  1987,  1990,  1991,  1992,  1993,
-    1994,  1995,  1996,  1997,  1998,  1999,  2001,  2004,  2010,  2029,
-    2073,  2091,  2099,  2110,  2116,  2125,  2131,  2143,  2146,  2149,
-    2152,  2155,  2158,  2162,  2166,  2171,  2179,  2187,  2196,  2203,
-    2210,  2217,  2224,  2231,  2239,  2247,  2255,  2263,  2271,  2279,
-    2287,  2295,  2303,  2311,  2319,  2327,  2357,  2365,  2374,  2382,
-    2391,  2399,  2405,  2412,  2418,  2425,  2430,  2437,  2444,  2452,
-    2476,  2482,  2488,  2495,  2503,  2510,  2517,  2522,  2532,  2537,
-    2542,  2547,  2552,  2557,  2562,  2567,  2572,  2577,  2580,  2583,
-    2587,  2590,  2593,  2596,  2600,  2604,  2609,  2614,  2617,  2621,
-    2625,  2632,  2639,  2643,  2650,  2657,  2661,  2665,  2669,  2672,
-    2676,  2680,  2685,  2690,  2694,  2699,  2704,  2710,  2716,  2722,
-    2728,  2734,  2740,  2746,  2752,  2758,  2764,  2770,  2781,  2785,
-    2790,  2815,  2825,  2831,  2835,  2836,  2838,  2839,  2841,  2842,
-    2854,  2862,  2866,  2869,  2873,  2876,  2880,  2884,  2889,  2894,
-    2902,  2909,  2920,  2968,  3017
+       0,   494,   494,   498,   504,   511,   512,   513,   514,   515,
+     516,   517,   518,   519,   520,   521,   522,   523,   524,   525,
+     527,   528,   529,   530,   531,   532,   533,   534,   535,   536,
+     537,   538,   543,   556,   562,   575,   592,   608,   637,   653,
+     671,   700,   704,   710,   713,   719,   767,   803,   804,   805,
+     806,   807,   808,   809,   810,   811,   812,   813,   814,   815,
+     816,   817,   818,   819,   820,   821,   824,   826,   827,   828,
+     829,   832,   833,   834,   835,   836,   837,   838,   839,   840,
+     856,   857,   858,   859,   860,   861,   862,   863,   864,   865,
+     866,   867,   868,   869,   870,   871,   872,   873,   874,   875,
+     876,   877,   878,   879,   880,   896,   897,   898,   899,   900,
+     901,   902,   903,   922,   926,   936,   939,   942,   945,   949,
+     952,   957,   962,   969,   975,   985,  1001,  1035,  1048,  1051,
+    1058,  1064,  1067,  1070,  1073,  1076,  1079,  1082,  1085,  1092,
+    1105,  1109,  1114,  1127,  1140,  1155,  1170,  1185,  1208,  1249,
+    1294,  1297,  1300,  1309,  1319,  1322,  1326,  1331,  1353,  1356,
+    1361,  1377,  1380,  1384,  1388,  1393,  1399,  1402,  1405,  1409,
+    1413,  1415,  1419,  1421,  1424,  1428,  1431,  1435,  1440,  1444,
+    1447,  1451,  1454,  1458,  1461,  1465,  1468,  1471,  1474,  1482,
+    1485,  1500,  1500,  1502,  1516,  1525,  1530,  1539,  1544,  1549,
+    1555,  1562,  1565,  1569,  1572,  1577,  1589,  1596,  1610,  1613,
+    1616,  1619,  1622,  1625,  1628,  1634,  1638,  1642,  1646,  1650,
+    1657,  1661,  1665,  1669,  1675,  1681,  1687,  1698,  1709,  1720,
+    1732,  1744,  1757,  1771,  1782,  1796,  1812,  1833,  1837,  1841,
+    1849,  1863,  1869,  1874,  1880,  1886,  1894,  1900,  1906,  1912,
+    1918,  1926,  1932,  1938,  1944,  1950,  1958,  1964,  1971,  1988,
+    1992,  1997,  2001,  2028,  2034,  2038,  2039,  2040,  2041,  2042,
+    2044,  2047,  2053,  2056,  2059,  2060,  2061,  2062,  2063,  2064,
+    2065,  2066,  2067,  2068,  2070,  2073,  2079,  2098,  2139,  2173,
+    2191,  2199,  2210,  2216,  2225,  2231,  2243,  2246,  2249,  2252,
+    2255,  2258,  2262,  2266,  2271,  2279,  2287,  2296,  2303,  2310,
+    2317,  2324,  2331,  2339,  2347,  2355,  2363,  2371,  2379,  2387,
+    2395,  2403,  2411,  2419,  2427,  2457,  2465,  2474,  2482,  2491,
+    2499,  2505,  2512,  2518,  2525,  2530,  2537,  2544,  2552,  2576,
+    2582,  2588,  2595,  2603,  2610,  2617,  2622,  2632,  2637,  2642,
+    2647,  2652,  2657,  2662,  2667,  2672,  2677,  2680,  2683,  2687,
+    2690,  2693,  2696,  2700,  2704,  2709,  2714,  2717,  2721,  2725,
+    2732,  2739,  2743,  2750,  2757,  2761,  2765,  2769,  2772,  2776,
+    2780,  2785,  2790,  2794,  2799,  2804,  2810,  2816,  2822,  2828,
+    2834,  2840,  2846,  2852,  2858,  2864,  2870,  2881,  2885,  2890,
+    2915,  2925,  2931,  2935,  2936,  2938,  2939,  2941,  2942,  2954,
+    2962,  2966,  2969,  2973,  2976,  2980,  2984,  2989,  2994,  3002,
+    3009,  3020,  3068,  3117
 };
 #endif
 
@@ -909,15 +913,16 @@ static const char *const yytname[] =
   "EXPORT", "PROFILE", "CONFIGS", "CONFIG", "PROFILES", "VARIABLES",
   "VARIABLE", "SEARCH", "MATCH", "MAXSIM", "QUERY", "FUSION", "NUMBER",
   "'='", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "'['", "']'",
-  "'('", "')'", "'.'", "';'", "','", "':'", "$accept", "input_pattern",
-  "statement_list", "statement", "explainable_statement",
-  "create_statement", "table_element_array", "table_element",
-  "table_column", "column_type", "column_constraints", "column_constraint",
-  "default_expr", "table_constraint", "identifier_array",
-  "delete_statement", "insert_statement", "optional_identifier_array",
-  "explain_statement", "explain_type", "update_statement",
-  "update_expr_array", "update_expr", "drop_statement", "copy_statement",
-  "select_statement", "select_with_paren", "select_without_paren",
+  "'('", "')'", "'.'", "';'", "','", "'?'", "':'", "$accept",
+  "input_pattern", "statement_list", "statement", "explainable_statement",
+  "prepare_statement", "execute_statement", "create_statement",
+  "table_element_array", "table_element", "table_column", "column_type",
+  "column_constraints", "column_constraint", "default_expr",
+  "table_constraint", "identifier_array", "delete_statement",
+  "insert_statement", "optional_identifier_array", "explain_statement",
+  "explain_type", "update_statement", "update_expr_array", "update_expr",
+  "drop_statement", "copy_statement", "select_statement",
+  "select_with_paren", "select_without_paren",
   "select_clause_with_modifier", "select_clause_without_modifier_paren",
   "select_clause_without_modifier", "order_by_clause",
   "order_by_expr_list", "order_by_expr", "order_by_type", "limit_expr",
@@ -954,12 +959,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-772)
+#define YYPACT_NINF (-747)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-402)
+#define YYTABLE_NINF (-411)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -968,94 +973,96 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     239,   263,    52,   321,    38,   -18,    38,    50,    39,   227,
-      70,    58,   112,    38,   125,     5,   -60,   183,    60,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,   317,  -772,  -772,
-     255,  -772,  -772,  -772,  -772,  -772,   207,   207,   207,   207,
-     -11,    38,   213,   213,   213,   213,   213,    97,   295,    38,
-     190,   335,   355,   357,  -772,  -772,  -772,  -772,  -772,  -772,
-    -772,   680,   374,    38,  -772,  -772,  -772,   130,   148,  -772,
-     409,  -772,    38,  -772,  -772,  -772,  -772,  -772,   369,   132,
-    -772,   432,   270,   276,  -772,   161,  -772,   436,  -772,  -772,
-      14,   396,  -772,   400,   395,   468,    38,    38,    38,   474,
-     433,   312,   413,   501,    38,    38,    38,   502,   513,   514,
-     451,   519,   519,    30,    59,    63,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,   317,  -772,  -772,  -772,  -772,  -772,  -772,
-     265,  -772,   521,  -772,   523,  -772,  -772,   344,   125,   519,
-    -772,  -772,  -772,  -772,    14,  -772,  -772,  -772,   462,   475,
-     461,   456,  -772,   -39,  -772,   312,  -772,    38,   530,     6,
-    -772,  -772,  -772,  -772,  -772,   471,  -772,   362,   -51,  -772,
-     462,  -772,  -772,   459,   460,  -772,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-     538,   536,  -772,  -772,  -772,  -772,  -772,   255,  -772,  -772,
-     358,   359,   361,  -772,  -772,   733,   496,   367,   368,   343,
-     549,   550,   554,   555,  -772,  -772,   557,   377,   169,   384,
-     385,   580,   580,  -772,    20,   378,   -54,  -772,   -20,   638,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,   387,  -772,  -772,  -772,  -116,  -772,  -772,
-      -3,  -772,    48,  -772,  -772,  -772,    51,  -772,    57,  -772,
-     462,   462,   503,  -772,   -60,    16,   518,   392,  -772,  -115,
-     397,  -772,    38,   462,   514,  -772,   194,   410,   423,   531,
-     350,   394,  -772,  -772,   224,  -772,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,   580,   424,   705,
-     516,   462,   462,    75,   -33,  -772,  -772,  -772,  -772,   733,
-    -772,   593,   427,   428,   430,   431,   612,   624,    41,    41,
-    -772,   441,  -772,  -772,  -772,  -772,   447,  -102,     7,   462,
-     467,   633,   462,   462,   -43,   453,   -30,   580,   580,   580,
-     580,   580,   580,   580,   580,   580,   580,   580,   580,   580,
-     580,    25,  -772,   463,  -772,   632,  -772,   636,  -772,   637,
-    -772,   643,   466,  -772,    29,   194,   462,  -772,   317,   797,
-     534,   476,   -77,  -772,  -772,  -772,   -60,   530,   477,  -772,
-     656,   462,   482,  -772,   194,  -772,   306,   306,   657,   665,
-    -772,  -772,   462,  -772,   -19,   516,   510,   487,   -14,    -7,
-     272,  -772,   462,   462,   599,   462,   675,    26,   462,     4,
-      73,   405,  -772,  -772,   -60,   493,   307,  -772,    27,  -772,
-    -772,   152,   451,  -772,  -772,   537,   504,   580,   378,   569,
-    -772,   443,   443,   155,   155,   649,   443,   443,   155,   155,
-      41,    41,  -772,  -772,  -772,  -772,  -772,  -772,   508,  -772,
-     509,  -772,  -772,  -772,   462,  -772,  -772,  -772,   194,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-     515,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-    -772,   517,   520,   524,   528,   532,   151,   533,   530,   672,
-      16,   317,    85,   530,  -772,    90,   535,   698,   711,  -772,
-     118,  -772,   186,   667,   668,   191,  -772,   540,  -772,   797,
-     462,  -772,   462,   -62,    32,   580,   -99,   544,  -772,   -48,
-     -91,  -772,   718,  -772,   719,  -772,  -772,    22,     7,   676,
-    -772,  -772,  -772,  -772,  -772,  -772,   677,  -772,   734,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,   556,   688,   378,
-     443,   560,   209,  -772,   580,   737,   742,  -772,   744,   342,
-     393,   511,   558,   635,   622,   630,  -772,  -772,   113,   151,
-    -772,  -772,   530,   219,   571,  -772,  -772,   604,   237,  -772,
-     462,  -772,  -772,  -772,   306,  -772,   750,   757,  -772,  -772,
-     581,   194,   -24,  -772,   462,   594,   585,   773,   463,   596,
-     602,   603,    27,   307,     7,     7,   597,   152,   736,   741,
-     607,   254,  -772,  -772,   705,   271,   601,   611,   614,   615,
-     616,   617,   618,   619,   620,   621,   623,   634,   645,   646,
-     647,   648,   650,   651,   652,   654,   655,   658,   659,   660,
-     666,   670,   671,   673,   674,   689,   690,   720,   721,   723,
-     724,   727,   728,   732,   735,   738,  -772,  -772,  -772,  -772,
-    -772,   290,  -772,   807,   817,   664,   291,  -772,  -772,  -772,
-    -772,  -772,   194,  -772,   415,   739,   305,   740,   794,   743,
-    -772,  -772,  -772,  -772,   767,   530,  -772,   462,   462,  -772,
-    -772,  -772,  -772,   831,   838,   839,   847,   849,   850,   854,
-     857,   915,   916,   918,   919,   923,   924,   926,   927,   928,
-     929,   930,   931,   932,   933,   934,   935,   936,   937,   938,
-     939,   940,   941,   942,   943,   944,   945,   946,   947,   948,
-     949,   950,   951,   952,  -772,   785,   310,  -772,   880,   958,
-    -772,  -772,   959,  -772,   960,   961,   441,   962,   462,   318,
-     774,   194,   782,   783,   784,   786,   787,   788,   789,   790,
-     791,   792,   793,   795,   796,   798,   799,   800,   801,   802,
-     803,   804,   805,   806,   808,   809,   810,   811,   812,   813,
-     814,   815,   816,   818,   819,   820,   821,   822,   823,   824,
-     825,   826,   827,   425,  -772,   807,   829,  -772,   880,   828,
-     830,   832,   833,   194,  -772,  -772,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-    -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,  -772,
-     807,  -772,   966,  -772,   975,   976,   325,   834,   835,   840,
-    -772,   986,   998,   841,   880,   842,  -772,  -772,  -772,   880,
-    -772
+     616,   232,   -21,   326,    37,    25,    37,   123,   425,    60,
+     108,   144,   164,   393,   204,    37,   206,    50,   -54,   220,
+      43,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,   159,  -747,  -747,   226,  -747,  -747,  -747,  -747,  -747,
+     166,   166,   166,   166,    33,    37,   190,   190,   190,   190,
+     190,    93,   252,    37,    45,   312,   346,   369,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,   642,   378,    37,  -747,  -747,
+    -747,   -11,    80,  -747,   398,  -747,   161,   360,    37,  -747,
+    -747,  -747,  -747,  -747,   365,   224,  -747,   423,   271,   273,
+    -747,    49,  -747,   445,  -747,  -747,    -2,   406,  -747,   415,
+     399,   487,    37,    37,    37,   489,   433,   317,   430,   508,
+      37,    37,    37,   520,   528,   530,   469,   535,   535,    48,
+      77,    82,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   159,
+    -747,  -747,  -747,  -747,  -747,  -747,   352,  -747,   550,  -747,
+     551,  -747,   405,   -54,  -747,   391,   206,   535,  -747,  -747,
+    -747,  -747,    -2,  -747,  -747,  -747,   405,   503,   511,   483,
+    -747,   -47,  -747,   317,  -747,    37,   582,     4,  -747,  -747,
+    -747,  -747,  -747,   524,  -747,   418,   -55,  -747,   405,  -747,
+    -747,   513,   516,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,   592,   591,
+    -747,  -747,  -747,  -747,  -747,   414,  -747,  -747,   627,   515,
+     416,   419,   316,   598,   600,   601,   602,  -747,  -747,   605,
+     429,   263,   431,   432,   604,   604,  -747,     9,   373,  -747,
+     117,  -747,   -49,   662,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,   426,  -747,  -747,
+    -747,  -131,  -747,  -747,    44,  -747,   118,  -747,  -747,  -747,
+     130,  -747,   186,  -747,   159,   226,  -747,  -747,   436,   437,
+     -67,   405,   405,   543,  -747,   -54,    28,   567,   449,  -747,
+     129,   452,  -747,    37,   405,   530,  -747,   175,   453,   454,
+     594,   313,   181,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,   604,   463,   717,   570,   405,
+     405,    65,   286,  -747,  -747,  -747,  -747,   627,  -747,   653,
+     475,   476,   477,   478,   659,   660,   392,   392,  -747,   480,
+    -747,  -747,  -747,  -747,   486,    95,  -747,   405,   669,   405,
+     405,   -53,   490,   -28,   604,   604,   604,   604,   604,   604,
+     604,   604,   604,   604,   604,   604,   604,   604,    18,  -747,
+     491,  -747,   670,  -747,   672,  -747,   674,  -747,   676,   492,
+    -747,  -747,     6,   507,   494,  -747,   -36,   175,   405,  -747,
+     159,   818,   559,   501,   148,  -747,  -747,  -747,   -54,   582,
+     505,  -747,   688,   405,   510,  -747,   175,  -747,   497,   497,
+     689,   695,  -747,   405,  -747,   163,   570,   553,   517,   -41,
+     -71,   308,  -747,   405,   405,   625,   405,   706,    19,   405,
+     266,   267,   401,  -747,  -747,  -747,  -747,  -747,   562,   529,
+     604,   373,   586,  -747,   726,   726,   162,   162,   671,   726,
+     726,   162,   162,   392,   392,  -747,  -747,  -747,  -747,  -747,
+    -747,   525,  -747,   526,  -747,  -747,  -747,  -747,   -54,   533,
+     374,  -747,    29,  -747,   121,   469,   405,  -747,  -747,  -747,
+     175,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,   539,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,   540,   542,   544,   545,   546,   103,   547,
+     582,   686,    28,   159,   294,   582,  -747,   298,   548,   723,
+     733,  -747,   311,  -747,   327,   685,   690,   328,  -747,   556,
+    -747,   818,   405,  -747,   405,    10,     8,   604,    55,   554,
+    -747,  -115,    72,  -747,   739,  -747,   740,  -747,  -747,   373,
+     726,   560,   329,  -747,   604,   750,   752,     3,     6,   712,
+    -747,  -747,  -747,  -747,  -747,  -747,   713,  -747,   771,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,   590,   725,  -747,
+     774,   160,   177,   205,   236,   332,   658,   661,  -747,  -747,
+      14,   103,  -747,  -747,   582,   340,   603,  -747,  -747,   633,
+     342,  -747,   405,  -747,  -747,  -747,   497,  -747,   785,   788,
+    -747,  -747,   610,   175,    67,  -747,   405,   573,  -134,   792,
+     491,   615,   614,   617,   619,   344,  -747,  -747,   717,    29,
+     374,     6,     6,   621,   121,   746,   755,   353,   624,   631,
+     634,   636,   637,   639,   640,   641,   643,   644,   645,   646,
+     647,   666,   667,   668,   677,   678,   679,   680,   687,   691,
+     692,   693,   694,   696,   697,   698,   699,   700,   701,   702,
+     711,   741,   742,   744,   745,   748,   749,   753,   754,   756,
+    -747,  -747,  -747,  -747,  -747,   355,  -747,   810,   827,   664,
+     375,  -747,  -747,  -747,  -747,  -747,   175,  -747,   757,   758,
+     376,   759,   851,   760,  -747,  -747,  -747,  -747,  -747,  -747,
+     794,   582,  -747,   405,   405,  -747,  -747,   853,   854,   868,
+     870,   871,   877,   937,   943,   944,   945,   946,   947,   948,
+     949,   950,   951,   952,   953,   954,   955,   956,   957,   958,
+     959,   960,   961,   962,   963,   964,   965,   966,   967,   968,
+     969,   970,   971,   972,   973,   974,   975,   976,   977,   978,
+    -747,   811,   380,  -747,   906,   984,  -747,   985,   986,  -747,
+     987,   988,   480,   989,   405,   381,   800,   175,   809,   812,
+     813,   814,   815,   816,   817,   819,   820,   821,   822,   823,
+     824,   825,   826,   828,   829,   830,   831,   832,   833,   834,
+     835,   836,   837,   838,   839,   840,   841,   842,   843,   844,
+     845,   846,   847,   848,   849,   850,   852,   855,   856,   857,
+     858,   410,  -747,   810,   860,  -747,   906,   807,   808,   861,
+     859,   862,   175,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,  -747,
+    -747,   810,  -747,   999,  1008,  -747,  1032,  1033,   382,   863,
+     864,   865,   869,  -747,  1039,  1042,  1034,   872,   906,   873,
+     874,  -747,  -747,  -747,   906,   906,  -747,  -747
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1063,128 +1070,130 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     195,     0,     0,     0,     0,     0,     0,     0,   131,     0,
-       0,     0,     0,     0,     0,     0,   195,     0,   399,     3,
-       5,    10,    12,    13,    11,     6,     7,     9,   144,   143,
-       0,     8,    14,    15,    16,    17,   397,   397,   397,   397,
-     397,     0,   395,   395,   395,   395,   395,   188,     0,     0,
-       0,     0,     0,     0,   125,   129,   126,   127,   128,   130,
-     124,   195,     0,     0,   209,   210,   208,     0,     0,   211,
-       0,   213,     0,   230,   231,   232,   234,   233,     0,   194,
-     196,     0,     0,     0,     1,   195,     2,   178,   180,   181,
-       0,   167,   149,   155,     0,     0,     0,     0,     0,     0,
-       0,   122,     0,     0,     0,     0,     0,     0,     0,     0,
-     173,     0,     0,     0,     0,     0,   123,    18,    23,    25,
-      24,    19,    20,    22,    21,    26,    27,    28,    29,   218,
-     219,   214,     0,   215,     0,   212,   251,     0,     0,     0,
-     148,   147,     4,   179,     0,   145,   146,   166,     0,     0,
-     163,     0,    30,     0,    31,   122,   400,     0,     0,   195,
-     394,   136,   138,   137,   139,     0,   189,     0,   173,   133,
-       0,   118,   393,     0,     0,   238,   240,   239,   236,   237,
-     243,   245,   244,   241,   242,   248,   250,   249,   246,   247,
-       0,     0,   221,   220,   226,   216,   217,     0,   197,   235,
-       0,     0,   334,   338,   341,   342,     0,     0,     0,     0,
-       0,     0,     0,     0,   339,   340,     0,     0,     0,     0,
-       0,     0,     0,   336,     0,   195,   169,   252,   257,   258,
-     272,   270,   273,   271,   274,   275,   267,   262,   261,   260,
-     268,   269,   259,   266,   265,   349,   351,     0,   352,   357,
-       0,   358,     0,   353,   350,   368,     0,   369,     0,   348,
-       0,     0,   165,   396,   195,     0,     0,     0,   116,     0,
-       0,   120,     0,     0,     0,   132,   172,     0,     0,   227,
-     222,     0,   152,   151,     0,   377,   376,   379,   378,   381,
-     380,   383,   382,   385,   384,   387,   386,     0,     0,   300,
-     195,     0,     0,     0,     0,   343,   344,   345,   346,     0,
-     347,     0,     0,     0,     0,     0,     0,     0,   302,   301,
-     374,   371,   365,   355,   360,   363,     0,     0,     0,     0,
-     171,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     202,     0,     0,     0,     0,     0,     0,     0,   138,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   202,     0,
+     408,     3,    18,    19,     5,    10,    12,    13,    11,     6,
+       7,     9,   151,   150,     0,     8,    14,    15,    16,    17,
+     406,   406,   406,   406,   406,     0,   404,   404,   404,   404,
+     404,   195,     0,     0,     0,     0,     0,     0,   132,   136,
+     133,   134,   135,   137,   131,   202,     0,     0,   216,   217,
+     215,     0,     0,   218,     0,   220,    33,     0,     0,   237,
+     238,   239,   241,   240,     0,   201,   203,     0,     0,     0,
+       1,   202,     2,   185,   187,   188,     0,   174,   156,   162,
+       0,     0,     0,     0,     0,     0,     0,   129,     0,     0,
+       0,     0,     0,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,   130,    20,    25,    27,    26,    21,    22,    24,
+      23,    28,    29,    30,    31,   225,   226,   221,     0,   222,
+       0,   219,     0,   202,   258,     0,     0,     0,   155,   154,
+       4,   186,     0,   152,   153,   173,     0,     0,   170,     0,
+      35,     0,    36,   129,   409,     0,     0,   202,   403,   143,
+     145,   144,   146,     0,   196,     0,   180,   140,     0,   125,
+     402,     0,     0,   245,   247,   246,   243,   244,   250,   252,
+     251,   248,   249,   255,   257,   256,   253,   254,     0,     0,
+     228,   227,   233,   223,   224,   343,   347,   350,   351,     0,
+       0,     0,     0,     0,     0,     0,     0,   348,   349,     0,
+       0,     0,     0,     0,     0,     0,   345,     0,   202,   273,
+       0,   259,   264,   265,   280,   278,   281,   279,   282,   283,
+     275,   269,   268,   267,   276,   277,   266,   274,   272,   358,
+     360,     0,   361,   366,     0,   367,     0,   362,   359,   377,
+       0,   378,     0,   357,    32,     0,   204,   242,     0,     0,
+     176,     0,     0,   172,   405,   202,     0,     0,     0,   123,
+       0,     0,   127,     0,     0,     0,   139,   179,     0,     0,
+     234,   229,     0,   386,   385,   388,   387,   390,   389,   392,
+     391,   394,   393,   396,   395,     0,     0,   309,   202,     0,
+       0,     0,     0,   352,   353,   354,   355,     0,   356,     0,
+       0,     0,     0,     0,     0,     0,   311,   310,   383,   380,
+     374,   364,   369,   372,     0,     0,    34,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   354,     0,   359,     0,   362,     0,   370,     0,
-     373,     0,   154,   156,   161,   162,     0,   150,    33,     0,
-       0,     0,     0,    36,    38,    39,   195,     0,    35,   121,
-       0,     0,   119,   140,   135,   134,     0,     0,     0,     0,
-     223,   198,     0,   295,     0,   195,     0,     0,     0,     0,
-       0,   325,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   264,   263,   195,   168,   182,   184,   193,   185,
-     253,     0,   173,   256,   318,   319,     0,     0,   195,     0,
-     299,   309,   310,   313,   314,     0,   316,   308,   311,   312,
-     304,   303,   305,   306,   307,   335,   337,   356,     0,   361,
-       0,   364,   372,   375,     0,   159,   160,   158,   164,    42,
-      45,    46,    43,    44,    47,    48,    62,    49,    51,    50,
-      65,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,     0,     0,     0,     0,     0,   113,     0,     0,   405,
-       0,    34,     0,     0,   117,     0,     0,     0,     0,   392,
-       0,   388,     0,   228,   224,     0,   296,     0,   330,     0,
-       0,   323,     0,     0,     0,     0,     0,     0,   334,     0,
-       0,   283,     0,   285,     0,   367,   366,     0,     0,     0,
-     202,   203,   204,   205,   201,   206,     0,   191,     0,   186,
-     289,   287,   290,   288,   291,   292,   293,   170,   177,   195,
-     317,     0,     0,   298,     0,     0,     0,   157,     0,     0,
-       0,     0,     0,     0,     0,     0,   109,   110,     0,   113,
-     106,    40,     0,     0,     0,    32,    37,   414,     0,   254,
-       0,   391,   390,   142,     0,   141,     0,     0,   297,   331,
-       0,   327,     0,   326,     0,     0,     0,     0,     0,     0,
-       0,     0,   193,   183,     0,     0,   190,     0,     0,   175,
-       0,     0,   332,   321,   320,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   363,
+       0,   368,     0,   371,     0,   379,     0,   382,     0,     0,
+     159,   158,     0,   178,   161,   163,   168,   169,     0,   157,
+      38,     0,     0,     0,     0,    41,    43,    44,   202,     0,
+      40,   128,     0,     0,   126,   147,   142,   141,     0,     0,
+       0,     0,   230,     0,   304,     0,   202,     0,     0,     0,
+       0,     0,   334,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   271,   270,   260,   263,   327,   328,     0,
+       0,   202,     0,   308,   318,   319,   322,   323,     0,   325,
+     317,   320,   321,   313,   312,   314,   315,   316,   344,   346,
+     365,     0,   370,     0,   373,   381,   384,   205,   202,   175,
+     189,   191,   200,   192,     0,   180,     0,   166,   167,   165,
+     171,    47,    50,    51,    48,    49,    52,    53,    67,    54,
+      56,    55,    70,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,     0,     0,     0,     0,     0,   120,     0,
+       0,   414,     0,    39,     0,     0,   124,     0,     0,     0,
+       0,   401,     0,   397,     0,   235,   231,     0,   305,     0,
+     339,     0,     0,   332,     0,     0,     0,     0,     0,     0,
+     343,     0,     0,   292,     0,   294,     0,   376,   375,   202,
+     326,     0,     0,   307,     0,     0,     0,     0,     0,     0,
+     209,   210,   211,   212,   208,   213,     0,   198,     0,   193,
+     298,   296,   299,   297,   300,   301,   302,   177,   184,   164,
+       0,     0,     0,     0,     0,     0,     0,     0,   116,   117,
+       0,   120,   113,    45,     0,     0,     0,    37,    42,   423,
+       0,   261,     0,   400,   399,   149,     0,   148,     0,     0,
+     306,   340,     0,   336,     0,   335,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   341,   330,   329,   200,
+     190,     0,     0,   197,     0,     0,   182,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   111,   108,   112,   107,
-      41,     0,   115,     0,     0,     0,     0,   389,   229,   225,
-     329,   324,   328,   315,     0,     0,     0,     0,     0,     0,
-     284,   286,   187,   199,     0,     0,   294,     0,     0,   153,
-     333,   322,    64,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     118,   115,   119,   114,    46,     0,   122,     0,     0,     0,
+       0,   398,   236,   232,   338,   333,   337,   324,     0,     0,
+       0,     0,     0,     0,   293,   295,   342,   331,   194,   206,
+       0,     0,   303,     0,     0,   160,    69,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   114,   408,     0,   406,   403,     0,
-     255,   371,     0,   281,     0,     0,     0,     0,     0,     0,
-     176,   174,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     121,   417,     0,   415,   412,     0,   262,     0,     0,   290,
+       0,     0,     0,     0,     0,     0,   183,   181,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   404,     0,     0,   412,   403,     0,
-       0,     0,     0,   200,   192,    63,    69,    70,    67,    68,
-      71,    72,    73,    66,    93,    94,    91,    92,    95,    96,
-      97,    90,    77,    78,    75,    76,    79,    80,    81,    74,
-     101,   102,    99,   100,   103,   104,   105,    98,    85,    86,
-      83,    84,    87,    88,    89,    82,   409,   411,   410,   407,
-       0,   413,     0,   282,     0,     0,     0,     0,   277,     0,
-     402,     0,     0,     0,   403,     0,   276,   278,   280,   403,
-     279
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   413,     0,     0,   421,   412,     0,     0,     0,
+       0,     0,   207,   199,    68,    79,    74,    75,    72,    73,
+      76,    77,    78,    71,   104,    99,   100,    97,    98,   101,
+     102,   103,    96,    83,    84,    81,    82,    85,    86,    87,
+      80,   108,   109,   106,   107,   110,   111,   112,   105,    91,
+      92,    89,    90,    93,    94,    95,    88,   418,   420,   419,
+     416,     0,   422,     0,     0,   291,     0,     0,     0,     0,
+       0,   285,     0,   411,     0,     0,     0,     0,   412,     0,
+       0,   284,   286,   289,   412,   412,   288,   287
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -772,  -772,  -772,   953,  -772,   956,  -772,   529,  -772,   505,
-    -772,   449,   455,  -772,  -372,   967,   968,   875,  -772,  -772,
-     970,  -772,   758,   972,   973,   -58,  1019,   -15,   843,   892,
-     -52,  -772,  -772,   583,  -772,  -772,  -772,  -772,  -772,  -772,
-    -162,  -772,  -772,  -772,  -772,   522,  -161,     8,   437,  -772,
-    -772,   903,  -772,  -772,   981,   982,   983,   984,   985,  -282,
-    -772,   722,  -170,  -190,  -772,  -414,  -413,  -412,  -410,  -408,
-    -406,   440,  -772,  -772,  -772,  -772,  -772,  -772,   745,  -772,
-    -772,   642,   484,  -220,  -772,  -772,   454,  -772,  -772,  -772,
-    -772,  -772,   699,   700,   464,  -772,  -772,  -772,  -772,   845,
-     669,   478,   -17,   371,   412,  -772,  -772,  -771,  -772,   205,
-     264,  -772
+    -747,  -747,  -747,   979,  -747,  -747,  -747,   990,  -747,   558,
+    -747,   541,  -747,   468,   482,  -747,  -385,   991,   996,   901,
+    -747,  -747,  1000,  -747,   781,  1002,  1003,   -62,  1051,   -17,
+     806,   920,   -30,  -747,  -747,   607,  -747,  -747,  -747,  -747,
+    -747,  -747,  -171,  -747,  -747,  -747,  -747,   527,  -235,    24,
+     455,  -747,  -747,   930,  -747,  -747,  1012,  1013,  1014,  1015,
+    1016,  -154,  -747,   747,  -178,  -180,  -747,  -431,  -429,  -423,
+    -422,  -421,  -418,   458,  -747,  -747,  -747,  -747,  -747,  -747,
+     772,  -747,  -747,   673,   506,  -220,  -747,  -747,   474,  -747,
+    -747,  -747,  -747,  -747,   727,   724,  -747,  -747,  -747,  -747,
+    -747,   875,   703,   496,    -8,   394,   428,  -747,  -747,  -746,
+    -747,   216,   277,  -747
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    17,    18,    19,   116,    20,   372,   373,   374,   486,
-     569,   570,   571,   375,   269,    21,    22,   159,    23,    61,
-      24,   168,   169,    25,    26,    27,    28,    29,    92,   145,
-      93,   150,   362,   363,   457,   262,   367,   148,   330,   422,
-     171,   689,   609,    90,   415,   416,   417,   418,   539,    30,
-      79,    80,   419,   536,    31,    32,    33,    34,    35,   226,
-     382,   227,   228,   229,   863,   230,   231,   232,   233,   234,
-     235,   546,   547,   236,   237,   238,   239,   240,   304,   241,
-     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
-     252,   253,   324,   325,   254,   255,   256,   257,   258,   259,
-     500,   501,   173,   103,    95,    86,   100,   797,   575,   736,
-     737,   378
+       0,    19,    20,    21,   122,    22,    23,    24,   384,   385,
+     386,   498,   581,   582,   583,   387,   280,    25,    26,   167,
+      27,    65,    28,   176,   177,    29,    30,    31,    32,    33,
+      98,   153,    99,   158,   374,   375,   469,   273,   379,   156,
+     373,   465,   179,   705,   626,    96,   459,   460,   461,   462,
+     559,    34,    85,    86,   463,   556,    35,    36,    37,    38,
+      39,   230,   394,   231,   232,   233,   887,   234,   235,   236,
+     237,   238,   239,   566,   567,   240,   241,   242,   243,   244,
+     312,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,   255,   256,   257,   332,   333,   258,   259,   260,   261,
+     262,   263,   512,   513,   181,   109,   101,    92,   106,   815,
+     587,   752,   753,   390
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1192,224 +1201,232 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     276,    83,   394,   123,   323,   492,   275,   540,   541,   542,
-      47,   543,    48,   544,    50,   545,   299,   170,   264,   369,
-      14,    77,    91,   593,   328,   320,   321,   851,   445,   518,
-     537,   318,   319,   175,   426,   176,   177,   331,   146,   303,
-     270,    47,    87,   509,    88,   429,    89,   332,   333,   101,
-     332,   333,   401,  -401,   402,   327,   403,   110,   332,   333,
-      49,   671,   180,    94,   181,   182,   185,   352,   186,   187,
-     379,   130,   353,   380,    54,    55,    56,    57,    58,    59,
-     136,   510,    60,   413,   538,    41,    14,   332,   333,   596,
-     364,   365,   201,   868,   178,   174,   430,   599,   870,   495,
-      72,   455,   456,   384,   153,   154,   155,   299,   489,   427,
-     505,   490,   162,   163,   164,    76,   573,   203,   204,   205,
-     594,   578,   199,   183,    16,   332,   333,   188,    78,   332,
-     333,   398,   399,   447,   329,   332,   333,   274,   351,   370,
-     598,   371,   332,   333,   271,   265,   552,   431,   432,   433,
-     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
-     444,  -398,   424,   425,   302,   267,   506,    81,     1,   329,
-       2,     3,     4,     5,     6,     7,     8,     9,   332,   333,
-     354,   332,   333,    84,    10,   355,    11,    12,    13,   521,
-     179,   414,   522,   540,   541,   542,   458,   543,   144,   544,
-     661,   545,   224,   322,   446,   223,   368,   602,    51,    52,
-     326,    73,    74,    75,    53,   210,   211,   212,   213,   184,
-     348,   349,   350,   189,   332,   333,   564,   202,   203,   204,
-     205,   356,   513,   514,   358,   516,   357,   550,   520,   359,
-     360,    14,   214,   215,   216,   361,     1,    85,     2,     3,
-       4,     5,     6,     7,     8,     9,    62,    63,   523,    64,
-     548,   524,    10,    91,    11,    12,    13,   611,   111,   112,
-     577,    65,    66,   380,   565,   579,   566,   567,   329,   568,
-     383,    94,   336,   108,   364,   397,   312,   102,   313,   314,
-     315,   392,    36,    37,    38,   224,   131,   132,   666,   206,
-     207,  -402,  -402,   583,    39,    40,   584,   190,   208,   109,
-     209,   191,   192,   749,   133,   134,   193,   194,   491,    14,
-     138,   218,    15,   219,   220,   595,   210,   211,   212,   213,
-    -402,  -402,   346,   347,   348,   349,   350,    87,   113,    88,
-     591,    89,   592,   332,   333,    16,   202,   203,   204,   205,
-      42,    43,    44,   214,   215,   216,   527,   511,   114,   512,
-     115,   403,    45,    46,   614,   529,  -207,   530,   531,   532,
-     533,   585,   534,   535,   584,   217,   588,   129,   677,   329,
-     507,   202,   203,   204,   205,    67,    68,   497,   498,   499,
-      69,    70,    71,   218,   613,   219,   220,   329,   389,   390,
-      15,   221,   222,   223,   662,   750,   224,   380,   225,   393,
-     525,   526,   135,   551,   104,   105,   106,   107,   206,   207,
-     320,   741,   665,    16,   672,   380,   137,   208,   846,   209,
-     847,   848,   302,   616,   617,   618,   619,   620,   139,   691,
-     621,   622,   329,   683,   684,   210,   211,   212,   213,    96,
-      97,    98,    99,   206,   207,   140,   692,   143,    14,   693,
-     623,   141,   208,   147,   209,   202,   203,   204,   205,   149,
-     151,   152,   214,   215,   216,   734,   740,   156,   380,   329,
-     210,   211,   212,   213,   624,   625,   626,   627,   628,   160,
-     743,   629,   630,   744,   217,   794,   158,   157,   795,   202,
-     203,   204,   205,   804,   161,   165,   380,   214,   215,   216,
-     860,   631,   218,   795,   219,   220,   166,   167,   751,   170,
-     221,   222,   223,   172,   195,   224,   196,   225,   197,   217,
-     260,   261,   263,   268,   610,   272,   273,   206,   207,   277,
-     278,   279,   280,   282,   283,   284,   208,   218,   209,   219,
-     220,   300,   301,   305,   306,   221,   222,   223,   307,   308,
-     224,   311,   225,   309,   210,   211,   212,   213,   316,   317,
-     336,   297,   298,   351,   366,   376,   377,   388,   803,   391,
-     208,   381,   209,   202,   203,   204,   205,  -402,  -402,   339,
-     340,   214,   215,   216,   386,  -402,    14,   404,   210,   211,
-     212,   213,   632,   633,   634,   635,   636,   387,   395,   637,
-     638,   405,   406,   217,   407,   408,   409,  -402,   344,   345,
-     346,   347,   348,   349,   350,   214,   215,   216,   410,   639,
-     411,   218,   412,   219,   220,   421,   423,   428,   448,   221,
-     222,   223,   450,   452,   224,   224,   225,   217,   453,   640,
-     641,   642,   643,   644,   454,   297,   645,   646,   487,   494,
-     488,   493,   427,   503,   208,   218,   209,   219,   220,   396,
-     496,   504,   508,   221,   222,   223,   647,   515,   224,   517,
-     225,   528,   210,   211,   212,   213,   332,     1,   549,     2,
-       3,     4,     5,     6,     7,   553,     9,   555,   556,   558,
-     574,   559,   581,    10,   560,    11,    12,    13,   561,   214,
-     215,   216,   562,   334,   582,   335,   563,   572,   587,   580,
-     586,   336,   600,   601,   396,   589,   648,   649,   650,   651,
-     652,   217,   597,   653,   654,   604,   605,   606,   337,   338,
-     339,   340,   608,   526,   607,   612,   342,   525,   656,   218,
-     615,   219,   220,   655,   657,   663,   668,   221,   222,   223,
-      14,   664,   224,   669,   225,   336,   670,   674,   343,   344,
-     345,   346,   347,   348,   349,   350,   336,   676,   678,   673,
-     396,   685,   337,   338,   339,   340,   341,   680,   681,   694,
-     342,   687,   690,   337,   338,   339,   340,   688,   554,   695,
-     746,   342,   696,   697,   698,   699,   700,   701,   702,   703,
-     735,   704,   343,   344,   345,   346,   347,   348,   349,   350,
-     738,   739,   705,   343,   344,   345,   346,   347,   348,   349,
-     350,   748,   336,   706,   707,   708,   709,   752,   710,   711,
-     712,    15,   713,   714,   753,   754,   715,   716,   717,   337,
-     338,   339,   340,   755,   718,   756,   757,   342,   719,   720,
-     758,   721,   722,   759,    16,   285,   286,   287,   288,   289,
-     290,   291,   292,   293,   294,   295,   296,   723,   724,   343,
-     344,   345,   346,   347,   348,   349,   350,   459,   460,   461,
-     462,   463,   464,   465,   466,   467,   468,   469,   470,   471,
-     472,   473,   474,   475,   476,   477,   478,   479,   725,   726,
-     480,   727,   728,   481,   482,   729,   730,   483,   484,   485,
-     731,   760,   761,   732,   762,   763,   733,   742,   745,   764,
-     765,   747,   766,   767,   768,   769,   770,   771,   772,   773,
-     774,   775,   776,   777,   778,   779,   780,   781,   782,   783,
-     784,   785,   786,   787,   788,   789,   790,   791,   792,   793,
-     796,   798,   329,   799,   800,   801,   802,   805,   806,   807,
-     857,   808,   809,   810,   811,   812,   813,   814,   815,   858,
-     816,   817,   859,   818,   819,   820,   821,   822,   823,   824,
-     825,   826,   865,   827,   828,   829,   830,   831,   832,   833,
-     834,   835,   866,   836,   837,   838,   839,   840,   841,   842,
-     843,   844,   845,   850,   590,   853,   852,   117,   659,   576,
-     854,   855,   861,   862,   660,   864,   867,   869,   118,   119,
-     266,   120,   385,   121,   122,    82,   200,   557,   142,   682,
-     281,   198,   124,   125,   126,   127,   128,   686,   400,   519,
-     603,   420,   658,   679,   449,   856,   502,   451,     0,   849,
-     675,   310,   667
+     287,    89,   270,   129,   504,   286,    97,   331,   338,    51,
+     275,   372,    45,   178,   328,   329,   521,   522,   206,   207,
+     208,   448,   530,    93,   429,    94,    16,    95,    52,   307,
+      54,   381,   557,   560,   311,   561,   467,   468,   281,    83,
+      51,   562,   563,   564,   326,   327,   565,   432,   227,  -407,
+     335,   183,   359,   184,   185,   688,     1,   360,     2,     3,
+       4,     5,     6,     7,     8,     9,   154,    10,    11,   107,
+     872,   358,    12,   610,    13,    14,    15,   116,   339,   340,
+     188,   264,   189,   190,    16,   193,   558,   194,   195,    66,
+      67,   136,    68,   376,   377,   605,   606,  -410,   433,   430,
+     339,   340,   144,    53,    69,    70,   396,   100,   339,   340,
+     182,    76,   186,   339,   340,   585,   213,   214,   215,   216,
+     590,   337,   269,   117,   118,   307,   161,   162,   163,    16,
+      18,   409,   410,   285,   170,   171,   172,   276,   405,   267,
+     450,   191,   893,   217,   218,   219,   196,    77,   896,   897,
+     282,   382,   685,   383,   310,   137,   138,   339,   340,   339,
+     340,   427,   428,   628,   434,   435,   436,   437,   438,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   576,    93,
+     637,    94,   152,    95,   205,   206,   207,   208,   619,   278,
+     458,   227,   330,   560,    78,   561,   227,   449,   226,   675,
+     470,   562,   563,   564,   339,   340,   565,    82,   187,    84,
+      17,   334,    87,   380,   339,   340,   339,   340,    71,    72,
+      90,   339,   340,    73,    74,    75,   577,   361,   578,   579,
+      91,   580,   362,    18,    97,   525,   526,   192,   528,   507,
+     100,   532,   197,   608,   339,   340,   139,   140,   403,   517,
+     540,   629,   630,   631,   632,   633,   209,   210,   634,   635,
+     611,    40,    41,    42,   108,   211,   115,   212,   638,   639,
+     640,   641,   642,    43,    44,   643,   644,   542,   636,   114,
+     424,    55,    56,   213,   214,   215,   216,    57,   376,   343,
+     221,   408,   222,   223,   568,   645,   646,   647,   648,   649,
+     650,   363,   336,   651,   652,   337,   364,   395,  -411,  -411,
+     217,   218,   219,   365,   391,   119,   765,   392,   366,   205,
+     206,   207,   208,   653,   339,   340,   503,   654,   655,   656,
+     657,   658,   220,   501,   659,   660,   502,  -411,  -411,   353,
+     354,   355,   356,   357,   603,   142,   604,   607,   518,   120,
+     221,   337,   222,   223,   661,    46,    47,    48,   224,   225,
+     226,   401,   402,   227,   618,   228,   404,    49,    50,   367,
+     229,   412,   121,   413,   368,   414,   205,   206,   207,   208,
+     320,   135,   321,   322,   323,   615,   699,   700,   689,   519,
+     691,   209,   210,   523,   198,   524,   547,   414,   199,   200,
+     211,   141,   212,   201,   202,   310,   537,   538,   205,   206,
+     207,   208,   146,   867,   541,   868,   869,   143,   213,   214,
+     215,   216,   145,   662,   663,   664,   665,   666,   686,   147,
+     667,   668,   549,  -214,   550,   551,   552,   553,   680,   554,
+     555,   110,   111,   112,   113,   217,   218,   219,   209,   210,
+     669,   533,   535,    16,   534,   536,   148,   211,   149,   212,
+      58,    59,    60,    61,    62,    63,   151,   220,    64,   102,
+     103,   104,   105,   155,   159,   213,   214,   215,   216,   589,
+     209,   210,   392,   591,   157,   221,   337,   222,   223,   211,
+     160,   212,   164,   224,   225,   226,   595,   165,   227,   596,
+     228,   166,   217,   218,   219,   229,   168,   213,   214,   215,
+     216,   169,   597,   600,   617,   596,   337,   337,   205,   206,
+     207,   208,   614,   173,   220,   676,   767,   679,   392,   697,
+     392,   174,   337,   175,   217,   218,   219,   178,   706,   180,
+     750,   707,   221,   392,   222,   223,    79,    80,    81,   766,
+     224,   225,   226,   203,   204,   227,   220,   228,   271,   274,
+     756,   759,   229,   337,   760,   812,   823,   883,   813,   392,
+     813,   355,   356,   357,   221,   265,   222,   223,   509,   510,
+     511,   272,   224,   225,   226,   279,   822,   227,   283,   228,
+     305,   306,   284,   288,   229,   290,   289,   291,   292,   211,
+     308,   212,   313,   309,   314,   315,   316,   205,   206,   207,
+     208,   317,   358,   319,   378,   324,   325,   213,   214,   215,
+     216,   370,   371,     1,   388,     2,     3,     4,     5,     6,
+       7,     8,     9,   389,    10,    11,   393,   398,   399,    12,
+     400,    13,    14,    15,   217,   218,   219,   406,   407,     1,
+      16,     2,     3,     4,     5,     6,     7,   415,     9,   416,
+     417,   418,   419,   420,   421,    12,   220,    13,    14,    15,
+     422,   423,   426,   227,   431,   464,   451,   457,   453,   305,
+     455,   456,   466,   499,   221,   500,   222,   223,   211,   505,
+     212,   506,   224,   225,   226,   515,    16,   227,   508,   228,
+     343,   516,   520,   527,   229,   430,   213,   214,   215,   216,
+     529,   339,   543,   539,   586,   545,   546,   344,   345,   346,
+     347,   548,    16,   570,   571,   349,   572,   593,   573,   574,
+     575,   584,   592,   217,   218,   219,   594,   341,   598,   342,
+     599,   601,   609,   612,   613,   616,   407,   350,   351,   352,
+     353,   354,   355,   356,   357,   220,   538,   537,   687,   293,
+     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
+     304,   621,   622,   221,   623,   222,   223,    17,   624,   625,
+     627,   224,   225,   226,   670,   671,   227,   677,   228,   343,
+     678,   682,   407,   229,   683,   684,   690,   692,   343,   694,
+      18,   703,   695,    17,   696,   701,   344,   345,   346,   347,
+     348,   704,   708,   751,   349,   344,   345,   346,   347,   709,
+     544,   755,   710,   349,   711,   712,    18,   713,   714,   715,
+     754,   716,   717,   718,   719,   720,   350,   351,   352,   353,
+     354,   355,   356,   357,   343,   350,   351,   352,   353,   354,
+     355,   356,   357,   343,   721,   722,   723,   762,   764,   768,
+     769,   344,   345,   346,   347,   724,   725,   726,   727,   349,
+    -411,  -411,   346,   347,   770,   728,   771,   772,  -411,   729,
+     730,   731,   732,   773,   733,   734,   735,   736,   737,   738,
+     739,   350,   351,   352,   353,   354,   355,   356,   357,   740,
+    -411,   351,   352,   353,   354,   355,   356,   357,   471,   472,
+     473,   474,   475,   476,   477,   478,   479,   480,   481,   482,
+     483,   484,   485,   486,   487,   488,   489,   490,   491,   741,
+     742,   492,   743,   744,   493,   494,   745,   746,   495,   496,
+     497,   747,   748,   774,   749,   757,   758,   761,   763,   775,
+     776,   777,   778,   779,   780,   781,   782,   783,   784,   785,
+     786,   787,   788,   789,   790,   791,   792,   793,   794,   795,
+     796,   797,   798,   799,   800,   801,   802,   803,   804,   805,
+     806,   807,   808,   809,   810,   811,   814,   816,   337,   817,
+     818,   819,   820,   821,   824,   873,   874,   825,   826,   827,
+     828,   829,   830,   879,   831,   832,   833,   834,   835,   836,
+     837,   838,   880,   839,   840,   841,   842,   843,   844,   845,
+     846,   847,   848,   849,   850,   851,   852,   853,   854,   855,
+     856,   857,   858,   859,   860,   861,   881,   862,   891,   882,
+     863,   864,   865,   866,   871,   889,   875,   876,   890,   673,
+     877,   884,   885,   886,   888,   123,   124,   892,   894,   895,
+     588,   125,   602,   674,   277,   126,   397,   127,   128,    88,
+     150,   369,   268,   569,   698,   620,   266,   130,   131,   132,
+     133,   134,   702,   411,   425,   693,   672,   878,   454,   452,
+     870,   531,   681,     0,   318,     0,     0,     0,     0,     0,
+       0,     0,   514
 };
 
 static const yytype_int16 yycheck[] =
 {
-     170,    16,   284,    61,   224,   377,   168,   421,   421,   421,
-       3,   421,     4,   421,     6,   421,   206,    68,    57,     3,
-      80,    13,     8,    85,    78,     5,     6,   798,     3,     3,
-       3,   221,   222,     3,    77,     5,     6,    57,    90,   209,
-      34,     3,    20,    57,    22,    75,    24,   149,   150,    41,
-     149,   150,    85,    64,    87,   225,    89,    49,   149,   150,
-      78,    85,     3,    74,     5,     6,     3,   183,     5,     6,
-     185,    63,   188,   188,    35,    36,    37,    38,    39,    40,
-      72,    88,    43,   185,    57,    33,    80,   149,   150,   188,
-     260,   261,   144,   864,    64,   112,   126,   188,   869,   381,
-      30,    72,    73,   273,    96,    97,    98,   297,   185,   152,
-     392,   188,   104,   105,   106,     3,   488,     4,     5,     6,
-      88,   493,   139,    64,   184,   149,   150,    64,     3,   149,
-     150,   301,   302,   353,   188,   149,   150,   188,   186,   123,
-     188,   125,   149,   150,   159,   184,   428,   337,   338,   339,
-     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-     350,     0,   332,   333,    89,   157,   185,   162,     7,   188,
-       9,    10,    11,    12,    13,    14,    15,    16,   149,   150,
-     183,   149,   150,     0,    23,   188,    25,    26,    27,   185,
-     160,   184,   188,   607,   607,   607,   366,   607,   184,   607,
-     572,   607,   182,   183,   179,   179,   264,   185,   158,   159,
-     225,   153,   154,   155,   164,   102,   103,   104,   105,   160,
-     179,   180,   181,   160,   149,   150,    75,     3,     4,     5,
-       6,   183,   402,   403,   183,   405,   188,   427,   408,   188,
-     183,    80,   129,   130,   131,   188,     7,   187,     9,    10,
-      11,    12,    13,    14,    15,    16,    29,    30,   185,    32,
-     422,   188,    23,     8,    25,    26,    27,   549,    78,    79,
-     185,    44,    45,   188,   123,   185,   125,   126,   188,   128,
-     272,    74,   127,   186,   454,   300,   117,    74,   119,   120,
-     121,    67,    29,    30,    31,   182,   166,   167,   580,    75,
-      76,   146,   147,   185,    41,    42,   188,    42,    84,    14,
-      86,    46,    47,   685,   166,   167,    51,    52,   376,    80,
-     188,   169,   161,   171,   172,   515,   102,   103,   104,   105,
-     175,   176,   177,   178,   179,   180,   181,    20,     3,    22,
-     510,    24,   512,   149,   150,   184,     3,     4,     5,     6,
-      29,    30,    31,   129,   130,   131,   414,    85,     3,    87,
-       3,    89,    41,    42,   554,    58,    59,    60,    61,    62,
-      63,   185,    65,    66,   188,   151,   185,     3,   598,   188,
-     395,     3,     4,     5,     6,   158,   159,    81,    82,    83,
-     163,   164,   165,   169,   185,   171,   172,   188,    48,    49,
-     161,   177,   178,   179,   185,   687,   182,   188,   184,   185,
-       5,     6,     3,   428,    43,    44,    45,    46,    75,    76,
-       5,     6,   185,   184,   594,   188,    57,    84,     3,    86,
-       5,     6,    89,    91,    92,    93,    94,    95,     6,   185,
-      98,    99,   188,   604,   605,   102,   103,   104,   105,    37,
-      38,    39,    40,    75,    76,   185,   185,    21,    80,   188,
-     118,   185,    84,    67,    86,     3,     4,     5,     6,    69,
-      75,     3,   129,   130,   131,   185,   185,     3,   188,   188,
-     102,   103,   104,   105,    91,    92,    93,    94,    95,    76,
-     185,    98,    99,   188,   151,   185,   184,    64,   188,     3,
-       4,     5,     6,   185,     3,     3,   188,   129,   130,   131,
-     185,   118,   169,   188,   171,   172,     3,     3,   688,    68,
-     177,   178,   179,     4,     3,   182,     3,   184,   184,   151,
-      55,    70,    76,     3,   549,    64,   174,    75,    76,    80,
-      80,     3,     6,   185,   185,   184,    84,   169,    86,   171,
-     172,   184,   184,     4,     4,   177,   178,   179,     4,     4,
-     182,   184,   184,     6,   102,   103,   104,   105,   184,   184,
-     127,    75,    76,   186,    71,    57,   184,    46,   748,   185,
-      84,   184,    86,     3,     4,     5,     6,   144,   145,   146,
-     147,   129,   130,   131,   184,   152,    80,     4,   102,   103,
-     104,   105,    91,    92,    93,    94,    95,   184,   184,    98,
-      99,   184,   184,   151,   184,   184,     4,   174,   175,   176,
-     177,   178,   179,   180,   181,   129,   130,   131,     4,   118,
-     189,   169,   185,   171,   172,   168,     3,   184,     6,   177,
-     178,   179,     6,     6,   182,   182,   184,   151,     5,    91,
-      92,    93,    94,    95,   188,    75,    98,    99,   124,     3,
-     184,   184,   152,     6,    84,   169,    86,   171,   172,    75,
-     188,     6,   185,   177,   178,   179,   118,    78,   182,     4,
-     184,   188,   102,   103,   104,   105,   149,     7,   184,     9,
-      10,    11,    12,    13,    14,   126,    16,   189,   189,   184,
-      28,   184,     4,    23,   184,    25,    26,    27,   184,   129,
-     130,   131,   184,    75,     3,    77,   184,   184,    50,   184,
-      53,   127,     4,     4,    75,   185,    91,    92,    93,    94,
-      95,   151,   188,    98,    99,    59,    59,     3,   144,   145,
-     146,   147,    54,     6,   188,   185,   152,     5,   126,   169,
-       6,   171,   172,   118,   124,   184,     6,   177,   178,   179,
-      80,   157,   182,     6,   184,   127,   185,   182,   174,   175,
-     176,   177,   178,   179,   180,   181,   127,     4,   182,   185,
-      75,   184,   144,   145,   146,   147,   148,   185,   185,   188,
-     152,    55,   185,   144,   145,   146,   147,    56,   149,   188,
-       6,   152,   188,   188,   188,   188,   188,   188,   188,   188,
-       3,   188,   174,   175,   176,   177,   178,   179,   180,   181,
-       3,   157,   188,   174,   175,   176,   177,   178,   179,   180,
-     181,    64,   127,   188,   188,   188,   188,     6,   188,   188,
-     188,   161,   188,   188,     6,     6,   188,   188,   188,   144,
-     145,   146,   147,     6,   188,     6,     6,   152,   188,   188,
-       6,   188,   188,     6,   184,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   188,   188,   174,
-     175,   176,   177,   178,   179,   180,   181,    90,    91,    92,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   188,   188,
-     113,   188,   188,   116,   117,   188,   188,   120,   121,   122,
-     188,     6,     6,   188,     6,     6,   188,   188,   188,     6,
-       6,   188,     6,     6,     6,     6,     6,     6,     6,     6,
+     178,    18,   156,    65,   389,   176,     8,   227,    57,     3,
+      57,    78,    33,    68,     5,     6,    57,    88,     4,     5,
+       6,     3,     3,    20,    77,    22,    80,    24,     4,   209,
+       6,     3,     3,   464,   212,   464,    72,    73,    34,    15,
+       3,   464,   464,   464,   224,   225,   464,    75,   182,     0,
+     228,     3,   183,     5,     6,   189,     7,   188,     9,    10,
+      11,    12,    13,    14,    15,    16,    96,    18,    19,    45,
+     816,   186,    23,   188,    25,    26,    27,    53,   149,   150,
+       3,   143,     5,     6,    80,     3,    57,     5,     6,    29,
+      30,    67,    32,   271,   272,    85,    88,    64,   126,   152,
+     149,   150,    78,    78,    44,    45,   284,    74,   149,   150,
+     118,     3,    64,   149,   150,   500,   102,   103,   104,   105,
+     505,   188,   152,    78,    79,   305,   102,   103,   104,    80,
+     184,   309,   310,   188,   110,   111,   112,   184,   292,   147,
+     360,    64,   888,   129,   130,   131,    64,     3,   894,   895,
+     167,   123,    85,   125,    89,   166,   167,   149,   150,   149,
+     150,   339,   340,     3,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,    75,    20,
+       3,    22,   184,    24,     3,     4,     5,     6,   185,   165,
+     184,   182,   183,   624,    30,   624,   182,   179,   179,   584,
+     378,   624,   624,   624,   149,   150,   624,     3,   160,     3,
+     161,   228,   162,   275,   149,   150,   149,   150,   158,   159,
+       0,   149,   150,   163,   164,   165,   123,   183,   125,   126,
+     187,   128,   188,   184,     8,   413,   414,   160,   416,   393,
+      74,   419,   160,   188,   149,   150,   166,   167,    67,   403,
+     430,    91,    92,    93,    94,    95,    75,    76,    98,    99,
+     188,    29,    30,    31,    74,    84,    14,    86,    91,    92,
+      93,    94,    95,    41,    42,    98,    99,   431,   118,   186,
+     185,   158,   159,   102,   103,   104,   105,   164,   466,   127,
+     169,   308,   171,   172,   465,   118,    91,    92,    93,    94,
+      95,   183,   185,    98,    99,   188,   188,   283,   146,   147,
+     129,   130,   131,   183,   185,     3,   701,   188,   188,     3,
+       4,     5,     6,   118,   149,   150,   388,    91,    92,    93,
+      94,    95,   151,   185,    98,    99,   188,   175,   176,   177,
+     178,   179,   180,   181,   522,   184,   524,   527,   185,     3,
+     169,   188,   171,   172,   118,    29,    30,    31,   177,   178,
+     179,    48,    49,   182,   544,   184,   185,    41,    42,   183,
+     189,    85,     3,    87,   188,    89,     3,     4,     5,     6,
+     117,     3,   119,   120,   121,   539,   621,   622,   608,   406,
+     610,    75,    76,    85,    42,    87,   458,    89,    46,    47,
+      84,     3,    86,    51,    52,    89,     5,     6,     3,     4,
+       5,     6,   188,     3,   431,     5,     6,    57,   102,   103,
+     104,   105,    57,    91,    92,    93,    94,    95,   606,     6,
+      98,    99,    58,    59,    60,    61,    62,    63,   592,    65,
+      66,    47,    48,    49,    50,   129,   130,   131,    75,    76,
+     118,   185,   185,    80,   188,   188,   185,    84,   185,    86,
+      35,    36,    37,    38,    39,    40,    21,   151,    43,    41,
+      42,    43,    44,    67,    75,   102,   103,   104,   105,   185,
+      75,    76,   188,   185,    69,   169,   188,   171,   172,    84,
+       3,    86,     3,   177,   178,   179,   185,    64,   182,   188,
+     184,   184,   129,   130,   131,   189,    76,   102,   103,   104,
+     105,     3,   185,   185,   185,   188,   188,   188,     3,     4,
+       5,     6,   539,     3,   151,   185,   704,   185,   188,   185,
+     188,     3,   188,     3,   129,   130,   131,    68,   185,     4,
+     185,   188,   169,   188,   171,   172,   153,   154,   155,   703,
+     177,   178,   179,     3,     3,   182,   151,   184,    55,    76,
+     185,   185,   189,   188,   188,   185,   185,   185,   188,   188,
+     188,   179,   180,   181,   169,   184,   171,   172,    81,    82,
+      83,    70,   177,   178,   179,     3,   764,   182,    64,   184,
+      75,    76,   174,    80,   189,     3,    80,     6,   184,    84,
+     184,    86,     4,   184,     4,     4,     4,     3,     4,     5,
+       6,     6,   186,   184,    71,   184,   184,   102,   103,   104,
+     105,   185,   185,     7,    57,     9,    10,    11,    12,    13,
+      14,    15,    16,   184,    18,    19,   184,   184,   184,    23,
+      46,    25,    26,    27,   129,   130,   131,   184,    75,     7,
+      80,     9,    10,    11,    12,    13,    14,     4,    16,   184,
+     184,   184,   184,     4,     4,    23,   151,    25,    26,    27,
+     190,   185,     3,   182,   184,   168,     6,   185,     6,    75,
+       6,     5,   188,   124,   169,   184,   171,   172,    84,   184,
+      86,     3,   177,   178,   179,     6,    80,   182,   188,   184,
+     127,     6,   185,    78,   189,   152,   102,   103,   104,   105,
+       4,   149,   126,   184,    28,   190,   190,   144,   145,   146,
+     147,   188,    80,   184,   184,   152,   184,     4,   184,   184,
+     184,   184,   184,   129,   130,   131,     3,    75,    53,    77,
+      50,   185,   188,     4,     4,   185,    75,   174,   175,   176,
+     177,   178,   179,   180,   181,   151,     6,     5,   185,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,    59,    59,   169,     3,   171,   172,   161,   188,    54,
+       6,   177,   178,   179,   126,   124,   182,   184,   184,   127,
+     157,     6,    75,   189,     6,   185,     4,   182,   127,   185,
+     184,    55,   185,   161,   185,   184,   144,   145,   146,   147,
+     148,    56,   188,     3,   152,   144,   145,   146,   147,   188,
+     149,   157,   188,   152,   188,   188,   184,   188,   188,   188,
+       3,   188,   188,   188,   188,   188,   174,   175,   176,   177,
+     178,   179,   180,   181,   127,   174,   175,   176,   177,   178,
+     179,   180,   181,   127,   188,   188,   188,     6,    64,     6,
+       6,   144,   145,   146,   147,   188,   188,   188,   188,   152,
+     144,   145,   146,   147,     6,   188,     6,     6,   152,   188,
+     188,   188,   188,     6,   188,   188,   188,   188,   188,   188,
+     188,   174,   175,   176,   177,   178,   179,   180,   181,   188,
+     174,   175,   176,   177,   178,   179,   180,   181,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   188,
+     188,   113,   188,   188,   116,   117,   188,   188,   120,   121,
+     122,   188,   188,     6,   188,   188,   188,   188,   188,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,   174,
-      80,     3,   188,     4,     4,     4,     4,   185,   185,   185,
-       4,   185,   185,   185,   185,   185,   185,   185,   185,     4,
-     185,   185,     6,   185,   185,   185,   185,   185,   185,   185,
-     185,   185,     6,   185,   185,   185,   185,   185,   185,   185,
+       6,     6,     6,     6,     6,   174,    80,     3,   188,     4,
+       4,     4,     4,     4,   185,   188,   188,   185,   185,   185,
+     185,   185,   185,     4,   185,   185,   185,   185,   185,   185,
      185,   185,     4,   185,   185,   185,   185,   185,   185,   185,
-     185,   185,   185,   184,   509,   185,   188,    61,   569,   490,
-     188,   188,   188,   188,   569,   185,   185,   185,    61,    61,
-     155,    61,   274,    61,    61,    16,   144,   454,    85,   602,
-     197,   138,    61,    61,    61,    61,    61,   607,   303,   407,
-     528,   329,   568,   599,   355,   850,   387,   357,    -1,   795,
-     596,   216,   584
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,     4,   185,     4,     6,
+     185,   185,   185,   185,   184,     6,   185,   188,     6,   581,
+     188,   188,   188,   188,   185,    65,    65,   185,   185,   185,
+     502,    65,   521,   581,   163,    65,   285,    65,    65,    18,
+      91,   265,   152,   466,   619,   548,   146,    65,    65,    65,
+      65,    65,   624,   311,   337,   611,   580,   871,   364,   362,
+     813,   418,   596,    -1,   219,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   399
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1417,140 +1434,143 @@ static const yytype_int16 yycheck[] =
 static const yytype_int16 yystos[] =
 {
        0,     7,     9,    10,    11,    12,    13,    14,    15,    16,
-      23,    25,    26,    27,    80,   161,   184,   191,   192,   193,
-     195,   205,   206,   208,   210,   213,   214,   215,   216,   217,
-     239,   244,   245,   246,   247,   248,    29,    30,    31,    41,
-      42,    33,    29,    30,    31,    41,    42,     3,   237,    78,
-     237,   158,   159,   164,    35,    36,    37,    38,    39,    40,
-      43,   209,    29,    30,    32,    44,    45,   158,   159,   163,
-     164,   165,    30,   153,   154,   155,     3,   237,     3,   240,
-     241,   162,   216,   217,     0,   187,   295,    20,    22,    24,
-     233,     8,   218,   220,    74,   294,   294,   294,   294,   294,
-     296,   237,    74,   293,   293,   293,   293,   293,   186,    14,
-     237,    78,    79,     3,     3,     3,   194,   195,   205,   206,
-     210,   213,   214,   215,   244,   245,   246,   247,   248,     3,
-     237,   166,   167,   166,   167,     3,   237,    57,   188,     6,
-     185,   185,   193,    21,   184,   219,   220,    67,   227,    69,
-     221,    75,     3,   237,   237,   237,     3,    64,   184,   207,
-      76,     3,   237,   237,   237,     3,     3,     3,   211,   212,
-      68,   230,     4,   292,   292,     3,     5,     6,    64,   160,
-       3,     5,     6,    64,   160,     3,     5,     6,    64,   160,
-      42,    46,    47,    51,    52,     3,     3,   184,   241,   292,
-     219,   220,     3,     4,     5,     6,    75,    76,    84,    86,
-     102,   103,   104,   105,   129,   130,   131,   151,   169,   171,
-     172,   177,   178,   179,   182,   184,   249,   251,   252,   253,
-     255,   256,   257,   258,   259,   260,   263,   264,   265,   266,
-     267,   269,   270,   271,   272,   273,   274,   275,   276,   277,
-     278,   279,   280,   281,   284,   285,   286,   287,   288,   289,
-      55,    70,   225,    76,    57,   184,   207,   237,     3,   204,
-      34,   217,    64,   174,   188,   230,   252,    80,    80,     3,
-       6,   218,   185,   185,   184,   132,   133,   134,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,    75,    76,   253,
-     184,   184,    89,   252,   268,     4,     4,     4,     4,     6,
-     289,   184,   117,   119,   120,   121,   184,   184,   253,   253,
-       5,     6,   183,   273,   282,   283,   217,   252,    78,   188,
-     228,    57,   149,   150,    75,    77,   127,   144,   145,   146,
-     147,   148,   152,   174,   175,   176,   177,   178,   179,   180,
-     181,   186,   183,   188,   183,   188,   183,   188,   183,   188,
-     183,   188,   222,   223,   252,   252,    71,   226,   215,     3,
-     123,   125,   196,   197,   198,   203,    57,   184,   301,   185,
-     188,   184,   250,   237,   252,   212,   184,   184,    46,    48,
-      49,   185,    67,   185,   249,   184,    75,   217,   252,   252,
-     268,    85,    87,    89,     4,   184,   184,   184,   184,     4,
-       4,   189,   185,   185,   184,   234,   235,   236,   237,   242,
-     251,   168,   229,     3,   252,   252,    77,   152,   184,    75,
-     126,   253,   253,   253,   253,   253,   253,   253,   253,   253,
-     253,   253,   253,   253,   253,     3,   179,   273,     6,   282,
-       6,   283,     6,     5,   188,    72,    73,   224,   252,    90,
-      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     113,   116,   117,   120,   121,   122,   199,   124,   184,   185,
-     188,   215,   204,   184,     3,   249,   188,    81,    82,    83,
-     290,   291,   290,     6,     6,   249,   185,   217,   185,    57,
-      88,    85,    87,   252,   252,    78,   252,     4,     3,   271,
-     252,   185,   188,   185,   188,     5,     6,   215,   188,    58,
-      60,    61,    62,    63,    65,    66,   243,     3,    57,   238,
-     255,   256,   257,   258,   259,   260,   261,   262,   230,   184,
-     253,   217,   249,   126,   149,   189,   189,   223,   184,   184,
-     184,   184,   184,   184,    75,   123,   125,   126,   128,   200,
-     201,   202,   184,   204,    28,   298,   197,   185,   204,   185,
-     184,     4,     3,   185,   188,   185,    53,    50,   185,   185,
-     199,   252,   252,    85,    88,   253,   188,   188,   188,   188,
-       4,     4,   185,   235,    59,    59,     3,   188,    54,   232,
-     217,   249,   185,   185,   253,     6,    91,    92,    93,    94,
+      18,    19,    23,    25,    26,    27,    80,   161,   184,   192,
+     193,   194,   196,   197,   198,   208,   209,   211,   213,   216,
+     217,   218,   219,   220,   242,   247,   248,   249,   250,   251,
+      29,    30,    31,    41,    42,    33,    29,    30,    31,    41,
+      42,     3,   240,    78,   240,   158,   159,   164,    35,    36,
+      37,    38,    39,    40,    43,   212,    29,    30,    32,    44,
+      45,   158,   159,   163,   164,   165,     3,     3,    30,   153,
+     154,   155,     3,   240,     3,   243,   244,   162,   219,   220,
+       0,   187,   298,    20,    22,    24,   236,     8,   221,   223,
+      74,   297,   297,   297,   297,   297,   299,   240,    74,   296,
+     296,   296,   296,   296,   186,    14,   240,    78,    79,     3,
+       3,     3,   195,   198,   208,   209,   213,   216,   217,   218,
+     247,   248,   249,   250,   251,     3,   240,   166,   167,   166,
+     167,     3,   184,    57,   240,    57,   188,     6,   185,   185,
+     194,    21,   184,   222,   223,    67,   230,    69,   224,    75,
+       3,   240,   240,   240,     3,    64,   184,   210,    76,     3,
+     240,   240,   240,     3,     3,     3,   214,   215,    68,   233,
+       4,   295,   295,     3,     5,     6,    64,   160,     3,     5,
+       6,    64,   160,     3,     5,     6,    64,   160,    42,    46,
+      47,    51,    52,     3,     3,     3,     4,     5,     6,    75,
+      76,    84,    86,   102,   103,   104,   105,   129,   130,   131,
+     151,   169,   171,   172,   177,   178,   179,   182,   184,   189,
+     252,   254,   255,   256,   258,   259,   260,   261,   262,   263,
+     266,   267,   268,   269,   270,   272,   273,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,   283,   284,   287,   288,
+     289,   290,   291,   292,   218,   184,   244,   295,   222,   223,
+     252,    55,    70,   228,    76,    57,   184,   210,   240,     3,
+     207,    34,   220,    64,   174,   188,   233,   255,    80,    80,
+       3,     6,   184,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,    75,    76,   256,   184,   184,
+      89,   255,   271,     4,     4,     4,     4,     6,   292,   184,
+     117,   119,   120,   121,   184,   184,   256,   256,     5,     6,
+     183,   276,   285,   286,   220,   255,   185,   188,    57,   149,
+     150,    75,    77,   127,   144,   145,   146,   147,   148,   152,
+     174,   175,   176,   177,   178,   179,   180,   181,   186,   183,
+     188,   183,   188,   183,   188,   183,   188,   183,   188,   221,
+     185,   185,    78,   231,   225,   226,   255,   255,    71,   229,
+     218,     3,   123,   125,   199,   200,   201,   206,    57,   184,
+     304,   185,   188,   184,   253,   240,   255,   215,   184,   184,
+      46,    48,    49,    67,   185,   252,   184,    75,   220,   255,
+     255,   271,    85,    87,    89,     4,   184,   184,   184,   184,
+       4,     4,   190,   185,   185,   254,     3,   255,   255,    77,
+     152,   184,    75,   126,   256,   256,   256,   256,   256,   256,
+     256,   256,   256,   256,   256,   256,   256,   256,     3,   179,
+     276,     6,   285,     6,   286,     6,     5,   185,   184,   237,
+     238,   239,   240,   245,   168,   232,   188,    72,    73,   227,
+     255,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   113,   116,   117,   120,   121,   122,   202,   124,
+     184,   185,   188,   218,   207,   184,     3,   252,   188,    81,
+      82,    83,   293,   294,   293,     6,     6,   252,   185,   220,
+     185,    57,    88,    85,    87,   255,   255,    78,   255,     4,
+       3,   274,   255,   185,   188,   185,   188,     5,     6,   184,
+     256,   220,   252,   126,   149,   190,   190,   218,   188,    58,
+      60,    61,    62,    63,    65,    66,   246,     3,    57,   241,
+     258,   259,   260,   261,   262,   263,   264,   265,   233,   226,
+     184,   184,   184,   184,   184,   184,    75,   123,   125,   126,
+     128,   203,   204,   205,   184,   207,    28,   301,   200,   185,
+     207,   185,   184,     4,     3,   185,   188,   185,    53,    50,
+     185,   185,   202,   255,   255,    85,    88,   256,   188,   188,
+     188,   188,     4,     4,   220,   252,   185,   185,   256,   185,
+     238,    59,    59,     3,   188,    54,   235,     6,     3,    91,
+      92,    93,    94,    95,    98,    99,   118,     3,    91,    92,
+      93,    94,    95,    98,    99,   118,    91,    92,    93,    94,
       95,    98,    99,   118,    91,    92,    93,    94,    95,    98,
       99,   118,    91,    92,    93,    94,    95,    98,    99,   118,
-      91,    92,    93,    94,    95,    98,    99,   118,    91,    92,
-      93,    94,    95,    98,    99,   118,   126,   124,   272,   201,
-     202,   204,   185,   184,   157,   185,   249,   291,     6,     6,
-     185,    85,   252,   185,   182,   284,     4,   273,   182,   276,
-     185,   185,   238,   236,   236,   184,   261,    55,    56,   231,
-     185,   185,   185,   188,   188,   188,   188,   188,   188,   188,
+     126,   124,   275,   204,   205,   207,   185,   184,   157,   185,
+     252,   294,     6,     6,   185,    85,   255,   185,   189,   276,
+       4,   276,   182,   279,   185,   185,   185,   185,   241,   239,
+     239,   184,   264,    55,    56,   234,   185,   188,   188,   188,
+     188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
      188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
      188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
      188,   188,   188,   188,   188,   188,   188,   188,   188,   188,
-     188,   188,   188,   188,   185,     3,   299,   300,     3,   157,
-     185,     6,   188,   185,   188,   188,     6,   188,    64,   204,
-     249,   252,     6,     6,     6,     6,     6,     6,     6,     6,
+     185,     3,   302,   303,     3,   157,   185,   188,   188,   185,
+     188,   188,     6,   188,    64,   207,   252,   255,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,   174,   185,   188,    80,   297,     3,     4,
-       4,     4,     4,   252,   185,   185,   185,   185,   185,   185,
+       6,   174,   185,   188,    80,   300,     3,     4,     4,     4,
+       4,     4,   255,   185,   185,   185,   185,   185,   185,   185,
      185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
      185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
      185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
-     185,   185,   185,   185,   185,   185,     3,     5,     6,   300,
-     184,   297,   188,   185,   188,   188,   299,     4,     4,     6,
-     185,   188,   188,   254,   185,     6,     4,   185,   297,   185,
-     297
+     185,   185,   185,   185,   185,   185,   185,     3,     5,     6,
+     303,   184,   300,   188,   188,   185,   188,   188,   302,     4,
+       4,     4,     6,   185,   188,   188,   188,   257,   185,     6,
+       6,     4,   185,   300,   185,   185,   300,   300
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   190,   191,   192,   192,   193,   193,   193,   193,   193,
-     193,   193,   193,   193,   193,   193,   193,   193,   194,   194,
+       0,   191,   192,   193,   193,   194,   194,   194,   194,   194,
      194,   194,   194,   194,   194,   194,   194,   194,   194,   194,
-     195,   195,   195,   195,   195,   195,   196,   196,   197,   197,
-     198,   198,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   199,   199,   199,   199,   199,   200,   200,   201,   201,
-     201,   201,   202,   202,   203,   203,   204,   204,   205,   206,
-     206,   207,   207,   208,   209,   209,   209,   209,   209,   209,
-     209,   209,   210,   211,   211,   212,   213,   213,   213,   213,
-     213,   214,   214,   215,   215,   215,   215,   216,   216,   217,
-     218,   219,   219,   220,   221,   221,   222,   222,   223,   224,
-     224,   224,   225,   225,   226,   226,   227,   227,   228,   228,
-     229,   229,   230,   230,   231,   231,   232,   232,   233,   233,
-     233,   233,   234,   234,   235,   235,   236,   236,   237,   237,
-     238,   238,   238,   238,   239,   239,   240,   240,   241,   242,
-     242,   243,   243,   243,   243,   243,   243,   243,   244,   244,
-     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     245,   245,   245,   246,   247,   247,   247,   247,   247,   247,
+     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
+     195,   195,   196,   197,   197,   198,   198,   198,   198,   198,
+     198,   199,   199,   200,   200,   201,   201,   202,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   203,   203,   204,   204,   204,   204,   205,
+     205,   206,   206,   207,   207,   208,   209,   209,   210,   210,
+     211,   212,   212,   212,   212,   212,   212,   212,   212,   213,
+     214,   214,   215,   216,   216,   216,   216,   216,   217,   217,
+     218,   218,   218,   218,   219,   219,   220,   221,   222,   222,
+     223,   224,   224,   225,   225,   226,   227,   227,   227,   228,
+     228,   229,   229,   230,   230,   231,   231,   232,   232,   233,
+     233,   234,   234,   235,   235,   236,   236,   236,   236,   237,
+     237,   238,   238,   239,   239,   240,   240,   241,   241,   241,
+     241,   242,   242,   243,   243,   244,   245,   245,   246,   246,
+     246,   246,   246,   246,   246,   247,   247,   247,   247,   247,
      247,   247,   247,   247,   247,   247,   247,   247,   247,   247,
-     247,   248,   249,   249,   250,   250,   251,   251,   252,   252,
-     252,   252,   252,   253,   253,   253,   253,   253,   253,   253,
-     253,   253,   253,   253,   253,   253,   254,   254,   255,   256,
-     257,   258,   258,   259,   259,   260,   260,   261,   261,   261,
-     261,   261,   261,   262,   262,   263,   263,   263,   263,   263,
-     263,   263,   263,   263,   263,   263,   263,   263,   263,   263,
-     263,   263,   263,   263,   263,   263,   263,   263,   264,   264,
-     265,   266,   266,   267,   267,   267,   267,   268,   268,   269,
-     270,   270,   270,   270,   271,   271,   271,   271,   272,   272,
-     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
-     273,   273,   273,   273,   274,   275,   275,   276,   276,   277,
-     278,   278,   279,   280,   280,   281,   282,   283,   284,   284,
-     285,   286,   286,   287,   288,   288,   289,   289,   289,   289,
-     289,   289,   289,   289,   289,   289,   289,   289,   290,   290,
-     291,   291,   291,   292,   293,   293,   294,   294,   295,   295,
-     296,   296,   297,   297,   298,   298,   299,   299,   300,   300,
-     300,   300,   301,   301,   301
+     247,   247,   247,   247,   247,   247,   247,   248,   248,   248,
+     249,   250,   250,   250,   250,   250,   250,   250,   250,   250,
+     250,   250,   250,   250,   250,   250,   250,   250,   251,   252,
+     252,   253,   253,   254,   254,   255,   255,   255,   255,   255,
+     256,   256,   256,   256,   256,   256,   256,   256,   256,   256,
+     256,   256,   256,   256,   257,   257,   258,   259,   259,   260,
+     261,   261,   262,   262,   263,   263,   264,   264,   264,   264,
+     264,   264,   265,   265,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,   267,   267,   268,
+     269,   269,   270,   270,   270,   270,   271,   271,   272,   273,
+     273,   273,   273,   274,   274,   274,   274,   275,   275,   275,
+     275,   275,   275,   275,   275,   275,   275,   275,   275,   276,
+     276,   276,   276,   277,   278,   278,   279,   279,   280,   281,
+     281,   282,   283,   283,   284,   285,   286,   287,   287,   288,
+     289,   289,   290,   291,   291,   292,   292,   292,   292,   292,
+     292,   292,   292,   292,   292,   292,   292,   293,   293,   294,
+     294,   294,   295,   296,   296,   297,   297,   298,   298,   299,
+     299,   300,   300,   301,   301,   302,   302,   303,   303,   303,
+     303,   304,   304,   304
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1559,45 +1579,46 @@ static const yytype_int8 yyr2[] =
        0,     2,     2,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       4,     4,     8,     6,     7,     6,     1,     3,     1,     1,
-       3,     4,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     4,     2,     5,     4,     4,     8,     6,     7,
+       6,     1,     3,     1,     1,     3,     4,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     6,     4,     1,     6,     6,     6,     6,
+       1,     1,     1,     1,     1,     1,     1,     1,     6,     4,
+       1,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,     1,     2,     2,     1,
-       1,     2,     2,     0,     5,     4,     1,     3,     4,     6,
-       5,     3,     0,     3,     1,     1,     1,     1,     1,     1,
-       1,     0,     5,     1,     3,     3,     4,     4,     4,     4,
-       6,     8,     8,     1,     1,     3,     3,     3,     3,     2,
-       4,     3,     3,     8,     3,     0,     1,     3,     2,     1,
-       1,     0,     2,     0,     2,     0,     1,     0,     2,     0,
-       2,     0,     2,     0,     2,     0,     3,     0,     1,     2,
-       1,     1,     1,     3,     1,     1,     2,     4,     1,     3,
-       2,     1,     5,     0,     2,     0,     1,     3,     5,     4,
-       6,     1,     1,     1,     1,     1,     1,     0,     2,     2,
-       2,     2,     3,     2,     3,     3,     4,     4,     3,     3,
-       4,     4,     5,     6,     7,     9,     4,     5,     7,     9,
-       2,     2,     2,     2,     2,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     3,     1,     3,     3,     5,     3,     1,     1,     1,
-       1,     1,     1,     3,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     0,    12,    14,
-      12,     7,     9,     4,     6,     4,     6,     1,     1,     1,
-       1,     1,     1,     1,     3,     3,     4,     5,     4,     3,
-       2,     2,     2,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     6,     3,     4,     3,     3,
-       5,     5,     6,     4,     6,     3,     5,     4,     5,     6,
-       4,     5,     5,     6,     1,     3,     1,     3,     1,     1,
-       1,     1,     1,     2,     2,     2,     2,     2,     1,     1,
-       1,     1,     1,     1,     2,     2,     3,     1,     1,     2,
-       2,     3,     2,     2,     3,     2,     3,     3,     1,     1,
-       2,     2,     3,     2,     2,     3,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     1,     3,
-       2,     2,     1,     1,     2,     0,     3,     0,     1,     0,
-       2,     0,     4,     0,     4,     0,     1,     3,     1,     3,
-       3,     3,     6,     7,     3
+       6,     6,     6,     1,     2,     2,     1,     1,     2,     2,
+       0,     5,     4,     1,     3,     4,     6,     5,     3,     0,
+       3,     1,     1,     1,     1,     1,     1,     1,     0,     5,
+       1,     3,     3,     4,     4,     4,     4,     6,     8,     8,
+       1,     1,     3,     3,     3,     3,     2,     4,     3,     3,
+       8,     3,     0,     1,     3,     2,     1,     1,     0,     2,
+       0,     2,     0,     1,     0,     2,     0,     2,     0,     2,
+       0,     2,     0,     3,     0,     1,     2,     1,     1,     1,
+       3,     1,     1,     2,     4,     1,     3,     2,     1,     5,
+       0,     2,     0,     1,     3,     5,     4,     6,     1,     1,
+       1,     1,     1,     1,     0,     2,     2,     2,     2,     3,
+       2,     3,     3,     4,     4,     3,     3,     4,     4,     5,
+       6,     7,     9,     4,     5,     7,     9,     2,     2,     2,
+       2,     2,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     3,     1,
+       3,     3,     5,     3,     1,     1,     1,     1,     1,     1,
+       3,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     0,    12,    14,    14,    12,
+       7,     9,     4,     6,     4,     6,     1,     1,     1,     1,
+       1,     1,     1,     3,     3,     4,     5,     4,     3,     2,
+       2,     2,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     6,     3,     4,     3,     3,     5,
+       5,     6,     4,     6,     3,     5,     4,     5,     6,     4,
+       5,     5,     6,     1,     3,     1,     3,     1,     1,     1,
+       1,     1,     2,     2,     2,     2,     2,     1,     1,     1,
+       1,     1,     1,     2,     2,     3,     1,     1,     2,     2,
+       3,     2,     2,     3,     2,     3,     3,     1,     1,     2,
+       2,     3,     2,     2,     3,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     1,     3,     2,
+       2,     1,     1,     2,     0,     3,     0,     1,     0,     2,
+       0,     4,     0,     4,     0,     1,     3,     1,     3,     3,
+       3,     6,     7,     3
 };
 
 
@@ -2165,7 +2186,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2169 "parser.cpp"
+#line 2190 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2173,7 +2194,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2177 "parser.cpp"
+#line 2198 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2187,7 +2208,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2191 "parser.cpp"
+#line 2212 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2201,7 +2222,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2205 "parser.cpp"
+#line 2226 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2212,7 +2233,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2216 "parser.cpp"
+#line 2237 "parser.cpp"
         break;
 
     case YYSYMBOL_default_expr: /* default_expr  */
@@ -2220,7 +2241,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2224 "parser.cpp"
+#line 2245 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2229,7 +2250,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2233 "parser.cpp"
+#line 2254 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2238,7 +2259,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2242 "parser.cpp"
+#line 2263 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2252,7 +2273,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2256 "parser.cpp"
+#line 2277 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2263,7 +2284,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2267 "parser.cpp"
+#line 2288 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2273,7 +2294,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2277 "parser.cpp"
+#line 2298 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2283,7 +2304,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2287 "parser.cpp"
+#line 2308 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2293,7 +2314,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2297 "parser.cpp"
+#line 2318 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2303,7 +2324,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2307 "parser.cpp"
+#line 2328 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2313,7 +2334,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2317 "parser.cpp"
+#line 2338 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2323,7 +2344,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2327 "parser.cpp"
+#line 2348 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2337,7 +2358,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2341 "parser.cpp"
+#line 2362 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2351,7 +2372,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2355 "parser.cpp"
+#line 2376 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2361,7 +2382,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2365 "parser.cpp"
+#line 2386 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2369,7 +2390,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2373 "parser.cpp"
+#line 2394 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2377,7 +2398,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2381 "parser.cpp"
+#line 2402 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2386,7 +2407,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2390 "parser.cpp"
+#line 2411 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2394,7 +2415,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2398 "parser.cpp"
+#line 2419 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2402,7 +2423,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2406 "parser.cpp"
+#line 2427 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2410,7 +2431,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2414 "parser.cpp"
+#line 2435 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2424,7 +2445,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2428 "parser.cpp"
+#line 2449 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2433,7 +2454,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2437 "parser.cpp"
+#line 2458 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2442,7 +2463,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2446 "parser.cpp"
+#line 2467 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2451,7 +2472,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2455 "parser.cpp"
+#line 2476 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2464,7 +2485,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2468 "parser.cpp"
+#line 2489 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2473,7 +2494,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2477 "parser.cpp"
+#line 2498 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2487,7 +2508,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2491 "parser.cpp"
+#line 2512 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2501,7 +2522,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2505 "parser.cpp"
+#line 2526 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2511,7 +2532,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2515 "parser.cpp"
+#line 2536 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2520,7 +2541,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2524 "parser.cpp"
+#line 2545 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2534,7 +2555,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2538 "parser.cpp"
+#line 2559 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2551,7 +2572,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2555 "parser.cpp"
+#line 2576 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2559,7 +2580,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2563 "parser.cpp"
+#line 2584 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2567,7 +2588,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2571 "parser.cpp"
+#line 2592 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2575,7 +2596,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2579 "parser.cpp"
+#line 2600 "parser.cpp"
         break;
 
     case YYSYMBOL_extra_match_tensor_option: /* extra_match_tensor_option  */
@@ -2583,7 +2604,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2587 "parser.cpp"
+#line 2608 "parser.cpp"
         break;
 
     case YYSYMBOL_match_tensor_expr: /* match_tensor_expr  */
@@ -2591,7 +2612,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2595 "parser.cpp"
+#line 2616 "parser.cpp"
         break;
 
     case YYSYMBOL_match_vector_expr: /* match_vector_expr  */
@@ -2599,7 +2620,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2603 "parser.cpp"
+#line 2624 "parser.cpp"
         break;
 
     case YYSYMBOL_match_sparse_expr: /* match_sparse_expr  */
@@ -2607,7 +2628,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2611 "parser.cpp"
+#line 2632 "parser.cpp"
         break;
 
     case YYSYMBOL_match_text_expr: /* match_text_expr  */
@@ -2615,7 +2636,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2619 "parser.cpp"
+#line 2640 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2623,7 +2644,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2627 "parser.cpp"
+#line 2648 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2631,7 +2652,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2635 "parser.cpp"
+#line 2656 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search: /* sub_search  */
@@ -2639,7 +2660,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2643 "parser.cpp"
+#line 2664 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2653,7 +2674,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2657 "parser.cpp"
+#line 2678 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2661,7 +2682,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2665 "parser.cpp"
+#line 2686 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2669,7 +2690,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2673 "parser.cpp"
+#line 2694 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2677,7 +2698,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2681 "parser.cpp"
+#line 2702 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2685,7 +2706,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2689 "parser.cpp"
+#line 2710 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2693,7 +2714,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2697 "parser.cpp"
+#line 2718 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2706,7 +2727,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2710 "parser.cpp"
+#line 2731 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2714,7 +2735,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2718 "parser.cpp"
+#line 2739 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2722,7 +2743,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2726 "parser.cpp"
+#line 2747 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2730,7 +2751,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2734 "parser.cpp"
+#line 2755 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2738,7 +2759,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2742 "parser.cpp"
+#line 2763 "parser.cpp"
         break;
 
     case YYSYMBOL_common_array_expr: /* common_array_expr  */
@@ -2746,7 +2767,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2750 "parser.cpp"
+#line 2771 "parser.cpp"
         break;
 
     case YYSYMBOL_subarray_array_expr: /* subarray_array_expr  */
@@ -2754,7 +2775,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2758 "parser.cpp"
+#line 2779 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_subarray_array_expr: /* unclosed_subarray_array_expr  */
@@ -2762,7 +2783,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2766 "parser.cpp"
+#line 2787 "parser.cpp"
         break;
 
     case YYSYMBOL_sparse_array_expr: /* sparse_array_expr  */
@@ -2770,7 +2791,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2774 "parser.cpp"
+#line 2795 "parser.cpp"
         break;
 
     case YYSYMBOL_long_sparse_array_expr: /* long_sparse_array_expr  */
@@ -2778,7 +2799,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2782 "parser.cpp"
+#line 2803 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_sparse_array_expr: /* unclosed_long_sparse_array_expr  */
@@ -2786,7 +2807,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2790 "parser.cpp"
+#line 2811 "parser.cpp"
         break;
 
     case YYSYMBOL_double_sparse_array_expr: /* double_sparse_array_expr  */
@@ -2794,7 +2815,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2798 "parser.cpp"
+#line 2819 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_sparse_array_expr: /* unclosed_double_sparse_array_expr  */
@@ -2802,7 +2823,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2806 "parser.cpp"
+#line 2827 "parser.cpp"
         break;
 
     case YYSYMBOL_empty_array_expr: /* empty_array_expr  */
@@ -2810,7 +2831,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2814 "parser.cpp"
+#line 2835 "parser.cpp"
         break;
 
     case YYSYMBOL_int_sparse_ele: /* int_sparse_ele  */
@@ -2818,7 +2839,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).int_sparse_ele_t));
 }
-#line 2822 "parser.cpp"
+#line 2843 "parser.cpp"
         break;
 
     case YYSYMBOL_float_sparse_ele: /* float_sparse_ele  */
@@ -2826,7 +2847,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).float_sparse_ele_t));
 }
-#line 2830 "parser.cpp"
+#line 2851 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2834,7 +2855,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2838 "parser.cpp"
+#line 2859 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2842,7 +2863,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2846 "parser.cpp"
+#line 2867 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2850,7 +2871,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2854 "parser.cpp"
+#line 2875 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2858,7 +2879,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2862 "parser.cpp"
+#line 2883 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -2866,7 +2887,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2870 "parser.cpp"
+#line 2891 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -2874,7 +2895,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2878 "parser.cpp"
+#line 2899 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -2882,7 +2903,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2886 "parser.cpp"
+#line 2907 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -2893,7 +2914,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 2897 "parser.cpp"
+#line 2918 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -2907,7 +2928,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2911 "parser.cpp"
+#line 2932 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -2921,7 +2942,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2925 "parser.cpp"
+#line 2946 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info_list: /* index_info_list  */
@@ -2935,7 +2956,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_list_t));
     }
 }
-#line 2939 "parser.cpp"
+#line 2960 "parser.cpp"
         break;
 
       default:
@@ -3043,7 +3064,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 3047 "parser.cpp"
+#line 3068 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3254,187 +3275,236 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* input_pattern: statement_list semicolon  */
-#line 492 "parser.y"
+#line 494 "parser.y"
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 3262 "parser.cpp"
+#line 3283 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
-#line 496 "parser.y"
+#line 498 "parser.y"
                            {
     (yyvsp[0].base_stmt)->stmt_length_ = yylloc.string_length;
     yylloc.string_length = 0;
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 3273 "parser.cpp"
+#line 3294 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
-#line 502 "parser.y"
+#line 504 "parser.y"
                                {
     (yyvsp[0].base_stmt)->stmt_length_ = yylloc.string_length;
     yylloc.string_length = 0;
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3284 "parser.cpp"
+#line 3305 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
-#line 509 "parser.y"
+#line 511 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3290 "parser.cpp"
+#line 3311 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
-#line 510 "parser.y"
+#line 512 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3296 "parser.cpp"
+#line 3317 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
-#line 511 "parser.y"
+#line 513 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3302 "parser.cpp"
+#line 3323 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
-#line 512 "parser.y"
+#line 514 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3308 "parser.cpp"
+#line 3329 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
-#line 513 "parser.y"
+#line 515 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3314 "parser.cpp"
+#line 3335 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
-#line 514 "parser.y"
+#line 516 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3320 "parser.cpp"
+#line 3341 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
-#line 515 "parser.y"
+#line 517 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3326 "parser.cpp"
+#line 3347 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
-#line 516 "parser.y"
+#line 518 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3332 "parser.cpp"
+#line 3353 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
-#line 517 "parser.y"
+#line 519 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3338 "parser.cpp"
+#line 3359 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
-#line 518 "parser.y"
+#line 520 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3344 "parser.cpp"
+#line 3365 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
-#line 519 "parser.y"
+#line 521 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3350 "parser.cpp"
+#line 3371 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
-#line 520 "parser.y"
+#line 522 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3356 "parser.cpp"
+#line 3377 "parser.cpp"
     break;
 
   case 17: /* statement: compact_statement  */
-#line 521 "parser.y"
+#line 523 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3362 "parser.cpp"
+#line 3383 "parser.cpp"
     break;
 
-  case 18: /* explainable_statement: create_statement  */
-#line 523 "parser.y"
+  case 18: /* statement: prepare_statement  */
+#line 524 "parser.y"
+                    { (yyval.base_stmt) = (yyvsp[0].prepare_stmt); }
+#line 3389 "parser.cpp"
+    break;
+
+  case 19: /* statement: execute_statement  */
+#line 525 "parser.y"
+                    { (yyval.base_stmt) = (yyvsp[0].execute_stmt); }
+#line 3395 "parser.cpp"
+    break;
+
+  case 20: /* explainable_statement: create_statement  */
+#line 527 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3368 "parser.cpp"
+#line 3401 "parser.cpp"
     break;
 
-  case 19: /* explainable_statement: drop_statement  */
-#line 524 "parser.y"
+  case 21: /* explainable_statement: drop_statement  */
+#line 528 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3374 "parser.cpp"
+#line 3407 "parser.cpp"
     break;
 
-  case 20: /* explainable_statement: copy_statement  */
-#line 525 "parser.y"
+  case 22: /* explainable_statement: copy_statement  */
+#line 529 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3380 "parser.cpp"
+#line 3413 "parser.cpp"
     break;
 
-  case 21: /* explainable_statement: show_statement  */
-#line 526 "parser.y"
+  case 23: /* explainable_statement: show_statement  */
+#line 530 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3386 "parser.cpp"
+#line 3419 "parser.cpp"
     break;
 
-  case 22: /* explainable_statement: select_statement  */
-#line 527 "parser.y"
+  case 24: /* explainable_statement: select_statement  */
+#line 531 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3392 "parser.cpp"
+#line 3425 "parser.cpp"
     break;
 
-  case 23: /* explainable_statement: delete_statement  */
-#line 528 "parser.y"
+  case 25: /* explainable_statement: delete_statement  */
+#line 532 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3398 "parser.cpp"
+#line 3431 "parser.cpp"
     break;
 
-  case 24: /* explainable_statement: update_statement  */
-#line 529 "parser.y"
+  case 26: /* explainable_statement: update_statement  */
+#line 533 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3404 "parser.cpp"
+#line 3437 "parser.cpp"
     break;
 
-  case 25: /* explainable_statement: insert_statement  */
-#line 530 "parser.y"
+  case 27: /* explainable_statement: insert_statement  */
+#line 534 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3410 "parser.cpp"
+#line 3443 "parser.cpp"
     break;
 
-  case 26: /* explainable_statement: flush_statement  */
-#line 531 "parser.y"
+  case 28: /* explainable_statement: flush_statement  */
+#line 535 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3416 "parser.cpp"
+#line 3449 "parser.cpp"
     break;
 
-  case 27: /* explainable_statement: optimize_statement  */
-#line 532 "parser.y"
+  case 29: /* explainable_statement: optimize_statement  */
+#line 536 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3422 "parser.cpp"
+#line 3455 "parser.cpp"
     break;
 
-  case 28: /* explainable_statement: command_statement  */
-#line 533 "parser.y"
+  case 30: /* explainable_statement: command_statement  */
+#line 537 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3428 "parser.cpp"
+#line 3461 "parser.cpp"
     break;
 
-  case 29: /* explainable_statement: compact_statement  */
-#line 534 "parser.y"
+  case 31: /* explainable_statement: compact_statement  */
+#line 538 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3434 "parser.cpp"
+#line 3467 "parser.cpp"
+    break;
+
+  case 32: /* prepare_statement: PREPARE IDENTIFIER AS select_statement  */
+#line 543 "parser.y"
+                                                           {
+    (yyval.prepare_stmt) = new infinity::PrepareStatement();
+    ParserHelper::ToLower((yyvsp[-2].str_value));
+    (yyval.prepare_stmt)->name_ = (yyvsp[-2].str_value);
+    free((yyvsp[-2].str_value));
+    (yyval.prepare_stmt)->statement_ = (yyvsp[0].select_stmt);
+    (yyval.prepare_stmt)->parameter_count_ = result->parameter_count_;
+    result->parameter_count_ = 0;
+}
+#line 3481 "parser.cpp"
+    break;
+
+  case 33: /* execute_statement: EXECUTE IDENTIFIER  */
+#line 556 "parser.y"
+                                       {
+    (yyval.execute_stmt) = new infinity::ExecuteStatement();
+    ParserHelper::ToLower((yyvsp[0].str_value));
+    (yyval.execute_stmt)->name_ = (yyvsp[0].str_value);
+    free((yyvsp[0].str_value));
+}
+#line 3492 "parser.cpp"
+    break;
+
+  case 34: /* execute_statement: EXECUTE IDENTIFIER '(' expr_array ')'  */
+#line 562 "parser.y"
+                                        {
+    (yyval.execute_stmt) = new infinity::ExecuteStatement();
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    (yyval.execute_stmt)->name_ = (yyvsp[-3].str_value);
+    free((yyvsp[-3].str_value));
+    (yyval.execute_stmt)->parameters_ = (yyvsp[-1].expr_array_t);
+}
+#line 3504 "parser.cpp"
     break;
 
-  case 30: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
-#line 541 "parser.y"
+  case 35: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
+#line 575 "parser.y"
                                                             {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateSchemaInfo> create_schema_info = std::make_shared<infinity::CreateSchemaInfo>();
@@ -3450,11 +3520,11 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3454 "parser.cpp"
+#line 3524 "parser.cpp"
     break;
 
-  case 31: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
-#line 558 "parser.y"
+  case 36: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
+#line 592 "parser.y"
                                              {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateCollectionInfo> create_collection_info = std::make_shared<infinity::CreateCollectionInfo>();
@@ -3468,11 +3538,11 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3472 "parser.cpp"
+#line 3542 "parser.cpp"
     break;
 
-  case 32: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
-#line 574 "parser.y"
+  case 37: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
+#line 608 "parser.y"
                                                                                                    {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateTableInfo> create_table_info = std::make_shared<infinity::CreateTableInfo>();
@@ -3501,11 +3571,11 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3505 "parser.cpp"
+#line 3575 "parser.cpp"
     break;
 
-  case 33: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
-#line 603 "parser.y"
+  case 38: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
+#line 637 "parser.y"
                                                             {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateTableInfo> create_table_info = std::make_shared<infinity::CreateTableInfo>();
@@ -3521,11 +3591,11 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3525 "parser.cpp"
+#line 3595 "parser.cpp"
     break;
 
-  case 34: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
-#line 619 "parser.y"
+  case 39: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
+#line 653 "parser.y"
                                                                                      {
     (yyval.create_stmt) = new infinity::CreateStatement();
     std::shared_ptr<infinity::CreateViewInfo> create_view_info = std::make_shared<infinity::CreateViewInfo>();
@@ -3542,11 +3612,11 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3546 "parser.cpp"
+#line 3616 "parser.cpp"
     break;
 
-  case 35: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
-#line 637 "parser.y"
+  case 40: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
+#line 671 "parser.y"
                                                                 {
     std::shared_ptr<infinity::CreateIndexInfo> create_index_info = std::make_shared<infinity::CreateIndexInfo>();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -3575,45 +3645,45 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3579 "parser.cpp"
+#line 3649 "parser.cpp"
     break;
 
-  case 36: /* table_element_array: table_element  */
-#line 666 "parser.y"
+  case 41: /* table_element_array: table_element  */
+#line 700 "parser.y"
                                     {
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3588 "parser.cpp"
+#line 3658 "parser.cpp"
     break;
 
-  case 37: /* table_element_array: table_element_array ',' table_element  */
-#line 670 "parser.y"
+  case 42: /* table_element_array: table_element_array ',' table_element  */
+#line 704 "parser.y"
                                         {
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3597 "parser.cpp"
+#line 3667 "parser.cpp"
     break;
 
-  case 38: /* table_element: table_column  */
-#line 676 "parser.y"
+  case 43: /* table_element: table_column  */
+#line 710 "parser.y"
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3605 "parser.cpp"
+#line 3675 "parser.cpp"
     break;
 
-  case 39: /* table_element: table_constraint  */
-#line 679 "parser.y"
+  case 44: /* table_element: table_constraint  */
+#line 713 "parser.y"
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3613 "parser.cpp"
+#line 3683 "parser.cpp"
     break;
 
-  case 40: /* table_column: IDENTIFIER column_type default_expr  */
-#line 685 "parser.y"
+  case 45: /* table_column: IDENTIFIER column_type default_expr  */
+#line 719 "parser.y"
                                     {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -3662,11 +3732,11 @@ yyreduce:
     }
     */
 }
-#line 3666 "parser.cpp"
+#line 3736 "parser.cpp"
     break;
 
-  case 41: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
-#line 733 "parser.y"
+  case 46: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
+#line 767 "parser.y"
                                                          {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-2].column_type_t).logical_type_) {
@@ -3701,404 +3771,446 @@ yyreduce:
     }
     */
 }
-#line 3705 "parser.cpp"
+#line 3775 "parser.cpp"
     break;
 
-  case 42: /* column_type: BOOLEAN  */
-#line 769 "parser.y"
+  case 47: /* column_type: BOOLEAN  */
+#line 803 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3711 "parser.cpp"
+#line 3781 "parser.cpp"
     break;
 
-  case 43: /* column_type: TINYINT  */
-#line 770 "parser.y"
+  case 48: /* column_type: TINYINT  */
+#line 804 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3717 "parser.cpp"
+#line 3787 "parser.cpp"
     break;
 
-  case 44: /* column_type: SMALLINT  */
-#line 771 "parser.y"
+  case 49: /* column_type: SMALLINT  */
+#line 805 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3723 "parser.cpp"
+#line 3793 "parser.cpp"
     break;
 
-  case 45: /* column_type: INTEGER  */
-#line 772 "parser.y"
+  case 50: /* column_type: INTEGER  */
+#line 806 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3729 "parser.cpp"
+#line 3799 "parser.cpp"
     break;
 
-  case 46: /* column_type: INT  */
-#line 773 "parser.y"
+  case 51: /* column_type: INT  */
+#line 807 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3735 "parser.cpp"
+#line 3805 "parser.cpp"
     break;
 
-  case 47: /* column_type: BIGINT  */
-#line 774 "parser.y"
+  case 52: /* column_type: BIGINT  */
+#line 808 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3741 "parser.cpp"
+#line 3811 "parser.cpp"
     break;
 
-  case 48: /* column_type: HUGEINT  */
-#line 775 "parser.y"
+  case 53: /* column_type: HUGEINT  */
+#line 809 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3747 "parser.cpp"
+#line 3817 "parser.cpp"
     break;
 
-  case 49: /* column_type: FLOAT  */
-#line 776 "parser.y"
+  case 54: /* column_type: FLOAT  */
+#line 810 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3753 "parser.cpp"
+#line 3823 "parser.cpp"
     break;
 
-  case 50: /* column_type: REAL  */
-#line 777 "parser.y"
+  case 55: /* column_type: REAL  */
+#line 811 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3759 "parser.cpp"
+#line 3829 "parser.cpp"
     break;
 
-  case 51: /* column_type: DOUBLE  */
-#line 778 "parser.y"
+  case 56: /* column_type: DOUBLE  */
+#line 812 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3765 "parser.cpp"
+#line 3835 "parser.cpp"
     break;
 
-  case 52: /* column_type: DATE  */
-#line 779 "parser.y"
+  case 57: /* column_type: DATE  */
+#line 813 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3771 "parser.cpp"
+#line 3841 "parser.cpp"
     break;
 
-  case 53: /* column_type: TIME  */
-#line 780 "parser.y"
+  case 58: /* column_type: TIME  */
+#line 814 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3777 "parser.cpp"
+#line 3847 "parser.cpp"
     break;
 
-  case 54: /* column_type: DATETIME  */
-#line 781 "parser.y"
+  case 59: /* column_type: DATETIME  */
+#line 815 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3783 "parser.cpp"
+#line 3853 "parser.cpp"
     break;
 
-  case 55: /* column_type: TIMESTAMP  */
-#line 782 "parser.y"
+  case 60: /* column_type: TIMESTAMP  */
+#line 816 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3789 "parser.cpp"
+#line 3859 "parser.cpp"
     break;
 
-  case 56: /* column_type: UUID  */
-#line 783 "parser.y"
+  case 61: /* column_type: UUID  */
+#line 817 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3795 "parser.cpp"
+#line 3865 "parser.cpp"
     break;
 
-  case 57: /* column_type: POINT  */
-#line 784 "parser.y"
+  case 62: /* column_type: POINT  */
+#line 818 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3801 "parser.cpp"
+#line 3871 "parser.cpp"
     break;
 
-  case 58: /* column_type: LINE  */
-#line 785 "parser.y"
+  case 63: /* column_type: LINE  */
+#line 819 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3807 "parser.cpp"
+#line 3877 "parser.cpp"
     break;
 
-  case 59: /* column_type: LSEG  */
-#line 786 "parser.y"
+  case 64: /* column_type: LSEG  */
+#line 820 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3813 "parser.cpp"
+#line 3883 "parser.cpp"
     break;
 
-  case 60: /* column_type: BOX  */
-#line 787 "parser.y"
+  case 65: /* column_type: BOX  */
+#line 821 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3819 "parser.cpp"
+#line 3889 "parser.cpp"
     break;
 
-  case 61: /* column_type: CIRCLE  */
-#line 790 "parser.y"
+  case 66: /* column_type: CIRCLE  */
+#line 824 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3825 "parser.cpp"
+#line 3895 "parser.cpp"
     break;
 
-  case 62: /* column_type: VARCHAR  */
-#line 792 "parser.y"
+  case 67: /* column_type: VARCHAR  */
+#line 826 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3831 "parser.cpp"
+#line 3901 "parser.cpp"
     break;
 
-  case 63: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
-#line 793 "parser.y"
+  case 68: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
+#line 827 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3837 "parser.cpp"
+#line 3907 "parser.cpp"
     break;
 
-  case 64: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
-#line 794 "parser.y"
+  case 69: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
+#line 828 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3843 "parser.cpp"
+#line 3913 "parser.cpp"
     break;
 
-  case 65: /* column_type: DECIMAL  */
-#line 795 "parser.y"
+  case 70: /* column_type: DECIMAL  */
+#line 829 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3849 "parser.cpp"
+#line 3919 "parser.cpp"
     break;
 
-  case 66: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
-#line 798 "parser.y"
+  case 71: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
+#line 832 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3855 "parser.cpp"
+#line 3925 "parser.cpp"
     break;
 
-  case 67: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
-#line 799 "parser.y"
+  case 72: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
+#line 833 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3861 "parser.cpp"
+#line 3931 "parser.cpp"
     break;
 
-  case 68: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 800 "parser.y"
+  case 73: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 834 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3867 "parser.cpp"
+#line 3937 "parser.cpp"
     break;
 
-  case 69: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
-#line 801 "parser.y"
+  case 74: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
+#line 835 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3873 "parser.cpp"
+#line 3943 "parser.cpp"
     break;
 
-  case 70: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
-#line 802 "parser.y"
+  case 75: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
+#line 836 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3879 "parser.cpp"
+#line 3949 "parser.cpp"
     break;
 
-  case 71: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
-#line 803 "parser.y"
+  case 76: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
+#line 837 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3885 "parser.cpp"
+#line 3955 "parser.cpp"
     break;
 
-  case 72: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
-#line 804 "parser.y"
+  case 77: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
+#line 838 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3891 "parser.cpp"
+#line 3961 "parser.cpp"
     break;
 
-  case 73: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 805 "parser.y"
+  case 78: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 839 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3897 "parser.cpp"
+#line 3967 "parser.cpp"
     break;
 
-  case 74: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
-#line 806 "parser.y"
+  case 79: /* column_type: EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')'  */
+#line 840 "parser.y"
+                                              {
+    // Element types without a keyword of their own, e.g. FLOAT16 / BFLOAT16
+    ParserHelper::ToUpper((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "FLOAT16") == 0 || strcmp((yyvsp[-3].str_value), "F16") == 0 || strcmp((yyvsp[-3].str_value), "HALF") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemFloat16;
+    } else if (strcmp((yyvsp[-3].str_value), "BFLOAT16") == 0 || strcmp((yyvsp[-3].str_value), "BF16") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unsupported embedding element type.");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 3988 "parser.cpp"
+    break;
+
+  case 80: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
+#line 856 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3903 "parser.cpp"
+#line 3994 "parser.cpp"
     break;
 
-  case 75: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 807 "parser.y"
+  case 81: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 857 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3909 "parser.cpp"
+#line 4000 "parser.cpp"
     break;
 
-  case 76: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 808 "parser.y"
+  case 82: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 858 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3915 "parser.cpp"
+#line 4006 "parser.cpp"
     break;
 
-  case 77: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 809 "parser.y"
+  case 83: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 859 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3921 "parser.cpp"
+#line 4012 "parser.cpp"
     break;
 
-  case 78: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
-#line 810 "parser.y"
+  case 84: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
+#line 860 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3927 "parser.cpp"
+#line 4018 "parser.cpp"
     break;
 
-  case 79: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 811 "parser.y"
+  case 85: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 861 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3933 "parser.cpp"
+#line 4024 "parser.cpp"
     break;
 
-  case 80: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 812 "parser.y"
+  case 86: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 862 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3939 "parser.cpp"
+#line 4030 "parser.cpp"
     break;
 
-  case 81: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 813 "parser.y"
+  case 87: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 863 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3945 "parser.cpp"
+#line 4036 "parser.cpp"
     break;
 
-  case 82: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
-#line 814 "parser.y"
+  case 88: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
+#line 864 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3951 "parser.cpp"
+#line 4042 "parser.cpp"
     break;
 
-  case 83: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
-#line 815 "parser.y"
+  case 89: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
+#line 865 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3957 "parser.cpp"
+#line 4048 "parser.cpp"
     break;
 
-  case 84: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 816 "parser.y"
+  case 90: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 866 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3963 "parser.cpp"
+#line 4054 "parser.cpp"
     break;
 
-  case 85: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
-#line 817 "parser.y"
+  case 91: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
+#line 867 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3969 "parser.cpp"
+#line 4060 "parser.cpp"
     break;
 
-  case 86: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
-#line 818 "parser.y"
+  case 92: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
+#line 868 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3975 "parser.cpp"
+#line 4066 "parser.cpp"
     break;
 
-  case 87: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
-#line 819 "parser.y"
+  case 93: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
+#line 869 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3981 "parser.cpp"
+#line 4072 "parser.cpp"
     break;
 
-  case 88: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
-#line 820 "parser.y"
+  case 94: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
+#line 870 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3987 "parser.cpp"
+#line 4078 "parser.cpp"
     break;
 
-  case 89: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 821 "parser.y"
+  case 95: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 871 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3993 "parser.cpp"
+#line 4084 "parser.cpp"
     break;
 
-  case 90: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
-#line 822 "parser.y"
+  case 96: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 872 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3999 "parser.cpp"
+#line 4090 "parser.cpp"
     break;
 
-  case 91: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 823 "parser.y"
+  case 97: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 873 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4005 "parser.cpp"
+#line 4096 "parser.cpp"
     break;
 
-  case 92: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 824 "parser.y"
+  case 98: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 874 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4011 "parser.cpp"
+#line 4102 "parser.cpp"
     break;
 
-  case 93: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 825 "parser.y"
+  case 99: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 875 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4017 "parser.cpp"
+#line 4108 "parser.cpp"
     break;
 
-  case 94: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 826 "parser.y"
+  case 100: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 876 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4023 "parser.cpp"
+#line 4114 "parser.cpp"
     break;
 
-  case 95: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 827 "parser.y"
+  case 101: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 877 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4029 "parser.cpp"
+#line 4120 "parser.cpp"
     break;
 
-  case 96: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 828 "parser.y"
+  case 102: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 878 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4035 "parser.cpp"
+#line 4126 "parser.cpp"
     break;
 
-  case 97: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 829 "parser.y"
+  case 103: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 879 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4041 "parser.cpp"
+#line 4132 "parser.cpp"
     break;
 
-  case 98: /* column_type: SPARSE '(' BIT ',' LONG_VALUE ')'  */
-#line 830 "parser.y"
+  case 104: /* column_type: VECTOR '(' IDENTIFIER ',' LONG_VALUE ')'  */
+#line 880 "parser.y"
+                                           {
+    // Element types without a keyword of their own, e.g. FLOAT16 / BFLOAT16
+    ParserHelper::ToUpper((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "FLOAT16") == 0 || strcmp((yyvsp[-3].str_value), "F16") == 0 || strcmp((yyvsp[-3].str_value), "HALF") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemFloat16;
+    } else if (strcmp((yyvsp[-3].str_value), "BFLOAT16") == 0 || strcmp((yyvsp[-3].str_value), "BF16") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemBFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unsupported embedding element type.");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, elem_type};
+}
+#line 4153 "parser.cpp"
+    break;
+
+  case 105: /* column_type: SPARSE '(' BIT ',' LONG_VALUE ')'  */
+#line 896 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 4047 "parser.cpp"
+#line 4159 "parser.cpp"
     break;
 
-  case 99: /* column_type: SPARSE '(' TINYINT ',' LONG_VALUE ')'  */
-#line 831 "parser.y"
+  case 106: /* column_type: SPARSE '(' TINYINT ',' LONG_VALUE ')'  */
+#line 897 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 4053 "parser.cpp"
+#line 4165 "parser.cpp"
     break;
 
-  case 100: /* column_type: SPARSE '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 832 "parser.y"
+  case 107: /* column_type: SPARSE '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 898 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 4059 "parser.cpp"
+#line 4171 "parser.cpp"
     break;
 
-  case 101: /* column_type: SPARSE '(' INTEGER ',' LONG_VALUE ')'  */
-#line 833 "parser.y"
+  case 108: /* column_type: SPARSE '(' INTEGER ',' LONG_VALUE ')'  */
+#line 899 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4065 "parser.cpp"
+#line 4177 "parser.cpp"
     break;
 
-  case 102: /* column_type: SPARSE '(' INT ',' LONG_VALUE ')'  */
-#line 834 "parser.y"
+  case 109: /* column_type: SPARSE '(' INT ',' LONG_VALUE ')'  */
+#line 900 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 4071 "parser.cpp"
+#line 4183 "parser.cpp"
     break;
 
-  case 103: /* column_type: SPARSE '(' BIGINT ',' LONG_VALUE ')'  */
-#line 835 "parser.y"
+  case 110: /* column_type: SPARSE '(' BIGINT ',' LONG_VALUE ')'  */
+#line 901 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 4077 "parser.cpp"
+#line 4189 "parser.cpp"
     break;
 
-  case 104: /* column_type: SPARSE '(' FLOAT ',' LONG_VALUE ')'  */
-#line 836 "parser.y"
+  case 111: /* column_type: SPARSE '(' FLOAT ',' LONG_VALUE ')'  */
+#line 902 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 4083 "parser.cpp"
+#line 4195 "parser.cpp"
     break;
 
-  case 105: /* column_type: SPARSE '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 837 "parser.y"
+  case 112: /* column_type: SPARSE '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 903 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSparse, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 4089 "parser.cpp"
+#line 4201 "parser.cpp"
     break;
 
-  case 106: /* column_constraints: column_constraint  */
-#line 856 "parser.y"
+  case 113: /* column_constraints: column_constraint  */
+#line 922 "parser.y"
                                        {
     (yyval.column_constraints_t) = new std::set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 4098 "parser.cpp"
+#line 4210 "parser.cpp"
     break;
 
-  case 107: /* column_constraints: column_constraints column_constraint  */
-#line 860 "parser.y"
+  case 114: /* column_constraints: column_constraints column_constraint  */
+#line 926 "parser.y"
                                        {
     if((yyvsp[-1].column_constraints_t)->contains((yyvsp[0].column_constraint_t))) {
         yyerror(&yyloc, scanner, result, "Duplicate column constraint.");
@@ -4108,101 +4220,101 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 4112 "parser.cpp"
+#line 4224 "parser.cpp"
     break;
 
-  case 108: /* column_constraint: PRIMARY KEY  */
-#line 870 "parser.y"
+  case 115: /* column_constraint: PRIMARY KEY  */
+#line 936 "parser.y"
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4120 "parser.cpp"
+#line 4232 "parser.cpp"
     break;
 
-  case 109: /* column_constraint: UNIQUE  */
-#line 873 "parser.y"
+  case 116: /* column_constraint: UNIQUE  */
+#line 939 "parser.y"
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 4128 "parser.cpp"
+#line 4240 "parser.cpp"
     break;
 
-  case 110: /* column_constraint: NULLABLE  */
-#line 876 "parser.y"
+  case 117: /* column_constraint: NULLABLE  */
+#line 942 "parser.y"
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 4136 "parser.cpp"
+#line 4248 "parser.cpp"
     break;
 
-  case 111: /* column_constraint: NOT NULLABLE  */
-#line 879 "parser.y"
+  case 118: /* column_constraint: NOT NULLABLE  */
+#line 945 "parser.y"
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 4144 "parser.cpp"
+#line 4256 "parser.cpp"
     break;
 
-  case 112: /* default_expr: DEFAULT constant_expr  */
-#line 883 "parser.y"
+  case 119: /* default_expr: DEFAULT constant_expr  */
+#line 949 "parser.y"
                                      {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 4152 "parser.cpp"
+#line 4264 "parser.cpp"
     break;
 
-  case 113: /* default_expr: %empty  */
-#line 886 "parser.y"
+  case 120: /* default_expr: %empty  */
+#line 952 "parser.y"
                             {
     (yyval.const_expr_t) = nullptr;
 }
-#line 4160 "parser.cpp"
+#line 4272 "parser.cpp"
     break;
 
-  case 114: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
-#line 891 "parser.y"
+  case 121: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
+#line 957 "parser.y"
                                                         {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 4170 "parser.cpp"
+#line 4282 "parser.cpp"
     break;
 
-  case 115: /* table_constraint: UNIQUE '(' identifier_array ')'  */
-#line 896 "parser.y"
+  case 122: /* table_constraint: UNIQUE '(' identifier_array ')'  */
+#line 962 "parser.y"
                                   {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 4180 "parser.cpp"
+#line 4292 "parser.cpp"
     break;
 
-  case 116: /* identifier_array: IDENTIFIER  */
-#line 903 "parser.y"
+  case 123: /* identifier_array: IDENTIFIER  */
+#line 969 "parser.y"
                               {
     (yyval.identifier_array_t) = new std::vector<std::string>();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 4191 "parser.cpp"
+#line 4303 "parser.cpp"
     break;
 
-  case 117: /* identifier_array: identifier_array ',' IDENTIFIER  */
-#line 909 "parser.y"
+  case 124: /* identifier_array: identifier_array ',' IDENTIFIER  */
+#line 975 "parser.y"
                                   {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyvsp[-2].identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 4202 "parser.cpp"
+#line 4314 "parser.cpp"
     break;
 
-  case 118: /* delete_statement: DELETE FROM table_name where_clause  */
-#line 919 "parser.y"
+  case 125: /* delete_statement: DELETE FROM table_name where_clause  */
+#line 985 "parser.y"
                                                        {
     (yyval.delete_stmt) = new infinity::DeleteStatement();
 
@@ -4215,11 +4327,11 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 4219 "parser.cpp"
+#line 4331 "parser.cpp"
     break;
 
-  case 119: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
-#line 935 "parser.y"
+  case 126: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
+#line 1001 "parser.y"
                                                                                           {
     bool is_error{false};
     for (auto expr_array : *(yyvsp[0].expr_array_list_t)) {
@@ -4254,11 +4366,11 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 4258 "parser.cpp"
+#line 4370 "parser.cpp"
     break;
 
-  case 120: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
-#line 969 "parser.y"
+  case 127: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
+#line 1035 "parser.y"
                                                                         {
     (yyval.insert_stmt) = new infinity::InsertStatement();
     if((yyvsp[-2].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4271,101 +4383,101 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 4275 "parser.cpp"
+#line 4387 "parser.cpp"
     break;
 
-  case 121: /* optional_identifier_array: '(' identifier_array ')'  */
-#line 982 "parser.y"
+  case 128: /* optional_identifier_array: '(' identifier_array ')'  */
+#line 1048 "parser.y"
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 4283 "parser.cpp"
+#line 4395 "parser.cpp"
     break;
 
-  case 122: /* optional_identifier_array: %empty  */
-#line 985 "parser.y"
+  case 129: /* optional_identifier_array: %empty  */
+#line 1051 "parser.y"
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 4291 "parser.cpp"
+#line 4403 "parser.cpp"
     break;
 
-  case 123: /* explain_statement: EXPLAIN explain_type explainable_statement  */
-#line 992 "parser.y"
+  case 130: /* explain_statement: EXPLAIN explain_type explainable_statement  */
+#line 1058 "parser.y"
                                                                {
     (yyval.explain_stmt) = new infinity::ExplainStatement();
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 4301 "parser.cpp"
+#line 4413 "parser.cpp"
     break;
 
-  case 124: /* explain_type: ANALYZE  */
-#line 998 "parser.y"
+  case 131: /* explain_type: ANALYZE  */
+#line 1064 "parser.y"
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 4309 "parser.cpp"
+#line 4421 "parser.cpp"
     break;
 
-  case 125: /* explain_type: AST  */
-#line 1001 "parser.y"
+  case 132: /* explain_type: AST  */
+#line 1067 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 4317 "parser.cpp"
+#line 4429 "parser.cpp"
     break;
 
-  case 126: /* explain_type: RAW  */
-#line 1004 "parser.y"
+  case 133: /* explain_type: RAW  */
+#line 1070 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 4325 "parser.cpp"
+#line 4437 "parser.cpp"
     break;
 
-  case 127: /* explain_type: LOGICAL  */
-#line 1007 "parser.y"
+  case 134: /* explain_type: LOGICAL  */
+#line 1073 "parser.y"
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 4333 "parser.cpp"
+#line 4445 "parser.cpp"
     break;
 
-  case 128: /* explain_type: PHYSICAL  */
-#line 1010 "parser.y"
+  case 135: /* explain_type: PHYSICAL  */
+#line 1076 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4341 "parser.cpp"
+#line 4453 "parser.cpp"
     break;
 
-  case 129: /* explain_type: PIPELINE  */
-#line 1013 "parser.y"
+  case 136: /* explain_type: PIPELINE  */
+#line 1079 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 4349 "parser.cpp"
+#line 4461 "parser.cpp"
     break;
 
-  case 130: /* explain_type: FRAGMENT  */
-#line 1016 "parser.y"
+  case 137: /* explain_type: FRAGMENT  */
+#line 1082 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 4357 "parser.cpp"
+#line 4469 "parser.cpp"
     break;
 
-  case 131: /* explain_type: %empty  */
-#line 1019 "parser.y"
+  case 138: /* explain_type: %empty  */
+#line 1085 "parser.y"
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4365 "parser.cpp"
+#line 4477 "parser.cpp"
     break;
 
-  case 132: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
-#line 1026 "parser.y"
+  case 139: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
+#line 1092 "parser.y"
                                                                        {
     (yyval.update_stmt) = new infinity::UpdateStatement();
     if((yyvsp[-3].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4378,29 +4490,29 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 4382 "parser.cpp"
+#line 4494 "parser.cpp"
     break;
 
-  case 133: /* update_expr_array: update_expr  */
-#line 1039 "parser.y"
+  case 140: /* update_expr_array: update_expr  */
+#line 1105 "parser.y"
                                {
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 4391 "parser.cpp"
+#line 4503 "parser.cpp"
     break;
 
-  case 134: /* update_expr_array: update_expr_array ',' update_expr  */
-#line 1043 "parser.y"
+  case 141: /* update_expr_array: update_expr_array ',' update_expr  */
+#line 1109 "parser.y"
                                     {
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 4400 "parser.cpp"
+#line 4512 "parser.cpp"
     break;
 
-  case 135: /* update_expr: IDENTIFIER '=' expr  */
-#line 1048 "parser.y"
+  case 142: /* update_expr: IDENTIFIER '=' expr  */
+#line 1114 "parser.y"
                                   {
     (yyval.update_expr_t) = new infinity::UpdateExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -4408,11 +4520,11 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 4412 "parser.cpp"
+#line 4524 "parser.cpp"
     break;
 
-  case 136: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
-#line 1061 "parser.y"
+  case 143: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
+#line 1127 "parser.y"
                                                    {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropSchemaInfo> drop_schema_info = std::make_shared<infinity::DropSchemaInfo>();
@@ -4424,11 +4536,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 4428 "parser.cpp"
+#line 4540 "parser.cpp"
     break;
 
-  case 137: /* drop_statement: DROP COLLECTION if_exists table_name  */
-#line 1074 "parser.y"
+  case 144: /* drop_statement: DROP COLLECTION if_exists table_name  */
+#line 1140 "parser.y"
                                        {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropCollectionInfo> drop_collection_info = std::make_unique<infinity::DropCollectionInfo>();
@@ -4442,11 +4554,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4446 "parser.cpp"
+#line 4558 "parser.cpp"
     break;
 
-  case 138: /* drop_statement: DROP TABLE if_exists table_name  */
-#line 1089 "parser.y"
+  case 145: /* drop_statement: DROP TABLE if_exists table_name  */
+#line 1155 "parser.y"
                                   {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropTableInfo> drop_table_info = std::make_unique<infinity::DropTableInfo>();
@@ -4460,11 +4572,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4464 "parser.cpp"
+#line 4576 "parser.cpp"
     break;
 
-  case 139: /* drop_statement: DROP VIEW if_exists table_name  */
-#line 1104 "parser.y"
+  case 146: /* drop_statement: DROP VIEW if_exists table_name  */
+#line 1170 "parser.y"
                                  {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropViewInfo> drop_view_info = std::make_unique<infinity::DropViewInfo>();
@@ -4478,11 +4590,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4482 "parser.cpp"
+#line 4594 "parser.cpp"
     break;
 
-  case 140: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
-#line 1119 "parser.y"
+  case 147: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
+#line 1185 "parser.y"
                                                 {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropIndexInfo> drop_index_info = std::make_shared<infinity::DropIndexInfo>();
@@ -4501,11 +4613,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4505 "parser.cpp"
+#line 4617 "parser.cpp"
     break;
 
-  case 141: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
-#line 1142 "parser.y"
+  case 148: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
+#line 1208 "parser.y"
                                                                            {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4547,11 +4659,11 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4551 "parser.cpp"
+#line 4663 "parser.cpp"
     break;
 
-  case 142: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
-#line 1183 "parser.y"
+  case 149: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
+#line 1249 "parser.y"
                                                                {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4593,27 +4705,27 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4597 "parser.cpp"
+#line 4709 "parser.cpp"
     break;
 
-  case 143: /* select_statement: select_without_paren  */
-#line 1228 "parser.y"
+  case 150: /* select_statement: select_without_paren  */
+#line 1294 "parser.y"
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4605 "parser.cpp"
+#line 4717 "parser.cpp"
     break;
 
-  case 144: /* select_statement: select_with_paren  */
-#line 1231 "parser.y"
+  case 151: /* select_statement: select_with_paren  */
+#line 1297 "parser.y"
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4613 "parser.cpp"
+#line 4725 "parser.cpp"
     break;
 
-  case 145: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
-#line 1234 "parser.y"
+  case 152: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
+#line 1300 "parser.y"
                                                                      {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4623,11 +4735,11 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4627 "parser.cpp"
+#line 4739 "parser.cpp"
     break;
 
-  case 146: /* select_statement: select_statement set_operator select_clause_without_modifier  */
-#line 1243 "parser.y"
+  case 153: /* select_statement: select_statement set_operator select_clause_without_modifier  */
+#line 1309 "parser.y"
                                                                {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4637,36 +4749,36 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4641 "parser.cpp"
+#line 4753 "parser.cpp"
     break;
 
-  case 147: /* select_with_paren: '(' select_without_paren ')'  */
-#line 1253 "parser.y"
+  case 154: /* select_with_paren: '(' select_without_paren ')'  */
+#line 1319 "parser.y"
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4649 "parser.cpp"
+#line 4761 "parser.cpp"
     break;
 
-  case 148: /* select_with_paren: '(' select_with_paren ')'  */
-#line 1256 "parser.y"
+  case 155: /* select_with_paren: '(' select_with_paren ')'  */
+#line 1322 "parser.y"
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4657 "parser.cpp"
+#line 4769 "parser.cpp"
     break;
 
-  case 149: /* select_without_paren: with_clause select_clause_with_modifier  */
-#line 1260 "parser.y"
+  case 156: /* select_without_paren: with_clause select_clause_with_modifier  */
+#line 1326 "parser.y"
                                                               {
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4666 "parser.cpp"
+#line 4778 "parser.cpp"
     break;
 
-  case 150: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
-#line 1265 "parser.y"
+  case 157: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
+#line 1331 "parser.y"
                                                                                                    {
     if((yyvsp[-1].expr_t) == nullptr and (yyvsp[0].expr_t) != nullptr) {
         delete (yyvsp[-3].select_stmt);
@@ -4688,27 +4800,27 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 4692 "parser.cpp"
+#line 4804 "parser.cpp"
     break;
 
-  case 151: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
-#line 1287 "parser.y"
+  case 158: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
+#line 1353 "parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4700 "parser.cpp"
+#line 4812 "parser.cpp"
     break;
 
-  case 152: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
-#line 1290 "parser.y"
+  case 159: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
+#line 1356 "parser.y"
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4708 "parser.cpp"
+#line 4820 "parser.cpp"
     break;
 
-  case 153: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
-#line 1295 "parser.y"
+  case 160: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
+#line 1361 "parser.y"
                                                                                                 {
     (yyval.select_stmt) = new infinity::SelectStatement();
     (yyval.select_stmt)->select_list_ = (yyvsp[-5].expr_array_t);
@@ -4724,245 +4836,245 @@ yyreduce:
         YYERROR;
     }
 }
-#line 4728 "parser.cpp"
+#line 4840 "parser.cpp"
     break;
 
-  case 154: /* order_by_clause: ORDER BY order_by_expr_list  */
-#line 1311 "parser.y"
+  case 161: /* order_by_clause: ORDER BY order_by_expr_list  */
+#line 1377 "parser.y"
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 4736 "parser.cpp"
+#line 4848 "parser.cpp"
     break;
 
-  case 155: /* order_by_clause: %empty  */
-#line 1314 "parser.y"
+  case 162: /* order_by_clause: %empty  */
+#line 1380 "parser.y"
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 4744 "parser.cpp"
+#line 4856 "parser.cpp"
     break;
 
-  case 156: /* order_by_expr_list: order_by_expr  */
-#line 1318 "parser.y"
+  case 163: /* order_by_expr_list: order_by_expr  */
+#line 1384 "parser.y"
                                   {
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 4753 "parser.cpp"
+#line 4865 "parser.cpp"
     break;
 
-  case 157: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
-#line 1322 "parser.y"
+  case 164: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
+#line 1388 "parser.y"
                                        {
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 4762 "parser.cpp"
+#line 4874 "parser.cpp"
     break;
 
-  case 158: /* order_by_expr: expr order_by_type  */
-#line 1327 "parser.y"
+  case 165: /* order_by_expr: expr order_by_type  */
+#line 1393 "parser.y"
                                    {
     (yyval.order_by_expr_t) = new infinity::OrderByExpr();
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 4772 "parser.cpp"
+#line 4884 "parser.cpp"
     break;
 
-  case 159: /* order_by_type: ASC  */
-#line 1333 "parser.y"
+  case 166: /* order_by_type: ASC  */
+#line 1399 "parser.y"
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4780 "parser.cpp"
+#line 4892 "parser.cpp"
     break;
 
-  case 160: /* order_by_type: DESC  */
-#line 1336 "parser.y"
+  case 167: /* order_by_type: DESC  */
+#line 1402 "parser.y"
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 4788 "parser.cpp"
+#line 4900 "parser.cpp"
     break;
 
-  case 161: /* order_by_type: %empty  */
-#line 1339 "parser.y"
+  case 168: /* order_by_type: %empty  */
+#line 1405 "parser.y"
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4796 "parser.cpp"
+#line 4908 "parser.cpp"
     break;
 
-  case 162: /* limit_expr: LIMIT expr  */
-#line 1343 "parser.y"
+  case 169: /* limit_expr: LIMIT expr  */
+#line 1409 "parser.y"
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4804 "parser.cpp"
+#line 4916 "parser.cpp"
     break;
 
-  case 163: /* limit_expr: %empty  */
-#line 1347 "parser.y"
+  case 170: /* limit_expr: %empty  */
+#line 1413 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4810 "parser.cpp"
+#line 4922 "parser.cpp"
     break;
 
-  case 164: /* offset_expr: OFFSET expr  */
-#line 1349 "parser.y"
+  case 171: /* offset_expr: OFFSET expr  */
+#line 1415 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4818 "parser.cpp"
+#line 4930 "parser.cpp"
     break;
 
-  case 165: /* offset_expr: %empty  */
-#line 1353 "parser.y"
+  case 172: /* offset_expr: %empty  */
+#line 1419 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4824 "parser.cpp"
+#line 4936 "parser.cpp"
     break;
 
-  case 166: /* distinct: DISTINCT  */
-#line 1355 "parser.y"
+  case 173: /* distinct: DISTINCT  */
+#line 1421 "parser.y"
                     {
     (yyval.bool_value) = true;
 }
-#line 4832 "parser.cpp"
+#line 4944 "parser.cpp"
     break;
 
-  case 167: /* distinct: %empty  */
-#line 1358 "parser.y"
+  case 174: /* distinct: %empty  */
+#line 1424 "parser.y"
   {
     (yyval.bool_value) = false;
 }
-#line 4840 "parser.cpp"
+#line 4952 "parser.cpp"
     break;
 
-  case 168: /* from_clause: FROM table_reference  */
-#line 1362 "parser.y"
+  case 175: /* from_clause: FROM table_reference  */
+#line 1428 "parser.y"
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4848 "parser.cpp"
+#line 4960 "parser.cpp"
     break;
 
-  case 169: /* from_clause: %empty  */
-#line 1365 "parser.y"
+  case 176: /* from_clause: %empty  */
+#line 1431 "parser.y"
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 4856 "parser.cpp"
+#line 4968 "parser.cpp"
     break;
 
-  case 170: /* search_clause: SEARCH sub_search_array  */
-#line 1369 "parser.y"
+  case 177: /* search_clause: SEARCH sub_search_array  */
+#line 1435 "parser.y"
                                        {
     infinity::SearchExpr* search_expr = new infinity::SearchExpr();
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 4866 "parser.cpp"
+#line 4978 "parser.cpp"
     break;
 
-  case 171: /* search_clause: %empty  */
-#line 1374 "parser.y"
+  case 178: /* search_clause: %empty  */
+#line 1440 "parser.y"
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 4874 "parser.cpp"
+#line 4986 "parser.cpp"
     break;
 
-  case 172: /* where_clause: WHERE expr  */
-#line 1378 "parser.y"
+  case 179: /* where_clause: WHERE expr  */
+#line 1444 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4882 "parser.cpp"
+#line 4994 "parser.cpp"
     break;
 
-  case 173: /* where_clause: %empty  */
-#line 1381 "parser.y"
+  case 180: /* where_clause: %empty  */
+#line 1447 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4890 "parser.cpp"
+#line 5002 "parser.cpp"
     break;
 
-  case 174: /* having_clause: HAVING expr  */
-#line 1385 "parser.y"
+  case 181: /* having_clause: HAVING expr  */
+#line 1451 "parser.y"
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4898 "parser.cpp"
+#line 5010 "parser.cpp"
     break;
 
-  case 175: /* having_clause: %empty  */
-#line 1388 "parser.y"
+  case 182: /* having_clause: %empty  */
+#line 1454 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4906 "parser.cpp"
+#line 5018 "parser.cpp"
     break;
 
-  case 176: /* group_by_clause: GROUP BY expr_array  */
-#line 1392 "parser.y"
+  case 183: /* group_by_clause: GROUP BY expr_array  */
+#line 1458 "parser.y"
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 4914 "parser.cpp"
+#line 5026 "parser.cpp"
     break;
 
-  case 177: /* group_by_clause: %empty  */
-#line 1395 "parser.y"
+  case 184: /* group_by_clause: %empty  */
+#line 1461 "parser.y"
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 4922 "parser.cpp"
+#line 5034 "parser.cpp"
     break;
 
-  case 178: /* set_operator: UNION  */
-#line 1399 "parser.y"
+  case 185: /* set_operator: UNION  */
+#line 1465 "parser.y"
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 4930 "parser.cpp"
+#line 5042 "parser.cpp"
     break;
 
-  case 179: /* set_operator: UNION ALL  */
-#line 1402 "parser.y"
+  case 186: /* set_operator: UNION ALL  */
+#line 1468 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 4938 "parser.cpp"
+#line 5050 "parser.cpp"
     break;
 
-  case 180: /* set_operator: INTERSECT  */
-#line 1405 "parser.y"
+  case 187: /* set_operator: INTERSECT  */
+#line 1471 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 4946 "parser.cpp"
+#line 5058 "parser.cpp"
     break;
 
-  case 181: /* set_operator: EXCEPT  */
-#line 1408 "parser.y"
+  case 188: /* set_operator: EXCEPT  */
+#line 1474 "parser.y"
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 4954 "parser.cpp"
+#line 5066 "parser.cpp"
     break;
 
-  case 182: /* table_reference: table_reference_unit  */
-#line 1416 "parser.y"
+  case 189: /* table_reference: table_reference_unit  */
+#line 1482 "parser.y"
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4962 "parser.cpp"
+#line 5074 "parser.cpp"
     break;
 
-  case 183: /* table_reference: table_reference ',' table_reference_unit  */
-#line 1419 "parser.y"
+  case 190: /* table_reference: table_reference ',' table_reference_unit  */
+#line 1485 "parser.y"
                                            {
     infinity::CrossProductReference* cross_product_ref = nullptr;
     if((yyvsp[-2].table_reference_t)->type_ == infinity::TableRefType::kCrossProduct) {
@@ -4976,11 +5088,11 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 4980 "parser.cpp"
+#line 5092 "parser.cpp"
     break;
 
-  case 186: /* table_reference_name: table_name table_alias  */
-#line 1436 "parser.y"
+  case 193: /* table_reference_name: table_name table_alias  */
+#line 1502 "parser.y"
                                               {
     infinity::TableReference* table_ref = new infinity::TableReference();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4994,32 +5106,32 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 4998 "parser.cpp"
+#line 5110 "parser.cpp"
     break;
 
-  case 187: /* table_reference_name: '(' select_statement ')' table_alias  */
-#line 1450 "parser.y"
+  case 194: /* table_reference_name: '(' select_statement ')' table_alias  */
+#line 1516 "parser.y"
                                        {
     infinity::SubqueryReference* subquery_reference = new infinity::SubqueryReference();
     subquery_reference->select_statement_ = (yyvsp[-2].select_stmt);
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 5009 "parser.cpp"
+#line 5121 "parser.cpp"
     break;
 
-  case 188: /* table_name: IDENTIFIER  */
-#line 1459 "parser.y"
+  case 195: /* table_name: IDENTIFIER  */
+#line 1525 "parser.y"
                         {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5019 "parser.cpp"
+#line 5131 "parser.cpp"
     break;
 
-  case 189: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1464 "parser.y"
+  case 196: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1530 "parser.y"
                             {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5027,84 +5139,84 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 5031 "parser.cpp"
+#line 5143 "parser.cpp"
     break;
 
-  case 190: /* table_alias: AS IDENTIFIER  */
-#line 1473 "parser.y"
+  case 197: /* table_alias: AS IDENTIFIER  */
+#line 1539 "parser.y"
                             {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5041 "parser.cpp"
+#line 5153 "parser.cpp"
     break;
 
-  case 191: /* table_alias: IDENTIFIER  */
-#line 1478 "parser.y"
+  case 198: /* table_alias: IDENTIFIER  */
+#line 1544 "parser.y"
              {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 5051 "parser.cpp"
+#line 5163 "parser.cpp"
     break;
 
-  case 192: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
-#line 1483 "parser.y"
+  case 199: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
+#line 1549 "parser.y"
                                          {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[-3].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 5062 "parser.cpp"
+#line 5174 "parser.cpp"
     break;
 
-  case 193: /* table_alias: %empty  */
-#line 1489 "parser.y"
+  case 200: /* table_alias: %empty  */
+#line 1555 "parser.y"
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 5070 "parser.cpp"
+#line 5182 "parser.cpp"
     break;
 
-  case 194: /* with_clause: WITH with_expr_list  */
-#line 1496 "parser.y"
+  case 201: /* with_clause: WITH with_expr_list  */
+#line 1562 "parser.y"
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 5078 "parser.cpp"
+#line 5190 "parser.cpp"
     break;
 
-  case 195: /* with_clause: %empty  */
-#line 1499 "parser.y"
+  case 202: /* with_clause: %empty  */
+#line 1565 "parser.y"
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 5086 "parser.cpp"
+#line 5198 "parser.cpp"
     break;
 
-  case 196: /* with_expr_list: with_expr  */
-#line 1503 "parser.y"
+  case 203: /* with_expr_list: with_expr  */
+#line 1569 "parser.y"
                           {
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 5095 "parser.cpp"
+#line 5207 "parser.cpp"
     break;
 
-  case 197: /* with_expr_list: with_expr_list ',' with_expr  */
-#line 1506 "parser.y"
+  case 204: /* with_expr_list: with_expr_list ',' with_expr  */
+#line 1572 "parser.y"
                                  {
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 5104 "parser.cpp"
+#line 5216 "parser.cpp"
     break;
 
-  case 198: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
-#line 1511 "parser.y"
+  case 205: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
+#line 1577 "parser.y"
                                                              {
     (yyval.with_expr_t) = new infinity::WithExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -5112,11 +5224,11 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 5116 "parser.cpp"
+#line 5228 "parser.cpp"
     break;
 
-  case 199: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
-#line 1523 "parser.y"
+  case 206: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
+#line 1589 "parser.y"
                                                                     {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-3].table_reference_t);
@@ -5124,11 +5236,11 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 5128 "parser.cpp"
+#line 5240 "parser.cpp"
     break;
 
-  case 200: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
-#line 1530 "parser.y"
+  case 207: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
+#line 1596 "parser.y"
                                                                    {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-5].table_reference_t);
@@ -5137,102 +5249,102 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 5141 "parser.cpp"
+#line 5253 "parser.cpp"
     break;
 
-  case 201: /* join_type: INNER  */
-#line 1544 "parser.y"
+  case 208: /* join_type: INNER  */
+#line 1610 "parser.y"
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 5149 "parser.cpp"
+#line 5261 "parser.cpp"
     break;
 
-  case 202: /* join_type: LEFT  */
-#line 1547 "parser.y"
+  case 209: /* join_type: LEFT  */
+#line 1613 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 5157 "parser.cpp"
+#line 5269 "parser.cpp"
     break;
 
-  case 203: /* join_type: RIGHT  */
-#line 1550 "parser.y"
+  case 210: /* join_type: RIGHT  */
+#line 1616 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 5165 "parser.cpp"
+#line 5277 "parser.cpp"
     break;
 
-  case 204: /* join_type: OUTER  */
-#line 1553 "parser.y"
+  case 211: /* join_type: OUTER  */
+#line 1619 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5173 "parser.cpp"
+#line 5285 "parser.cpp"
     break;
 
-  case 205: /* join_type: FULL  */
-#line 1556 "parser.y"
+  case 212: /* join_type: FULL  */
+#line 1622 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 5181 "parser.cpp"
+#line 5293 "parser.cpp"
     break;
 
-  case 206: /* join_type: CROSS  */
-#line 1559 "parser.y"
+  case 213: /* join_type: CROSS  */
+#line 1625 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 5189 "parser.cpp"
+#line 5301 "parser.cpp"
     break;
 
-  case 207: /* join_type: %empty  */
-#line 1562 "parser.y"
+  case 214: /* join_type: %empty  */
+#line 1628 "parser.y"
                 {
 }
-#line 5196 "parser.cpp"
+#line 5308 "parser.cpp"
     break;
 
-  case 208: /* show_statement: SHOW DATABASES  */
-#line 1568 "parser.y"
+  case 215: /* show_statement: SHOW DATABASES  */
+#line 1634 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 5205 "parser.cpp"
+#line 5317 "parser.cpp"
     break;
 
-  case 209: /* show_statement: SHOW TABLES  */
-#line 1572 "parser.y"
+  case 216: /* show_statement: SHOW TABLES  */
+#line 1638 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 5214 "parser.cpp"
+#line 5326 "parser.cpp"
     break;
 
-  case 210: /* show_statement: SHOW VIEWS  */
-#line 1576 "parser.y"
+  case 217: /* show_statement: SHOW VIEWS  */
+#line 1642 "parser.y"
              {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 5223 "parser.cpp"
+#line 5335 "parser.cpp"
     break;
 
-  case 211: /* show_statement: SHOW CONFIGS  */
-#line 1580 "parser.y"
+  case 218: /* show_statement: SHOW CONFIGS  */
+#line 1646 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 5232 "parser.cpp"
+#line 5344 "parser.cpp"
     break;
 
-  case 212: /* show_statement: SHOW CONFIG IDENTIFIER  */
-#line 1584 "parser.y"
+  case 219: /* show_statement: SHOW CONFIG IDENTIFIER  */
+#line 1650 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfig;
@@ -5240,71 +5352,71 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5244 "parser.cpp"
+#line 5356 "parser.cpp"
     break;
 
-  case 213: /* show_statement: SHOW PROFILES  */
-#line 1591 "parser.y"
+  case 220: /* show_statement: SHOW PROFILES  */
+#line 1657 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 5253 "parser.cpp"
+#line 5365 "parser.cpp"
     break;
 
-  case 214: /* show_statement: SHOW SESSION VARIABLES  */
-#line 1595 "parser.y"
+  case 221: /* show_statement: SHOW SESSION VARIABLES  */
+#line 1661 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariables;
 }
-#line 5262 "parser.cpp"
+#line 5374 "parser.cpp"
     break;
 
-  case 215: /* show_statement: SHOW GLOBAL VARIABLES  */
-#line 1599 "parser.y"
+  case 222: /* show_statement: SHOW GLOBAL VARIABLES  */
+#line 1665 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariables;
 }
-#line 5271 "parser.cpp"
+#line 5383 "parser.cpp"
     break;
 
-  case 216: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
-#line 1603 "parser.y"
+  case 223: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
+#line 1669 "parser.y"
                                    {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5282 "parser.cpp"
+#line 5394 "parser.cpp"
     break;
 
-  case 217: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
-#line 1609 "parser.y"
+  case 224: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
+#line 1675 "parser.y"
                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5293 "parser.cpp"
+#line 5405 "parser.cpp"
     break;
 
-  case 218: /* show_statement: SHOW DATABASE IDENTIFIER  */
-#line 1615 "parser.y"
+  case 225: /* show_statement: SHOW DATABASE IDENTIFIER  */
+#line 1681 "parser.y"
                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabase;
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5304 "parser.cpp"
+#line 5416 "parser.cpp"
     break;
 
-  case 219: /* show_statement: SHOW TABLE table_name  */
-#line 1621 "parser.y"
+  case 226: /* show_statement: SHOW TABLE table_name  */
+#line 1687 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTable;
@@ -5316,11 +5428,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5320 "parser.cpp"
+#line 5432 "parser.cpp"
     break;
 
-  case 220: /* show_statement: SHOW TABLE table_name COLUMNS  */
-#line 1632 "parser.y"
+  case 227: /* show_statement: SHOW TABLE table_name COLUMNS  */
+#line 1698 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -5332,11 +5444,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5336 "parser.cpp"
+#line 5448 "parser.cpp"
     break;
 
-  case 221: /* show_statement: SHOW TABLE table_name SEGMENTS  */
-#line 1643 "parser.y"
+  case 228: /* show_statement: SHOW TABLE table_name SEGMENTS  */
+#line 1709 "parser.y"
                                  {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -5348,11 +5460,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5352 "parser.cpp"
+#line 5464 "parser.cpp"
     break;
 
-  case 222: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
-#line 1654 "parser.y"
+  case 229: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
+#line 1720 "parser.y"
                                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegment;
@@ -5365,11 +5477,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 5369 "parser.cpp"
+#line 5481 "parser.cpp"
     break;
 
-  case 223: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
-#line 1666 "parser.y"
+  case 230: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
+#line 1732 "parser.y"
                                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlocks;
@@ -5382,11 +5494,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 5386 "parser.cpp"
+#line 5498 "parser.cpp"
     break;
 
-  case 224: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1678 "parser.y"
+  case 231: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1744 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlock;
@@ -5400,11 +5512,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 5404 "parser.cpp"
+#line 5516 "parser.cpp"
     break;
 
-  case 225: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
-#line 1691 "parser.y"
+  case 232: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
+#line 1757 "parser.y"
                                                                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlockColumn;
@@ -5419,11 +5531,11 @@ yyreduce:
     (yyval.show_stmt)->column_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-6].table_name_t);
 }
-#line 5423 "parser.cpp"
+#line 5535 "parser.cpp"
     break;
 
-  case 226: /* show_statement: SHOW TABLE table_name INDEXES  */
-#line 1705 "parser.y"
+  case 233: /* show_statement: SHOW TABLE table_name INDEXES  */
+#line 1771 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -5435,11 +5547,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5439 "parser.cpp"
+#line 5551 "parser.cpp"
     break;
 
-  case 227: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
-#line 1716 "parser.y"
+  case 234: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
+#line 1782 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndex;
@@ -5454,11 +5566,11 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5458 "parser.cpp"
+#line 5570 "parser.cpp"
     break;
 
-  case 228: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
-#line 1730 "parser.y"
+  case 235: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE  */
+#line 1796 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexSegment;
@@ -5475,11 +5587,11 @@ yyreduce:
 
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
 }
-#line 5479 "parser.cpp"
+#line 5591 "parser.cpp"
     break;
 
-  case 229: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
-#line 1746 "parser.y"
+  case 236: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER SEGMENT LONG_VALUE CHUNK LONG_VALUE  */
+#line 1812 "parser.y"
                                                                              {
       (yyval.show_stmt) = new infinity::ShowStatement();
       (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexChunk;
@@ -5497,38 +5609,38 @@ yyreduce:
       (yyval.show_stmt)->segment_id_ = (yyvsp[-2].long_value);
       (yyval.show_stmt)->chunk_id_ = (yyvsp[0].long_value);
   }
-#line 5501 "parser.cpp"
+#line 5613 "parser.cpp"
     break;
 
-  case 230: /* flush_statement: FLUSH DATA  */
-#line 1767 "parser.y"
+  case 237: /* flush_statement: FLUSH DATA  */
+#line 1833 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 5510 "parser.cpp"
+#line 5622 "parser.cpp"
     break;
 
-  case 231: /* flush_statement: FLUSH LOG  */
-#line 1771 "parser.y"
+  case 238: /* flush_statement: FLUSH LOG  */
+#line 1837 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 5519 "parser.cpp"
+#line 5631 "parser.cpp"
     break;
 
-  case 232: /* flush_statement: FLUSH BUFFER  */
-#line 1775 "parser.y"
+  case 239: /* flush_statement: FLUSH BUFFER  */
+#line 1841 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 5528 "parser.cpp"
+#line 5640 "parser.cpp"
     break;
 
-  case 233: /* optimize_statement: OPTIMIZE table_name  */
-#line 1783 "parser.y"
+  case 240: /* optimize_statement: OPTIMIZE table_name  */
+#line 1849 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5539,54 +5651,54 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5543 "parser.cpp"
+#line 5655 "parser.cpp"
     break;
 
-  case 234: /* command_statement: USE IDENTIFIER  */
-#line 1797 "parser.y"
+  case 241: /* command_statement: USE IDENTIFIER  */
+#line 1863 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5554 "parser.cpp"
+#line 5666 "parser.cpp"
     break;
 
-  case 235: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1803 "parser.y"
+  case 242: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 1869 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 5564 "parser.cpp"
+#line 5676 "parser.cpp"
     break;
 
-  case 236: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1808 "parser.y"
+  case 243: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 1874 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5575 "parser.cpp"
+#line 5687 "parser.cpp"
     break;
 
-  case 237: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1814 "parser.y"
+  case 244: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 1880 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5586 "parser.cpp"
+#line 5698 "parser.cpp"
     break;
 
-  case 238: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
-#line 1820 "parser.y"
+  case 245: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
+#line 1886 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5595,55 +5707,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5599 "parser.cpp"
+#line 5711 "parser.cpp"
     break;
 
-  case 239: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1828 "parser.y"
+  case 246: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 1894 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5610 "parser.cpp"
+#line 5722 "parser.cpp"
     break;
 
-  case 240: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 1834 "parser.y"
+  case 247: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 1900 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5621 "parser.cpp"
+#line 5733 "parser.cpp"
     break;
 
-  case 241: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 1840 "parser.y"
+  case 248: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 1906 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5632 "parser.cpp"
+#line 5744 "parser.cpp"
     break;
 
-  case 242: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 1846 "parser.y"
+  case 249: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 1912 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5643 "parser.cpp"
+#line 5755 "parser.cpp"
     break;
 
-  case 243: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
-#line 1852 "parser.y"
+  case 250: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
+#line 1918 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5652,55 +5764,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5656 "parser.cpp"
+#line 5768 "parser.cpp"
     break;
 
-  case 244: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 1860 "parser.y"
+  case 251: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 1926 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5667 "parser.cpp"
+#line 5779 "parser.cpp"
     break;
 
-  case 245: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 1866 "parser.y"
+  case 252: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 1932 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5678 "parser.cpp"
+#line 5790 "parser.cpp"
     break;
 
-  case 246: /* command_statement: SET CONFIG IDENTIFIER ON  */
-#line 1872 "parser.y"
+  case 253: /* command_statement: SET CONFIG IDENTIFIER ON  */
+#line 1938 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5689 "parser.cpp"
+#line 5801 "parser.cpp"
     break;
 
-  case 247: /* command_statement: SET CONFIG IDENTIFIER OFF  */
-#line 1878 "parser.y"
+  case 254: /* command_statement: SET CONFIG IDENTIFIER OFF  */
+#line 1944 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5700 "parser.cpp"
+#line 5812 "parser.cpp"
     break;
 
-  case 248: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
-#line 1884 "parser.y"
+  case 255: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
+#line 1950 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5709,33 +5821,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5713 "parser.cpp"
+#line 5825 "parser.cpp"
     break;
 
-  case 249: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
-#line 1892 "parser.y"
+  case 256: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
+#line 1958 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5724 "parser.cpp"
+#line 5836 "parser.cpp"
     break;
 
-  case 250: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
-#line 1898 "parser.y"
+  case 257: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
+#line 1964 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5735 "parser.cpp"
+#line 5847 "parser.cpp"
     break;
 
-  case 251: /* compact_statement: COMPACT TABLE table_name  */
-#line 1905 "parser.y"
+  case 258: /* compact_statement: COMPACT TABLE table_name  */
+#line 1971 "parser.y"
                                             {
     std::string schema_name;
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5748,38 +5860,38 @@ yyreduce:
     (yyval.compact_stmt) = new infinity::ManualCompactStatement(std::move(schema_name), std::move(table_name));
     delete (yyvsp[0].table_name_t);
 }
-#line 5752 "parser.cpp"
+#line 5864 "parser.cpp"
     break;
 
-  case 252: /* expr_array: expr_alias  */
-#line 1922 "parser.y"
+  case 259: /* expr_array: expr_alias  */
+#line 1988 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5761 "parser.cpp"
+#line 5873 "parser.cpp"
     break;
 
-  case 253: /* expr_array: expr_array ',' expr_alias  */
-#line 1926 "parser.y"
+  case 260: /* expr_array: expr_array ',' expr_alias  */
+#line 1992 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5770 "parser.cpp"
+#line 5882 "parser.cpp"
     break;
 
-  case 254: /* expr_array_list: '(' expr_array ')'  */
-#line 1931 "parser.y"
+  case 261: /* expr_array_list: '(' expr_array ')'  */
+#line 1997 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 5779 "parser.cpp"
+#line 5891 "parser.cpp"
     break;
 
-  case 255: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 1935 "parser.y"
+  case 262: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 2001 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -5795,73 +5907,81 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 5799 "parser.cpp"
+#line 5911 "parser.cpp"
     break;
 
-  case 256: /* expr_alias: expr AS IDENTIFIER  */
-#line 1962 "parser.y"
+  case 263: /* expr_alias: expr AS IDENTIFIER  */
+#line 2028 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5810 "parser.cpp"
+#line 5922 "parser.cpp"
     break;
 
-  case 257: /* expr_alias: expr  */
-#line 1968 "parser.y"
+  case 264: /* expr_alias: expr  */
+#line 2034 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5818 "parser.cpp"
+#line 5930 "parser.cpp"
     break;
 
-  case 263: /* operand: '(' expr ')'  */
-#line 1978 "parser.y"
+  case 270: /* operand: '(' expr ')'  */
+#line 2044 "parser.y"
                       {
     (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 5826 "parser.cpp"
+#line 5938 "parser.cpp"
     break;
 
-  case 264: /* operand: '(' select_without_paren ')'  */
-#line 1981 "parser.y"
+  case 271: /* operand: '(' select_without_paren ')'  */
+#line 2047 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5837 "parser.cpp"
+#line 5949 "parser.cpp"
     break;
 
-  case 265: /* operand: constant_expr  */
-#line 1987 "parser.y"
+  case 272: /* operand: constant_expr  */
+#line 2053 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 5845 "parser.cpp"
+#line 5957 "parser.cpp"
     break;
 
-  case 276: /* extra_match_tensor_option: ',' STRING  */
-#line 2001 "parser.y"
+  case 273: /* operand: '?'  */
+#line 2056 "parser.y"
+      {
+    (yyval.expr_t) = new infinity::ParameterExpr(result->parameter_count_++);
+}
+#line 5965 "parser.cpp"
+    break;
+
+  case 284: /* extra_match_tensor_option: ',' STRING  */
+#line 2070 "parser.y"
                                        {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 5853 "parser.cpp"
+#line 5973 "parser.cpp"
     break;
 
-  case 277: /* extra_match_tensor_option: %empty  */
-#line 2004 "parser.y"
+  case 285: /* extra_match_tensor_option: %empty  */
+#line 2073 "parser.y"
   {
     (yyval.str_value) = nullptr;
 }
-#line 5861 "parser.cpp"
+#line 5981 "parser.cpp"
     break;
 
-  case 278: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING extra_match_tensor_option ')'  */
-#line 2010 "parser.y"
+  case 286: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING extra_match_tensor_option ')'  */
+#line 2079 "parser.y"
                                                                                                                            {
     auto match_tensor_expr = std::make_unique<infinity::MatchTensorExpr>();
     // search column
@@ -5878,12 +5998,12 @@ yyreduce:
     }
     (yyval.expr_t) = match_tensor_expr.release();
 }
-#line 5882 "parser.cpp"
+#line 6002 "parser.cpp"
     break;
 
-  case 279: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 2029 "parser.y"
-                                                                                                                        {
+  case 287: /* match_vector_expr: MATCH VECTOR '(' expr ',' common_array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 2098 "parser.y"
+                                                                                                                               {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
 
@@ -5924,11 +6044,47 @@ Error:
 Return:
     ;
 }
-#line 5928 "parser.cpp"
+#line 6048 "parser.cpp"
     break;
 
-  case 280: /* match_sparse_expr: MATCH SPARSE '(' expr ',' sparse_array_expr ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 2073 "parser.y"
+  case 288: /* match_vector_expr: MATCH VECTOR '(' expr ',' '?' ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 2139 "parser.y"
+                                                                                               {
+    infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
+    (yyval.expr_t) = match_vector_expr;
+
+    // KNN search column
+    match_vector_expr->column_expr_ = (yyvsp[-10].expr_t);
+
+    // KNN distance type
+    ParserHelper::ToLower((yyvsp[-4].str_value));
+    bool check = match_vector_expr->InitDistanceType((yyvsp[-4].str_value));
+    free((yyvsp[-4].str_value));
+    if (!check) {
+        for (auto* param_ptr: *(yyvsp[0].with_index_param_list_t)) {
+            delete param_ptr;
+        }
+        delete (yyvsp[0].with_index_param_list_t);
+        free((yyvsp[-6].str_value));
+        delete (yyval.expr_t);
+        yyerror(&yyloc, scanner, result, "Invalid knn distance type");
+        YYERROR;
+    }
+
+    // KNN query embedding is bound on EXECUTE
+    ParserHelper::ToLower((yyvsp[-6].str_value));
+    match_vector_expr->query_parameter_type_ = (yyvsp[-6].str_value);
+    free((yyvsp[-6].str_value));
+    match_vector_expr->query_parameter_index_ = result->parameter_count_++;
+
+    match_vector_expr->topn_ = (yyvsp[-2].long_value);
+    match_vector_expr->opt_params_ = (yyvsp[0].with_index_param_list_t);
+}
+#line 6084 "parser.cpp"
+    break;
+
+  case 289: /* match_sparse_expr: MATCH SPARSE '(' expr ',' sparse_array_expr ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 2173 "parser.y"
                                                                                                                    {
     auto match_sparse_expr = new infinity::MatchSparseExpr();
     (yyval.expr_t) = match_sparse_expr;
@@ -5946,11 +6102,11 @@ Return:
     // topn and options
     match_sparse_expr->SetOptParams((yyvsp[-2].long_value), (yyvsp[0].with_index_param_list_t));
 }
-#line 5950 "parser.cpp"
+#line 6106 "parser.cpp"
     break;
 
-  case 281: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ')'  */
-#line 2091 "parser.y"
+  case 290: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ')'  */
+#line 2191 "parser.y"
                                                        {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -5959,11 +6115,11 @@ Return:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 5963 "parser.cpp"
+#line 6119 "parser.cpp"
     break;
 
-  case 282: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING ')'  */
-#line 2099 "parser.y"
+  case 291: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING ')'  */
+#line 2199 "parser.y"
                                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -5974,22 +6130,22 @@ Return:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 5978 "parser.cpp"
+#line 6134 "parser.cpp"
     break;
 
-  case 283: /* query_expr: QUERY '(' STRING ')'  */
-#line 2110 "parser.y"
+  case 292: /* query_expr: QUERY '(' STRING ')'  */
+#line 2210 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 5989 "parser.cpp"
+#line 6145 "parser.cpp"
     break;
 
-  case 284: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 2116 "parser.y"
+  case 293: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
+#line 2216 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -5998,22 +6154,22 @@ Return:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 6002 "parser.cpp"
+#line 6158 "parser.cpp"
     break;
 
-  case 285: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 2125 "parser.y"
+  case 294: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 2225 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 6013 "parser.cpp"
+#line 6169 "parser.cpp"
     break;
 
-  case 286: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 2131 "parser.y"
+  case 295: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2231 "parser.y"
                                    {
     auto fusion_expr = std::make_unique<infinity::FusionExpr>();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -6025,77 +6181,77 @@ Return:
     fusion_expr->JobAfterParser();
     (yyval.expr_t) = fusion_expr.release();
 }
-#line 6029 "parser.cpp"
+#line 6185 "parser.cpp"
     break;
 
-  case 287: /* sub_search: match_vector_expr  */
-#line 2143 "parser.y"
+  case 296: /* sub_search: match_vector_expr  */
+#line 2243 "parser.y"
                                {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6037 "parser.cpp"
+#line 6193 "parser.cpp"
     break;
 
-  case 288: /* sub_search: match_text_expr  */
-#line 2146 "parser.y"
+  case 297: /* sub_search: match_text_expr  */
+#line 2246 "parser.y"
                   {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6045 "parser.cpp"
+#line 6201 "parser.cpp"
     break;
 
-  case 289: /* sub_search: match_tensor_expr  */
-#line 2149 "parser.y"
+  case 298: /* sub_search: match_tensor_expr  */
+#line 2249 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6053 "parser.cpp"
+#line 6209 "parser.cpp"
     break;
 
-  case 290: /* sub_search: match_sparse_expr  */
-#line 2152 "parser.y"
+  case 299: /* sub_search: match_sparse_expr  */
+#line 2252 "parser.y"
                     {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6061 "parser.cpp"
+#line 6217 "parser.cpp"
     break;
 
-  case 291: /* sub_search: query_expr  */
-#line 2155 "parser.y"
+  case 300: /* sub_search: query_expr  */
+#line 2255 "parser.y"
              {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6069 "parser.cpp"
+#line 6225 "parser.cpp"
     break;
 
-  case 292: /* sub_search: fusion_expr  */
-#line 2158 "parser.y"
+  case 301: /* sub_search: fusion_expr  */
+#line 2258 "parser.y"
               {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 6077 "parser.cpp"
+#line 6233 "parser.cpp"
     break;
 
-  case 293: /* sub_search_array: sub_search  */
-#line 2162 "parser.y"
+  case 302: /* sub_search_array: sub_search  */
+#line 2262 "parser.y"
                               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 6086 "parser.cpp"
+#line 6242 "parser.cpp"
     break;
 
-  case 294: /* sub_search_array: sub_search_array ',' sub_search  */
-#line 2166 "parser.y"
+  case 303: /* sub_search_array: sub_search_array ',' sub_search  */
+#line 2266 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 6095 "parser.cpp"
+#line 6251 "parser.cpp"
     break;
 
-  case 295: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2171 "parser.y"
+  case 304: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2271 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -6104,11 +6260,11 @@ Return:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 6108 "parser.cpp"
+#line 6264 "parser.cpp"
     break;
 
-  case 296: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2179 "parser.y"
+  case 305: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2279 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -6117,11 +6273,11 @@ Return:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 6121 "parser.cpp"
+#line 6277 "parser.cpp"
     break;
 
-  case 297: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2187 "parser.y"
+  case 306: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2287 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -6131,11 +6287,11 @@ Return:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 6135 "parser.cpp"
+#line 6291 "parser.cpp"
     break;
 
-  case 298: /* function_expr: operand IS NOT NULLABLE  */
-#line 2196 "parser.y"
+  case 307: /* function_expr: operand IS NOT NULLABLE  */
+#line 2296 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -6143,11 +6299,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6147 "parser.cpp"
+#line 6303 "parser.cpp"
     break;
 
-  case 299: /* function_expr: operand IS NULLABLE  */
-#line 2203 "parser.y"
+  case 308: /* function_expr: operand IS NULLABLE  */
+#line 2303 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -6155,11 +6311,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6159 "parser.cpp"
+#line 6315 "parser.cpp"
     break;
 
-  case 300: /* function_expr: NOT operand  */
-#line 2210 "parser.y"
+  case 309: /* function_expr: NOT operand  */
+#line 2310 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -6167,11 +6323,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6171 "parser.cpp"
+#line 6327 "parser.cpp"
     break;
 
-  case 301: /* function_expr: '-' operand  */
-#line 2217 "parser.y"
+  case 310: /* function_expr: '-' operand  */
+#line 2317 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -6179,11 +6335,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6183 "parser.cpp"
+#line 6339 "parser.cpp"
     break;
 
-  case 302: /* function_expr: '+' operand  */
-#line 2224 "parser.y"
+  case 311: /* function_expr: '+' operand  */
+#line 2324 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -6191,11 +6347,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6195 "parser.cpp"
+#line 6351 "parser.cpp"
     break;
 
-  case 303: /* function_expr: operand '-' operand  */
-#line 2231 "parser.y"
+  case 312: /* function_expr: operand '-' operand  */
+#line 2331 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -6204,11 +6360,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6208 "parser.cpp"
+#line 6364 "parser.cpp"
     break;
 
-  case 304: /* function_expr: operand '+' operand  */
-#line 2239 "parser.y"
+  case 313: /* function_expr: operand '+' operand  */
+#line 2339 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -6217,11 +6373,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6221 "parser.cpp"
+#line 6377 "parser.cpp"
     break;
 
-  case 305: /* function_expr: operand '*' operand  */
-#line 2247 "parser.y"
+  case 314: /* function_expr: operand '*' operand  */
+#line 2347 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -6230,11 +6386,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6234 "parser.cpp"
+#line 6390 "parser.cpp"
     break;
 
-  case 306: /* function_expr: operand '/' operand  */
-#line 2255 "parser.y"
+  case 315: /* function_expr: operand '/' operand  */
+#line 2355 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -6243,11 +6399,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6247 "parser.cpp"
+#line 6403 "parser.cpp"
     break;
 
-  case 307: /* function_expr: operand '%' operand  */
-#line 2263 "parser.y"
+  case 316: /* function_expr: operand '%' operand  */
+#line 2363 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -6256,11 +6412,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6260 "parser.cpp"
+#line 6416 "parser.cpp"
     break;
 
-  case 308: /* function_expr: operand '=' operand  */
-#line 2271 "parser.y"
+  case 317: /* function_expr: operand '=' operand  */
+#line 2371 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -6269,11 +6425,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6273 "parser.cpp"
+#line 6429 "parser.cpp"
     break;
 
-  case 309: /* function_expr: operand EQUAL operand  */
-#line 2279 "parser.y"
+  case 318: /* function_expr: operand EQUAL operand  */
+#line 2379 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -6282,11 +6438,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6286 "parser.cpp"
+#line 6442 "parser.cpp"
     break;
 
-  case 310: /* function_expr: operand NOT_EQ operand  */
-#line 2287 "parser.y"
+  case 319: /* function_expr: operand NOT_EQ operand  */
+#line 2387 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -6295,11 +6451,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6299 "parser.cpp"
+#line 6455 "parser.cpp"
     break;
 
-  case 311: /* function_expr: operand '<' operand  */
-#line 2295 "parser.y"
+  case 320: /* function_expr: operand '<' operand  */
+#line 2395 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -6308,11 +6464,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6312 "parser.cpp"
+#line 6468 "parser.cpp"
     break;
 
-  case 312: /* function_expr: operand '>' operand  */
-#line 2303 "parser.y"
+  case 321: /* function_expr: operand '>' operand  */
+#line 2403 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -6321,11 +6477,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6325 "parser.cpp"
+#line 6481 "parser.cpp"
     break;
 
-  case 313: /* function_expr: operand LESS_EQ operand  */
-#line 2311 "parser.y"
+  case 322: /* function_expr: operand LESS_EQ operand  */
+#line 2411 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -6334,11 +6490,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6338 "parser.cpp"
+#line 6494 "parser.cpp"
     break;
 
-  case 314: /* function_expr: operand GREATER_EQ operand  */
-#line 2319 "parser.y"
+  case 323: /* function_expr: operand GREATER_EQ operand  */
+#line 2419 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -6347,11 +6503,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6351 "parser.cpp"
+#line 6507 "parser.cpp"
     break;
 
-  case 315: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2327 "parser.y"
+  case 324: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 2427 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -6382,11 +6538,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6386 "parser.cpp"
+#line 6542 "parser.cpp"
     break;
 
-  case 316: /* function_expr: operand LIKE operand  */
-#line 2357 "parser.y"
+  case 325: /* function_expr: operand LIKE operand  */
+#line 2457 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -6395,11 +6551,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6399 "parser.cpp"
+#line 6555 "parser.cpp"
     break;
 
-  case 317: /* function_expr: operand NOT LIKE operand  */
-#line 2365 "parser.y"
+  case 326: /* function_expr: operand NOT LIKE operand  */
+#line 2465 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -6408,11 +6564,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6412 "parser.cpp"
+#line 6568 "parser.cpp"
     break;
 
-  case 318: /* conjunction_expr: expr AND expr  */
-#line 2374 "parser.y"
+  case 327: /* conjunction_expr: expr AND expr  */
+#line 2474 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -6421,11 +6577,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6425 "parser.cpp"
+#line 6581 "parser.cpp"
     break;
 
-  case 319: /* conjunction_expr: expr OR expr  */
-#line 2382 "parser.y"
+  case 328: /* conjunction_expr: expr OR expr  */
+#line 2482 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -6434,11 +6590,11 @@ Return:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6438 "parser.cpp"
+#line 6594 "parser.cpp"
     break;
 
-  case 320: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2391 "parser.y"
+  case 329: /* between_expr: operand BETWEEN operand AND operand  */
+#line 2491 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -6446,44 +6602,44 @@ Return:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 6450 "parser.cpp"
+#line 6606 "parser.cpp"
     break;
 
-  case 321: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2399 "parser.y"
+  case 330: /* in_expr: operand IN '(' expr_array ')'  */
+#line 2499 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 6461 "parser.cpp"
+#line 6617 "parser.cpp"
     break;
 
-  case 322: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2405 "parser.y"
+  case 331: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 2505 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 6472 "parser.cpp"
+#line 6628 "parser.cpp"
     break;
 
-  case 323: /* case_expr: CASE expr case_check_array END  */
-#line 2412 "parser.y"
+  case 332: /* case_expr: CASE expr case_check_array END  */
+#line 2512 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6483 "parser.cpp"
+#line 6639 "parser.cpp"
     break;
 
-  case 324: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2418 "parser.y"
+  case 333: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 2518 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -6491,32 +6647,32 @@ Return:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6495 "parser.cpp"
+#line 6651 "parser.cpp"
     break;
 
-  case 325: /* case_expr: CASE case_check_array END  */
-#line 2425 "parser.y"
+  case 334: /* case_expr: CASE case_check_array END  */
+#line 2525 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6505 "parser.cpp"
+#line 6661 "parser.cpp"
     break;
 
-  case 326: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2430 "parser.y"
+  case 335: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 2530 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6516 "parser.cpp"
+#line 6672 "parser.cpp"
     break;
 
-  case 327: /* case_check_array: WHEN expr THEN expr  */
-#line 2437 "parser.y"
+  case 336: /* case_check_array: WHEN expr THEN expr  */
+#line 2537 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -6524,11 +6680,11 @@ Return:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 6528 "parser.cpp"
+#line 6684 "parser.cpp"
     break;
 
-  case 328: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2444 "parser.y"
+  case 337: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 2544 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -6536,11 +6692,11 @@ Return:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 6540 "parser.cpp"
+#line 6696 "parser.cpp"
     break;
 
-  case 329: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2452 "parser.y"
+  case 338: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 2552 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -6564,33 +6720,33 @@ Return:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 6568 "parser.cpp"
+#line 6724 "parser.cpp"
     break;
 
-  case 330: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 2476 "parser.y"
+  case 339: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 2576 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6579 "parser.cpp"
+#line 6735 "parser.cpp"
     break;
 
-  case 331: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 2482 "parser.y"
+  case 340: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 2582 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6590 "parser.cpp"
+#line 6746 "parser.cpp"
     break;
 
-  case 332: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 2488 "parser.y"
+  case 341: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 2588 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -6598,11 +6754,11 @@ Return:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6602 "parser.cpp"
+#line 6758 "parser.cpp"
     break;
 
-  case 333: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 2495 "parser.y"
+  case 342: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 2595 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -6610,11 +6766,11 @@ Return:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6614 "parser.cpp"
+#line 6770 "parser.cpp"
     break;
 
-  case 334: /* column_expr: IDENTIFIER  */
-#line 2503 "parser.y"
+  case 343: /* column_expr: IDENTIFIER  */
+#line 2603 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6622,11 +6778,11 @@ Return:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6626 "parser.cpp"
+#line 6782 "parser.cpp"
     break;
 
-  case 335: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 2510 "parser.y"
+  case 344: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 2610 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6634,21 +6790,21 @@ Return:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6638 "parser.cpp"
+#line 6794 "parser.cpp"
     break;
 
-  case 336: /* column_expr: '*'  */
-#line 2517 "parser.y"
+  case 345: /* column_expr: '*'  */
+#line 2617 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6648 "parser.cpp"
+#line 6804 "parser.cpp"
     break;
 
-  case 337: /* column_expr: column_expr '.' '*'  */
-#line 2522 "parser.y"
+  case 346: /* column_expr: column_expr '.' '*'  */
+#line 2622 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -6658,208 +6814,208 @@ Return:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6662 "parser.cpp"
+#line 6818 "parser.cpp"
     break;
 
-  case 338: /* constant_expr: STRING  */
-#line 2532 "parser.y"
+  case 347: /* constant_expr: STRING  */
+#line 2632 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6672 "parser.cpp"
+#line 6828 "parser.cpp"
     break;
 
-  case 339: /* constant_expr: TRUE  */
-#line 2537 "parser.y"
+  case 348: /* constant_expr: TRUE  */
+#line 2637 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6682 "parser.cpp"
+#line 6838 "parser.cpp"
     break;
 
-  case 340: /* constant_expr: FALSE  */
-#line 2542 "parser.y"
+  case 349: /* constant_expr: FALSE  */
+#line 2642 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6692 "parser.cpp"
+#line 6848 "parser.cpp"
     break;
 
-  case 341: /* constant_expr: DOUBLE_VALUE  */
-#line 2547 "parser.y"
+  case 350: /* constant_expr: DOUBLE_VALUE  */
+#line 2647 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6702 "parser.cpp"
+#line 6858 "parser.cpp"
     break;
 
-  case 342: /* constant_expr: LONG_VALUE  */
-#line 2552 "parser.y"
+  case 351: /* constant_expr: LONG_VALUE  */
+#line 2652 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6712 "parser.cpp"
+#line 6868 "parser.cpp"
     break;
 
-  case 343: /* constant_expr: DATE STRING  */
-#line 2557 "parser.y"
+  case 352: /* constant_expr: DATE STRING  */
+#line 2657 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6722 "parser.cpp"
+#line 6878 "parser.cpp"
     break;
 
-  case 344: /* constant_expr: TIME STRING  */
-#line 2562 "parser.y"
+  case 353: /* constant_expr: TIME STRING  */
+#line 2662 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6732 "parser.cpp"
+#line 6888 "parser.cpp"
     break;
 
-  case 345: /* constant_expr: DATETIME STRING  */
-#line 2567 "parser.y"
+  case 354: /* constant_expr: DATETIME STRING  */
+#line 2667 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6742 "parser.cpp"
+#line 6898 "parser.cpp"
     break;
 
-  case 346: /* constant_expr: TIMESTAMP STRING  */
-#line 2572 "parser.y"
+  case 355: /* constant_expr: TIMESTAMP STRING  */
+#line 2672 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6752 "parser.cpp"
+#line 6908 "parser.cpp"
     break;
 
-  case 347: /* constant_expr: INTERVAL interval_expr  */
-#line 2577 "parser.y"
+  case 356: /* constant_expr: INTERVAL interval_expr  */
+#line 2677 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6760 "parser.cpp"
+#line 6916 "parser.cpp"
     break;
 
-  case 348: /* constant_expr: interval_expr  */
-#line 2580 "parser.y"
+  case 357: /* constant_expr: interval_expr  */
+#line 2680 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6768 "parser.cpp"
+#line 6924 "parser.cpp"
     break;
 
-  case 349: /* constant_expr: common_array_expr  */
-#line 2583 "parser.y"
+  case 358: /* constant_expr: common_array_expr  */
+#line 2683 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6776 "parser.cpp"
+#line 6932 "parser.cpp"
     break;
 
-  case 350: /* common_array_expr: array_expr  */
-#line 2587 "parser.y"
+  case 359: /* common_array_expr: array_expr  */
+#line 2687 "parser.y"
                               {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6784 "parser.cpp"
+#line 6940 "parser.cpp"
     break;
 
-  case 351: /* common_array_expr: subarray_array_expr  */
-#line 2590 "parser.y"
+  case 360: /* common_array_expr: subarray_array_expr  */
+#line 2690 "parser.y"
                       {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6792 "parser.cpp"
+#line 6948 "parser.cpp"
     break;
 
-  case 352: /* common_array_expr: sparse_array_expr  */
-#line 2593 "parser.y"
+  case 361: /* common_array_expr: sparse_array_expr  */
+#line 2693 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6800 "parser.cpp"
+#line 6956 "parser.cpp"
     break;
 
-  case 353: /* common_array_expr: empty_array_expr  */
-#line 2596 "parser.y"
+  case 362: /* common_array_expr: empty_array_expr  */
+#line 2696 "parser.y"
                    {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6808 "parser.cpp"
+#line 6964 "parser.cpp"
     break;
 
-  case 354: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
-#line 2600 "parser.y"
+  case 363: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
+#line 2700 "parser.y"
                                                       {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6816 "parser.cpp"
+#line 6972 "parser.cpp"
     break;
 
-  case 355: /* unclosed_subarray_array_expr: '[' common_array_expr  */
-#line 2604 "parser.y"
+  case 364: /* unclosed_subarray_array_expr: '[' common_array_expr  */
+#line 2704 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kSubArrayArray);
     const_expr->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6826 "parser.cpp"
+#line 6982 "parser.cpp"
     break;
 
-  case 356: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
-#line 2609 "parser.y"
+  case 365: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
+#line 2709 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6835 "parser.cpp"
+#line 6991 "parser.cpp"
     break;
 
-  case 357: /* sparse_array_expr: long_sparse_array_expr  */
-#line 2614 "parser.y"
+  case 366: /* sparse_array_expr: long_sparse_array_expr  */
+#line 2714 "parser.y"
                                           {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6843 "parser.cpp"
+#line 6999 "parser.cpp"
     break;
 
-  case 358: /* sparse_array_expr: double_sparse_array_expr  */
-#line 2617 "parser.y"
+  case 367: /* sparse_array_expr: double_sparse_array_expr  */
+#line 2717 "parser.y"
                            {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6851 "parser.cpp"
+#line 7007 "parser.cpp"
     break;
 
-  case 359: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
-#line 2621 "parser.y"
+  case 368: /* long_sparse_array_expr: unclosed_long_sparse_array_expr ']'  */
+#line 2721 "parser.y"
                                                             {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6859 "parser.cpp"
+#line 7015 "parser.cpp"
     break;
 
-  case 360: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
-#line 2625 "parser.y"
+  case 369: /* unclosed_long_sparse_array_expr: '[' int_sparse_ele  */
+#line 2725 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kLongSparseArray);
     const_expr->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
@@ -6867,30 +7023,30 @@ Return:
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6871 "parser.cpp"
+#line 7027 "parser.cpp"
     break;
 
-  case 361: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
-#line 2632 "parser.y"
+  case 370: /* unclosed_long_sparse_array_expr: unclosed_long_sparse_array_expr ',' int_sparse_ele  */
+#line 2732 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->long_sparse_array_.first.emplace_back((yyvsp[0].int_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->long_sparse_array_.second.emplace_back((yyvsp[0].int_sparse_ele_t)->second);
     delete (yyvsp[0].int_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6882 "parser.cpp"
+#line 7038 "parser.cpp"
     break;
 
-  case 362: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
-#line 2639 "parser.y"
+  case 371: /* double_sparse_array_expr: unclosed_double_sparse_array_expr ']'  */
+#line 2739 "parser.y"
                                                                 {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6890 "parser.cpp"
+#line 7046 "parser.cpp"
     break;
 
-  case 363: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
-#line 2643 "parser.y"
+  case 372: /* unclosed_double_sparse_array_expr: '[' float_sparse_ele  */
+#line 2743 "parser.y"
                                                         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleSparseArray);
     const_expr->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
@@ -6898,266 +7054,266 @@ Return:
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6902 "parser.cpp"
+#line 7058 "parser.cpp"
     break;
 
-  case 364: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
-#line 2650 "parser.y"
+  case 373: /* unclosed_double_sparse_array_expr: unclosed_double_sparse_array_expr ',' float_sparse_ele  */
+#line 2750 "parser.y"
                                                          {
     (yyvsp[-2].const_expr_t)->double_sparse_array_.first.emplace_back((yyvsp[0].float_sparse_ele_t)->first);
     (yyvsp[-2].const_expr_t)->double_sparse_array_.second.emplace_back((yyvsp[0].float_sparse_ele_t)->second);
     delete (yyvsp[0].float_sparse_ele_t);
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6913 "parser.cpp"
+#line 7069 "parser.cpp"
     break;
 
-  case 365: /* empty_array_expr: '[' ']'  */
-#line 2657 "parser.y"
+  case 374: /* empty_array_expr: '[' ']'  */
+#line 2757 "parser.y"
                           {
     (yyval.const_expr_t) = new infinity::ConstantExpr(infinity::LiteralType::kEmptyArray);
 }
-#line 6921 "parser.cpp"
+#line 7077 "parser.cpp"
     break;
 
-  case 366: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
-#line 2661 "parser.y"
+  case 375: /* int_sparse_ele: LONG_VALUE ':' LONG_VALUE  */
+#line 2761 "parser.y"
                                           {
     (yyval.int_sparse_ele_t) = new std::pair<int64_t, int64_t>{(yyvsp[-2].long_value), (yyvsp[0].long_value)};
 }
-#line 6929 "parser.cpp"
+#line 7085 "parser.cpp"
     break;
 
-  case 367: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
-#line 2665 "parser.y"
+  case 376: /* float_sparse_ele: LONG_VALUE ':' DOUBLE_VALUE  */
+#line 2765 "parser.y"
                                               {
     (yyval.float_sparse_ele_t) = new std::pair<int64_t, double>{(yyvsp[-2].long_value), (yyvsp[0].double_value)};
 }
-#line 6937 "parser.cpp"
+#line 7093 "parser.cpp"
     break;
 
-  case 368: /* array_expr: long_array_expr  */
-#line 2669 "parser.y"
+  case 377: /* array_expr: long_array_expr  */
+#line 2769 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6945 "parser.cpp"
+#line 7101 "parser.cpp"
     break;
 
-  case 369: /* array_expr: double_array_expr  */
-#line 2672 "parser.y"
+  case 378: /* array_expr: double_array_expr  */
+#line 2772 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6953 "parser.cpp"
+#line 7109 "parser.cpp"
     break;
 
-  case 370: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 2676 "parser.y"
+  case 379: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 2776 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6961 "parser.cpp"
+#line 7117 "parser.cpp"
     break;
 
-  case 371: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 2680 "parser.y"
+  case 380: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 2780 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6971 "parser.cpp"
+#line 7127 "parser.cpp"
     break;
 
-  case 372: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 2685 "parser.y"
+  case 381: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 2785 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6980 "parser.cpp"
+#line 7136 "parser.cpp"
     break;
 
-  case 373: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 2690 "parser.y"
+  case 382: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 2790 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6988 "parser.cpp"
+#line 7144 "parser.cpp"
     break;
 
-  case 374: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 2694 "parser.y"
+  case 383: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 2794 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6998 "parser.cpp"
+#line 7154 "parser.cpp"
     break;
 
-  case 375: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 2699 "parser.y"
+  case 384: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 2799 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 7007 "parser.cpp"
+#line 7163 "parser.cpp"
     break;
 
-  case 376: /* interval_expr: LONG_VALUE SECONDS  */
-#line 2704 "parser.y"
+  case 385: /* interval_expr: LONG_VALUE SECONDS  */
+#line 2804 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7018 "parser.cpp"
+#line 7174 "parser.cpp"
     break;
 
-  case 377: /* interval_expr: LONG_VALUE SECOND  */
-#line 2710 "parser.y"
+  case 386: /* interval_expr: LONG_VALUE SECOND  */
+#line 2810 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7029 "parser.cpp"
+#line 7185 "parser.cpp"
     break;
 
-  case 378: /* interval_expr: LONG_VALUE MINUTES  */
-#line 2716 "parser.y"
+  case 387: /* interval_expr: LONG_VALUE MINUTES  */
+#line 2816 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7040 "parser.cpp"
+#line 7196 "parser.cpp"
     break;
 
-  case 379: /* interval_expr: LONG_VALUE MINUTE  */
-#line 2722 "parser.y"
+  case 388: /* interval_expr: LONG_VALUE MINUTE  */
+#line 2822 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7051 "parser.cpp"
+#line 7207 "parser.cpp"
     break;
 
-  case 380: /* interval_expr: LONG_VALUE HOURS  */
-#line 2728 "parser.y"
+  case 389: /* interval_expr: LONG_VALUE HOURS  */
+#line 2828 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7062 "parser.cpp"
+#line 7218 "parser.cpp"
     break;
 
-  case 381: /* interval_expr: LONG_VALUE HOUR  */
-#line 2734 "parser.y"
+  case 390: /* interval_expr: LONG_VALUE HOUR  */
+#line 2834 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7073 "parser.cpp"
+#line 7229 "parser.cpp"
     break;
 
-  case 382: /* interval_expr: LONG_VALUE DAYS  */
-#line 2740 "parser.y"
+  case 391: /* interval_expr: LONG_VALUE DAYS  */
+#line 2840 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7084 "parser.cpp"
+#line 7240 "parser.cpp"
     break;
 
-  case 383: /* interval_expr: LONG_VALUE DAY  */
-#line 2746 "parser.y"
+  case 392: /* interval_expr: LONG_VALUE DAY  */
+#line 2846 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7095 "parser.cpp"
+#line 7251 "parser.cpp"
     break;
 
-  case 384: /* interval_expr: LONG_VALUE MONTHS  */
-#line 2752 "parser.y"
+  case 393: /* interval_expr: LONG_VALUE MONTHS  */
+#line 2852 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7106 "parser.cpp"
+#line 7262 "parser.cpp"
     break;
 
-  case 385: /* interval_expr: LONG_VALUE MONTH  */
-#line 2758 "parser.y"
+  case 394: /* interval_expr: LONG_VALUE MONTH  */
+#line 2858 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7117 "parser.cpp"
+#line 7273 "parser.cpp"
     break;
 
-  case 386: /* interval_expr: LONG_VALUE YEARS  */
-#line 2764 "parser.y"
+  case 395: /* interval_expr: LONG_VALUE YEARS  */
+#line 2864 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7128 "parser.cpp"
+#line 7284 "parser.cpp"
     break;
 
-  case 387: /* interval_expr: LONG_VALUE YEAR  */
-#line 2770 "parser.y"
+  case 396: /* interval_expr: LONG_VALUE YEAR  */
+#line 2870 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 7139 "parser.cpp"
+#line 7295 "parser.cpp"
     break;
 
-  case 388: /* copy_option_list: copy_option  */
-#line 2781 "parser.y"
+  case 397: /* copy_option_list: copy_option  */
+#line 2881 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 7148 "parser.cpp"
+#line 7304 "parser.cpp"
     break;
 
-  case 389: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 2785 "parser.y"
+  case 398: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 2885 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 7157 "parser.cpp"
+#line 7313 "parser.cpp"
     break;
 
-  case 390: /* copy_option: FORMAT IDENTIFIER  */
-#line 2790 "parser.y"
+  case 399: /* copy_option: FORMAT IDENTIFIER  */
+#line 2890 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -7183,11 +7339,11 @@ Return:
         YYERROR;
     }
 }
-#line 7187 "parser.cpp"
+#line 7343 "parser.cpp"
     break;
 
-  case 391: /* copy_option: DELIMITER STRING  */
-#line 2815 "parser.y"
+  case 400: /* copy_option: DELIMITER STRING  */
+#line 2915 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -7198,53 +7354,53 @@ Return:
     }
     free((yyvsp[0].str_value));
 }
-#line 7202 "parser.cpp"
+#line 7358 "parser.cpp"
     break;
 
-  case 392: /* copy_option: HEADER  */
-#line 2825 "parser.y"
+  case 401: /* copy_option: HEADER  */
+#line 2925 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 7212 "parser.cpp"
+#line 7368 "parser.cpp"
     break;
 
-  case 393: /* file_path: STRING  */
-#line 2831 "parser.y"
+  case 402: /* file_path: STRING  */
+#line 2931 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 7220 "parser.cpp"
+#line 7376 "parser.cpp"
     break;
 
-  case 394: /* if_exists: IF EXISTS  */
-#line 2835 "parser.y"
+  case 403: /* if_exists: IF EXISTS  */
+#line 2935 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 7226 "parser.cpp"
+#line 7382 "parser.cpp"
     break;
 
-  case 395: /* if_exists: %empty  */
-#line 2836 "parser.y"
+  case 404: /* if_exists: %empty  */
+#line 2936 "parser.y"
   { (yyval.bool_value) = false; }
-#line 7232 "parser.cpp"
+#line 7388 "parser.cpp"
     break;
 
-  case 396: /* if_not_exists: IF NOT EXISTS  */
-#line 2838 "parser.y"
+  case 405: /* if_not_exists: IF NOT EXISTS  */
+#line 2938 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 7238 "parser.cpp"
+#line 7394 "parser.cpp"
     break;
 
-  case 397: /* if_not_exists: %empty  */
-#line 2839 "parser.y"
+  case 406: /* if_not_exists: %empty  */
+#line 2939 "parser.y"
   { (yyval.bool_value) = false; }
-#line 7244 "parser.cpp"
+#line 7400 "parser.cpp"
     break;
 
-  case 400: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 2854 "parser.y"
+  case 409: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 2954 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -7253,79 +7409,79 @@ Return:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7257 "parser.cpp"
+#line 7413 "parser.cpp"
     break;
 
-  case 401: /* if_not_exists_info: %empty  */
-#line 2862 "parser.y"
+  case 410: /* if_not_exists_info: %empty  */
+#line 2962 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 7265 "parser.cpp"
+#line 7421 "parser.cpp"
     break;
 
-  case 402: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 2866 "parser.y"
+  case 411: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 2966 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 7273 "parser.cpp"
+#line 7429 "parser.cpp"
     break;
 
-  case 403: /* with_index_param_list: %empty  */
-#line 2869 "parser.y"
+  case 412: /* with_index_param_list: %empty  */
+#line 2969 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 7281 "parser.cpp"
+#line 7437 "parser.cpp"
     break;
 
-  case 404: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 2873 "parser.y"
+  case 413: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 2973 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 7289 "parser.cpp"
+#line 7445 "parser.cpp"
     break;
 
-  case 405: /* optional_table_properties_list: %empty  */
-#line 2876 "parser.y"
+  case 414: /* optional_table_properties_list: %empty  */
+#line 2976 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 7297 "parser.cpp"
+#line 7453 "parser.cpp"
     break;
 
-  case 406: /* index_param_list: index_param  */
-#line 2880 "parser.y"
+  case 415: /* index_param_list: index_param  */
+#line 2980 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 7306 "parser.cpp"
+#line 7462 "parser.cpp"
     break;
 
-  case 407: /* index_param_list: index_param_list ',' index_param  */
-#line 2884 "parser.y"
+  case 416: /* index_param_list: index_param_list ',' index_param  */
+#line 2984 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 7315 "parser.cpp"
+#line 7471 "parser.cpp"
     break;
 
-  case 408: /* index_param: IDENTIFIER  */
-#line 2889 "parser.y"
+  case 417: /* index_param: IDENTIFIER  */
+#line 2989 "parser.y"
                          {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7325 "parser.cpp"
+#line 7481 "parser.cpp"
     break;
 
-  case 409: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 2894 "parser.y"
+  case 418: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 2994 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7334,11 +7490,11 @@ Return:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7338 "parser.cpp"
+#line 7494 "parser.cpp"
     break;
 
-  case 410: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 2902 "parser.y"
+  case 419: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 3002 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7346,11 +7502,11 @@ Return:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 7350 "parser.cpp"
+#line 7506 "parser.cpp"
     break;
 
-  case 411: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 2909 "parser.y"
+  case 420: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 3009 "parser.y"
                               {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7358,11 +7514,11 @@ Return:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 7362 "parser.cpp"
+#line 7518 "parser.cpp"
     break;
 
-  case 412: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2920 "parser.y"
+  case 421: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 3020 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -7411,11 +7567,11 @@ Return:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 7415 "parser.cpp"
+#line 7571 "parser.cpp"
     break;
 
-  case 413: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2968 "parser.y"
+  case 422: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 3068 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -7465,11 +7621,11 @@ Return:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 7469 "parser.cpp"
+#line 7625 "parser.cpp"
     break;
 
-  case 414: /* index_info_list: '(' identifier_array ')'  */
-#line 3017 "parser.y"
+  case 423: /* index_info_list: '(' identifier_array ')'  */
+#line 3117 "parser.y"
                            {
     infinity::IndexType index_type = infinity::IndexType::kSecondary;
     size_t index_count = (yyvsp[-1].identifier_array_t)->size();
@@ -7483,11 +7639,11 @@ Return:
     }
     delete (yyvsp[-1].identifier_array_t);
 }
-#line 7487 "parser.cpp"
+#line 7643 "parser.cpp"
     break;
 
 
-#line 7491 "parser.cpp"
+#line 7647 "parser.cpp"
 
       default: break;
     }
@@ -7716,7 +7872,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 3031 "parser.y"
+#line 3131 "parser.y"
 
 
 void
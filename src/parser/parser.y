@@ -408,6 +408,8 @@ struct SQL_LTYPE {
 %type <optimize_stmt>     optimize_statement
 %type <command_stmt>      command_statement
 %type <compact_stmt>      compact_statement
+%type <prepare_stmt>      prepare_statement
+%type <execute_stmt>      execute_statement
 
 %type <stmt_array>        statement_list
 
@@ -519,6 +521,8 @@ statement : create_statement { $$ = $1; }
 | optimize_statement { $$ = $1; }
 | command_statement { $$ = $1; }
 | compact_statement { $$ = $1; }
+| prepare_statement { $$ = $1; }
+| execute_statement { $$ = $1; }
 
 explainable_statement : create_statement { $$ = $1; }
 | drop_statement { $$ = $1; }
@@ -533,6 +537,36 @@ explainable_statement : create_statement { $$ = $1; }
 | command_statement { $$ = $1; }
 | compact_statement { $$ = $1; }
 
+/*
+ * PREPARE STATEMENT
+ */
+prepare_statement : PREPARE IDENTIFIER AS select_statement {
+    $$ = new infinity::PrepareStatement();
+    ParserHelper::ToLower($2);
+    $$->name_ = $2;
+    free($2);
+    $$->statement_ = $4;
+    $$->parameter_count_ = result->parameter_count_;
+    result->parameter_count_ = 0;
+};
+
+/*
+ * EXECUTE STATEMENT
+ */
+execute_statement : EXECUTE IDENTIFIER {
+    $$ = new infinity::ExecuteStatement();
+    ParserHelper::ToLower($2);
+    $$->name_ = $2;
+    free($2);
+}
+| EXECUTE IDENTIFIER '(' expr_array ')' {
+    $$ = new infinity::ExecuteStatement();
+    ParserHelper::ToLower($2);
+    $$->name_ = $2;
+    free($2);
+    $$->parameters_ = $4;
+};
+
 /*
  * CREATE STATEMENT
  */
@@ -803,6 +837,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | EMBEDDING '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | EMBEDDING '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | EMBEDDING '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // Element types without a keyword of their own, e.g. FLOAT16 / BFLOAT16
+    ParserHelper::ToUpper($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "FLOAT16") == 0 || strcmp($3, "F16") == 0 || strcmp($3, "HALF") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemFloat16;
+    } else if (strcmp($3, "BFLOAT16") == 0 || strcmp($3, "BF16") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemBFloat16;
+    }
+    free($3);
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unsupported embedding element type.");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 | TENSOR '(' BIT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kTensor, $5, 0, 0, infinity::kElemBit}; }
 | TENSOR '(' TINYINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kTensor, $5, 0, 0, infinity::kElemInt8}; }
 | TENSOR '(' SMALLINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kTensor, $5, 0, 0, infinity::kElemInt16}; }
@@ -827,6 +877,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | VECTOR '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | VECTOR '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | VECTOR '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| VECTOR '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // Element types without a keyword of their own, e.g. FLOAT16 / BFLOAT16
+    ParserHelper::ToUpper($3);
+    infinity::EmbeddingDataType elem_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "FLOAT16") == 0 || strcmp($3, "F16") == 0 || strcmp($3, "HALF") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemFloat16;
+    } else if (strcmp($3, "BFLOAT16") == 0 || strcmp($3, "BF16") == 0) {
+        elem_type = infinity::EmbeddingDataType::kElemBFloat16;
+    }
+    free($3);
+    if (elem_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Unsupported embedding element type.");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, elem_type};
+}
 | SPARSE '(' BIT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kSparse, $5, 0, 0, infinity::kElemBit}; }
 | SPARSE '(' TINYINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kSparse, $5, 0, 0, infinity::kElemInt8}; }
 | SPARSE '(' SMALLINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kSparse, $5, 0, 0, infinity::kElemInt16}; }
@@ -1987,6 +2053,9 @@ operand: '(' expr ')' {
 | constant_expr {
     $$ = $1;
 }
+| '?' {
+    $$ = new infinity::ParameterExpr(result->parameter_count_++);
+}
 | column_expr
 | function_expr
 | case_expr
@@ -2026,7 +2095,7 @@ match_tensor_expr : MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRIN
 
 //                  MATCH VECTOR (column_name, query_vec, data_type, metric_type, topn        )  extra options
 //                   1      2         4         6              8          10           12             14
-match_vector_expr : MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list {
+match_vector_expr : MATCH VECTOR '(' expr ',' common_array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     $$ = match_vector_expr;
 
@@ -2067,6 +2136,37 @@ Error:
 Return:
     ;
 }
+| MATCH VECTOR '(' expr ',' '?' ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list {
+    infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
+    $$ = match_vector_expr;
+
+    // KNN search column
+    match_vector_expr->column_expr_ = $4;
+
+    // KNN distance type
+    ParserHelper::ToLower($10);
+    bool check = match_vector_expr->InitDistanceType($10);
+    free($10);
+    if (!check) {
+        for (auto* param_ptr: *$14) {
+            delete param_ptr;
+        }
+        delete $14;
+        free($8);
+        delete $$;
+        yyerror(&yyloc, scanner, result, "Invalid knn distance type");
+        YYERROR;
+    }
+
+    // KNN query embedding is bound on EXECUTE
+    ParserHelper::ToLower($8);
+    match_vector_expr->query_parameter_type_ = $8;
+    free($8);
+    match_vector_expr->query_parameter_index_ = result->parameter_count_++;
+
+    match_vector_expr->topn_ = $12;
+    match_vector_expr->opt_params_ = $14;
+}
 
 //                 MATCH SPARSE (column_name, query_sparse,      metric_type,   topn)         extra options
 //                   1      2         4             6                8           10              12
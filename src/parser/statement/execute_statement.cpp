@@ -11,5 +11,20 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #include "execute_statement.h"
+
+namespace infinity {
+
+ExecuteStatement::~ExecuteStatement() {
+    if (parameters_ != nullptr) {
+        for (auto *parameter : *parameters_) {
+            delete parameter;
+        }
+        delete parameters_;
+        parameters_ = nullptr;
+    }
+}
+
+std::string ExecuteStatement::ToString() const { return "Execute " + name_; }
+
+} // namespace infinity
@@ -11,13 +11,26 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #pragma once
 
 #include "base_statement.h"
+#include "expr/parsed_expr.h"
+#include <string>
+#include <vector>
 
 namespace infinity {
 
-class ExecuteStatement : public BaseStatement {};
+// EXECUTE name [(param, ...)]
+class ExecuteStatement : public BaseStatement {
+public:
+    ExecuteStatement() : BaseStatement(StatementType::kExecute) {}
+
+    ~ExecuteStatement() override;
+
+    [[nodiscard]] std::string ToString() const final;
+
+    std::string name_{};
+    std::vector<ParsedExpr *> *parameters_{nullptr};
+};
 
 } // namespace infinity
@@ -39,6 +39,11 @@ InsertStatement::~InsertStatement() {
         delete values_;
         values_ = nullptr;
     }
+
+    if (column_data_ != nullptr) {
+        delete column_data_;
+        column_data_ = nullptr;
+    }
 }
 
 std::string InsertStatement::ToString() const { return "insert statement"; }
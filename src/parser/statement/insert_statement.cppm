@@ -21,5 +21,6 @@ export module insert_statement;
 namespace infinity {
 
 export using infinity::InsertStatement;
+export using infinity::InsertColumnData;
 
 }
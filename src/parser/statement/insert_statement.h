@@ -16,9 +16,21 @@
 
 #include "base_statement.h"
 #include "statement/select_statement.h"
+#include "type/data_type.h"
 
 namespace infinity {
 
+// Values of one column for the columnar insert, row_count_ of them packed back to back in data_ in the layout of data_type_:
+// fixed width values as they are stored (a boolean takes one byte), embeddings as dimension elements of the embedding type
+// and varchars concatenated, delimited by the row_count_ + 1 offsets in varchar_offsets_.
+struct InsertColumnData {
+    std::string column_name_{};
+    std::shared_ptr<DataType> data_type_{};
+    size_t row_count_{};
+    std::vector<char> data_{};
+    std::vector<uint32_t> varchar_offsets_{};
+};
+
 class InsertStatement final : public BaseStatement {
 public:
     InsertStatement() : BaseStatement(StatementType::kInsert) {}
@@ -33,6 +45,9 @@ public:
     std::vector<std::string> *columns_{nullptr};
     std::vector<std::vector<ParsedExpr *> *> *values_{nullptr};
 
+    // Set instead of values_ by the columnar insert
+    std::vector<InsertColumnData> *column_data_{nullptr};
+
     SelectStatement *select_{nullptr};
 };
 
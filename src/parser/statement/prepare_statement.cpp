@@ -11,5 +11,17 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #include "prepare_statement.h"
+
+namespace infinity {
+
+PrepareStatement::~PrepareStatement() {
+    if (statement_ != nullptr) {
+        delete statement_;
+        statement_ = nullptr;
+    }
+}
+
+std::string PrepareStatement::ToString() const { return "Prepare " + name_; }
+
+} // namespace infinity
@@ -11,13 +11,26 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-
 #pragma once
 
 #include "base_statement.h"
+#include <string>
 
 namespace infinity {
 
-class PrepareStatement : public BaseStatement {};
+// PREPARE name AS select_statement
+// The inner statement may contain '?' parameters, they are bound by EXECUTE.
+class PrepareStatement : public BaseStatement {
+public:
+    PrepareStatement() : BaseStatement(StatementType::kPrepare) {}
+
+    ~PrepareStatement() override;
+
+    [[nodiscard]] std::string ToString() const final;
+
+    std::string name_{};
+    BaseStatement *statement_{nullptr};
+    size_t parameter_count_{0};
+};
 
 } // namespace infinity
@@ -25,6 +25,8 @@ size_t EmbeddingType::embedding_type_width[] = {
     8, // int64
     4, // float32
     8, // double64
+    2, // float16
+    2, // bfloat16
 };
 
 void EmbeddingType::Init(const void *from_ptr, size_t size) {
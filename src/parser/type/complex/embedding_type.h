@@ -15,6 +15,8 @@
 #pragma once
 
 #include "parser_assert.h"
+#include "type/number/bfloat16.h"
+#include "type/number/float16.h"
 #include <bitset>
 #include <charconv>
 #include <cstdint>
@@ -31,6 +33,8 @@ enum EmbeddingDataType : int8_t {
     kElemInt64,
     kElemFloat,
     kElemDouble,
+    kElemFloat16,
+    kElemBFloat16,
     kElemInvalid,
 };
 
@@ -74,6 +78,16 @@ inline EmbeddingDataType ToEmbeddingDataType<double>() {
     return EmbeddingDataType::kElemDouble;
 }
 
+template <>
+inline EmbeddingDataType ToEmbeddingDataType<float16_t>() {
+    return EmbeddingDataType::kElemFloat16;
+}
+
+template <>
+inline EmbeddingDataType ToEmbeddingDataType<bfloat16_t>() {
+    return EmbeddingDataType::kElemBFloat16;
+}
+
 struct EmbeddingType {
 public:
     char *ptr{};
@@ -110,6 +124,10 @@ public:
                 return "FLOAT32";
             case kElemDouble:
                 return "FLOAT64";
+            case kElemFloat16:
+                return "FLOAT16";
+            case kElemBFloat16:
+                return "BFLOAT16";
             default: {
                 ParserError("Unexpected embedding type");
             }
@@ -132,6 +150,10 @@ public:
             return kElemFloat;
         } else if (sv == "FLOAT64" || sv == "DOUBLE" || sv == "F64") {
             return kElemDouble;
+        } else if (sv == "FLOAT16" || sv == "F16") {
+            return kElemFloat16;
+        } else if (sv == "BFLOAT16" || sv == "BF16") {
+            return kElemBFloat16;
         } else {
             ParserError("Unexpected embedding type");
         }
@@ -154,6 +176,10 @@ public:
                 return Embedding2StringInternal<float>(embedding, dimension);
             case kElemDouble:
                 return Embedding2StringInternal<double>(embedding, dimension);
+            case kElemFloat16:
+                return HalfEmbedding2StringInternal<float16_t>(embedding, dimension);
+            case kElemBFloat16:
+                return HalfEmbedding2StringInternal<bfloat16_t>(embedding, dimension);
             default: {
                 ParserError("Unexpected embedding type");
             }
@@ -187,6 +213,21 @@ private:
         return ss.str();
     }
 
+    // Half precision elements are printed through float so that they share the float32 formatting.
+    template <typename T>
+    static inline std::string HalfEmbedding2StringInternal(const EmbeddingType &embedding, size_t dimension) {
+        std::stringstream ss;
+        for (size_t i = 0; i < dimension; ++i) {
+            char buffer[20];
+            auto [ptr, ec] = std::to_chars(buffer, buffer + sizeof(buffer), float(((T *)(embedding.ptr))[i]), std::chars_format::general, 6);
+            ss.write((const char *)buffer, ptr - buffer);
+            if (i != dimension - 1) {
+                ss.put(',');
+            }
+        }
+        return ss.str();
+    }
+
     [[nodiscard]] static inline std::string BitmapEmbedding2StringInternal(const EmbeddingType &embedding, size_t dimension) {
         // TODO:  This is for bitmap, and high-performance implementation is needed here.
         ParserAssert(dimension % 8 == 0, "Binary embedding dimension should be the times of 8.");
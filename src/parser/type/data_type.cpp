@@ -417,6 +417,16 @@ std::string DataType::TypeToString<DoubleT>() {
     return "Double";
 }
 
+template <>
+std::string DataType::TypeToString<Float16T>() {
+    return "Float16";
+}
+
+template <>
+std::string DataType::TypeToString<BFloat16T>() {
+    return "BFloat16";
+}
+
 template <>
 std::string DataType::TypeToString<DecimalT>() {
     return "Decimal";
@@ -646,4 +656,14 @@ DoubleT DataType::StringToValue<DoubleT>(const std::string_view &str) {
 #endif
     return value;
 }
+
+template <>
+Float16T DataType::StringToValue<Float16T>(const std::string_view &str) {
+    return Float16T(StringToValue<FloatT>(str));
+}
+
+template <>
+BFloat16T DataType::StringToValue<BFloat16T>(const std::string_view &str) {
+    return BFloat16T(StringToValue<FloatT>(str));
+}
 } // namespace infinity
@@ -94,6 +94,7 @@ public:
             case kTime:
             case kDateTime:  // need to be converted to int64 and keep order
             case kTimestamp: // need to be converted to int64 and keep order
+            case kVarchar:   // stored as ordinals in the sorted dictionary of each chunk
             {
                 return true;
             }
@@ -238,6 +239,12 @@ std::string DataType::TypeToString<FloatT>();
 template <>
 std::string DataType::TypeToString<DoubleT>();
 
+template <>
+std::string DataType::TypeToString<Float16T>();
+
+template <>
+std::string DataType::TypeToString<BFloat16T>();
+
 template <>
 std::string DataType::TypeToString<DecimalT>();
 
@@ -328,4 +335,10 @@ FloatT DataType::StringToValue<FloatT>(const std::string_view &str_view);
 
 template <>
 DoubleT DataType::StringToValue<DoubleT>(const std::string_view &str_view);
+
+template <>
+Float16T DataType::StringToValue<Float16T>(const std::string_view &str_view);
+
+template <>
+BFloat16T DataType::StringToValue<BFloat16T>(const std::string_view &str_view);
 } // namespace infinity
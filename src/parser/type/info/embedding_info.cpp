@@ -47,6 +47,10 @@ std::string EmbeddingInfo::EmbeddingDataTypeToString(EmbeddingDataType type) {
             return "float";
         case kElemDouble:
             return "double";
+        case kElemFloat16:
+            return "float16";
+        case kElemBFloat16:
+            return "bfloat16";
         default:
             ParserError("Unexpected embedding type");
     }
@@ -30,6 +30,8 @@ export using infinity::HugeIntT;
 
 export using infinity::DoubleT;
 export using infinity::FloatT;
+export using infinity::Float16T;
+export using infinity::BFloat16T;
 
 export using infinity::DecimalT;
 
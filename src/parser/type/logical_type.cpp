@@ -263,6 +263,11 @@ LogicalType GetCommonLogicalType(const EmbeddingDataType column_type) {
         case EmbeddingDataType::kElemDouble: {
             return GetCommonLogicalType<T, double>();
         }
+        case EmbeddingDataType::kElemFloat16:
+        case EmbeddingDataType::kElemBFloat16: {
+            // half precision elements are promoted to float
+            return GetCommonLogicalType<T, float>();
+        }
         case EmbeddingDataType::kElemBit:
         case EmbeddingDataType::kElemInvalid: {
             return LogicalType::kInvalid;
@@ -290,6 +295,10 @@ LogicalType GetCommonLogicalType(const EmbeddingDataType type1, const EmbeddingD
         case EmbeddingDataType::kElemDouble: {
             return GetCommonLogicalType<double>(type2);
         }
+        case EmbeddingDataType::kElemFloat16:
+        case EmbeddingDataType::kElemBFloat16: {
+            return GetCommonLogicalType<float>(type2);
+        }
         case EmbeddingDataType::kElemBit:
         case EmbeddingDataType::kElemInvalid: {
             return LogicalType::kInvalid;
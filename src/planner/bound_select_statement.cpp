@@ -179,6 +179,10 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
             SharedPtr<LogicalMatch> match_node = MakeShared<LogicalMatch>(bind_context->GetNewLogicalNodeId(), base_table_ref, match_expr);
             match_node->filter_expression_ = filter_expr;
             match_node->common_query_filter_ = common_query_filter;
+            // A full text search has no way other than its index, it waits for the memory indexes recovered after the startup
+            if (Status status = base_table_ref->table_entry_ptr_->WaitMemIndexReady(); !status.ok()) {
+                RecoverableError(status);
+            }
             match_node->index_reader_ = base_table_ref->table_entry_ptr_->GetFullTextIndexReader(query_context->GetTxn());
 
             const Map<String, String> &column2analyzer = match_node->index_reader_.GetColumn2Analyzer();
@@ -245,6 +249,8 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildPlan(QueryContext *query_conte
         }
         for (auto &match_sparse_expr : search_expr_->match_sparse_exprs_) {
             auto match_sparse_node = MakeShared<LogicalMatchSparseScan>(bind_context->GetNewLogicalNodeId(), base_table_ref, match_sparse_expr);
+            match_sparse_node->filter_expression_ = filter_expr;
+            match_sparse_node->common_query_filter_ = common_query_filter;
             match_knn_nodes.push_back(std::move(match_sparse_node));
         }
         bind_context->GenerateTableIndex();
@@ -60,6 +60,7 @@ import status;
 import query_context;
 import logger;
 import embedding_info;
+import expression_type;
 import sparse_info;
 import parsed_expr;
 import function_expr;
@@ -76,7 +77,9 @@ import match_expr;
 import match_tensor_expr;
 import match_sparse_expr;
 import fusion_expr;
+import parameter_expr;
 import data_type;
+import default_values;
 
 import catalog;
 import table_entry;
@@ -142,6 +145,9 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildExpression(const ParsedExpr &ex
         case ParsedExprType::kSearch: {
             return BuildSearchExpr((const SearchExpr &)expr, bind_context_ptr, depth, root);
         }
+        case ParsedExprType::kParameter: {
+            return BuildParameterExpr((const ParameterExpr &)expr, bind_context_ptr, depth, root);
+        }
         default: {
             String error_message = "Unexpected expression type.";
             LOG_CRITICAL(error_message);
@@ -199,6 +205,46 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildBetweenExpr(const BetweenExpr &
     return MakeShared<FunctionExpression>(scalar_function, arguments);
 }
 
+const ConstantExpr *ExpressionBinder::GetPreparedParameter(SizeT parameter_index) const {
+    const Vector<ParsedExpr *> *parameters = query_context_->prepared_parameters();
+    if (parameters == nullptr or parameter_index >= parameters->size()) {
+        Status status = Status::SyntaxError(fmt::format("Parameter ${} isn't bound, use EXECUTE to run a prepared statement", parameter_index + 1));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    // Checked to be constant by QueryContext before the prepared statement is executed
+    return static_cast<const ConstantExpr *>((*parameters)[parameter_index]);
+}
+
+SharedPtr<BaseExpression> ExpressionBinder::BuildParameterExpr(const ParameterExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root) {
+    SharedPtr<BaseExpression> value_expr = BuildValueExpr(*GetPreparedParameter(expr.index_), bind_context_ptr, depth, root);
+    if (value_expr->type() == ExpressionType::kValue) {
+        query_context_->AddParameterExpression(expr.index_, static_cast<ValueExpression *>(value_expr.get()));
+    }
+    return value_expr;
+}
+
+bool ExpressionBinder::BuildParameterEmbedding(const ConstantExpr &query_vec,
+                                               const String &embedding_type,
+                                               KnnDistanceType distance_type,
+                                               EmbeddingDataType &data_type,
+                                               i64 &dimension,
+                                               i64 &query_count,
+                                               UniquePtr<char[]> &embedding) {
+    KnnExpr parameter_knn_expr;
+    parameter_knn_expr.distance_type_ = distance_type;
+    if (!parameter_knn_expr.InitEmbedding(embedding_type.c_str(), &query_vec) or parameter_knn_expr.embedding_data_ptr_ == nullptr) {
+        return false;
+    }
+    data_type = parameter_knn_expr.embedding_data_type_;
+    dimension = parameter_knn_expr.dimension_;
+    query_count = parameter_knn_expr.query_count_;
+    SizeT embedding_size = EmbeddingT::EmbeddingSize(data_type, dimension) * query_count;
+    embedding = MakeUniqueForOverwrite<char[]>(embedding_size);
+    std::memcpy(embedding.get(), parameter_knn_expr.embedding_data_ptr_, embedding_size);
+    return true;
+}
+
 SharedPtr<BaseExpression> ExpressionBinder::BuildValueExpr(const ConstantExpr &expr, BindContext *, i64, bool) {
     switch (expr.literal_type_) {
         case LiteralType::kInteger: {
@@ -516,7 +562,9 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     } else {
         // Searched case
@@ -529,17 +577,32 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildCaseExpr(const CaseExpr &expr,
             // SharedPtr<BaseExpression> then_expr
             SharedPtr<BaseExpression> then_expr_ptr = BuildExpression(*(when_then_expr->then_), bind_context_ptr, depth, false);
             case_expression_ptr->AddCaseCheck(when_expr_ptr, then_expr_ptr);
-            return_type.MaxDataType(then_expr_ptr->Type());
+            if (then_expr_ptr->Type().type() != LogicalType::kNull) {
+                return_type.MaxDataType(then_expr_ptr->Type());
+            }
         }
     }
     // Construct else expression
     SharedPtr<BaseExpression> else_expr_ptr;
     if (expr.else_expr_ != nullptr) {
         else_expr_ptr = BuildExpression(*expr.else_expr_, bind_context_ptr, depth, false);
-        return_type.MaxDataType(else_expr_ptr->Type());
+        if (else_expr_ptr->Type().type() != LogicalType::kNull) {
+            return_type.MaxDataType(else_expr_ptr->Type());
+        }
     } else {
         else_expr_ptr = MakeShared<ValueExpression>(Value::MakeNull());
     }
+
+    // Cast the results to the return type, then the evaluator copies the rows of each branch as they are.
+    // NULL results are left as they are, their rows are set to null.
+    for (auto &case_check : case_expression_ptr->CaseExpr()) {
+        if (case_check.then_expr_->Type().type() != LogicalType::kNull) {
+            case_check.then_expr_ = CastExpression::AddCastToType(case_check.then_expr_, return_type);
+        }
+    }
+    if (else_expr_ptr->Type().type() != LogicalType::kNull) {
+        else_expr_ptr = CastExpression::AddCastToType(else_expr_ptr, return_type);
+    }
     case_expression_ptr->AddElseExpr(else_expr_ptr);
 
     case_expression_ptr->SetReturnType(return_type);
@@ -553,10 +616,24 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildInExpr(const InExpr &expr, Bind
     Vector<SharedPtr<BaseExpression>> arguments;
     arguments.reserve(argument_count);
 
+    // Numeric operands are compared in their common type, as with "=": casting the values to the type of the left operand
+    // would round "int_col IN (1.5)" to 2 and fail on out of range values. Other values, such as a date given as a string,
+    // are cast to the type of the left operand.
+    DataType common_type = bound_left_expr->Type();
     for (SizeT idx = 0; idx < argument_count; ++idx) {
         auto bound_argument_expr = BuildExpression(*expr.arguments_->at(idx), bind_context_ptr, depth, false);
+        if (common_type.IsNumeric() && bound_argument_expr->Type().IsNumeric()) {
+            common_type.MaxDataType(bound_argument_expr->Type());
+        }
         arguments.emplace_back(bound_argument_expr);
     }
+    // All the operands have one type, so that the values are compared with the left operand in a typed set
+    bound_left_expr = CastExpression::AddCastToType(bound_left_expr, common_type);
+    for (auto &argument : arguments) {
+        if (argument->Type().type() != LogicalType::kNull) {
+            argument = CastExpression::AddCastToType(argument, common_type);
+        }
+    }
 
     InType in_type{InType::kIn};
     if (expr.not_in_) {
@@ -586,6 +663,27 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildKnnExpr(const KnnExpr &parsed_k
         RecoverableError(status);
     }
     auto expr_ptr = BuildColExpr((ColumnExpr &)*parsed_knn_expr.column_expr_, bind_context_ptr, depth, false);
+
+    EmbeddingDataType query_data_type = parsed_knn_expr.embedding_data_type_;
+    i64 query_dimension = parsed_knn_expr.dimension_;
+    i64 query_count = parsed_knn_expr.query_count_;
+    UniquePtr<char[]> parameter_embedding{};
+    if (parsed_knn_expr.query_parameter_index_ >= 0) {
+        // The query embedding of a prepared statement is given by EXECUTE
+        const ConstantExpr *query_vec = GetPreparedParameter(parsed_knn_expr.query_parameter_index_);
+        if (!BuildParameterEmbedding(*query_vec,
+                                     parsed_knn_expr.query_parameter_type_,
+                                     parsed_knn_expr.distance_type_,
+                                     query_data_type,
+                                     query_dimension,
+                                     query_count,
+                                     parameter_embedding)) {
+            Status status = Status::InvalidEmbeddingDataType();
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+    }
+
     TypeInfo *type_info = expr_ptr->Type().type_info().get();
     if (type_info == nullptr or type_info->type() != TypeInfoType::kEmbedding) {
         Status status = Status::SyntaxError("Expect the column search is an embedding column");
@@ -593,27 +691,42 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildKnnExpr(const KnnExpr &parsed_k
         RecoverableError(status);
     } else {
         EmbeddingInfo *embedding_info = (EmbeddingInfo *)type_info;
-        if ((i64)embedding_info->Dimension() != parsed_knn_expr.dimension_) {
+        if ((i64)embedding_info->Dimension() != query_dimension) {
             Status status = Status::SyntaxError(fmt::format("Query embedding with dimension: {} which doesn't not matched with {}",
-                                                            parsed_knn_expr.dimension_,
+                                                            query_dimension,
                                                             embedding_info->Dimension()));
             LOG_ERROR(status.message());
             RecoverableError(status);
         }
     }
 
+    // Each scan task outputs the results of all queries in one data block
+    if (query_count * parsed_knn_expr.topn_ > (i64)DEFAULT_BLOCK_CAPACITY) {
+        Status status = Status::InvalidParameterValue("query count",
+                                                      std::to_string(query_count),
+                                                      fmt::format("query count * topn should not exceed {}", DEFAULT_BLOCK_CAPACITY));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+
     arguments.emplace_back(expr_ptr);
 
-    // Create query embedding
-    EmbeddingT query_embedding((ptr_t)parsed_knn_expr.embedding_data_ptr_, false);
+    // Create query embedding, it owns the data only when built from a parameter
+    bool own_query_data = parameter_embedding.get() != nullptr;
+    ptr_t query_data = own_query_data ? parameter_embedding.release() : (ptr_t)parsed_knn_expr.embedding_data_ptr_;
+    EmbeddingT query_embedding(std::move(query_data), own_query_data);
 
-    SharedPtr<KnnExpression> bound_knn_expr = MakeShared<KnnExpression>(parsed_knn_expr.embedding_data_type_,
-                                                                        parsed_knn_expr.dimension_,
+    SharedPtr<KnnExpression> bound_knn_expr = MakeShared<KnnExpression>(query_data_type,
+                                                                        query_dimension,
                                                                         parsed_knn_expr.distance_type_,
                                                                         std::move(query_embedding),
                                                                         arguments,
                                                                         parsed_knn_expr.topn_,
-                                                                        parsed_knn_expr.opt_params_);
+                                                                        parsed_knn_expr.opt_params_,
+                                                                        query_count);
+    if (parsed_knn_expr.query_parameter_index_ >= 0) {
+        query_context_->AddParameterKnnExpression(parsed_knn_expr.query_parameter_index_, bound_knn_expr.get(), parsed_knn_expr.query_parameter_type_);
+    }
 
     return bound_knn_expr;
 }
@@ -35,6 +35,8 @@ import match_sparse_expr;
 import search_expr;
 import subquery_expr;
 import cast_expr;
+import parameter_expr;
+import internal_types;
 
 namespace infinity {
 
@@ -75,6 +77,17 @@ public:
 
     virtual SharedPtr<BaseExpression> BuildKnnExpr(const KnnExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root);
 
+    virtual SharedPtr<BaseExpression> BuildParameterExpr(const ParameterExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root);
+
+    // Reads the query embedding of KNN given by a parameter, false if the parameter isn't an embedding of embedding_type
+    static bool BuildParameterEmbedding(const ConstantExpr &query_vec,
+                                        const String &embedding_type,
+                                        KnnDistanceType distance_type,
+                                        EmbeddingDataType &data_type,
+                                        i64 &dimension,
+                                        i64 &query_count,
+                                        UniquePtr<char[]> &embedding);
+
     virtual SharedPtr<BaseExpression> BuildMatchTensorExpr(const MatchTensorExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root);
 
     virtual SharedPtr<BaseExpression> BuildMatchSparseExpr(const MatchSparseExpr &expr, BindContext *bind_context_ptr, i64 depth, bool root);
@@ -93,6 +106,8 @@ public:
 protected:
     Optional<SharedPtr<BaseExpression>> TryBuildSpecialFuncExpr(const FunctionExpr &expr, BindContext *bind_context_ptr, i64 depth);
 
+    const ConstantExpr *GetPreparedParameter(SizeT parameter_index) const;
+
     QueryContext *query_context_{};
 };
 
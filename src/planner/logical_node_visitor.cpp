@@ -40,6 +40,7 @@ import logical_knn_scan;
 import logical_index_scan;
 import logical_match;
 import logical_match_tensor_scan;
+import logical_match_sparse_scan;
 import aggregate_expression;
 import between_expression;
 import case_expression;
@@ -125,6 +126,11 @@ void LogicalNodeVisitor::VisitNodeExpression(LogicalNode &op) {
                 for (auto &expression : value) {
                     VisitExpression(expression);
                 }
+            for (auto &expression : node.column_defaults()) {
+                if (expression.get() != nullptr) {
+                    VisitExpression(expression);
+                }
+            }
             break;
         }
         case LogicalNodeType::kUpdate: {
@@ -156,6 +162,13 @@ void LogicalNodeVisitor::VisitNodeExpression(LogicalNode &op) {
             }
             break;
         }
+        case LogicalNodeType::kMatchSparseScan: {
+            auto &node = (LogicalMatchSparseScan &)op;
+            if (node.common_query_filter_ and node.common_query_filter_->filter_leftover_) {
+                VisitExpression(node.common_query_filter_->filter_leftover_);
+            }
+            break;
+        }
         case LogicalNodeType::kIndexScan: {
             // always keep the original expression
             break;
@@ -200,7 +200,9 @@ Status LogicalPlanner::BuildSelect(const SelectStatement *statement, SharedPtr<B
 
 Status LogicalPlanner::BuildInsert(InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     BindSchemaName(statement->schema_name_);
-    if (statement->select_ == nullptr) {
+    if (statement->column_data_ != nullptr) {
+        return BuildInsertColumns(statement, bind_context_ptr);
+    } else if (statement->select_ == nullptr) {
         return BuildInsertValue(statement, bind_context_ptr);
     } else {
         return BuildInsertSelect(statement, bind_context_ptr);
@@ -387,6 +389,151 @@ Status LogicalPlanner::BuildInsertValue(const InsertStatement *statement, Shared
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildInsertColumns(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    bind_context_ptr->expression_binder_ = MakeShared<InsertBinder>(query_context_ptr_);
+
+    const String &schema_name = statement->schema_name_;
+    const String &table_name = statement->table_name_;
+    if (table_name.empty()) {
+        String error_message = "Insert statement missing table table_name.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    Txn *txn = query_context_ptr_->GetTxn();
+    auto [table_entry, status] = txn->GetTableByName(schema_name, table_name);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+
+    if (table_entry->EntryType() == TableEntryType::kCollectionEntry) {
+        Status status = Status::NotSupport("Currently, collection isn't supported.");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+
+    if (statement->column_data_->empty() || statement->column_data_->front().row_count_ == 0) {
+        Status status = Status::SyntaxError("INSERT: No value to insert");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    SizeT row_count = statement->column_data_->front().row_count_;
+
+    // Check the column buffers and arrange them in the table column order
+    SizeT table_column_count = table_entry->ColumnCount();
+    Vector<const InsertColumnData *> column_data(table_column_count, nullptr);
+    for (const InsertColumnData &column : *statement->column_data_) {
+        SizeT column_id = table_entry->GetColumnIdByName(column.column_name_);
+        if (column_data[column_id] != nullptr) {
+            Status status = Status::DuplicateColumnName(column.column_name_);
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        if (column.row_count_ != row_count) {
+            Status status = Status::SyntaxError(
+                fmt::format("INSERT: Column {} has {} values, but column {} has {}", column.column_name_, column.row_count_, statement->column_data_->front().column_name_, row_count));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+
+        const DataType &data_type = *column.data_type_;
+        SizeT expect_size = 0;
+        switch (data_type.type()) {
+            case LogicalType::kBoolean: {
+                expect_size = row_count;
+                break;
+            }
+            case LogicalType::kTinyInt:
+            case LogicalType::kSmallInt:
+            case LogicalType::kInteger:
+            case LogicalType::kBigInt:
+            case LogicalType::kHugeInt:
+            case LogicalType::kFloat:
+            case LogicalType::kDouble:
+            case LogicalType::kDate:
+            case LogicalType::kTime:
+            case LogicalType::kDateTime:
+            case LogicalType::kTimestamp:
+            case LogicalType::kEmbedding: {
+                expect_size = row_count * data_type.Size();
+                break;
+            }
+            case LogicalType::kVarchar: {
+                if (column.varchar_offsets_.size() != row_count + 1) {
+                    Status status = Status::SyntaxError(fmt::format("INSERT: Column {} needs {} varchar offsets", column.column_name_, row_count + 1));
+                    LOG_ERROR(status.message());
+                    RecoverableError(status);
+                }
+                // The offsets delimit the values in data_, PhysicalInsert reads the values through them without checking
+                const Vector<u32> &offsets = column.varchar_offsets_;
+                for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                    if (offsets[row_idx] > offsets[row_idx + 1] || offsets[row_idx + 1] > column.data_.size()) {
+                        Status status = Status::SyntaxError(fmt::format("INSERT: Column {} has invalid varchar offsets {} and {} of row {} in {} bytes",
+                                                                        column.column_name_,
+                                                                        offsets[row_idx],
+                                                                        offsets[row_idx + 1],
+                                                                        row_idx,
+                                                                        column.data_.size()));
+                        LOG_ERROR(status.message());
+                        RecoverableError(status);
+                    }
+                }
+                expect_size = offsets.back();
+                break;
+            }
+            default: {
+                Status status = Status::NotSupport(fmt::format("Columnar insert of {} values", data_type.ToString()));
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+        }
+        if (column.data_.size() != expect_size) {
+            Status status =
+                Status::SyntaxError(fmt::format("INSERT: Column {} has {} bytes of {} values, expect {}", column.column_name_, column.data_.size(), data_type.ToString(), expect_size));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+
+        // Check that the values can be cast to the column type, the cast itself is done on the whole vector at execution
+        const SharedPtr<DataType> &table_column_type = table_entry->GetColumnDefByID(column_id)->column_type_;
+        if (data_type != *table_column_type) {
+            CastFunction::GetBoundFunc(data_type, *table_column_type);
+        }
+        column_data[column_id] = &column;
+    }
+
+    // The columns without values take the default value
+    Vector<SharedPtr<BaseExpression>> column_defaults(table_column_count);
+    for (SizeT column_idx = 0; column_idx < table_column_count; ++column_idx) {
+        if (column_data[column_idx] != nullptr) {
+            continue;
+        }
+        auto column_def = table_entry->GetColumnDefByID(column_idx);
+        if (!column_def->has_default_value()) {
+            Status status = Status::SyntaxError(fmt::format("INSERT: No value or default value for column {}", column_def->name()));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        SharedPtr<BaseExpression> value_expr =
+            bind_context_ptr->expression_binder_->BuildExpression(*column_def->default_expr_.get(), bind_context_ptr.get(), 0, true);
+        const SharedPtr<DataType> &table_column_type = column_def->column_type_;
+        DataType value_type = value_expr->Type();
+        if (value_type != *table_column_type && LogicalInsert::NeedCastInInsert(value_type, *table_column_type)) {
+            BoundCastFunc cast = CastFunction::GetBoundFunc(value_type, *table_column_type);
+            value_expr = MakeShared<CastExpression>(cast, value_expr, *table_column_type);
+        }
+        column_defaults[column_idx] = value_expr;
+    }
+
+    SharedPtr<LogicalNode> logical_insert = MakeShared<LogicalInsert>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                      table_entry,
+                                                                      bind_context_ptr->GenerateTableIndex(),
+                                                                      std::move(column_data),
+                                                                      std::move(column_defaults),
+                                                                      row_count);
+    this->logical_plan_ = logical_insert;
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildInsertSelect(const InsertStatement *, SharedPtr<BindContext> &) {
     Status status = Status::NotSupport("Not supported");
     LOG_ERROR(status.message());
@@ -61,6 +61,8 @@ public:
 
     Status BuildInsertValue(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
+    Status BuildInsertColumns(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
+
     Status BuildInsertSelect(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr);
 
     // Update operator
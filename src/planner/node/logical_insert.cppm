@@ -25,6 +25,7 @@ import base_expression;
 import table_entry;
 import internal_types;
 import data_type;
+import insert_statement;
 
 namespace infinity {
 
@@ -35,6 +36,16 @@ public:
         : LogicalNode(node_id, LogicalNodeType::kInsert), table_entry_(table_collection_ptr), value_list_(std::move(value_list)),
           table_index_(table_index){};
 
+    // Columnar insert: column_data[i] holds the values of the i-th table column, or it's nullptr and column_defaults[i] is evaluated instead.
+    explicit inline LogicalInsert(u64 node_id,
+                                  TableEntry *table_collection_ptr,
+                                  u64 table_index,
+                                  Vector<const InsertColumnData *> column_data,
+                                  Vector<SharedPtr<BaseExpression>> column_defaults,
+                                  SizeT row_count)
+        : LogicalNode(node_id, LogicalNodeType::kInsert), table_entry_(table_collection_ptr), table_index_(table_index),
+          column_data_(std::move(column_data)), column_defaults_(std::move(column_defaults)), row_count_(row_count){};
+
     [[nodiscard]] Vector<ColumnBinding> GetColumnBindings() const final;
 
     [[nodiscard]] SharedPtr<Vector<String>> GetOutputNames() const final;
@@ -57,6 +68,14 @@ public:
 
     [[nodiscard]] inline u64 table_index() const { return table_index_; }
 
+    [[nodiscard]] inline const Vector<const InsertColumnData *> &column_data() const { return column_data_; }
+
+    inline Vector<SharedPtr<BaseExpression>> &column_defaults() { return column_defaults_; }
+
+    [[nodiscard]] inline const Vector<SharedPtr<BaseExpression>> &column_defaults() const { return column_defaults_; }
+
+    [[nodiscard]] inline SizeT row_count() const { return row_count_; }
+
 public:
     static bool NeedCastInInsert(const DataType &from, const DataType &to) {
         if (from.type() == to.type()) {
@@ -75,6 +94,10 @@ private:
     TableEntry *table_entry_{};
     Vector<Vector<SharedPtr<BaseExpression>>> value_list_{};
     u64 table_index_{};
+
+    Vector<const InsertColumnData *> column_data_{};
+    Vector<SharedPtr<BaseExpression>> column_defaults_{};
+    SizeT row_count_{};
 };
 
 } // namespace infinity
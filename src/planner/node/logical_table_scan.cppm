@@ -24,6 +24,7 @@ import table_entry;
 import internal_types;
 import data_type;
 import fast_rough_filter;
+import base_expression;
 
 export module logical_table_scan;
 
@@ -51,7 +52,9 @@ public:
 
     SharedPtr<BaseTableRef> base_table_ref_{};
 
-    UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+    SharedPtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+    // The filter the evaluator is built from, kept by a prepared plan only, see FilterExpressionPushDown::CopyFilterExpression
+    SharedPtr<BaseExpression> fast_rough_filter_source_;
 
     bool add_row_id_;
 };
@@ -24,6 +24,7 @@ import logical_table_scan;
 import logical_index_scan;
 import logical_knn_scan;
 import logical_match_tensor_scan;
+import logical_match_sparse_scan;
 import logical_match;
 import query_context;
 import logical_node_visitor;
@@ -37,7 +38,8 @@ namespace infinity {
 
 class ApplyFastRoughFilterMethod {
 public:
-    inline static void VisitNode(SharedPtr<LogicalNode> &op) {
+    // keep_source: the plan of a prepared statement, the filters are built again when it's executed with other parameters
+    inline static void VisitNode(SharedPtr<LogicalNode> &op, bool keep_source) {
         if (!op) {
             return;
         }
@@ -51,38 +53,50 @@ public:
             } else if (op->left_node()->operator_type() == LogicalNodeType::kTableScan) {
                 auto &table_scan = static_cast<LogicalTableScan &>(*(op->left_node()));
                 table_scan.fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(filter_expression);
+                if (keep_source) {
+                    table_scan.fast_rough_filter_source_ = FilterExpressionPushDown::CopyFilterExpression(filter_expression);
+                }
             } else if (op->left_node()->operator_type() == LogicalNodeType::kIndexScan) {
                 // warn
                 LOG_WARN("ApplyFastRoughFilterMethod: IndexScan exist after Filter. A part of filter condition has been removed.");
                 // still build from remaining filter condition
                 auto &index_scan = static_cast<LogicalIndexScan &>(*(op->left_node()));
                 index_scan.fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(filter_expression);
+                if (keep_source) {
+                    index_scan.fast_rough_filter_source_ = FilterExpressionPushDown::CopyFilterExpression(filter_expression);
+                }
             } else {
                 LOG_WARN("ApplyFastRoughFilterMethod: Filter node should be followed by TableScan or IndexScan.");
             }
         } else if (op->operator_type() == LogicalNodeType::kKnnScan) {
             // also need to apply filter
             auto &knn_scan = static_cast<LogicalKnnScan &>(*op);
-            knn_scan.common_query_filter_->TryApplyFastRoughFilterOptimizer();
+            knn_scan.common_query_filter_->TryApplyFastRoughFilterOptimizer(keep_source);
         } else if (op->operator_type() == LogicalNodeType::kMatch) {
             // also need to apply filter
             auto &match = static_cast<LogicalMatch &>(*op);
-            match.common_query_filter_->TryApplyFastRoughFilterOptimizer();
+            match.common_query_filter_->TryApplyFastRoughFilterOptimizer(keep_source);
         } else if (op->operator_type() == LogicalNodeType::kMatchTensorScan) {
             // also need to apply filter
             auto &matchtensor = static_cast<LogicalMatchTensorScan &>(*op);
-            matchtensor.common_query_filter_->TryApplyFastRoughFilterOptimizer();
+            matchtensor.common_query_filter_->TryApplyFastRoughFilterOptimizer(keep_source);
+        } else if (op->operator_type() == LogicalNodeType::kMatchSparseScan) {
+            // also need to apply filter
+            auto &match_sparse = static_cast<LogicalMatchSparseScan &>(*op);
+            match_sparse.common_query_filter_->TryApplyFastRoughFilterOptimizer(keep_source);
         } else if (op->operator_type() == LogicalNodeType::kIndexScan) {
             String error_message = "ApplyFastRoughFilterMethod: IndexScan optimizer should not happen before ApplyFastRoughFilter optimizer.";
             LOG_CRITICAL(error_message);
             UnrecoverableError(error_message);
         }
         // visit children after handling current node
-        VisitNode(op->left_node());
-        VisitNode(op->right_node());
+        VisitNode(op->left_node(), keep_source);
+        VisitNode(op->right_node(), keep_source);
     }
 };
 
-void ApplyFastRoughFilter::ApplyToPlan(QueryContext *, SharedPtr<LogicalNode> &logical_plan) { ApplyFastRoughFilterMethod::VisitNode(logical_plan); }
+void ApplyFastRoughFilter::ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) {
+    ApplyFastRoughFilterMethod::VisitNode(logical_plan, query_context_ptr->executing_prepared());
+}
 
 } // namespace infinity
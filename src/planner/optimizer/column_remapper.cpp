@@ -49,6 +49,7 @@ void BindingRemapper::VisitNode(LogicalNode &op) {
         case LogicalNodeType::kJoin:
         case LogicalNodeType::kMatch:
         case LogicalNodeType::kMatchTensorScan:
+        case LogicalNodeType::kMatchSparseScan:
         case LogicalNodeType::kKnnScan: {
             VisitNodeChildren(op);
             bindings_ = op.GetColumnBindings();
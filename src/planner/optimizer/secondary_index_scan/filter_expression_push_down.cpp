@@ -36,6 +36,7 @@ import scalar_function_set;
 import cast_expression;
 import column_expression;
 import value_expression;
+import in_expression;
 import secondary_index_scan_execute_expression;
 import index_base;
 import table_index_entry;
@@ -46,6 +47,8 @@ import value;
 import column_vector;
 import filter_expression_push_down_helper;
 import table_index_meta;
+import min_max_data_filter;
+import like;
 
 namespace infinity {
 
@@ -255,6 +258,10 @@ private:
         TxnTimeStamp begin_ts = query_context_->GetTxn()->BeginTS();
 
         auto &table_entry = base_table_ref_.table_entry_ptr_;
+        if (!table_entry->MemIndexReady()) {
+            // The memory indexes are recovered after the startup, the filter is evaluated on the blocks until then
+            return;
+        }
         {
             auto map_guard = table_entry->IndexMetaMap();
             for (auto &[index_name, table_index_meta] : *map_guard) {
@@ -293,7 +300,9 @@ private:
     inline SharedPtr<BaseExpression> RewriteForIndexScan(const SharedPtr<BaseExpression> &expression) {
         // case 1. expression is a scalar expression containing only one column and the column has a secondary index
         // case 2. expression is an "and" or "or" expression, and each child expression can be applied to the index scan (recursive check)
-        // now we do not support "not" expression in index scan
+        // case 3. expression is an "in" expression on a column with a secondary index
+        // case 4. expression is a "like" expression with a prefix pattern on a varchar column with a secondary index
+        // case 5. expression is a "not" expression, and the child expression can be applied to the index scan (recursive check)
         if (expression->type() == ExpressionType::kFunction) {
             auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
             if (auto const &f_name = function_expression->ScalarFunctionName(); f_name == "AND" or f_name == "OR") {
@@ -318,14 +327,24 @@ private:
                 arguments.emplace_back(std::move(right_arg));
                 return MakeShared<FunctionExpression>(function_expression->func_, std::move(arguments));
             } else if (f_name == "NOT") {
-                LOG_TRACE(fmt::format("Unsupported expression type: In CanApplyIndexScan(), the expression {} is a \"not\" function expression. "
-                                      "Now we do not support not expression in index scan.",
-                                      expression->Name()));
-                return nullptr;
+                // case 5.
+                auto arg = RewriteForIndexScan(expression->arguments()[0]);
+                if (!arg) {
+                    return nullptr;
+                }
+                Vector<SharedPtr<BaseExpression>> arguments;
+                arguments.emplace_back(std::move(arg));
+                return MakeShared<FunctionExpression>(function_expression->func_, std::move(arguments));
+            } else if (f_name == "like") {
+                // case 4.
+                return RewriteLikeForIndexScan(function_expression);
             } else {
                 // case 1.
                 return CheckExprIndexStateAndRewrite(expression, 0);
             }
+        } else if (expression->type() == ExpressionType::kIn) {
+            // case 3.
+            return RewriteInForIndexScan(std::static_pointer_cast<InExpression>(expression));
         } else if (expression->type() == ExpressionType::kValue) {
             LOG_TRACE(fmt::format("Unsupported expression type: In CanApplyIndexScan(), the expression \"{}\" is a value expression. "
                                   "Need to apply the expression rewrite optimizer first.",
@@ -337,6 +356,133 @@ private:
         }
     }
 
+    inline bool IsColumnWithIndex(const SharedPtr<BaseExpression> &expr, u32 depth) const {
+        if (!(expr->Type().CanBuildSecondaryIndex())) {
+            // Unsupported type
+            LOG_TRACE(fmt::format("Expression depth: {}. In is_column_index(), unsupported column value type {}. Expression: {}.",
+                                  depth,
+                                  expr->Type().ToString(),
+                                  expr->Name()));
+            return false;
+        }
+        auto column_expression = std::static_pointer_cast<ColumnExpression>(expr);
+        auto column_id = column_expression->binding().column_idx;
+        if (candidate_column_index_map_.contains(column_id)) {
+            LOG_TRACE(fmt::format("Expression depth: {}. Column {} has index.", depth, expr->Name()));
+            return true;
+        } else {
+            LOG_TRACE(
+                fmt::format("Expression depth: {}. Column {} does not have a secondary index. Cannot apply index scan.", depth, expr->Name()));
+            return false;
+        }
+    }
+
+    // case 3. expression is "[cast] x [NOT] IN (value_expression, ...)" and the column x has a secondary index.
+    // It is rewritten into "x = v1 OR x = v2 OR ...", so that the index scan unions one range lookup per value, and "NOT IN" into its "NOT".
+    inline SharedPtr<BaseExpression> RewriteInForIndexScan(const SharedPtr<InExpression> &in_expression) {
+        const bool not_in = in_expression->in_type() != InType::kIn;
+        auto is_column_index = [this](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool { return IsColumnWithIndex(expr, depth); };
+        const SharedPtr<BaseExpression> &left_operand = in_expression->left_operand();
+        if (!IsValidColumnExpression(left_operand, 1, is_column_index)) {
+            return nullptr;
+        }
+        auto equal_function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "=");
+        auto equal_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(equal_function_set_ptr);
+        Vector<SharedPtr<BaseExpression>> equal_expressions;
+        equal_expressions.reserve(in_expression->arguments().size());
+        for (const auto &value_expression : in_expression->arguments()) {
+            if (value_expression->Type().type() == LogicalType::kNull) {
+                if (not_in) {
+                    // "NOT IN" a list with a NULL value never selects a row, leave it to the filter
+                    return nullptr;
+                }
+                // a NULL value never selects a row
+                continue;
+            }
+            if (!IsValueResultExpression(value_expression, 1)) {
+                return nullptr;
+            }
+            Vector<SharedPtr<BaseExpression>> arguments{left_operand, value_expression};
+            ScalarFunction equal_func = equal_scalar_function_set_ptr->GetMostMatchFunction(arguments);
+            equal_expressions.emplace_back(MakeShared<FunctionExpression>(std::move(equal_func), std::move(arguments)));
+        }
+        if (equal_expressions.empty()) {
+            return nullptr;
+        }
+        auto or_function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "OR");
+        auto or_scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(or_function_set_ptr);
+        auto or_expression = BuildOrTree(equal_expressions, 0, equal_expressions.size(), or_scalar_function_set_ptr);
+        if (!not_in) {
+            return or_expression;
+        }
+        auto not_function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "NOT");
+        Vector<SharedPtr<BaseExpression>> arguments{std::move(or_expression)};
+        ScalarFunction not_func = static_pointer_cast<ScalarFunctionSet>(not_function_set_ptr)->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(not_func), std::move(arguments));
+    }
+
+    // case 4. expression is "x like pattern_expression", the column x is varchar and has a secondary index.
+    // 'abc' is rewritten into "x = 'abc'", and 'abc%' into "x >= 'abc' AND x < 'abd'". Other patterns can't be answered by the index alone.
+    inline SharedPtr<BaseExpression> RewriteLikeForIndexScan(const SharedPtr<FunctionExpression> &like_expression) {
+        const SharedPtr<BaseExpression> &column_expression = like_expression->arguments()[0];
+        SharedPtr<BaseExpression> pattern_expression = like_expression->arguments()[1];
+        if (column_expression->type() != ExpressionType::kColumn or column_expression->Type().type() != LogicalType::kVarchar or
+            !IsColumnWithIndex(column_expression, 1) or !IsValueResultExpression(pattern_expression, 1)) {
+            return nullptr;
+        }
+        auto pattern = FilterExpressionPushDownHelper::CalcValueResult(pattern_expression);
+        if (pattern.type().type() != LogicalType::kVarchar) {
+            return nullptr;
+        }
+        LikeMatcher matcher(pattern.GetVarchar());
+        const String &prefix = matcher.LiteralPrefix();
+        if (matcher.kind() == LikeMatcherKind::kExact) {
+            return MakeCompareExpression("=", column_expression, prefix);
+        }
+        if (matcher.kind() != LikeMatcherKind::kPrefix or prefix.empty()) {
+            LOG_TRACE(fmt::format("Unsupported expression type: In RewriteLikeForIndexScan(), {} is not a prefix pattern.", like_expression->Name()));
+            return nullptr;
+        }
+        auto lower_expression = MakeCompareExpression(">=", column_expression, prefix);
+        // the strings starting with the prefix are less than the prefix with its last byte below 0xff incremented
+        String upper = prefix;
+        while (!upper.empty() and static_cast<u8>(upper.back()) == 0xff) {
+            upper.pop_back();
+        }
+        if (upper.empty()) {
+            return lower_expression;
+        }
+        upper.back() = static_cast<char>(static_cast<u8>(upper.back()) + 1);
+        Vector<SharedPtr<BaseExpression>> arguments;
+        arguments.emplace_back(std::move(lower_expression));
+        arguments.emplace_back(MakeCompareExpression("<", column_expression, upper));
+        auto and_function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), "AND");
+        ScalarFunction and_func = static_pointer_cast<ScalarFunctionSet>(and_function_set_ptr)->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(and_func), std::move(arguments));
+    }
+
+    inline SharedPtr<BaseExpression>
+    MakeCompareExpression(const String &function_name, const SharedPtr<BaseExpression> &column_expression, const String &value) const {
+        auto function_set_ptr = Catalog::GetFunctionSetByName(query_context_->storage()->catalog(), function_name);
+        Vector<SharedPtr<BaseExpression>> arguments{column_expression, MakeShared<ValueExpression>(Value::MakeVarchar(value))};
+        ScalarFunction func = static_pointer_cast<ScalarFunctionSet>(function_set_ptr)->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(func), std::move(arguments));
+    }
+
+    // balanced, to keep the recursion of the index scan command builder shallow for long IN lists
+    static SharedPtr<BaseExpression>
+    BuildOrTree(Vector<SharedPtr<BaseExpression>> &expressions, SizeT begin, SizeT end, const SharedPtr<ScalarFunctionSet> &or_function_set) {
+        if (end - begin == 1) {
+            return std::move(expressions[begin]);
+        }
+        SizeT middle = begin + (end - begin) / 2;
+        Vector<SharedPtr<BaseExpression>> arguments;
+        arguments.emplace_back(BuildOrTree(expressions, begin, middle, or_function_set));
+        arguments.emplace_back(BuildOrTree(expressions, middle, end, or_function_set));
+        ScalarFunction or_func = or_function_set->GetMostMatchFunction(arguments);
+        return MakeShared<FunctionExpression>(std::move(or_func), std::move(arguments));
+    }
+
     // case 1. expression needs to be in the form of "[cast] x compare value_expression" and the column x should have a secondary index.
     inline SharedPtr<BaseExpression> CheckExprIndexStateAndRewrite(const SharedPtr<BaseExpression> &expression, u32 sub_expr_depth) {
         // TODO: now do not support "!=" in index scan
@@ -361,26 +507,8 @@ private:
                         UnrecoverableError(error_message);
                         return nullptr;
                     }
-                    auto is_column_index = [&m = candidate_column_index_map_](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool {
-                        if (!(expr->Type().CanBuildSecondaryIndex())) {
-                            // Unsupported type
-                            LOG_TRACE(fmt::format("Expression depth: {}. In is_column_index(), unsupported column value type {}. Expression: {}.",
-                                                  depth,
-                                                  expr->Type().ToString(),
-                                                  expr->Name()));
-                            return false;
-                        }
-                        auto column_expression = std::static_pointer_cast<ColumnExpression>(expr);
-                        auto column_id = column_expression->binding().column_idx;
-                        if (m.contains(column_id)) {
-                            LOG_TRACE(fmt::format("Expression depth: {}. Column {} has index.", depth, expr->Name()));
-                            return true;
-                        } else {
-                            LOG_TRACE(fmt::format("Expression depth: {}. Column {} does not have a secondary index. Cannot apply index scan.",
-                                                  depth,
-                                                  expr->Name()));
-                            return false;
-                        }
+                    auto is_column_index = [this](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool {
+                        return IsColumnWithIndex(expr, depth);
                     };
                     if (HaveLeftColumnAndRightValue(function_expression, sub_expr_depth + 1, is_column_index)) {
                         return expression;
@@ -483,10 +611,7 @@ private:
                 return AddIndexForBooleanExpression(expression->arguments()[0]) and AddIndexForBooleanExpression(expression->arguments()[1]);
             } else if (f_name == "NOT") {
                 // recursive check
-                String error_message = "Error when trying to apply index scan on \"NOT\" expression: need to be excluded early.";
-                LOG_CRITICAL(error_message);
-                UnrecoverableError(error_message);
-                return false;
+                return AddIndexForBooleanExpression(expression->arguments()[0]);
             } else {
                 // compare function "[cast] x compare value_expr"
                 // check left argument
@@ -607,6 +732,7 @@ public:
         // known expression 1: "[cast] x equal value_expr" for ProbabilisticDataFilter, also need to build a val <= x <= val filter for MinMaxFilter
         // known expression 2: "[cast] x compare (>, <, >=, <=) value_expr" for MinMaxFilter
         // known expression 3 : "and" or "or" expression
+        // known expression 4: "x like pattern_expr" for MinMaxFilter, when the pattern starts with literal bytes
         switch (expression->type()) {
             case ExpressionType::kFunction: {
                 static constexpr std::array<const char *, 4> Case2FunctionNames = {"<", ">", "<=", ">="};
@@ -759,6 +885,26 @@ public:
                         // unknown expression
                         return ReturnAlwaysTrue();
                     }
+                } else if (f_name == "like") {
+                    // maybe known expression 4
+                    auto is_valid_column = [](const SharedPtr<BaseExpression> &expr, u32 depth) -> bool {
+                        if (expr->Type().type() == LogicalType::kVarchar and expr->Type().SupportMinMaxFilter()) {
+                            return true;
+                        } else {
+                            LOG_TRACE(fmt::format("Expression depth: {}. column value type {} does not support LIKE prefix filter. Expression: {}.",
+                                                  depth,
+                                                  expr->Type().ToString(),
+                                                  expr->Name()));
+                            return false;
+                        }
+                    };
+                    if (FilterExpressionPushDownMethodBase::HaveLeftColumnAndRightValue(function_expression, sub_expr_depth + 1, is_valid_column)) {
+                        // known expression 4
+                        return SolveForLikePrefix(expression->arguments()[0], expression->arguments()[1]);
+                    } else {
+                        // unknown expression
+                        return ReturnAlwaysTrue();
+                    }
                 } else if (FilterExpressionPushDownMethodBase::IsValueResultExpression(expression, sub_expr_depth + 1)) {
                     return ReturnValue(expression, sub_expr_depth);
                 } else {
@@ -777,6 +923,30 @@ public:
         }
     }
 
+private:
+    // known expression 4: "x like pattern_expr" where the pattern starts with literal bytes, e.g. 'abc%' or 'abc_d%e'.
+    // Every match is in the range ['abc', 'abc' followed by max bytes], the upper bound being long enough for the truncated min max values.
+    static inline UniquePtr<FastRoughFilterEvaluator> SolveForLikePrefix(SharedPtr<BaseExpression> &col_expr, SharedPtr<BaseExpression> &pattern_expr) {
+        auto pattern = FilterExpressionPushDownHelper::CalcValueResult(pattern_expr);
+        if (pattern.type().type() != LogicalType::kVarchar) {
+            return ReturnAlwaysTrue();
+        }
+        String prefix = LikeMatcher(pattern.GetVarchar()).LiteralPrefix();
+        if (prefix.empty()) {
+            return ReturnAlwaysTrue();
+        }
+        String prefix_upper = prefix + String(InnerMinMaxDataFilterVarcharType::INNER_STORED_LENGTH, static_cast<char>(0xff));
+        auto [column_id, value, compare_type] =
+            FilterExpressionPushDownHelper::UnwindCast(col_expr, Value::MakeVarchar(prefix), FilterCompareType::kGreaterEqual);
+        if (compare_type != FilterCompareType::kGreaterEqual) {
+            return ReturnAlwaysTrue();
+        }
+        auto minmax_filter_ge = MakeUnique<FastRoughFilterEvaluatorMinMaxFilter>(column_id, std::move(value), FilterCompareType::kGreaterEqual);
+        auto minmax_filter_le =
+            MakeUnique<FastRoughFilterEvaluatorMinMaxFilter>(column_id, Value::MakeVarchar(prefix_upper), FilterCompareType::kLessEqual);
+        return MakeUnique<FastRoughFilterEvaluatorCombineAnd>(std::move(minmax_filter_ge), std::move(minmax_filter_le));
+    }
+
 private:
     static inline UniquePtr<FastRoughFilterEvaluator> ReturnAlwaysTrue() { return MakeUnique<FastRoughFilterEvaluatorTrue>(); }
 
@@ -803,4 +973,33 @@ UniquePtr<FastRoughFilterEvaluator> FilterExpressionPushDown::PushDownToFastRoug
     return FastRoughFilterExpressionPushDownMethod::SolveForFastRoughFilter(expression);
 }
 
+SharedPtr<BaseExpression> FilterExpressionPushDown::CopyFilterExpression(const SharedPtr<BaseExpression> &expression) {
+    if (!expression) {
+        return nullptr;
+    }
+    Vector<SharedPtr<BaseExpression>> arguments;
+    arguments.reserve(expression->arguments().size());
+    for (const auto &argument : expression->arguments()) {
+        arguments.push_back(CopyFilterExpression(argument));
+    }
+    switch (expression->type()) {
+        case ExpressionType::kFunction: {
+            const auto &function_expression = static_cast<const FunctionExpression &>(*expression);
+            return MakeShared<FunctionExpression>(function_expression.func_, std::move(arguments));
+        }
+        case ExpressionType::kCast: {
+            const auto &cast_expression = static_cast<const CastExpression &>(*expression);
+            return MakeShared<CastExpression>(cast_expression.func_, arguments[0], cast_expression.Type());
+        }
+        case ExpressionType::kIn: {
+            const auto &in_expression = static_cast<const InExpression &>(*expression);
+            return MakeShared<InExpression>(in_expression.in_type(), CopyFilterExpression(in_expression.left_operand()), arguments);
+        }
+        default: {
+            // Not looked into by the push down, or a leaf
+            return expression;
+        }
+    }
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -29,8 +29,6 @@ namespace infinity {
 
 // TODO: equivalent expression rewrite optimization
 
-// TODO: now do not support "not" expression in index scan
-
 export struct IndexScanFilterExpressionPushDownResult {
     IndexScanFilterExpressionPushDownResult(HashMap<ColumnID, TableIndexEntry *> &&column_index_map,
                                             SharedPtr<BaseExpression> &&index_filter_qualified,
@@ -50,6 +48,11 @@ public:
     PushDownToIndexScan(QueryContext *query_context, const BaseTableRef &base_table_ref, const SharedPtr<BaseExpression> &expression);
 
     static UniquePtr<FastRoughFilterEvaluator> PushDownToFastRoughFilter(SharedPtr<BaseExpression> &expression);
+
+    // Copies the function, cast and in nodes of the filter, the columns and the values are shared.
+    // The column remapper replaces the columns in the argument lists of the plan, the copy keeps them so that the pushed down
+    // filter can be built again after the values of a prepared plan are overwritten.
+    static SharedPtr<BaseExpression> CopyFilterExpression(const SharedPtr<BaseExpression> &expression);
 };
 
 } // namespace infinity
\ No newline at end of file
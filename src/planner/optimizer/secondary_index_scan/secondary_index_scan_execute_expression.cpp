@@ -35,8 +35,8 @@ concept IncompatibleFilterIntervalRangePair = (not std::same_as<T1, T2>) or std:
 
 class FilterCommandBuilder {
 private:
-    // filter_evaluator_ only contain FilterCompareType of kEqual, kLessEqual, kGreaterEqual, kAlwaysFalse, kAlwaysTrue
-    // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr
+    // filter_evaluator_ only contain FilterCompareType of kEqual, kLessEqual, kGreaterEqual, kAlwaysFalse, kAlwaysTrue, and kLess for varchar
+    // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr, kNot
     const Vector<FilterEvaluatorElem> &filter_evaluator_;
     Vector<FilterExecuteElem> result_;
 
@@ -82,6 +82,10 @@ private:
                 result.SetIntervalRange<TimestampT>(value, compare_type);
                 break;
             }
+            case LogicalType::kVarchar: {
+                result.SetIntervalRange<VarcharT>(value, compare_type);
+                break;
+            }
             default: {
                 String error_message = fmt::format("SaveToResult(): type error: {}.", value.type().ToString());
                 LOG_CRITICAL(error_message);
@@ -98,10 +102,11 @@ private:
                 return;
             }
             case FilterCompareType::kEqual:
+            case FilterCompareType::kLess:
             case FilterCompareType::kLessEqual:
             case FilterCompareType::kGreaterEqual:
             case FilterCompareType::kAlwaysTrue: {
-                // step 2. set interval range for kEqual, kLessEqual, kGreaterEqual and kAlwaysTrue
+                // step 2. set interval range for kEqual, kLess (only for varchar), kLessEqual, kGreaterEqual and kAlwaysTrue
                 auto &result_variant = result_.emplace_back(std::in_place_index<1>, column_id, FilterRangeType::kInterval);
                 auto &result = std::get<FilterExecuteSingleRange>(result_variant);
                 SetResultIntervalValue(result, value, compare_type);
@@ -273,6 +278,16 @@ public:
                         }
                         break;
                     }
+                    case BooleanCombineType::kNot: {
+                        if (result_.empty()) {
+                            String error_message = "FilterCommandBuilder::Build(): result is empty before \"NOT\".";
+                            LOG_CRITICAL(error_message);
+                            UnrecoverableError(error_message);
+                            return false;
+                        }
+                        result_.emplace_back(FilterExecuteCombineType::kNot);
+                        break;
+                    }
                     default: {
                         String error_message = "FilterCommandBuilder::Build(): combine type error.";
                         LOG_CRITICAL(error_message);
@@ -303,7 +318,7 @@ Vector<FilterExecuteElem> BuildSecondaryIndexScanCommand(SharedPtr<BaseExpressio
     // Use Reverse Polish notation to evaluate the filter
     // For example, the filter "a >= 1 AND a <= 2" will be converted to "a 1 >= a 2 <= AND"
     // filter_evaluator_ only contain FilterCompareType of kEqual, kLessEqual, kGreaterEqual, kAlwaysFalse, kAlwaysTrue
-    // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr
+    // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr, kNot
     Vector<FilterEvaluatorElem> filter_evaluator = BuildSecondaryIndexScanMiddleCommand(index_filter_qualified_);
 
     // step 2. commands used in PhysicalIndexScan::ExecuteInternal()
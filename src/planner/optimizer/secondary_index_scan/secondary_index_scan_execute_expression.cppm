@@ -106,6 +106,80 @@ private:
     }
 };
 
+// A string has no previous or next value to close the interval with, so the VARCHAR interval is half-open:
+// [begin_val_, end_val_), or [begin_val_, +inf) without end_val_. "x <= v" is "x < v + '\0'", since v + '\0' is the next string of v.
+export template <>
+class FilterIntervalRangeT<VarcharT> {
+public:
+    explicit FilterIntervalRangeT(const Value &val, FilterCompareType compare_type) {
+        const String &raw_val = val.GetVarchar();
+        switch (compare_type) {
+            case FilterCompareType::kLess: {
+                AddLess(raw_val);
+                break;
+            }
+            case FilterCompareType::kLessEqual: {
+                AddLess(raw_val + '\0');
+                break;
+            }
+            case FilterCompareType::kGreaterEqual: {
+                AddGE(raw_val);
+                break;
+            }
+            case FilterCompareType::kEqual: {
+                AddLess(raw_val + '\0');
+                AddGE(raw_val);
+                break;
+            }
+            case FilterCompareType::kAlwaysTrue: {
+                // default to all strings
+                break;
+            }
+            default: {
+                String error_message = "FilterIntervalRangeT<VarcharT>: compare type error.";
+                LOG_CRITICAL(error_message);
+                UnrecoverableError(error_message);
+            }
+        }
+    }
+
+    [[nodiscard]] bool MergeAnd(const FilterIntervalRangeT &other) {
+        if (other.end_val_.has_value()) {
+            AddLess(*other.end_val_);
+        }
+        AddGE(other.begin_val_);
+        return !end_val_.has_value() or begin_val_ < *end_val_;
+    }
+
+    [[nodiscard]] Pair<std::string_view, Optional<std::string_view>> GetRange() const {
+        if (end_val_.has_value()) {
+            return {begin_val_, std::string_view(*end_val_)};
+        }
+        return {begin_val_, None};
+    }
+
+    inline void SetAlwaysFalse() {
+        begin_val_.clear();
+        end_val_ = String();
+    }
+
+private:
+    // default: all strings, the empty string is the smallest one
+    String begin_val_;
+    Optional<String> end_val_;
+
+    inline void AddLess(const String &val) {
+        if (!end_val_.has_value() or val < *end_val_) {
+            end_val_ = val;
+        }
+    }
+    inline void AddGE(const String &val) {
+        if (val > begin_val_) {
+            begin_val_ = val;
+        }
+    }
+};
+
 export using FilterIntervalRange = std::variant<std::monostate,
                                                 FilterIntervalRangeT<TinyIntT>,
                                                 FilterIntervalRangeT<SmallIntT>,
@@ -116,7 +190,8 @@ export using FilterIntervalRange = std::variant<std::monostate,
                                                 FilterIntervalRangeT<DateT>,
                                                 FilterIntervalRangeT<TimeT>,
                                                 FilterIntervalRangeT<DateTimeT>,
-                                                FilterIntervalRangeT<TimestampT>>;
+                                                FilterIntervalRangeT<TimestampT>,
+                                                FilterIntervalRangeT<VarcharT>>;
 
 // because some rows may be deleted, kAlwaysTrue is meaningless
 // kInterval of the same column can be merged in "AND" condition
@@ -161,7 +236,8 @@ public:
     }
 };
 
-export enum class FilterExecuteCombineType : i8 { kAnd, kOr };
+// kNot is unary, it selects the rows of the segment not selected by the last result
+export enum class FilterExecuteCombineType : i8 { kAnd, kOr, kNot };
 
 export using FilterExecuteElem = std::variant<FilterExecuteCombineType, FilterExecuteSingleRange>;
 
@@ -55,7 +55,7 @@ private:
         if (expression->type() == ExpressionType::kFunction) {
             auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
             auto const &function_name = function_expression->ScalarFunctionName();
-            if (function_name == "AND" or function_name == "OR") {
+            if (function_name == "AND" or function_name == "OR" or function_name == "NOT") {
                 for (auto &arg : function_expression->arguments()) {
                     if (not BuildFilterEvaluator(arg)) {
                         String error_message = fmt::format("BuildFilterEvaluator(): subexpression error in \"{}\".", expression->Name());
@@ -88,6 +88,9 @@ private:
                     auto &right = function_expression->arguments()[1]; // value-expression
                     // 2. right
                     auto right_val = FilterExpressionPushDownHelper::CalcValueResult(right);
+                    if (right_val.type().type() == LogicalType::kVarchar and left->type() == ExpressionType::kColumn) {
+                        return BuildVarcharFilterEvaluator(left, std::move(right_val), compare_type);
+                    }
                     // 1. left, maybe with cast
                     auto [column_id, final_val, final_compare_type] =
                         FilterExpressionPushDownHelper::UnwindCast(left, std::move(right_val), compare_type);
@@ -133,11 +136,26 @@ private:
         }
     }
 
+    // a string has no previous value, so "x < v" is kept as kLess for the half-open varchar range
+    // "x > v" is "x >= v + '\0'", since v + '\0' is the next string of v
+    inline bool BuildVarcharFilterEvaluator(SharedPtr<BaseExpression> &column_expr, Value &&right_val, FilterCompareType compare_type) {
+        if (compare_type == FilterCompareType::kGreater) {
+            right_val = Value::MakeVarchar(right_val.GetVarchar() + '\0');
+            compare_type = FilterCompareType::kGreaterEqual;
+        }
+        result_.emplace_back(std::static_pointer_cast<ColumnExpression>(column_expr)->binding().column_idx);
+        result_.emplace_back(std::move(right_val));
+        result_.emplace_back(compare_type);
+        return true;
+    }
+
     inline static BooleanCombineType GetBooleanCombineType(const String &function_name) {
         if (function_name == "AND") {
             return BooleanCombineType::kAnd;
         } else if (function_name == "OR") {
             return BooleanCombineType::kOr;
+        } else if (function_name == "NOT") {
+            return BooleanCombineType::kNot;
         } else {
             String error_message = fmt::format("GetBooleanCombineType(): function name error: {}.", function_name);
             LOG_CRITICAL(error_message);
@@ -151,8 +169,8 @@ Vector<FilterEvaluatorElem> BuildSecondaryIndexScanMiddleCommand(SharedPtr<BaseE
     // step 1. middle representation
     // Use Reverse Polish notation to evaluate the filter
     // For example, the filter "a >= 1 AND a <= 2" will be converted to "a 1 >= a 2 <= AND"
-    // filter_evaluator_ only contain FilterCompareType of kEqual, kLessEqual, kGreaterEqual, kAlwaysFalse, kAlwaysTrue
-    // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr
+    // filter_evaluator_ only contain FilterCompareType of kEqual, kLessEqual, kGreaterEqual, kAlwaysFalse, kAlwaysTrue, and kLess for varchar
+    // filter_evaluator_ only contain BooleanCombineType of kAnd, kOr, kNot
     Vector<FilterEvaluatorElem> filter_evaluator;
     FilterEvaluatorBuilder filter_builder(index_filter_qualified_);
     if (filter_builder.Solve()) {
@@ -24,9 +24,10 @@ import filter_expression_push_down_helper;
 
 namespace infinity {
 
-// TODO: now do not support "NOT" expression and "!=" compare function in index scan
+// TODO: now do not support "!=" compare function in index scan
 
-export enum class BooleanCombineType : i8 { kAnd, kOr, kInvalid };
+// kNot is unary
+export enum class BooleanCombineType : i8 { kAnd, kOr, kNot, kInvalid };
 
 export using FilterEvaluatorElem = std::variant<ColumnID, Value, FilterCompareType, BooleanCombineType>;
 
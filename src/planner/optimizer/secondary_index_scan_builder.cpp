@@ -25,6 +25,7 @@ import logical_index_scan;
 import logical_knn_scan;
 import logical_match;
 import logical_match_tensor_scan;
+import logical_match_sparse_scan;
 import query_context;
 import logical_node_visitor;
 import infinity_exception;
@@ -77,6 +78,7 @@ public:
                                                                    std::move(filter_execute_command),
                                                                    std::move(fast_rough_filter_evaluator),
                                                                    true);
+                    index_scan->fast_rough_filter_source_ = std::move(table_scan.fast_rough_filter_source_);
                     op->set_left_node(std::move(index_scan));
                     LOG_TRACE("BuildSecondaryIndexScan: Push down the qualified index scan filter. Replace table scan with index scan.");
                 }
@@ -99,6 +101,9 @@ public:
         } else if (op->operator_type() == LogicalNodeType::kMatchTensorScan) {
             auto &match_tensor = static_cast<LogicalMatchTensorScan &>(*op);
             match_tensor.common_query_filter_->TryApplySecondaryIndexFilterOptimizer(query_context_);
+        } else if (op->operator_type() == LogicalNodeType::kMatchSparseScan) {
+            auto &match_sparse = static_cast<LogicalMatchSparseScan &>(*op);
+            match_sparse.common_query_filter_->TryApplySecondaryIndexFilterOptimizer(query_context_);
         }
         // visit children after handling current node
         VisitNode(op->left_node());
@@ -258,7 +258,7 @@ UniquePtr<OperatorState> MakeMergeKnnState(PhysicalMergeKnn *physical_merge_knn,
     UniquePtr<OperatorState> operator_state = MakeUnique<MergeKnnOperatorState>();
     MergeKnnOperatorState *merge_knn_op_state_ptr = (MergeKnnOperatorState *)(operator_state.get());
     // Set fake parallel number here. It will be set in SetMergeKnnState
-    merge_knn_op_state_ptr->merge_knn_function_data_ = MakeShared<MergeKnnFunctionData>(1,
+    merge_knn_op_state_ptr->merge_knn_function_data_ = MakeShared<MergeKnnFunctionData>(knn_expr->query_count_,
                                                                                         knn_expr->topn_,
                                                                                         knn_expr->embedding_data_type_,
                                                                                         knn_expr->distance_type_,
@@ -706,7 +706,7 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                               std::move(knn_expr->opt_params_),
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
-                                              1,
+                                              knn_expr->query_count_,
                                               knn_expr->query_embedding_.ptr,
                                               knn_expr->embedding_data_type_,
                                               knn_expr->distance_type_);
@@ -721,7 +721,7 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                               std::move(knn_expr->opt_params_),
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
-                                              1,
+                                              knn_expr->query_count_,
                                               knn_expr->query_embedding_.ptr,
                                               knn_expr->embedding_data_type_,
                                               knn_expr->distance_type_);
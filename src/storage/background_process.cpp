@@ -62,12 +62,14 @@ void BGTaskProcessor::Process() {
             switch (bg_task->type_) {
                 case BGTaskType::kStopProcessor: {
                     LOG_INFO("Stop the background processor");
+                    WaitFullCheckpoint();
                     running = false;
                     break;
                 }
                 case BGTaskType::kForceCheckpoint: {
                     LOG_DEBUG("Force checkpoint in background");
                     ForceCheckpointTask *force_ckp_task = static_cast<ForceCheckpointTask *>(bg_task.get());
+                    WaitFullCheckpoint();
                     auto [max_commit_ts, wal_size] = catalog_->GetCheckpointState();
                     wal_manager_->Checkpoint(force_ckp_task, max_commit_ts, wal_size);
                     LOG_DEBUG("Force checkpoint in background done");
@@ -82,12 +84,22 @@ void BGTaskProcessor::Process() {
                     LOG_DEBUG("Checkpoint in background");
                     auto *task = static_cast<CheckpointTask *>(bg_task.get());
                     bool is_full_checkpoint = task->is_full_checkpoint_;
+                    // The last full checkpoint may still be committing its txn
+                    WaitFullCheckpoint();
                     auto [max_commit_ts, wal_size] = catalog_->GetCheckpointState();
+                    if (is_full_checkpoint) {
+                        StartFullCheckpoint(max_commit_ts, wal_size);
+                        break;
+                    }
                     wal_manager_->Checkpoint(is_full_checkpoint, max_commit_ts, wal_size);
                     LOG_DEBUG("Checkpoint in background done");
                     break;
                 }
                 case BGTaskType::kCleanup: {
+                    if (DeferTask(bg_task)) {
+                        LOG_DEBUG("Cleanup is put off until the full checkpoint is done");
+                        continue;
+                    }
                     LOG_DEBUG("Cleanup in background");
                     auto task = static_cast<CleanupTask *>(bg_task.get());
                     task->Execute();
@@ -117,4 +129,43 @@ void BGTaskProcessor::Process() {
     }
 }
 
+void BGTaskProcessor::StartFullCheckpoint(TxnTimeStamp max_commit_ts, i64 wal_size) {
+    {
+        std::lock_guard<std::mutex> lock(full_checkpoint_mutex_);
+        full_checkpoint_running_ = true;
+    }
+    // The checkpoint txn is committed once the file is durable. The checkpoint_in_progress_ flag of the wal manager keeps the next
+    // checkpoint from being submitted until then.
+    full_checkpoint_thread_ = Thread([this, max_commit_ts, wal_size] {
+        LOG_DEBUG("Full checkpoint in background");
+        wal_manager_->Checkpoint(true, max_commit_ts, wal_size);
+        Vector<SharedPtr<BGTask>> deferred_tasks;
+        {
+            std::lock_guard<std::mutex> lock(full_checkpoint_mutex_);
+            full_checkpoint_running_ = false;
+            deferred_tasks.swap(deferred_tasks_);
+        }
+        for (auto &deferred_task : deferred_tasks) {
+            Submit(std::move(deferred_task));
+        }
+        LOG_DEBUG("Full checkpoint in background done");
+    });
+}
+
+void BGTaskProcessor::WaitFullCheckpoint() {
+    if (full_checkpoint_thread_.joinable()) {
+        full_checkpoint_thread_.join();
+    }
+}
+
+bool BGTaskProcessor::DeferTask(const SharedPtr<BGTask> &bg_task) {
+    // The cleanup removes entries from the catalog which the full checkpoint may be serializing
+    std::lock_guard<std::mutex> lock(full_checkpoint_mutex_);
+    if (!full_checkpoint_running_) {
+        return false;
+    }
+    deferred_tasks_.push_back(bg_task);
+    return true;
+}
+
 } // namespace infinity
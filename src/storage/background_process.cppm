@@ -40,11 +40,22 @@ private:
     void Process();
     void CompactProcess();
 
+    // The full checkpoint is written on its own thread, the delta entries of the commits are added meanwhile.
+    void StartFullCheckpoint(TxnTimeStamp max_commit_ts, i64 wal_size);
+    void WaitFullCheckpoint();
+    // Returns true if the task is put off until the running full checkpoint is done.
+    bool DeferTask(const SharedPtr<BGTask> &bg_task);
+
 private:
     BlockingQueue<SharedPtr<BGTask>> task_queue_;
 
     Thread processor_thread_{};
 
+    Thread full_checkpoint_thread_{};
+    std::mutex full_checkpoint_mutex_{};
+    bool full_checkpoint_running_{false};
+    Vector<SharedPtr<BGTask>> deferred_tasks_{};
+
     WalManager *wal_manager_{};
     Catalog *catalog_{};
 
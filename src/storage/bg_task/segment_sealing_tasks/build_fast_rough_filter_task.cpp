@@ -370,6 +370,10 @@ void BuildFastRoughFilterTask::SetSegmentFinishBuildMinMaxFilterTask(SegmentEntr
 
 // deprecate except this
 void BuildFastRoughFilterTask::ExecuteOnNewSealedSegment(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts) {
+    if (segment_entry->GetFastRoughFilter()->HaveMinMaxFilter()) {
+        // built by the import which created the segment
+        return;
+    }
     bool use_block_version = false;
     switch (auto status = segment_entry->status(); status) {
         case SegmentStatus::kUnsealed: {
@@ -414,6 +418,16 @@ void BuildFastRoughFilterTask::ExecuteOnNewSealedSegment(SegmentEntry *segment_e
     LOG_TRACE(fmt::format("BuildFastRoughFilterTask: build fast rough filter for segment {}, job end.", segment_entry->segment_id()));
 }
 
+void BuildFastRoughFilterTask::ExecuteOnImportedSegment(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts) {
+    LOG_TRACE(fmt::format("BuildFastRoughFilterTask: build fast rough filter for imported segment {}, job begin.", segment_entry->segment_id()));
+    // the segment is invisible to other txns until the import commits, and it has no block version to check
+    CheckAndSetSegmentHaveStartedBuildMinMaxFilterTask(segment_entry, begin_ts);
+    SetSegmentBeginBuildMinMaxFilterTask(segment_entry, segment_entry->column_count());
+    ExecuteInner<false>(segment_entry, buffer_manager, begin_ts);
+    SetSegmentFinishBuildMinMaxFilterTask(segment_entry);
+    LOG_TRACE(fmt::format("BuildFastRoughFilterTask: build fast rough filter for imported segment {}, job end.", segment_entry->segment_id()));
+}
+
 void BuildFastRoughFilterTask::ExecuteUpdateSegmentBloomFilter(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts) {}
 
 // will check every column
@@ -59,6 +59,9 @@ export class BuildFastRoughFilterTask {
 public:
     static void ExecuteOnNewSealedSegment(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts);
 
+    // Build the filters of a segment created by import before the import commits, so the commit doesn't build them again
+    static void ExecuteOnImportedSegment(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts);
+
     static void ExecuteUpdateSegmentBloomFilter(SegmentEntry *segment_entry, BufferManager *buffer_manager, TxnTimeStamp begin_ts);
 
 private:
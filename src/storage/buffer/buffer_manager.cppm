@@ -57,6 +57,11 @@ public:
 
     void RemoveClean();
 
+    // Memory of the caches built from buffer objects, counted against the same limit so that loading a cache unloads buffers
+    void RequestExtraSpace(SizeT need_size) { RequestSpace(need_size); }
+
+    void FreeExtraSpace(SizeT size) { current_memory_size_ -= size; }
+
 private:
     friend class BufferObj;
 
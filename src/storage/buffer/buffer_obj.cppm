@@ -87,6 +87,8 @@ public:
 
     FileWorker *file_worker() { return file_worker_.get(); }
 
+    BufferManager *buffer_mgr() const { return buffer_mgr_; }
+
 private:
     // Friend to encapsulate `Unload` interface and to increase `rc_`.
     friend class BufferHandle;
@@ -106,6 +106,9 @@ void AnnIVFFlatIndexFileWorker<DataType>::AllocateInMemory() {
         centroids_count = default_centroid_num_;
     }
     switch (GetType()) {
+        // half precision columns are indexed as f32 vectors
+        case kElemFloat16:
+        case kElemBFloat16:
         case kElemFloat: {
             data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType>(index_ivfflat->metric_type_, dimension, centroids_count));
             break;
@@ -65,6 +65,9 @@ void HnswFileWorker::AllocateInMemory() {
     SizeT ef_c = index_hnsw->ef_construction_;
     EmbeddingDataType embedding_type = GetType();
     switch (embedding_type) {
+        // half precision columns are indexed as f32 vectors
+        case kElemFloat16:
+        case kElemBFloat16:
         case kElemFloat: {
             AbstractHnsw<f32, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
             abstract_hnsw.Make(chunk_size_, max_chunk_num_, dimension, M, ef_c);
@@ -88,6 +91,8 @@ void HnswFileWorker::FreeInMemory() {
     const IndexHnsw *index_hnsw = static_cast<const IndexHnsw *>(index_base_.get());
     EmbeddingDataType embedding_type = GetType();
     switch (embedding_type) {
+        case kElemFloat16:
+        case kElemBFloat16:
         case kElemFloat: {
             AbstractHnsw<f32, SegmentOffset> abstract_hnsw(data_, index_hnsw);
             abstract_hnsw.Free();
@@ -112,6 +117,8 @@ void HnswFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
     const IndexHnsw *index_hnsw = static_cast<const IndexHnsw *>(index_base_.get());
     EmbeddingDataType embedding_type = GetType();
     switch (embedding_type) {
+        case kElemFloat16:
+        case kElemBFloat16:
         case kElemFloat: {
             AbstractHnsw<f32, SegmentOffset> abstract_hnsw(data_, index_hnsw);
             abstract_hnsw.Save(*file_handler_);
@@ -131,6 +138,8 @@ void HnswFileWorker::ReadFromFileImpl() {
     const IndexHnsw *index_hnsw = static_cast<const IndexHnsw *>(index_base_.get());
     EmbeddingDataType embedding_type = GetType();
     switch (embedding_type) {
+        case kElemFloat16:
+        case kElemBFloat16:
         case kElemFloat: {
             AbstractHnsw<f32, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
             abstract_hnsw.Load(*file_handler_);
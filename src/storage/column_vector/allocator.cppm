@@ -25,7 +25,7 @@ export class Allocator {
 public:
     static ptr_t allocate(SizeT bytes) {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrRawMemCount("Allocator");
+        GlobalResourceUsage::IncrRawMemCount(ResourceCounter::kAllocator);
 #endif
         return new char[bytes];
     }
@@ -33,7 +33,7 @@ public:
     static void deallocate(ptr_t ptr) {
         delete[] ptr;
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::DecrRawMemCount("Allocator");
+        GlobalResourceUsage::DecrRawMemCount(ResourceCounter::kAllocator);
 #endif
     }
 };
@@ -31,7 +31,7 @@ namespace infinity {
 
 Bitmask::Bitmask() : data_ptr_(nullptr), buffer_ptr(nullptr), count_(0) {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("Bitmask");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kBitmask);
 #endif
 }
 
@@ -39,13 +39,13 @@ Bitmask::Bitmask(Bitmask &&right) : data_ptr_(right.data_ptr_), buffer_ptr(std::
     right.data_ptr_ = nullptr;
     right.count_ = 0;
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("Bitmask");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kBitmask);
 #endif
 }
 
 Bitmask::~Bitmask() {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::DecrObjectCount("Bitmask");
+    GlobalResourceUsage::DecrObjectCount(ResourceCounter::kBitmask);
 #endif
     //    Reset();
 }
@@ -37,13 +37,13 @@ SharedPtr<BitmaskBuffer> BitmaskBuffer::Make(const u64 *input_ptr, SizeT count)
 
 BitmaskBuffer::BitmaskBuffer() {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("BitmaskBuffer");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kBitmaskBuffer);
 #endif
 }
 
 BitmaskBuffer::~BitmaskBuffer() {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::DecrObjectCount("BitmaskBuffer");
+    GlobalResourceUsage::DecrObjectCount(ResourceCounter::kBitmaskBuffer);
 #endif
 }
 
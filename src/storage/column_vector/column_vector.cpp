@@ -1630,6 +1630,14 @@ void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
                     AppendEmbedding<DoubleT>(ele_str_views, dst_off);
                     break;
                 }
+                case kElemFloat16: {
+                    AppendEmbedding<Float16T>(ele_str_views, dst_off);
+                    break;
+                }
+                case kElemBFloat16: {
+                    AppendEmbedding<BFloat16T>(ele_str_views, dst_off);
+                    break;
+                }
                 default: {
                     String error_message = "Invalid embedding type";
                     LOG_ERROR(error_message);
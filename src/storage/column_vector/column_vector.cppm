@@ -96,7 +96,7 @@ public:
     // Construct a column vector without initialization;
     explicit ColumnVector(SharedPtr<DataType> data_type) : vector_type_(ColumnVectorType::kInvalid), data_type_(std::move(data_type)) {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("ColumnVector");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kColumnVector);
 #endif
     }
 
@@ -106,7 +106,7 @@ public:
           vector_type_(right.vector_type_), data_type_(right.data_type_), data_ptr_(right.data_ptr_), capacity_(right.capacity_),
           tail_index_(right.tail_index_) {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("ColumnVector");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kColumnVector);
 #endif
     }
 
@@ -116,14 +116,14 @@ public:
           initialized(right.initialized), vector_type_(right.vector_type_), data_type_(std::move(right.data_type_)), data_ptr_(right.data_ptr_),
           capacity_(right.capacity_), tail_index_(right.tail_index_) {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("ColumnVector");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kColumnVector);
 #endif
     }
 
     ~ColumnVector() {
         // Reset(); // TODO: overload copy constructor and move constructor TO PREVENT USING `Reset`
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::DecrObjectCount("ColumnVector");
+        GlobalResourceUsage::DecrObjectCount(ResourceCounter::kColumnVector);
 #endif
     }
 
@@ -1167,6 +1167,35 @@ private:
     }
 };
 
+// Reads the varchars of a column, pointing into the heap chunk unless the string spans two chunks.
+// The returned view is valid until the next call.
+export class VarcharColumnReader {
+public:
+    explicit VarcharColumnReader(const ColumnVector &column)
+        : data_ptr_(reinterpret_cast<const VarcharT *>(column.data())), fix_heap_mgr_(column.buffer_->fix_heap_mgr_.get()) {}
+
+    const VarcharT &operator[](SizeT idx) const { return data_ptr_[idx]; }
+
+    std::string_view GetString(const VarcharT &varchar) {
+        if (varchar.IsInlined()) {
+            return {varchar.short_.data_, static_cast<SizeT>(varchar.length_)};
+        }
+        SizeT length = varchar.length_;
+        u64 chunk_offset = varchar.vector_.chunk_offset_;
+        if (chunk_offset + length <= fix_heap_mgr_->current_chunk_size()) {
+            return {fix_heap_mgr_->GetRawPtrFromChunk(varchar.vector_.chunk_id_, chunk_offset), length};
+        }
+        buffer_.resize(length);
+        fix_heap_mgr_->ReadFromHeap(buffer_.data(), varchar.vector_.chunk_id_, chunk_offset, length);
+        return buffer_;
+    }
+
+private:
+    const VarcharT *data_ptr_{nullptr};
+    FixHeapManager *fix_heap_mgr_{nullptr};
+    String buffer_{};
+};
+
 // BooleanColumnWriter does not check null, range and type.
 export using BooleanColumnWriter = ColumnVectorPtrAndIdx<BooleanT>;
 
@@ -33,7 +33,7 @@ namespace infinity {
 
 FixHeapManager::FixHeapManager(const u32 heap_id, const u64 chunk_size, bool allow_cross_chunk) : heap_id_(heap_id), current_chunk_size_(chunk_size) {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("FixHeapManager");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kFixHeapManager);
 #endif
     current_chunk_idx_ = INVALID_CHUNK_ID;
     allow_storage_across_chunks_ = allow_cross_chunk;
@@ -47,7 +47,7 @@ FixHeapManager::FixHeapManager(const u32 heap_id,
     : heap_id_(heap_id), current_chunk_size_(chunk_size), current_chunk_offset_(block_column_entry->LastChunkOff(heap_id)), buffer_mgr_(buffer_mgr),
       block_column_entry_(block_column_entry) {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("FixHeapManager");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kFixHeapManager);
 #endif
     const int cnt = block_column_entry->OutlineBufferCount(heap_id);
     if (cnt == 0) {
@@ -60,7 +60,7 @@ FixHeapManager::FixHeapManager(const u32 heap_id,
 
 FixHeapManager::~FixHeapManager() {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::DecrObjectCount("FixHeapManager");
+    GlobalResourceUsage::DecrObjectCount(ResourceCounter::kFixHeapManager);
 #endif
     // std::variant in `VectorHeapChunk` will call destructor automatically
 }
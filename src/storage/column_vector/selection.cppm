@@ -32,13 +32,13 @@ struct SelectionData {
         }
         data_ = MakeUnique<u16[]>(count);
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("SelectionData");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kSelectionData);
 #endif
     }
 
     ~SelectionData() {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::DecrObjectCount("SelectionData");
+        GlobalResourceUsage::DecrObjectCount(ResourceCounter::kSelectionData);
 #endif
     }
 
@@ -50,13 +50,13 @@ export class Selection {
 public:
     Selection() {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("Selection");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kSelection);
 #endif
     }
 
     ~Selection() {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::DecrObjectCount("Selection");
+        GlobalResourceUsage::DecrObjectCount(ResourceCounter::kSelection);
 #endif
     }
 
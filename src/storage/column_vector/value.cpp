@@ -37,7 +37,11 @@ namespace {
 template <typename T>
 void Embedding2JsonInternal(const EmbeddingType &embedding, size_t dimension, nlohmann::json& embedding_json) {
     for (size_t i = 0; i < dimension; ++i) {
-        embedding_json.push_back(((T *)(embedding.ptr))[i]);
+        if constexpr (std::is_same_v<T, Float16T> || std::is_same_v<T, BFloat16T>) {
+            embedding_json.push_back(static_cast<float>(((T *)(embedding.ptr))[i]));
+        } else {
+            embedding_json.push_back(((T *)(embedding.ptr))[i]);
+        }
     }
 }
 
@@ -88,6 +92,14 @@ void Embedding2Json(const EmbeddingType &embedding, EmbeddingDataType type, size
             Embedding2JsonInternal<double>(embedding, dimension, embedding_json);
             break;
         }
+        case kElemFloat16: {
+            Embedding2JsonInternal<Float16T>(embedding, dimension, embedding_json);
+            break;
+        }
+        case kElemBFloat16: {
+            Embedding2JsonInternal<BFloat16T>(embedding, dimension, embedding_json);
+            break;
+        }
         default: {
             Status status = Status::SyntaxError("Unexpected embedding type");
             LOG_ERROR(status.message());
@@ -576,32 +588,32 @@ RowID Value::GetValue() const {
 
 Value::~Value() {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::DecrObjectCount("Value");
+    GlobalResourceUsage::DecrObjectCount(ResourceCounter::kValue);
 #endif
 }
 
 Value::Value(const DataType &data_type) : type_(data_type) {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("Value");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kValue);
 #endif
 }
 
 Value::Value(LogicalType type, SharedPtr<TypeInfo> typeinfo_ptr) : type_(type, std::move(typeinfo_ptr)) {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("Value");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kValue);
 #endif
 }
 
 Value::Value(const Value &other) : type_(other.type_) {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("Value");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kValue);
 #endif
     CopyUnionValue(other);
 }
 
 Value::Value(Value &&other) noexcept : type_(other.type_) {
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("Value");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kValue);
 #endif
     MoveUnionValue(std::forward<Value>(other));
 }
@@ -49,13 +49,13 @@ public:
 public:
     explicit VectorBuffer() {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("VectorBuffer");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kVectorBuffer);
 #endif
     }
 
     ~VectorBuffer() {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::DecrObjectCount("VectorBuffer");
+        GlobalResourceUsage::DecrObjectCount(ResourceCounter::kVectorBuffer);
 #endif
     }
 
@@ -32,13 +32,13 @@ export struct VectorHeapChunk {
 public:
     explicit VectorHeapChunk(BufferObj *buffer_obj) : ptr_(buffer_obj->Load()) {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("VectorHeapChunk");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kVectorHeapChunk);
 #endif
     }
 
     explicit VectorHeapChunk(u64 capacity) : ptr_(MakeUniqueForOverwrite<char[]>(capacity)) {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("VectorHeapChunk");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kVectorHeapChunk);
 #endif
     }
 
@@ -46,7 +46,7 @@ public:
 
     VectorHeapChunk(VectorHeapChunk &&other) {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::IncrObjectCount("VectorHeapChunk");
+        GlobalResourceUsage::IncrObjectCount(ResourceCounter::kVectorHeapChunk);
 #endif
         if (std::holds_alternative<UniquePtr<char[]>>(other.ptr_)) {
             ptr_ = std::move(std::get<UniquePtr<char[]>>(other.ptr_));
@@ -61,7 +61,7 @@ public:
 
     ~VectorHeapChunk() {
 #ifdef INFINITY_DEBUG
-        GlobalResourceUsage::DecrObjectCount("VectorHeapChunk");
+        GlobalResourceUsage::DecrObjectCount(ResourceCounter::kVectorHeapChunk);
 #endif
     }
 
@@ -91,5 +91,6 @@ void FastPForWrapper<Codec>::RevertDelta(u32 *src, SizeT count) {
 
 // template struct FastPForWrapper<FastPForCodec::FastPFor>;
 template struct FastPForWrapper<FastPForCodec::SIMDBitPacking>;
+template struct FastPForWrapper<FastPForCodec::StreamVByte>;
 
 } // namespace infinity
\ No newline at end of file
@@ -32,6 +32,9 @@ public:
     // return number of elements
     inline u32 Decode(T *dest, u32 dest_len, ByteSliceReader &slice_reader) const;
 
+    // Appends the next encoded block to dest without decoding it, so that it can be decoded later
+    inline void CopyEncoded(ByteSliceReader &slice_reader, Vector<u8> &dest) const;
+
 private:
     Compressor compressor_{};
 };
@@ -60,6 +63,17 @@ inline u32 IntEncoder<T, Compressor>::Decode(T *dest, u32 dest_len, ByteSliceRea
     return (u32)compressor_.Decompress(dest, dest_len, (const u32 *)buf_ptr, comp_len);
 }
 
+template <typename T, typename Compressor>
+inline void IntEncoder<T, Compressor>::CopyEncoded(ByteSliceReader &slice_reader, Vector<u8> &dest) const {
+    u32 header = (u32)slice_reader.PeekInt32();
+    size_t comp_len = compressor_.GetCompressedLength(header) * sizeof(u32);
+    size_t dest_offset = dest.size();
+    dest.resize(dest_offset + comp_len);
+    if (slice_reader.Read(dest.data() + dest_offset, comp_len) != comp_len) {
+        UnrecoverableError("Decode posting FAILEDF");
+    }
+}
+
 export template <FastPForCodec Codec>
 class IntEncoder<u32, FastPForWrapper<Codec>> {
 public:
@@ -77,6 +91,9 @@ public:
     // return number of elements
     inline u32 Decode(u32 *dest, u32 dest_len, ByteSliceReader &slice_reader) const;
 
+    // Appends the next encoded block to dest without decoding it, so that it can be decoded later
+    inline void CopyEncoded(ByteSliceReader &slice_reader, Vector<u8> &dest) const;
+
 private:
     FastPForWrapper<Codec> compressor_{};
 };
@@ -97,7 +114,13 @@ inline u32 IntEncoder<u32, FastPForWrapper<Codec>>::Decode(u32 *dest, u32 dest_l
     u32 comp_len = slice_reader.ReadByte();
     void *buf_ptr = buffer;
     comp_len *= sizeof(u32);
-    size_t len = slice_reader.ReadMayCopy(buf_ptr, comp_len);
+    size_t len = 0;
+    if constexpr (Codec == FastPForCodec::StreamVByte) {
+        // the simd kernel loads 16 bytes for every 4 values and may read past the end of the block, decode from the local buffer
+        len = slice_reader.Read(buf_ptr, comp_len);
+    } else {
+        len = slice_reader.ReadMayCopy(buf_ptr, comp_len);
+    }
     if (len != comp_len) {
         UnrecoverableError("Decode posting FAILEDF");
     }
@@ -107,4 +130,15 @@ inline u32 IntEncoder<u32, FastPForWrapper<Codec>>::Decode(u32 *dest, u32 dest_l
     return destlen;
 }
 
+template <FastPForCodec Codec>
+inline void IntEncoder<u32, FastPForWrapper<Codec>>::CopyEncoded(ByteSliceReader &slice_reader, Vector<u8> &dest) const {
+    u8 comp_len = slice_reader.ReadByte();
+    size_t dest_offset = dest.size();
+    dest.resize(dest_offset + sizeof(u8) + comp_len * sizeof(u32));
+    dest[dest_offset] = comp_len;
+    if (slice_reader.Read(dest.data() + dest_offset + sizeof(u8), comp_len * sizeof(u32)) != comp_len * sizeof(u32)) {
+        UnrecoverableError("Decode posting FAILEDF");
+    }
+}
+
 } // namespace infinity
@@ -33,6 +33,8 @@ export struct TableInfo {
     i64 column_count_{};
     i64 segment_count_{};
     i64 row_count_{};
+    // False while the memory indexes are recovered after the startup
+    bool index_ready_{};
 };
 
 export struct TableIndexInfo {
@@ -33,15 +33,21 @@ import query_context;
 import infinity_context;
 import compact_statement;
 import compilation_config;
-import defer_op;
-import bg_query_state;
+import block_index;
+import segment_entry;
+import default_values;
 
 namespace infinity {
 
-CompactionProcessor::CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr) : catalog_(catalog), txn_mgr_(txn_mgr) {}
+CompactionProcessor::CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr, SizeT worker_count, SizeT table_concurrency)
+    : catalog_(catalog), txn_mgr_(txn_mgr), worker_count_(std::max(worker_count, SizeT(1))),
+      table_concurrency_(std::max(table_concurrency, SizeT(1))) {}
 
 void CompactionProcessor::Start() {
-    LOG_INFO("Compaction processor is started.");
+    LOG_INFO(fmt::format("Compaction processor is started with {} workers.", worker_count_));
+    for (SizeT i = 0; i < worker_count_; ++i) {
+        worker_threads_.emplace_back([this] { WorkerLoop(); });
+    }
     processor_thread_ = Thread([this] { Process(); });
 }
 
@@ -51,6 +57,15 @@ void CompactionProcessor::Stop() {
     this->Submit(stop_task);
     stop_task->Wait();
     processor_thread_.join();
+    {
+        std::unique_lock lock(job_mutex_);
+        stop_workers_ = true;
+    }
+    job_cv_.notify_all();
+    for (auto &worker_thread : worker_threads_) {
+        worker_thread.join();
+    }
+    worker_threads_.clear();
     LOG_INFO("Compaction processor is stopped.");
 }
 
@@ -59,33 +74,6 @@ void CompactionProcessor::Submit(SharedPtr<BGTask> bg_task) {
     ++ task_count_;
 }
 
-void CompactionProcessor::DoCompact() {
-    Txn *scan_txn = txn_mgr_->BeginTxn(MakeUnique<String>("ScanForCompact"));
-    bool success = false;
-    DeferFn defer_fn([&] {
-        if (!success) {
-            txn_mgr_->RollBackTxn(scan_txn);
-        }
-    });
-
-    Vector<Pair<UniquePtr<BaseStatement>, Txn *>> statements = this->ScanForCompact(scan_txn);
-    Vector<Pair<BGQueryContextWrapper, BGQueryState>> wrappers;
-    for (const auto &[statement, txn] : statements) {
-        BGQueryContextWrapper wrapper(txn);
-        BGQueryState state;
-        bool res = wrapper.query_context_->ExecuteBGStatement(statement.get(), state);
-        if (res) {
-            wrappers.emplace_back(std::move(wrapper), std::move(state));
-        }
-    }
-    for (auto &[wrapper, query_state] : wrappers) {
-        TxnTimeStamp commit_ts_out = 0;
-        wrapper.query_context_->JoinBGStatement(query_state, commit_ts_out);
-    }
-    txn_mgr_->CommitTxn(scan_txn);
-    success = true;
-}
-
 TxnTimeStamp
 CompactionProcessor::ManualDoCompact(const String &schema_name, const String &table_name, bool rollback, Optional<std::function<void()>> mid_func) {
     auto statement = MakeUnique<ManualCompactStatement>(schema_name, table_name);
@@ -103,44 +91,144 @@ CompactionProcessor::ManualDoCompact(const String &schema_name, const String &ta
     return out_commit_ts;
 }
 
-Vector<Pair<UniquePtr<BaseStatement>, Txn *>> CompactionProcessor::ScanForCompact(Txn *scan_txn) {
+void CompactionProcessor::ScheduleCompact() {
+    Txn *scan_txn = txn_mgr_->BeginTxn(MakeUnique<String>("ScanForCompact"));
+    TransactionID txn_id = scan_txn->TxnID();
+    TxnTimeStamp begin_ts = scan_txn->BeginTS();
+    Vector<DBEntry *> db_entries = catalog_->Databases(txn_id, begin_ts);
+    for (auto *db_entry : db_entries) {
+        Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts);
+        for (auto *table_entry : table_entries) {
+            f64 benefit = CompactBenefit(table_entry, scan_txn);
+            AddJob(Job{JobType::kCompact, *table_entry->GetDBName(), *table_entry->GetTableName(), benefit});
+        }
+    }
+    txn_mgr_->CommitTxn(scan_txn);
+}
 
-    Vector<Pair<UniquePtr<BaseStatement>, Txn *>> compaction_tasks;
+void CompactionProcessor::ScheduleOptimize() {
+    Txn *scan_txn = txn_mgr_->BeginTxn(MakeUnique<String>("ScanForOptimize"));
     TransactionID txn_id = scan_txn->TxnID();
     TxnTimeStamp begin_ts = scan_txn->BeginTS();
     Vector<DBEntry *> db_entries = catalog_->Databases(txn_id, begin_ts);
     for (auto *db_entry : db_entries) {
         Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts);
         for (auto *table_entry : table_entries) {
-            while (true) {
-                Txn *txn = txn_mgr_->BeginTxn(MakeUnique<String>("Compact"));
-                TransactionID txn_id = txn->TxnID();
-                auto compact_segments = table_entry->CheckCompaction(txn_id);
-                if (compact_segments.empty()) {
-                    txn_mgr_->RollBackTxn(txn);
-                    break;
-                }
+            AddJob(Job{JobType::kOptimize, *table_entry->GetDBName(), *table_entry->GetTableName(), 0});
+        }
+    }
+    txn_mgr_->CommitTxn(scan_txn);
+}
 
-                compaction_tasks.emplace_back(MakeUnique<AutoCompactStatement>(table_entry, std::move(compact_segments)), txn);
+void CompactionProcessor::AddJob(Job job) {
+    {
+        std::unique_lock lock(job_mutex_);
+        for (auto &pending_job : pending_jobs_) {
+            if (pending_job.type_ == job.type_ && pending_job.db_name_ == job.db_name_ && pending_job.table_name_ == job.table_name_) {
+                pending_job.benefit_ = std::max(pending_job.benefit_, job.benefit_);
+                return;
             }
         }
+        pending_jobs_.push_back(std::move(job));
+        ++task_count_;
     }
+    job_cv_.notify_one();
+}
 
-    return compaction_tasks;
+Optional<CompactionProcessor::Job> CompactionProcessor::PickJob() {
+    auto picked = pending_jobs_.end();
+    for (auto iter = pending_jobs_.begin(); iter != pending_jobs_.end(); ++iter) {
+        if (auto running_iter = table_running_count_.find(TableKey(*iter));
+            running_iter != table_running_count_.end() && running_iter->second >= table_concurrency_) {
+            continue;
+        }
+        if (picked == pending_jobs_.end() || iter->benefit_ > picked->benefit_) {
+            picked = iter;
+        }
+    }
+    if (picked == pending_jobs_.end()) {
+        return None;
+    }
+    Job job = std::move(*picked);
+    pending_jobs_.erase(picked);
+    ++table_running_count_[TableKey(job)];
+    return job;
 }
 
-void CompactionProcessor::ScanAndOptimize() {
-    Txn *opt_txn = txn_mgr_->BeginTxn(MakeUnique<String>("ScanAndOptimize"));
-    TransactionID txn_id = opt_txn->TxnID();
-    TxnTimeStamp begin_ts = opt_txn->BeginTS();
+void CompactionProcessor::WorkerLoop() {
+    while (true) {
+        Optional<Job> job;
+        {
+            std::unique_lock lock(job_mutex_);
+            while (!stop_workers_ && !(job = PickJob()).has_value()) {
+                job_cv_.wait(lock);
+            }
+            if (stop_workers_) {
+                return;
+            }
+        }
 
-    Vector<DBEntry *> db_entries = catalog_->Databases(txn_id, begin_ts);
-    for (auto *db_entry : db_entries) {
-        Vector<TableEntry *> table_entries = db_entry->TableCollections(txn_id, begin_ts);
-        for (auto *table_entry : table_entries) {
-            table_entry->OptimizeIndex(opt_txn);
+        bool compacted = false;
+        switch (job->type_) {
+            case JobType::kCompact: {
+                LOG_DEBUG(fmt::format("Compact table {}.{} start.", job->db_name_, job->table_name_));
+                compacted = Compact(*job);
+                LOG_DEBUG(fmt::format("Compact table {}.{} end.", job->db_name_, job->table_name_));
+                break;
+            }
+            case JobType::kOptimize: {
+                LOG_DEBUG(fmt::format("Optimize table {}.{} start.", job->db_name_, job->table_name_));
+                Optimize(*job);
+                LOG_DEBUG(fmt::format("Optimize table {}.{} done.", job->db_name_, job->table_name_));
+                break;
+            }
+        }
+        if (compacted) {
+            AddJob(*job);
         }
+        {
+            std::unique_lock lock(job_mutex_);
+            String table_key = TableKey(*job);
+            if (--table_running_count_[table_key] == 0) {
+                table_running_count_.erase(table_key);
+            }
+        }
+        job_cv_.notify_all();
+        --task_count_;
+    }
+}
+
+bool CompactionProcessor::Compact(const Job &job) {
+    Txn *txn = txn_mgr_->BeginTxn(MakeUnique<String>("Compact"));
+    auto [table_entry, status] = txn->GetTableByName(job.db_name_, job.table_name_);
+    if (!status.ok()) {
+        txn_mgr_->RollBackTxn(txn);
+        return false;
+    }
+    Vector<SegmentEntry *> compact_segments = table_entry->CheckCompaction(txn->TxnID());
+    if (compact_segments.empty()) {
+        txn_mgr_->RollBackTxn(txn);
+        return false;
+    }
+
+    auto statement = MakeUnique<AutoCompactStatement>(table_entry, std::move(compact_segments));
+    BGQueryContextWrapper wrapper(txn);
+    BGQueryState state;
+    if (!wrapper.query_context_->ExecuteBGStatement(statement.get(), state)) {
+        return false;
+    }
+    TxnTimeStamp commit_ts_out = 0;
+    return wrapper.query_context_->JoinBGStatement(state, commit_ts_out);
+}
+
+void CompactionProcessor::Optimize(const Job &job) {
+    Txn *opt_txn = txn_mgr_->BeginTxn(MakeUnique<String>("Optimize"));
+    auto [table_entry, status] = opt_txn->GetTableByName(job.db_name_, job.table_name_);
+    if (!status.ok()) {
+        txn_mgr_->RollBackTxn(opt_txn);
+        return;
     }
+    table_entry->OptimizeIndex(opt_txn);
     try {
         txn_mgr_->CommitTxn(opt_txn);
     } catch (const RecoverableException &e) {
@@ -148,6 +236,34 @@ void CompactionProcessor::ScanAndOptimize() {
     }
 }
 
+f64 CompactionProcessor::CompactBenefit(TableEntry *table_entry, Txn *txn) {
+    // The share of deleted rows and the share of small segments, which a compaction reclaims.
+    // A small segment is one of the first layer of DBT compaction, merging pays off only if there are several of them.
+    SharedPtr<BlockIndex> block_index = table_entry->GetBlockIndex(txn);
+    SizeT segment_count = block_index->segment_block_index_.size();
+    SizeT row_count = 0;
+    SizeT deleted_row_count = 0;
+    SizeT small_segment_count = 0;
+    for (const auto &[segment_id, segment_snapshot] : block_index->segment_block_index_) {
+        const SegmentEntry *segment_entry = segment_snapshot.segment_entry_;
+        SizeT segment_row_count = segment_entry->row_count();
+        SizeT actual_row_count = segment_entry->actual_row_count();
+        row_count += segment_row_count;
+        deleted_row_count += segment_row_count - actual_row_count;
+        if (actual_row_count < DBT_COMPACTION_S * DBT_COMPACTION_C) {
+            ++small_segment_count;
+        }
+    }
+    if (row_count == 0) {
+        return 0;
+    }
+    f64 benefit = static_cast<f64>(deleted_row_count) / row_count;
+    if (small_segment_count > 1) {
+        benefit += static_cast<f64>(small_segment_count) / segment_count;
+    }
+    return benefit;
+}
+
 void CompactionProcessor::Process() {
     bool running = true;
     while (running) {
@@ -160,15 +276,13 @@ void CompactionProcessor::Process() {
                     break;
                 }
                 case BGTaskType::kNotifyCompact: {
-                    LOG_DEBUG("Do compact start.");
-                    DoCompact();
-                    LOG_DEBUG("Do compact end.");
+                    LOG_DEBUG("Schedule compact jobs.");
+                    ScheduleCompact();
                     break;
                 }
                 case BGTaskType::kNotifyOptimize: {
-                    LOG_DEBUG("Optimize start.");
-                    ScanAndOptimize();
-                    LOG_DEBUG("Optimize done.");
+                    LOG_DEBUG("Schedule optimize jobs.");
+                    ScheduleOptimize();
                     break;
                 }
                 default: {
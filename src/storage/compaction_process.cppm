@@ -21,16 +21,21 @@ import txn;
 import bg_task;
 import blocking_queue;
 import base_statement;
+import third_party;
 
 namespace infinity {
 
 class Catalog;
 class TxnManager;
 class SessionManager;
+struct TableEntry;
 
+// Runs the compaction and index optimize tasks on `worker_count` threads.
+// A notification turns into one job per table, the jobs run in the order of their expected benefit and at most
+// `table_concurrency` of them run on the same table at the same time.
 export class CompactionProcessor {
 public:
-    CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr);
+    CompactionProcessor(Catalog *catalog, TxnManager *txn_mgr, SizeT worker_count = 1, SizeT table_concurrency = 1);
 
     void Start();
 
@@ -38,8 +43,7 @@ public:
 
     void Submit(SharedPtr<BGTask> bg_task);
 
-    void DoCompact();
-
+    // Background tasks and jobs, either queued or running
     u64 RunningTaskCount() const { return task_count_; }
 
     TxnTimeStamp ManualDoCompact(const String &schema_name,
@@ -48,9 +52,37 @@ public:
                                  Optional<std::function<void()>> mid_func = None); // false unit test
 
 private:
-    Vector<Pair<UniquePtr<BaseStatement>, Txn *>> ScanForCompact(Txn *scan_txn);
+    enum class JobType : u8 {
+        kCompact,
+        kOptimize,
+    };
+
+    struct Job {
+        JobType type_{JobType::kCompact};
+        String db_name_{};
+        String table_name_{};
+        f64 benefit_{}; // jobs with more benefit run first
+    };
+
+    void ScheduleCompact();
+
+    void ScheduleOptimize();
+
+    void AddJob(Job job);
+
+    // Called with `job_mutex_` held. Returns the job with the most benefit among the tables below the concurrency limit.
+    Optional<Job> PickJob();
 
-    void ScanAndOptimize();
+    void WorkerLoop();
+
+    // Returns true if a compaction is committed, so the table may have more segments to compact
+    bool Compact(const Job &job);
+
+    void Optimize(const Job &job);
+
+    static f64 CompactBenefit(TableEntry *table_entry, Txn *txn);
+
+    static String TableKey(const Job &job) { return fmt::format("{}.{}", job.db_name_, job.table_name_); }
 
     void Process();
 
@@ -63,6 +95,16 @@ private:
     TxnManager *txn_mgr_{};
     SessionManager *session_mgr_{};
 
+    const SizeT worker_count_{};
+    const SizeT table_concurrency_{};
+    Vector<Thread> worker_threads_{};
+
+    std::mutex job_mutex_{};
+    std::condition_variable job_cv_{};
+    bool stop_workers_{false};
+    List<Job> pending_jobs_{};
+    HashMap<String, SizeT> table_running_count_{};
+
     Atomic<u64> task_count_{};
 };
 
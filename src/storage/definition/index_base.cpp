@@ -202,7 +202,11 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
         }
         case IndexType::kFullText: {
             String analyzer = index_def_json["analyzer"];
-            auto ptr = MakeShared<IndexFullText>(index_name, file_name, std::move(column_names), analyzer);
+            optionflag_t flag = OPTION_FLAG_ALL;
+            if (index_def_json.contains("flag")) {
+                flag = index_def_json["flag"];
+            }
+            auto ptr = MakeShared<IndexFullText>(index_name, file_name, std::move(column_names), analyzer, flag);
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
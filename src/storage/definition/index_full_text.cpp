@@ -44,6 +44,8 @@ SharedPtr<IndexBase> IndexFullText::Make(SharedPtr<String> index_name,
                                          const Vector<InitParameter *> &index_param_list) {
     String analyzer_name{};
     u64 flag = OPTION_FLAG_ALL;
+    String codec_name{};
+    String norm_name{};
     SizeT param_count = index_param_list.size();
     for (SizeT param_idx = 0; param_idx < param_count; ++param_idx) {
         InitParameter *parameter = index_param_list[param_idx];
@@ -53,8 +55,32 @@ SharedPtr<IndexBase> IndexFullText::Make(SharedPtr<String> index_name,
             analyzer_name = parameter->param_value_;
         } else if (para_name == "flag") {
             flag = std::strtoul(parameter->param_value_.c_str(), nullptr, 10);
+        } else if (para_name == "codec") {
+            codec_name = parameter->param_value_;
+            ToLowerString(codec_name);
+        } else if (para_name == "norm") {
+            norm_name = parameter->param_value_;
+            ToLowerString(norm_name);
         }
     }
+    if (codec_name == "streamvbyte") {
+        flag = SetPostingCodec(flag, PostingCodec::kStreamVByte);
+    } else if (codec_name == "simdbp128") {
+        flag = SetPostingCodec(flag, PostingCodec::kSIMDBitPacking);
+    } else if (!codec_name.empty()) {
+        Status status = Status::InvalidIndexDefinition(fmt::format("Unknown posting codec: {}, expect simdbp128 or streamvbyte.", codec_name));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    if (norm_name == "quantized") {
+        flag |= of_quantized_norm;
+    } else if (norm_name == "exact") {
+        flag &= ~u64(of_quantized_norm);
+    } else if (!norm_name.empty()) {
+        Status status = Status::InvalidIndexDefinition(fmt::format("Unknown norm: {}, expect exact or quantized.", norm_name));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
     if (analyzer_name.empty()) {
         analyzer_name = "standard";
     }
@@ -69,7 +95,7 @@ bool IndexFullText::operator==(const IndexFullText &other) const {
     if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
         return false;
     }
-    return analyzer_ == other.analyzer_;
+    return analyzer_ == other.analyzer_ && flag_ == other.flag_;
 }
 
 bool IndexFullText::operator!=(const IndexFullText &other) const { return !(*this == other); }
@@ -107,6 +133,7 @@ String IndexFullText::BuildOtherParamsString() const {
 nlohmann::json IndexFullText::Serialize() const {
     nlohmann::json res = IndexBase::Serialize();
     res["analyzer"] = analyzer_;
+    res["flag"] = flag_;
     return res;
 }
 
@@ -34,6 +34,15 @@ ColumnIndexIterator::ColumnIndexIterator(const String &index_dir, const String &
     posting_decoder_ = MakeShared<PostingDecoder>(format_option);
 }
 
+ColumnIndexIterator::ColumnIndexIterator(const String &index_dir,
+                                         const String &base_name,
+                                         optionflag_t flag,
+                                         const String &min_term,
+                                         const String &max_term)
+    : ColumnIndexIterator(index_dir, base_name, flag) {
+    dict_reader_->InitRangeIterator(min_term, max_term);
+}
+
 ColumnIndexIterator::~ColumnIndexIterator() {
     ByteSlice::DestroySlice(doc_list_slice_);
     ByteSlice::DestroySlice(pos_list_slice_);
@@ -44,6 +53,8 @@ bool ColumnIndexIterator::Next(String &key, PostingDecoder *&decoder) {
     if (!ret)
         return false;
     u32 total_len = 0;
+    // postings are read sequentially, the seek only moves the file pointer when iterating a term range
+    posting_file_->Seek(term_meta_.doc_start_);
     DecodeDocList();
     DecodePosList();
 
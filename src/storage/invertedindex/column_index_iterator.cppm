@@ -19,6 +19,9 @@ export class ColumnIndexIterator {
 public:
     ColumnIndexIterator(const String &index_dir, const String &base_name, optionflag_t flag);
 
+    // Iterate terms in [min_term, max_term) only, an empty bound is unbounded.
+    ColumnIndexIterator(const String &index_dir, const String &base_name, optionflag_t flag, const String &min_term, const String &max_term);
+
     ~ColumnIndexIterator();
 
     bool Next(String &term, PostingDecoder *&decoder);
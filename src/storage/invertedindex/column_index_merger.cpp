@@ -1,6 +1,7 @@
 module;
 
 #include <cassert>
+#include <filesystem>
 #include <fstream>
 #include <string>
 
@@ -17,7 +18,6 @@ import term_meta;
 import index_full_text;
 import column_index_iterator;
 import segment_term_posting;
-import fst;
 import internal_types;
 import posting_byte_slice_reader;
 import posting_merger;
@@ -27,9 +27,12 @@ import file_system_type;
 import infinity_exception;
 import vector_with_lock;
 import logger;
+import dict_reader;
+import posting_partition;
 
 namespace infinity {
-ColumnIndexMerger::ColumnIndexMerger(const String &index_dir, optionflag_t flag) : index_dir_(index_dir), flag_(flag) {}
+ColumnIndexMerger::ColumnIndexMerger(const String &index_dir, optionflag_t flag, SizeT partition_count)
+    : index_dir_(index_dir), flag_(flag), partition_count_(partition_count) {}
 
 ColumnIndexMerger::~ColumnIndexMerger() {}
 
@@ -43,20 +46,7 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
     Path path = Path(index_dir_) / dst_base_name;
     String index_prefix = path.string();
     String dict_file = index_prefix + DICT_SUFFIX;
-    String fst_file = dict_file + ".fst";
-    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs_, dict_file, 1024);
-    TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
     String posting_file = index_prefix + POSTING_SUFFIX;
-    posting_file_writer_ = MakeShared<FileWriter>(fs_, posting_file, 1024);
-
-    std::ofstream ofs(fst_file.c_str(), std::ios::binary | std::ios::trunc);
-    OstreamWriter wtr(ofs);
-    FstBuilder fst_builder(wtr);
-
-    SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_);
-    String term;
-    TermMeta term_meta;
-    SizeT term_meta_offset = 0;
 
     auto merge_base_rowid = base_rowids[0];
     for (auto& row_id : base_rowids) {
@@ -102,32 +92,74 @@ void ColumnIndexMerger::Merge(const Vector<String> &base_names, const Vector<Row
         fs_.Close(*file_handler);
     }
 
-    while (!term_posting_queue.Empty()) {
-        const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
-
-        MergeTerm(term, term_meta, merging_term_postings, merge_base_rowid);
-
-        term_meta_dumpler.Dump(dict_file_writer, term_meta);
-
-        fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
-        term_meta_offset = dict_file_writer->TotalWrittenBytes();
-        term_posting_queue.MoveToNextTerm();
-    }
-    dict_file_writer->Sync();
-    posting_file_writer_->Sync();
-    fst_builder.Finish();
-    fs_.AppendFile(dict_file, fst_file);
-    fs_.DeleteFile(fst_file);
+    // Terms are merged in ranges on several threads, each range into its own posting file
+    Vector<String> split_terms = SplitTerms(base_names);
+    PostingPartitionWriter partition_writer(posting_file, dict_file, flag_, split_terms.size() + 1, 128000);
+    partition_writer.Run([&](SizeT partition_id) {
+        String min_term = partition_id == 0 ? String() : split_terms[partition_id - 1];
+        String max_term = partition_id == split_terms.size() ? String() : split_terms[partition_id];
+        const SharedPtr<FileWriter> &posting_file_writer = partition_writer.GetPostingFileWriter(partition_id);
+        SegmentTermPostingQueue term_posting_queue(index_dir_, base_names, base_rowids, flag_, min_term, max_term);
+        String term;
+        TermMeta term_meta;
+        while (!term_posting_queue.Empty()) {
+            const Vector<SegmentTermPosting *> &merging_term_postings = term_posting_queue.GetCurrentMerging(term);
+
+            MergeTerm(term, term_meta, merging_term_postings, merge_base_rowid, posting_file_writer);
+
+            partition_writer.AddTerm(partition_id, term, term_meta);
+            term_posting_queue.MoveToNextTerm();
+        }
+    });
+    partition_writer.Finish();
 }
 
 void ColumnIndexMerger::MergeTerm(const String &term,
                                   TermMeta &term_meta,
                                   const Vector<SegmentTermPosting *> &merging_term_postings,
-                                  const RowID &merge_base_rowid) {
+                                  const RowID &merge_base_rowid,
+                                  const SharedPtr<FileWriter> &posting_file_writer) {
     SharedPtr<PostingMerger> posting_merger = CreatePostingMerger();
     posting_merger->Merge(merging_term_postings, merge_base_rowid);
 
-    posting_merger->Dump(posting_file_writer_, term_meta);
+    posting_merger->Dump(posting_file_writer, term_meta);
+}
+
+Vector<String> ColumnIndexMerger::SplitTerms(const Vector<String> &base_names) {
+    SizeT total_posting_bytes = 0;
+    SizeT largest_posting_bytes = 0;
+    SizeT largest_idx = 0;
+    for (SizeT i = 0; i < base_names.size(); ++i) {
+        String posting_file = (Path(index_dir_) / base_names[i]).string() + POSTING_SUFFIX;
+        SizeT posting_bytes = std::filesystem::file_size(posting_file);
+        total_posting_bytes += posting_bytes;
+        if (posting_bytes > largest_posting_bytes) {
+            largest_posting_bytes = posting_bytes;
+            largest_idx = i;
+        }
+    }
+    SizeT partition_count = partition_count_ > 0 ? partition_count_ : PostingPartitionWriter::SuggestPartitionCount(total_posting_bytes);
+    Vector<String> split_terms;
+    if (partition_count <= 1 || largest_posting_bytes == 0) {
+        return split_terms;
+    }
+
+    // The posting offsets in the dictionary of the largest source approximate the distribution of the merged postings over terms
+    String dict_file = (Path(index_dir_) / base_names[largest_idx]).string() + DICT_SUFFIX;
+    DictionaryReader dict_reader(dict_file, PostingFormatOption(flag_));
+    String term;
+    TermMeta term_meta;
+    SizeT split_idx = 1;
+    while (split_idx < partition_count && dict_reader.Next(term, term_meta)) {
+        if (term_meta.doc_start_ * partition_count < largest_posting_bytes * split_idx) {
+            continue;
+        }
+        split_terms.push_back(term);
+        while (split_idx < partition_count && term_meta.doc_start_ * partition_count >= largest_posting_bytes * split_idx) {
+            ++split_idx;
+        }
+    }
+    return split_terms;
 }
 
 } // namespace infinity
\ No newline at end of file
@@ -20,7 +20,8 @@ import vector_with_lock;
 namespace infinity {
 export class ColumnIndexMerger {
 public:
-    ColumnIndexMerger(const String &index_dir, optionflag_t flag);
+    // partition_count is the number of term ranges merged in parallel, 0 picks it by the size of the postings to merge.
+    ColumnIndexMerger(const String &index_dir, optionflag_t flag, SizeT partition_count = 0);
     ~ColumnIndexMerger();
 
     void Merge(const Vector<String> &base_names, const Vector<RowID> &base_rowids, const String &dst_base_name);
@@ -28,11 +29,18 @@ public:
 private:
     SharedPtr<PostingMerger> CreatePostingMerger();
 
-    void MergeTerm(const String &term, TermMeta &term_meta, const Vector<SegmentTermPosting *> &merging_term_postings, const RowID &merge_base_rowid);
+    void MergeTerm(const String &term,
+                   TermMeta &term_meta,
+                   const Vector<SegmentTermPosting *> &merging_term_postings,
+                   const RowID &merge_base_rowid,
+                   const SharedPtr<FileWriter> &posting_file_writer);
+
+    // Returns the first term of each partition but the first one.
+    Vector<String> SplitTerms(const Vector<String> &base_names);
 
     String index_dir_;
     optionflag_t flag_;
-    SharedPtr<FileWriter> posting_file_writer_;
+    SizeT partition_count_;
     LocalFileSystem fs_;
 
     // for column length info
@@ -0,0 +1,68 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+
+export module column_length_norm;
+
+import stl;
+
+namespace infinity {
+
+// A column length quantized to a byte, used by BM25 when the index is created with norm = quantized.
+// Lengths below NORM_EXACT_LENGTH_COUNT are exact, larger ones are a float with a 3 bits mantissa, like Lucene's SmallFloat.intToByte4.
+// Lengths are rounded up, so a quantized length never makes a score exceed the block max bound computed from the exact lengths.
+constexpr u32 NORM_EXACT_LENGTH_COUNT = 24;
+
+constexpr u32 Int4ToLength(u32 i) {
+    u32 bits = i & 0x07;
+    u32 shift = i >> 3;
+    return shift == 0 ? bits : (bits | 0x08) << (shift - 1);
+}
+
+constexpr u32 LengthToInt4(u32 length) {
+    u32 bit_count = std::bit_width(length);
+    if (bit_count < 4) {
+        return length;
+    }
+    u32 shift = bit_count - 4;
+    return ((length >> shift) & 0x07) | ((shift + 1) << 3);
+}
+
+constexpr Array<u32, 256> MakeNormLengthTable() {
+    Array<u32, 256> table{};
+    for (u32 norm = 0; norm < 256; ++norm) {
+        table[norm] = norm < NORM_EXACT_LENGTH_COUNT ? norm : Int4ToLength(norm - NORM_EXACT_LENGTH_COUNT) + NORM_EXACT_LENGTH_COUNT;
+    }
+    return table;
+}
+
+constexpr Array<u32, 256> NORM_LENGTH_TABLE = MakeNormLengthTable();
+
+export inline u32 NormToColumnLength(u8 norm) { return NORM_LENGTH_TABLE[norm]; }
+
+export inline u8 ColumnLengthToNorm(u32 column_length) {
+    if (column_length < NORM_EXACT_LENGTH_COUNT) {
+        return column_length;
+    }
+    u32 norm = std::min<u32>(LengthToInt4(column_length - NORM_EXACT_LENGTH_COUNT) + NORM_EXACT_LENGTH_COUNT, 255);
+    if (norm < 255 && NORM_LENGTH_TABLE[norm] < column_length) {
+        ++norm;
+    }
+    return norm;
+}
+
+} // namespace infinity
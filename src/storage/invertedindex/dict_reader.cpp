@@ -69,6 +69,12 @@ void DictionaryReader::InitIterator(const String &min, const String &max) {
 
 void DictionaryReader::InitIterator(const String &prefix) { s_->Reset((u8 *)prefix.c_str(), prefix.length()); }
 
+void DictionaryReader::InitRangeIterator(const String &min, const String &max) {
+    Bound min_bound(Bound::kIncluded, (u8 *)min.c_str(), min.length());
+    Bound max_bound = max.empty() ? Bound() : Bound(Bound::kExcluded, (u8 *)max.c_str(), max.length());
+    s_->Reset(min_bound, max_bound);
+}
+
 bool DictionaryReader::Next(String &term, TermMeta &term_meta) {
     Vector<u8> key;
     u64 val;
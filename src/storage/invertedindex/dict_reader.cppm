@@ -42,6 +42,9 @@ public:
 
     void InitIterator(const String &prefix);
 
+    // Iterate terms in [min, max), an empty bound is unbounded.
+    void InitRangeIterator(const String &min, const String &max);
+
     bool Next(String &term, TermMeta &term_meta);
 };
 } // namespace infinity
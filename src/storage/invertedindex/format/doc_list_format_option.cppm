@@ -41,6 +41,7 @@ public:
         }
         short_list_vbyte_compress_ = 0;
         has_block_max_ = (option_flag & of_block_max) ? 1 : 0;
+        posting_codec_ = static_cast<u8>(infinity::GetPostingCodec(option_flag));
         unused_ = 0;
         // when has_block_max_ is set, has_tf_list_ must also be set
         if (has_block_max_ and !has_tf_list_) {
@@ -52,9 +53,11 @@ public:
     bool HasTfList() const { return has_tf_list_ == 1; }
     bool HasDocPayload() const { return has_doc_payload_ == 1; }
     bool HasBlockMax() const { return has_block_max_ == 1; }
+    PostingCodec GetPostingCodec() const { return static_cast<PostingCodec>(posting_codec_); }
     bool operator==(const DocListFormatOption &right) const {
         return has_tf_ == right.has_tf_ && has_tf_list_ == right.has_tf_list_ && has_doc_payload_ == right.has_doc_payload_ &&
-               short_list_vbyte_compress_ == right.short_list_vbyte_compress_ && has_block_max_ == right.has_block_max_;
+               short_list_vbyte_compress_ == right.short_list_vbyte_compress_ && has_block_max_ == right.has_block_max_ &&
+               posting_codec_ == right.posting_codec_;
     }
     bool IsShortListVbyteCompress() const { return short_list_vbyte_compress_ == 1; }
     void SetShortListVbyteCompress(bool flag) { short_list_vbyte_compress_ = flag ? 1 : 0; }
@@ -65,7 +68,8 @@ private:
     u8 has_doc_payload_ : 1;
     u8 short_list_vbyte_compress_ : 1;
     u8 has_block_max_ : 1;
-    u8 unused_ : 3;
+    u8 posting_codec_ : 2;
+    u8 unused_ : 1;
 };
 
 export class DocSkipListFormat : public PostingFields {
@@ -86,7 +90,7 @@ private:
             TypedPostingField<u32> *doc_id_field = new TypedPostingField<u32>;
             doc_id_field->location_ = row_count++;
             doc_id_field->offset_ = offset;
-            doc_id_field->encoder_ = GetSkipListEncoder();
+            doc_id_field->encoder_ = GetSkipListEncoder(option.GetPostingCodec());
             values_.push_back(doc_id_field);
             offset += sizeof(u32);
         }
@@ -95,7 +99,7 @@ private:
             TypedPostingField<u32> *tf_field = new TypedPostingField<u32>;
             tf_field->location_ = row_count++;
             tf_field->offset_ = offset;
-            tf_field->encoder_ = GetSkipListEncoder();
+            tf_field->encoder_ = GetSkipListEncoder(option.GetPostingCodec());
             values_.push_back(tf_field);
             offset += sizeof(u32);
         }
@@ -105,7 +109,7 @@ private:
             TypedPostingField<u32> *max_tf_field = new TypedPostingField<u32>;
             max_tf_field->location_ = row_count++;
             max_tf_field->offset_ = offset;
-            max_tf_field->encoder_ = GetSkipListEncoder();
+            max_tf_field->encoder_ = GetSkipListEncoder(option.GetPostingCodec());
             values_.push_back(max_tf_field);
             offset += sizeof(u32);
             // max_percentage in a block (max tf / doc_len, quantized to u16)
@@ -120,7 +124,7 @@ private:
             TypedPostingField<u32> *offset_field = new TypedPostingField<u32>;
             offset_field->location_ = row_count++;
             offset_field->offset_ = offset;
-            offset_field->encoder_ = GetSkipListEncoder();
+            offset_field->encoder_ = GetSkipListEncoder(option.GetPostingCodec());
             values_.push_back(offset_field);
         }
     }
@@ -152,7 +156,7 @@ private:
             TypedPostingField<u32> *doc_id_field = new TypedPostingField<u32>;
             doc_id_field->location_ = row_count++;
             doc_id_field->offset_ = offset;
-            doc_id_field->encoder_ = GetDocIDEncoder();
+            doc_id_field->encoder_ = GetDocIDEncoder(option.GetPostingCodec());
             values_.push_back(doc_id_field);
             offset += sizeof(u32);
         }
@@ -160,7 +164,7 @@ private:
             TypedPostingField<u32> *tf_field = new TypedPostingField<u32>;
             tf_field->location_ = row_count++;
             tf_field->offset_ = offset;
-            tf_field->encoder_ = GetTFEncoder();
+            tf_field->encoder_ = GetTFEncoder(option.GetPostingCodec());
             values_.push_back(tf_field);
             offset += sizeof(u32);
         }
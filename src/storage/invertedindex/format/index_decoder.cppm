@@ -55,8 +55,8 @@ public:
                      const DocListFormatOption &doc_list_format_option)
         : IndexDecoder(doc_list_format_option), skiplist_reader_(nullptr), doc_list_reader_(doc_list_reader),
           doc_list_begin_pos_(doc_list_begin) {
-        doc_id_encoder_ = GetDocIDEncoder();
-        tf_list_encoder_ = GetTFEncoder();
+        doc_id_encoder_ = GetDocIDEncoder(doc_list_format_option.GetPostingCodec());
+        tf_list_encoder_ = GetTFEncoder(doc_list_format_option.GetPostingCodec());
         doc_payload_encoder_ = GetDocPayloadEncoder();
     }
 
@@ -66,7 +66,7 @@ void PositionListDecoder::Init(ByteSlice *pos_list, tf_t total_tf, u32 pos_list_
     pos_single_slice_ = pos_list;
 
     total_tf_ = total_tf;
-    pos_encoder_ = GetPosListEncoder();
+    pos_encoder_ = GetPosListEncoder(option_.GetPosListFormatOption().GetPostingCodec());
 
     if (!option_.HasPositionList()) {
         return;
@@ -88,7 +88,7 @@ void PositionListDecoder::Init(ByteSlice *pos_list, tf_t total_tf, u32 pos_list_
 
 void PositionListDecoder::Init(const ByteSliceList *pos_list, tf_t total_tf, u32 pos_list_begin, InDocPositionState *state) {
     total_tf_ = total_tf;
-    pos_encoder_ = GetPosListEncoder();
+    pos_encoder_ = GetPosListEncoder(option_.GetPosListFormatOption().GetPostingCodec());
 
     if (!option_.HasPositionList()) {
         return;
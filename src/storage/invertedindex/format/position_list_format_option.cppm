@@ -14,16 +14,22 @@ public:
 
     inline void Init(optionflag_t option_flag) {
         has_position_list_ = option_flag & of_position_list ? 1 : 0;
+        posting_codec_ = static_cast<u8>(infinity::GetPostingCodec(option_flag));
         unused_ = 0;
     }
 
     bool HasPositionList() const { return has_position_list_ == 1; }
 
-    bool operator==(const PositionListFormatOption &right) const { return has_position_list_ == right.has_position_list_; }
+    PostingCodec GetPostingCodec() const { return static_cast<PostingCodec>(posting_codec_); }
+
+    bool operator==(const PositionListFormatOption &right) const {
+        return has_position_list_ == right.has_position_list_ && posting_codec_ == right.posting_codec_;
+    }
 
 private:
     u8 has_position_list_ : 1;
-    u8 unused_ : 7;
+    u8 posting_codec_ : 2;
+    u8 unused_ : 5;
 };
 
 export class PositionSkipListFormat : public PostingFields {
@@ -39,7 +45,7 @@ public:
             TypedPostingField<u32> *total_pos_field = new TypedPostingField<u32>;
             total_pos_field->location_ = row_count++;
             total_pos_field->offset_ = offset;
-            total_pos_field->encoder_ = GetPosListEncoder();
+            total_pos_field->encoder_ = GetPosListEncoder(option.GetPostingCodec());
             values_.push_back(total_pos_field);
             offset += sizeof(u32);
         }
@@ -47,7 +53,7 @@ public:
             TypedPostingField<u32> *offset_field = new TypedPostingField<u32>;
             offset_field->location_ = row_count++;
             offset_field->offset_ = offset;
-            offset_field->encoder_ = GetPosListEncoder();
+            offset_field->encoder_ = GetPosListEncoder(option.GetPostingCodec());
             values_.push_back(offset_field);
         }
     }
@@ -77,7 +83,7 @@ private:
             TypedPostingField<u32> *pos_field = new TypedPostingField<u32>;
             pos_field->location_ = row_count++;
             pos_field->offset_ = offset;
-            pos_field->encoder_ = GetPosListEncoder();
+            pos_field->encoder_ = GetPosListEncoder(option.GetPostingCodec());
             values_.push_back(pos_field);
             offset += sizeof(u32);
         }
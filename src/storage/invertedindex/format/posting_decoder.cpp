@@ -99,9 +99,9 @@ u32 PostingDecoder::DecodePosList(pos_t *pos_list_buf, SizeT len) {
 }
 
 void PostingDecoder::InitDocListEncoder(const DocListFormatOption &doc_list_format_option, df_t df) {
-    doc_id_encoder_ = GetDocIDEncoder();
+    doc_id_encoder_ = GetDocIDEncoder(doc_list_format_option.GetPostingCodec());
     if (doc_list_format_option.HasTfList()) {
-        tf_list_encoder_ = GetTFEncoder();
+        tf_list_encoder_ = GetTFEncoder(doc_list_format_option.GetPostingCodec());
     }
 
     if (doc_list_format_option.HasDocPayload()) {
@@ -113,6 +113,6 @@ void PostingDecoder::InitPosListEncoder(const PositionListFormatOption &position
     if (!position_list_format_option.HasPositionList()) {
         return;
     }
-    position_encoder_ = GetPosListEncoder();
+    position_encoder_ = GetPosListEncoder(position_list_format_option.GetPostingCodec());
 }
 } // namespace infinity
\ No newline at end of file
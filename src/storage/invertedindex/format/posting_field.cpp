@@ -4,13 +4,16 @@ import stl;
 import int_encoder;
 import no_compress_encoder;
 import vbyte_compress_encoder;
+import fastpfor;
+import index_defines;
 
 module posting_field;
 
 namespace infinity {
 
 struct EncoderProvider {
-    UniquePtr<Int32Encoder> int32_encoder_ = MakeUnique<Int32Encoder>();
+    UniquePtr<Int32Encoder> int32_encoder_ = MakeUnique<FastPForInt32Encoder<FastPForCodec::SIMDBitPacking>>();
+    UniquePtr<Int32Encoder> streamvbyte_int32_encoder_ = MakeUnique<FastPForInt32Encoder<FastPForCodec::StreamVByte>>();
     UniquePtr<Int16Encoder> int16_encoder_ = MakeUnique<Int16Encoder>();
     UniquePtr<NoCompressEncoder> no_compress_encoder_ = MakeUnique<NoCompressEncoder>();
     UniquePtr<VByteCompressEncoder> vbyte_compress_encoder_ = MakeUnique<VByteCompressEncoder>();
@@ -20,7 +23,14 @@ struct EncoderProvider {
         return &instance;
     }
 
-    Int32Encoder *GetInt32Encoder() { return int32_encoder_.get(); }
+    Int32Encoder *GetInt32Encoder(PostingCodec codec) {
+        switch (codec) {
+            case PostingCodec::kStreamVByte:
+                return streamvbyte_int32_encoder_.get();
+            default:
+                return int32_encoder_.get();
+        }
+    }
 
     Int16Encoder *GetInt16Encoder() { return int16_encoder_.get(); }
 
@@ -29,16 +39,16 @@ struct EncoderProvider {
     VByteCompressEncoder *GetVByteCompressEncoder() { return vbyte_compress_encoder_.get(); }
 };
 
-const Int32Encoder *GetDocIDEncoder() { return EncoderProvider::GetInstance()->GetInt32Encoder(); }
+const Int32Encoder *GetDocIDEncoder(PostingCodec codec) { return EncoderProvider::GetInstance()->GetInt32Encoder(codec); }
 
-const Int32Encoder *GetTFEncoder() { return EncoderProvider::GetInstance()->GetInt32Encoder(); }
+const Int32Encoder *GetTFEncoder(PostingCodec codec) { return EncoderProvider::GetInstance()->GetInt32Encoder(codec); }
 
 const Int16Encoder *GetDocPayloadEncoder() { return EncoderProvider::GetInstance()->GetInt16Encoder(); }
 
 const Int16Encoder *GetTermPercentageEncoder() { return EncoderProvider::GetInstance()->GetInt16Encoder(); }
 
-const Int32Encoder *GetSkipListEncoder() { return EncoderProvider::GetInstance()->GetInt32Encoder(); }
+const Int32Encoder *GetSkipListEncoder(PostingCodec codec) { return EncoderProvider::GetInstance()->GetInt32Encoder(codec); }
 
-const Int32Encoder *GetPosListEncoder() { return EncoderProvider::GetInstance()->GetInt32Encoder(); }
+const Int32Encoder *GetPosListEncoder(PostingCodec codec) { return EncoderProvider::GetInstance()->GetInt32Encoder(codec); }
 
 } // namespace infinity
\ No newline at end of file
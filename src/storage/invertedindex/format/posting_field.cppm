@@ -7,6 +7,7 @@ import byte_slice_reader;
 import byte_slice_writer;
 import no_compress_encoder;
 import vbyte_compress_encoder;
+import index_defines;
 
 export module posting_field;
 
@@ -43,8 +44,34 @@ struct ValueTypeTraits<u32> {
     static const PostingField::ValueType TYPE = PostingField::U32;
 };
 
-// export typedef IntEncoder<u32, NewPForDeltaCompressor> Int32Encoder;
-export typedef IntEncoder<u32, SIMDBitPacking> Int32Encoder;
+// Encoder of the u32 streams of a posting list, its block codec is chosen per index, see PostingCodec
+export class Int32Encoder {
+public:
+    virtual ~Int32Encoder() = default;
+
+    // src_len: number of elements in src. Return number of bytes after compression
+    virtual u32 Encode(ByteSliceWriter &slice_writer, const u32 *src, u32 src_len) const = 0;
+
+    // return number of elements
+    virtual u32 Decode(u32 *dest, u32 dest_len, ByteSliceReader &slice_reader) const = 0;
+
+    // Appends the next encoded block to dest without decoding it, so that it can be decoded later
+    virtual void CopyEncoded(ByteSliceReader &slice_reader, Vector<u8> &dest) const = 0;
+};
+
+export template <FastPForCodec Codec>
+class FastPForInt32Encoder final : public Int32Encoder {
+public:
+    u32 Encode(ByteSliceWriter &slice_writer, const u32 *src, u32 src_len) const override { return encoder_.Encode(slice_writer, src, src_len); }
+
+    u32 Decode(u32 *dest, u32 dest_len, ByteSliceReader &slice_reader) const override { return encoder_.Decode(dest, dest_len, slice_reader); }
+
+    void CopyEncoded(ByteSliceReader &slice_reader, Vector<u8> &dest) const override { encoder_.CopyEncoded(slice_reader, dest); }
+
+private:
+    IntEncoder<u32, FastPForWrapper<Codec>> encoder_{};
+};
+
 export typedef IntEncoder<u16, NewPForDeltaCompressor> Int16Encoder;
 export typedef NoCompressIntEncoder<u32> NoCompressEncoder;
 export typedef VByteIntEncoder<u32> VByteCompressEncoder;
@@ -60,21 +87,20 @@ struct EncoderTypeTraits<u16> {
 };
 template <>
 struct EncoderTypeTraits<u32> {
-    // typedef IntEncoder<u32, NewPForDeltaCompressor> Encoder;
-    typedef IntEncoder<u32, SIMDBitPacking> Encoder;
+    typedef Int32Encoder Encoder;
 };
 
-export const Int32Encoder *GetDocIDEncoder();
+export const Int32Encoder *GetDocIDEncoder(PostingCodec codec = PostingCodec::kSIMDBitPacking);
 
-export const Int32Encoder *GetTFEncoder();
+export const Int32Encoder *GetTFEncoder(PostingCodec codec = PostingCodec::kSIMDBitPacking);
 
 export const Int16Encoder *GetDocPayloadEncoder();
 
 export const Int16Encoder *GetTermPercentageEncoder();
 
-export const Int32Encoder *GetSkipListEncoder();
+export const Int32Encoder *GetSkipListEncoder(PostingCodec codec = PostingCodec::kSIMDBitPacking);
 
-export const Int32Encoder *GetPosListEncoder();
+export const Int32Encoder *GetPosListEncoder(PostingCodec codec = PostingCodec::kSIMDBitPacking);
 
 export template <typename T>
 struct TypedPostingField : public PostingField {
@@ -10,6 +10,8 @@ import flush_info;
 import infinity_exception;
 import logger;
 import third_party;
+import byte_slice_reader;
+import index_defines;
 
 namespace infinity {
 
@@ -48,8 +50,8 @@ bool SkipListReader::SkipTo(u32 query_doc_id, u32 &doc_id, u32 &prev_doc_id, u32
             current_offset_ = current_offset;
             current_ttf_ = current_ttf;
             if (has_block_max_) {
-                current_block_max_tf_ = block_max_tf_buffer_[current_cursor];
-                current_block_max_tf_percentage_ = block_max_tf_percentage_buffer_[current_cursor];
+                current_block_max_cursor_ = current_cursor;
+                current_block_max_loaded_ = false;
             }
             prev_doc_id = prev_doc_id_ = local_prev_doc_id;
             offset = prev_offset_ = local_prev_offset;
@@ -123,10 +125,10 @@ void SkipListReaderByteSlice::Load(ByteSlice *byte_slice, u32 start, u32 end) {
 Pair<int, bool> SkipListReaderByteSlice::LoadBuffer() {
     u32 end = byte_slice_reader_.Tell();
     if (end < end_) {
-        const Int32Encoder *doc_id_encoder = GetSkipListEncoder();
+        const Int32Encoder *doc_id_encoder = GetSkipListEncoder(posting_codec_);
         u32 doc_num = doc_id_encoder->Decode(static_cast<u32 *>(doc_id_buffer_), SKIP_LIST_BUFFER_SIZE, byte_slice_reader_);
         if (has_tf_list_) {
-            const Int32Encoder *tf_encoder = GetSkipListEncoder();
+            const Int32Encoder *tf_encoder = GetSkipListEncoder(posting_codec_);
             u32 ttf_num = tf_encoder->Decode(ttf_buffer_.get(), SKIP_LIST_BUFFER_SIZE, byte_slice_reader_);
             if (ttf_num != doc_num) {
                 String error_message = fmt::format("SKipList decode error, doc_num = {} ttf_num = {}", doc_num, ttf_num);
@@ -137,25 +139,15 @@ Pair<int, bool> SkipListReaderByteSlice::LoadBuffer() {
             }
         }
         if (has_block_max_) {
-            const Int32Encoder *block_max_tf_encoder = GetSkipListEncoder();
-            u32 block_max_tf_num = block_max_tf_encoder->Decode(block_max_tf_buffer_.get(), SKIP_LIST_BUFFER_SIZE, byte_slice_reader_);
-            if (block_max_tf_num != doc_num) {
-                String error_message = fmt::format("SKipList decode error, doc_num = {} block_max_tf_num = {}", doc_num, block_max_tf_num);
-                LOG_ERROR(error_message);
-                UnrecoverableError(error_message);
-                return MakePair(-1, false);
-            }
-            const Int16Encoder *tf_percentage_encoder = GetTermPercentageEncoder();
-            u32 tf_percentage_num = tf_percentage_encoder->Decode(block_max_tf_percentage_buffer_.get(), SKIP_LIST_BUFFER_SIZE, byte_slice_reader_);
-            if (tf_percentage_num != doc_num) {
-                String error_message = fmt::format("SKipList decode error, doc_num = {} block_max_tf_percentage_num = {}", doc_num, tf_percentage_num);
-                LOG_ERROR(error_message);
-                UnrecoverableError(error_message);
-                return MakePair(-1, false);
-            }
+            // only block max iterators read these columns, keep them encoded until then
+            block_max_bytes_.clear();
+            GetSkipListEncoder(posting_codec_)->CopyEncoded(byte_slice_reader_, block_max_bytes_);
+            GetTermPercentageEncoder()->CopyEncoded(byte_slice_reader_, block_max_bytes_);
+            block_max_num_ = doc_num;
+            block_max_buffer_decoded_ = false;
         }
         {
-            const Int32Encoder *offset_encoder = GetSkipListEncoder();
+            const Int32Encoder *offset_encoder = GetSkipListEncoder(posting_codec_);
             u32 len_num = offset_encoder->Decode(static_cast<u32 *>(offset_buffer_), SKIP_LIST_BUFFER_SIZE, byte_slice_reader_);
             if (len_num != doc_num) {
                 String error_message = fmt::format("SKipList decode error, doc_num = {} offset_num = {}", doc_num, len_num);
@@ -171,6 +163,27 @@ Pair<int, bool> SkipListReaderByteSlice::LoadBuffer() {
     return MakePair(0, false);
 }
 
+void SkipListReaderByteSlice::DecodeBlockMaxBuffer() {
+    ByteSlice block_max_slice;
+    block_max_slice.data_ = block_max_bytes_.data();
+    block_max_slice.size_ = block_max_bytes_.size();
+    block_max_slice.owned_ = false;
+    ByteSliceReader block_max_reader;
+    block_max_reader.Open(&block_max_slice);
+    u32 block_max_tf_num = GetSkipListEncoder(posting_codec_)->Decode(block_max_tf_buffer_.get(), SKIP_LIST_BUFFER_SIZE, block_max_reader);
+    if (block_max_tf_num != block_max_num_) {
+        String error_message = fmt::format("SKipList decode error, doc_num = {} block_max_tf_num = {}", block_max_num_, block_max_tf_num);
+        LOG_ERROR(error_message);
+        UnrecoverableError(error_message);
+    }
+    u32 tf_percentage_num = GetTermPercentageEncoder()->Decode(block_max_tf_percentage_buffer_.get(), SKIP_LIST_BUFFER_SIZE, block_max_reader);
+    if (tf_percentage_num != block_max_num_) {
+        String error_message = fmt::format("SKipList decode error, doc_num = {} block_max_tf_percentage_num = {}", block_max_num_, tf_percentage_num);
+        LOG_ERROR(error_message);
+        UnrecoverableError(error_message);
+    }
+}
+
 SkipListReaderPostingByteSlice::~SkipListReaderPostingByteSlice() {
     delete skiplist_buffer_;
     skiplist_buffer_ = nullptr;
@@ -30,8 +30,8 @@ namespace infinity {
 export class SkipListReader {
 public:
     explicit SkipListReader(const DocListFormatOption &doc_list_format_option)
-        : has_tf_list_(doc_list_format_option.HasTfList()),
-          has_block_max_(doc_list_format_option.HasBlockMax()) {
+        : has_tf_list_(doc_list_format_option.HasTfList()), has_block_max_(doc_list_format_option.HasBlockMax()),
+          posting_codec_(doc_list_format_option.GetPostingCodec()) {
         if (has_tf_list_) {
             ttf_buffer_ = MakeUnique<u32[]>(SKIP_LIST_BUFFER_SIZE);
         }
@@ -41,7 +41,7 @@ public:
         }
     }
 
-    explicit SkipListReader(const PositionListFormatOption &doc_list_format_option) {}
+    explicit SkipListReader(const PositionListFormatOption &pos_list_format_option) : posting_codec_(pos_list_format_option.GetPostingCodec()) {}
 
     virtual ~SkipListReader() = default;
 
@@ -69,19 +69,38 @@ public:
 
     // u32: block max tf
     // u16: block max (ceil(tf / doc length) * numeric_limits<u16>::max())
-    Pair<u32, u16> GetBlockMaxInfo() const { return {current_block_max_tf_, current_block_max_tf_percentage_}; }
+    // The block max columns of a skip list buffer are only decoded when the first of its items is asked for
+    Pair<u32, u16> GetBlockMaxInfo() {
+        if (!current_block_max_loaded_) {
+            if (!block_max_buffer_decoded_) {
+                DecodeBlockMaxBuffer();
+                block_max_buffer_decoded_ = true;
+            }
+            current_block_max_tf_ = block_max_tf_buffer_[current_block_max_cursor_];
+            current_block_max_tf_percentage_ = block_max_tf_percentage_buffer_[current_block_max_cursor_];
+            current_block_max_loaded_ = true;
+        }
+        return {current_block_max_tf_, current_block_max_tf_percentage_};
+    }
 
 protected:
     virtual Pair<int, bool> LoadBuffer() = 0;
 
+    // Decodes the block max columns of the current buffer if LoadBuffer deferred them
+    virtual void DecodeBlockMaxBuffer() {}
+
     const bool has_tf_list_ = false;
     const bool has_block_max_ = false;
+    const PostingCodec posting_codec_ = PostingCodec::kSIMDBitPacking;
     i32 skipped_item_count_ = 0;
     u32 current_doc_id_ = 0;
     u32 current_offset_ = 0;
     u32 current_ttf_ = 0;
     u32 current_block_max_tf_ = 0;
     u16 current_block_max_tf_percentage_ = 0;
+    u32 current_block_max_cursor_ = 0;
+    bool current_block_max_loaded_ = true;
+    bool block_max_buffer_decoded_ = true;
     u32 prev_doc_id_ = 0;
     u32 prev_offset_ = 0;
     u32 prev_ttf_ = 0;
@@ -113,9 +132,14 @@ public:
 protected:
     Pair<int, bool> LoadBuffer() override;
 
+    void DecodeBlockMaxBuffer() override;
+
     ByteSliceReader byte_slice_reader_;
     u32 start_ = 0;
     u32 end_ = 0;
+    // encoded block max columns of the current buffer
+    Vector<u8> block_max_bytes_;
+    u32 block_max_num_ = 0;
 };
 
 export class SkipListReaderPostingByteSlice final : public SkipListReader {
@@ -15,13 +15,29 @@ export {
 
     enum OptionFlag {
         of_none = 0,
-        of_term_payload = 1,   // 1 << 0
-        of_doc_payload = 2,    // 1 << 1
-        of_position_list = 4,  // 1 << 2
-        of_term_frequency = 8, // 1 << 3
-        of_block_max = 16,     // 1 << 4
+        of_term_payload = 1,     // 1 << 0
+        of_doc_payload = 2,      // 1 << 1
+        of_position_list = 4,    // 1 << 2
+        of_term_frequency = 8,   // 1 << 3
+        of_block_max = 16,       // 1 << 4
+        of_posting_codec = 96,   // 1 << 5 | 1 << 6, holds a PostingCodec
+        of_quantized_norm = 128, // 1 << 7, score with byte quantized column lengths
     };
 
+    // Block codec of the u32 streams of a posting list: doc ids, term frequencies, positions and skip lists
+    enum class PostingCodec : u8 {
+        kSIMDBitPacking = 0, // SIMD-BP128
+        kStreamVByte = 1,
+    };
+
+    constexpr u8 POSTING_CODEC_SHIFT = 5;
+
+    inline PostingCodec GetPostingCodec(optionflag_t flag) { return static_cast<PostingCodec>((flag & of_posting_codec) >> POSTING_CODEC_SHIFT); }
+
+    inline optionflag_t SetPostingCodec(optionflag_t flag, PostingCodec codec) {
+        return (flag & ~of_posting_codec) | (static_cast<u8>(codec) << POSTING_CODEC_SHIFT);
+    }
+
     typedef u16 docpayload_t;
     typedef u32 termpayload_t;
     typedef u8 optionflag_t;
@@ -60,6 +60,7 @@ import buf_writer;
 import profiler;
 import third_party;
 import infinity_context;
+import posting_partition;
 
 namespace infinity {
 constexpr int MAX_TUPLE_LENGTH = 1024; // we assume that analyzed term, together with docid/offset info, will never exceed such length
@@ -258,35 +259,43 @@ void MemoryIndexer::Dump(bool offline, bool spill) {
     String index_prefix = path.string();
     LocalFileSystem fs;
     String posting_file = index_prefix + POSTING_SUFFIX + (spill ? SPILL_SUFFIX : "");
-    SharedPtr<FileWriter> posting_file_writer = MakeShared<FileWriter>(fs, posting_file, 128000);
     String dict_file = index_prefix + DICT_SUFFIX + (spill ? SPILL_SUFFIX : "");
-    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs, dict_file, 128000);
-    TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
 
-    String fst_file = dict_file + ".fst";
-    std::ofstream ofs(fst_file.c_str(), std::ios::binary | std::ios::trunc);
-    OstreamWriter wtr(ofs);
-    FstBuilder fst_builder(wtr);
-
-    if (spill) {
-        posting_file_writer->WriteVInt(i32(doc_count_));
-    }
     if (posting_table_.get() != nullptr) {
         MemoryIndexer::PostingTableStore &posting_store = posting_table_->store_;
+        // Split the terms into ranges of similar dump size, the ranges are dumped in parallel
+        Vector<u32> dump_lengths;
+        SizeT dump_bytes = 0;
         for (auto it = posting_store.UnsafeBegin(); it != posting_store.UnsafeEnd(); ++it) {
-            const MemoryIndexer::PostingPtr posting_writer = it->second;
-            TermMeta term_meta(posting_writer->GetDF(), posting_writer->GetTotalTF());
-            posting_writer->Dump(posting_file_writer, term_meta, spill);
-            SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
-            term_meta_dumpler.Dump(dict_file_writer, term_meta);
-            const String &term = it->first;
-            fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+            dump_lengths.push_back(it->second->GetDumpLength());
+            dump_bytes += dump_lengths.back();
         }
-        posting_file_writer->Sync();
-        dict_file_writer->Sync();
-        fst_builder.Finish();
-        fs.AppendFile(dict_file, fst_file);
-        fs.DeleteFile(fst_file);
+        SizeT partition_count = dump_partition_count_ > 0 ? dump_partition_count_ : PostingPartitionWriter::SuggestPartitionCount(dump_bytes);
+        Vector<decltype(posting_store.UnsafeBegin())> range_begins{posting_store.UnsafeBegin()};
+        SizeT term_idx = 0;
+        SizeT range_bytes = 0;
+        for (auto it = posting_store.UnsafeBegin(); it != posting_store.UnsafeEnd() && range_begins.size() < partition_count; ++it, ++term_idx) {
+            if (range_bytes * partition_count >= dump_bytes * range_begins.size()) {
+                range_begins.push_back(it);
+            }
+            range_bytes += dump_lengths[term_idx];
+        }
+        range_begins.push_back(posting_store.UnsafeEnd());
+
+        PostingPartitionWriter partition_writer(posting_file, dict_file, flag_, range_begins.size() - 1, 128000);
+        if (spill) {
+            partition_writer.GetPostingFileWriter(0)->WriteVInt(i32(doc_count_));
+        }
+        partition_writer.Run([&](SizeT partition_id) {
+            const SharedPtr<FileWriter> &posting_file_writer = partition_writer.GetPostingFileWriter(partition_id);
+            for (auto it = range_begins[partition_id]; it != range_begins[partition_id + 1]; ++it) {
+                const MemoryIndexer::PostingPtr posting_writer = it->second;
+                TermMeta term_meta(posting_writer->GetDF(), posting_writer->GetTotalTF());
+                posting_writer->Dump(posting_file_writer, term_meta, spill);
+                partition_writer.AddTerm(partition_id, it->first, term_meta);
+            }
+        });
+        partition_writer.Finish();
     }
 
     String column_length_file = index_prefix + LENGTH_SUFFIX + (spill ? SPILL_SUFFIX : "");
@@ -378,22 +387,70 @@ void MemoryIndexer::OfflineDump() {
     merger->Run();
     delete merger;
 
-    MmapReader reader(spill_full_path_);
-    u64 term_list_count;
-    reader.ReadU64(term_list_count);
+    // Split the sorted tuples into ranges of similar size, cut at term boundaries. The ranges are dumped in parallel.
+    Vector<SizeT> range_offsets;
+    Vector<u64> range_first_records;
+    {
+        MmapReader reader(spill_full_path_);
+        u64 term_list_count;
+        reader.ReadU64(term_list_count);
+        SizeT data_begin = reader.Tell();
+        SizeT data_len = reader.DataLen() - data_begin;
+        SizeT partition_count = dump_partition_count_ > 0 ? dump_partition_count_ : PostingPartitionWriter::SuggestPartitionCount(data_len);
+        range_offsets.push_back(data_begin);
+        range_first_records.push_back(0);
+        u32 record_length = 0;
+        u32 term_length = 0;
+        std::string_view last_term;
+        for (u64 i = 0; i < term_list_count && range_offsets.size() < partition_count; ++i) {
+            SizeT record_offset = reader.Tell();
+            reader.ReadU32(record_length);
+            reader.ReadU32(term_length);
+            if (term_length < MAX_TUPLE_LENGTH) {
+                reader.Seek(sizeof(u32));
+                std::string_view term(reader.ReadBufNonCopy(term_length), term_length);
+                if (term != last_term && (record_offset - data_begin) * partition_count >= data_len * range_offsets.size()) {
+                    range_offsets.push_back(record_offset);
+                    range_first_records.push_back(i);
+                }
+                last_term = term;
+            }
+            reader.Seek(record_offset + sizeof(u32) + record_length, true);
+        }
+        range_first_records.push_back(term_list_count);
+    }
 
     Path path = Path(index_dir_) / base_name_;
     String index_prefix = path.string();
     LocalFileSystem fs;
     String posting_file = index_prefix + POSTING_SUFFIX;
-    SharedPtr<FileWriter> posting_file_writer = MakeShared<FileWriter>(fs, posting_file, 128000);
     String dict_file = index_prefix + DICT_SUFFIX;
-    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs, dict_file, 128000);
-    TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
-    String fst_file = index_prefix + DICT_SUFFIX + ".fst";
-    std::ofstream ofs(fst_file.c_str(), std::ios::binary | std::ios::trunc);
-    OstreamWriter wtr(ofs);
-    FstBuilder fst_builder(wtr);
+    PostingPartitionWriter partition_writer(posting_file, dict_file, flag_, range_offsets.size(), 128000);
+    partition_writer.Run([&](SizeT partition_id) {
+        u64 record_count = range_first_records[partition_id + 1] - range_first_records[partition_id];
+        OfflineDumpRange(partition_writer, partition_id, range_offsets[partition_id], record_count);
+    });
+    partition_writer.Finish();
+
+    String column_length_file = index_prefix + LENGTH_SUFFIX;
+    auto [file_handler, status] = fs.OpenFile(column_length_file, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kNoLock);
+    if(!status.ok()) {
+        LOG_CRITICAL(status.message());
+        UnrecoverableError(status.message());
+    }
+
+    Vector<u32> &unsafe_column_lengths = column_lengths_.UnsafeVec();
+    fs.Write(*file_handler, &unsafe_column_lengths[0], sizeof(unsafe_column_lengths[0]) * unsafe_column_lengths.size());
+    fs.Close(*file_handler);
+
+    std::filesystem::remove(spill_full_path_);
+    num_runs_ = 0;
+}
+
+void MemoryIndexer::OfflineDumpRange(PostingPartitionWriter &partition_writer, SizeT partition_id, SizeT offset, u64 record_count) {
+    MmapReader reader(spill_full_path_);
+    reader.Seek(offset, true);
+    const SharedPtr<FileWriter> &posting_file_writer = partition_writer.GetPostingFileWriter(partition_id);
 
     u32 record_length = 0;
     u32 term_length = 0;
@@ -408,7 +465,7 @@ void MemoryIndexer::OfflineDump() {
 
     assert(record_length < MAX_TUPLE_LIST_LENGTH);
 
-    for (u64 i = 0; i < term_list_count; ++i) {
+    for (u64 i = 0; i < record_count; ++i) {
         reader.ReadU32(record_length);
         reader.ReadU32(term_length);
 
@@ -434,16 +491,14 @@ void MemoryIndexer::OfflineDump() {
             if (posting.get()) {
                 TermMeta term_meta(posting->GetDF(), posting->GetTotalTF());
                 posting->Dump(posting_file_writer, term_meta);
-                SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
-                term_meta_dumpler.Dump(dict_file_writer, term_meta);
-                fst_builder.Insert((u8 *)last_term.data(), last_term.length(), term_meta_offset);
+                partition_writer.AddTerm(partition_id, last_term_str, term_meta);
             }
             posting = MakeUnique<PostingWriter>(posting_format_, column_lengths_);
             last_term_str = String(term);
             last_term = std::string_view(last_term_str);
             last_doc_id = INVALID_DOCID;
         }
-        for (SizeT i = 0; i < doc_pos_list_size; ++i) {
+        for (SizeT j = 0; j < doc_pos_list_size; ++j) {
             u32& doc_id = *(u32 *)(buf.get() + buf_idx);
             buf_idx += sizeof(u32);
             u32& term_pos = *(u32 *)(buf.get() + buf_idx);
@@ -463,29 +518,8 @@ void MemoryIndexer::OfflineDump() {
         posting->EndDocument(last_doc_id, 0);
         TermMeta term_meta(posting->GetDF(), posting->GetTotalTF());
         posting->Dump(posting_file_writer, term_meta);
-        SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
-        term_meta_dumpler.Dump(dict_file_writer, term_meta);
-        fst_builder.Insert((u8 *)last_term.data(), last_term.length(), term_meta_offset);
-    }
-    posting_file_writer->Sync();
-    dict_file_writer->Sync();
-    fst_builder.Finish();
-    fs.AppendFile(dict_file, fst_file);
-    fs.DeleteFile(fst_file);
-
-    String column_length_file = index_prefix + LENGTH_SUFFIX;
-    auto [file_handler, status] = fs.OpenFile(column_length_file, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kNoLock);
-    if(!status.ok()) {
-        LOG_CRITICAL(status.message());
-        UnrecoverableError(status.message());
+        partition_writer.AddTerm(partition_id, last_term_str, term_meta);
     }
-
-    Vector<u32> &unsafe_column_lengths = column_lengths_.UnsafeVec();
-    fs.Write(*file_handler, &unsafe_column_lengths[0], sizeof(unsafe_column_lengths[0]) * unsafe_column_lengths.size());
-    fs.Close(*file_handler);
-
-    std::filesystem::remove(spill_full_path_);
-    num_runs_ = 0;
 }
 
 void MemoryIndexer::FinalSpillFile() {
@@ -32,6 +32,7 @@ import map_with_lock;
 import vector_with_lock;
 import buf_writer;
 import posting_list_format;
+import posting_partition;
 
 namespace infinity {
 
@@ -93,6 +94,9 @@ public:
 
     SharedPtr<PostingWriter> GetOrAddPosting(const String &term);
 
+    // The number of term ranges dumped in parallel, 0 picks it by the size of the postings to dump.
+    void SetDumpPartitionCount(SizeT partition_count) { dump_partition_count_ = partition_count; }
+
     void Reset();
 
 private:
@@ -106,6 +110,9 @@ private:
 
     void OfflineDump();
 
+    // Dump record_count spilled tuples from offset of the spill file into a partition
+    void OfflineDumpRange(PostingPartitionWriter &partition_writer, SizeT partition_id, SizeT offset, u64 record_count);
+
     void FinalSpillFile();
 
     void PrepareSpillFile();
@@ -141,6 +148,8 @@ private:
 
     bool is_spilled_{false};
 
+    SizeT dump_partition_count_{0};
+
     // for column length info
     VectorWithLock<u32> column_lengths_;
     Atomic<u32> column_length_sum_{0};
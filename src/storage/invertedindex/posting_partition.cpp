@@ -0,0 +1,140 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <exception>
+#include <fstream>
+#include <future>
+
+module posting_partition;
+
+import stl;
+import file_writer;
+import term_meta;
+import index_defines;
+import posting_list_format;
+import local_file_system;
+import fst;
+import infinity_context;
+import third_party;
+
+namespace infinity {
+
+PostingPartitionWriter::PostingPartitionWriter(const String &posting_file,
+                                               const String &dict_file,
+                                               optionflag_t flag,
+                                               SizeT partition_count,
+                                               SizeT buffer_size)
+    : posting_file_(posting_file), dict_file_(dict_file), flag_(flag), buffer_size_(buffer_size) {
+    partitions_.resize(std::max(partition_count, SizeT(1)));
+    for (SizeT i = 0; i < partitions_.size(); ++i) {
+        Partition &partition = partitions_[i];
+        partition.posting_file_ = i == 0 ? posting_file_ : fmt::format("{}.part{}", posting_file_, i);
+        if (i > 0 && fs_.Exists(partition.posting_file_)) {
+            // left over by an interrupted dump, it would be appended as a whole
+            fs_.DeleteFile(partition.posting_file_);
+        }
+        partition.posting_file_writer_ = MakeShared<FileWriter>(fs_, partition.posting_file_, buffer_size_);
+    }
+}
+
+PostingPartitionWriter::~PostingPartitionWriter() = default;
+
+void PostingPartitionWriter::AddTerm(SizeT partition_id, const String &term, const TermMeta &term_meta) {
+    partitions_[partition_id].term_metas_.emplace_back(term, term_meta);
+}
+
+void PostingPartitionWriter::Run(const std::function<void(SizeT)> &func) {
+    if (partitions_.size() == 1) {
+        func(0);
+        return;
+    }
+    ThreadPool &merging_thread_pool = InfinityContext::instance().GetFulltextMergingThreadPool();
+    Vector<std::future<void>> partition_futures;
+    partition_futures.reserve(partitions_.size() - 1);
+    for (SizeT i = 1; i < partitions_.size(); ++i) {
+        partition_futures.emplace_back(merging_thread_pool.push([&func, i](int) { func(i); }));
+    }
+    std::exception_ptr exception;
+    try {
+        func(0);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    for (auto &partition_future : partition_futures) {
+        try {
+            partition_future.get();
+        } catch (...) {
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void PostingPartitionWriter::Finish() {
+    Vector<SizeT> base_offsets(partitions_.size(), 0);
+    for (SizeT i = 0; i < partitions_.size(); ++i) {
+        partitions_[i].posting_file_writer_->Sync();
+        if (i + 1 < partitions_.size()) {
+            base_offsets[i + 1] = base_offsets[i] + partitions_[i].posting_file_writer_->TotalWrittenBytes();
+        }
+    }
+    if (partitions_.size() > 1) {
+        // the posting file isn't truncated on open, drop a stale tail before appending behind partition 0
+        fs_.Truncate(posting_file_, base_offsets[1]);
+        for (SizeT i = 1; i < partitions_.size(); ++i) {
+            partitions_[i].posting_file_writer_.reset();
+            fs_.AppendFile(posting_file_, partitions_[i].posting_file_);
+            fs_.DeleteFile(partitions_[i].posting_file_);
+        }
+    }
+
+    bool has_position = PostingFormatOption(flag_).HasPositionList();
+    SharedPtr<FileWriter> dict_file_writer = MakeShared<FileWriter>(fs_, dict_file_, buffer_size_);
+    TermMetaDumper term_meta_dumpler((PostingFormatOption(flag_)));
+    String fst_file = dict_file_ + ".fst";
+    std::ofstream ofs(fst_file.c_str(), std::ios::binary | std::ios::trunc);
+    OstreamWriter wtr(ofs);
+    FstBuilder fst_builder(wtr);
+    for (SizeT i = 0; i < partitions_.size(); ++i) {
+        SizeT base_offset = base_offsets[i];
+        for (auto &[term, term_meta] : partitions_[i].term_metas_) {
+            term_meta.doc_start_ += base_offset;
+            if (has_position) {
+                term_meta.pos_start_ += base_offset;
+                term_meta.pos_end_ += base_offset;
+            }
+            SizeT term_meta_offset = dict_file_writer->TotalWrittenBytes();
+            term_meta_dumpler.Dump(dict_file_writer, term_meta);
+            fst_builder.Insert((u8 *)term.c_str(), term.length(), term_meta_offset);
+        }
+        Vector<Pair<String, TermMeta>>().swap(partitions_[i].term_metas_);
+    }
+    dict_file_writer->Sync();
+    fst_builder.Finish();
+    fs_.AppendFile(dict_file_, fst_file);
+    fs_.DeleteFile(fst_file);
+}
+
+SizeT PostingPartitionWriter::SuggestPartitionCount(SizeT posting_bytes) {
+    ThreadPool &merging_thread_pool = InfinityContext::instance().GetFulltextMergingThreadPool();
+    return std::max(SizeT(1), std::min(posting_bytes / MIN_PARTITION_BYTES, SizeT(merging_thread_pool.size())));
+}
+
+} // namespace infinity
@@ -0,0 +1,71 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module posting_partition;
+
+import stl;
+import file_writer;
+import term_meta;
+import index_defines;
+import local_file_system;
+
+namespace infinity {
+
+// Writes the postings of a fulltext index in term range partitions, so that the ranges can be dumped on several threads.
+// Partition i holds the i-th range of terms in ascending order. Partition 0 is written to the posting file in place, the others
+// to temporary part files. Finish appends the part files to the posting file, shifts the term metas by the offset of their part,
+// and writes the dictionary and its fst in a single pass.
+export class PostingPartitionWriter {
+public:
+    PostingPartitionWriter(const String &posting_file, const String &dict_file, optionflag_t flag, SizeT partition_count, SizeT buffer_size);
+
+    ~PostingPartitionWriter();
+
+    SizeT PartitionCount() const { return partitions_.size(); }
+
+    // Posting offsets written to the term metas are relative to the beginning of the partition.
+    const SharedPtr<FileWriter> &GetPostingFileWriter(SizeT partition_id) const { return partitions_[partition_id].posting_file_writer_; }
+
+    // Terms of a partition shall be added in ascending order. Different partitions can be added to concurrently.
+    void AddTerm(SizeT partition_id, const String &term, const TermMeta &term_meta);
+
+    // Runs func on every partition id and waits for all of them. Partition 0 runs on the calling thread, the others on the fulltext
+    // merging thread pool.
+    void Run(const std::function<void(SizeT)> &func);
+
+    void Finish();
+
+    // The number of partitions worth splitting postings of posting_bytes into.
+    static SizeT SuggestPartitionCount(SizeT posting_bytes);
+
+    static constexpr SizeT MIN_PARTITION_BYTES = 8 * 1024 * 1024;
+
+private:
+    struct Partition {
+        String posting_file_{};
+        SharedPtr<FileWriter> posting_file_writer_{};
+        Vector<Pair<String, TermMeta>> term_metas_{};
+    };
+
+    String posting_file_;
+    String dict_file_;
+    optionflag_t flag_;
+    SizeT buffer_size_;
+    LocalFileSystem fs_;
+    Vector<Partition> partitions_;
+};
+
+} // namespace infinity
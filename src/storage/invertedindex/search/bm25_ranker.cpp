@@ -21,24 +21,35 @@ module bm25_ranker;
 import stl;
 import index_defines;
 import third_party;
+import column_length_norm;
 
 namespace infinity {
 
 constexpr float k1 = 1.2F;
 constexpr float b = 0.75F;
 
-BM25Ranker::BM25Ranker(u64 total_df) : total_df_(std::max(total_df, 1UL)) {}
+float BM25Ranker::IDF(u64 total_df, u64 df) {
+    total_df = std::max(total_df, 1UL);
+    return std::log(1.0F + (total_df - df + 0.5F) / (df + 0.5F));
+}
+
+float BM25Ranker::LengthNorm(float avg_column_len, u32 column_len) { return k1 * (1.0F - b + b * column_len / avg_column_len); }
+
+void BM25Ranker::BuildNormTable(float avg_column_len, Vector<float> &norm_table) {
+    norm_table.resize(256);
+    for (u32 norm = 0; norm < norm_table.size(); ++norm) {
+        norm_table[norm] = LengthNorm(avg_column_len, NormToColumnLength(norm));
+    }
+}
 
-void BM25Ranker::AddTermParam(u64 tf, u64 df, float avg_column_len, u32 column_len, float weight) {
-    float smooth_idf = std::log(1.0F + (total_df_ - df + 0.5F) / (df + 0.5F));
-    float smooth_tf = (k1 + 1.0F) * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
-    score_ += smooth_idf * smooth_tf * weight;
+void BM25Ranker::AddTermParam(u64 tf, float idf, float length_norm, float weight) {
+    float smooth_tf = (k1 + 1.0F) * tf / (tf + length_norm);
+    score_ += idf * smooth_tf * weight;
 }
 
-void BM25Ranker::AddPhraseParam(tf_t tf, u64 df, float avg_column_len, u32 column_len, float weight) {
-    float smooth_idf = std::log(1.0F + (total_df_ - df + 0.5F) / (df + 0.5F));
-    float smooth_tf = (k1 + 1.0F) * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
-    score_ += smooth_idf * smooth_tf * weight;
+void BM25Ranker::AddPhraseParam(tf_t tf, float idf, float length_norm, float weight) {
+    float smooth_tf = (k1 + 1.0F) * tf / (tf + length_norm);
+    score_ += idf * smooth_tf * weight;
 }
 
 } // namespace infinity
@@ -22,17 +22,25 @@ import index_defines;
 namespace infinity {
 export class BM25Ranker {
 public:
-    BM25Ranker(u64 total_df);
+    BM25Ranker() = default;
     ~BM25Ranker() = default;
 
-    void AddTermParam(u64 tf, u64 df, float avg_column_len, u32 column_len, float weight);
+    // Depends on the term only, computed once per term rather than for every matched document
+    static float IDF(u64 total_df, u64 df);
 
-    void AddPhraseParam(tf_t tf, u64 df, float avg_colum_len, u32 column_len, float weight);
+    // k1 * (1 - b + b * column_len / avg_column_len), shared by the terms matched in a column of a document
+    static float LengthNorm(float avg_column_len, u32 column_len);
+
+    // LengthNorm of the column length of every byte norm, for the columns indexed with quantized norms, see ColumnLengthToNorm
+    static void BuildNormTable(float avg_column_len, Vector<float> &norm_table);
+
+    void AddTermParam(u64 tf, float idf, float length_norm, float weight);
+
+    void AddPhraseParam(tf_t tf, float idf, float length_norm, float weight);
 
     float GetScore() { return score_; }
 
 private:
     float score_{0};
-    u64 total_df_{0};
 };
-} // namespace infinity
\ No newline at end of file
+} // namespace infinity
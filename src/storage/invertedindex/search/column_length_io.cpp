@@ -32,14 +32,17 @@ import chunk_index_entry;
 import memory_indexer;
 import buffer_obj;
 import buffer_handle;
+import column_length_norm;
 
 namespace infinity {
 
 FullTextColumnLengthReader::FullTextColumnLengthReader(UniquePtr<FileSystem> file_system,
                                                        const String &index_dir,
                                                        const Vector<SharedPtr<ChunkIndexEntry>> &chunk_index_entries,
-                                                       SharedPtr<MemoryIndexer> memory_indexer)
-    : file_system_(std::move(file_system)), index_dir_(index_dir), chunk_index_entries_(chunk_index_entries), memory_indexer_(memory_indexer) {}
+                                                       SharedPtr<MemoryIndexer> memory_indexer,
+                                                       bool quantized_norm)
+    : file_system_(std::move(file_system)), index_dir_(index_dir), chunk_index_entries_(chunk_index_entries), memory_indexer_(memory_indexer),
+      quantized_norm_(quantized_norm) {}
 
 u32 FullTextColumnLengthReader::SeekFile(RowID row_id) {
     // determine the ChunkIndexEntry which contains row_id
@@ -62,11 +65,16 @@ u32 FullTextColumnLengthReader::SeekFile(RowID row_id) {
         return 0;
     }
 
+    current_chunk_base_rowid_ = chunk_index_entries_[current_chunk]->base_rowid_;
+    current_chunk_row_count_ = chunk_index_entries_[current_chunk]->row_count_;
+    if (quantized_norm_) {
+        column_norms_ = chunk_index_entries_[current_chunk]->GetColumnNorms();
+        return NormToColumnLength(column_norms_[row_id - current_chunk_base_rowid_]);
+    }
+
     // Load the column-length file of the ChunkIndexEntry
     current_chunk_buffer_handle_ = chunk_index_entries_[current_chunk]->GetBufferObj()->Load();
     column_lengths_ = (const u32 *)current_chunk_buffer_handle_.GetData();
-    current_chunk_base_rowid_ = chunk_index_entries_[current_chunk]->base_rowid_;
-    current_chunk_row_count_ = chunk_index_entries_[current_chunk]->row_count_;
     return column_lengths_[row_id - current_chunk_base_rowid_];
 }
 
@@ -76,7 +84,8 @@ void ColumnLengthReader::AppendColumnLength(IndexReader *index_reader, const Vec
     column_length_vector_.emplace_back(MakeUnique<FullTextColumnLengthReader>(MakeUnique<LocalFileSystem>(),
                                                                               reader->index_dir_,
                                                                               reader->chunk_index_entries_,
-                                                                              reader->memory_indexer_));
+                                                                              reader->memory_indexer_,
+                                                                              reader->GetOptionFlag() & of_quantized_norm));
     avg_column_length.emplace_back(reader->GetAvgColumnLength());
 }
 
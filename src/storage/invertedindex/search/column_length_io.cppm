@@ -25,6 +25,7 @@ import chunk_index_entry;
 import memory_indexer;
 import buffer_obj;
 import buffer_handle;
+import column_length_norm;
 
 namespace infinity {
 class SegmentIndexEntry;
@@ -37,10 +38,15 @@ public:
     FullTextColumnLengthReader(UniquePtr<FileSystem> file_system,
                                const String &index_dir,
                                const Vector<SharedPtr<ChunkIndexEntry>> &chunk_index_entries,
-                               SharedPtr<MemoryIndexer> memory_indexer);
+                               SharedPtr<MemoryIndexer> memory_indexer,
+                               bool quantized_norm = false);
 
+    // With quantized norms, the length is decoded from the byte norm cached by the chunk, see ColumnLengthToNorm
     inline u32 GetColumnLength(RowID row_id) {
         if (row_id >= current_chunk_base_rowid_ && row_id < current_chunk_base_rowid_ + current_chunk_row_count_) [[likely]] {
+            if (column_norms_ != nullptr) {
+                return NormToColumnLength(column_norms_[row_id - current_chunk_base_rowid_]);
+            }
             assert(column_lengths_ != nullptr);
             return column_lengths_[row_id - current_chunk_base_rowid_];
         }
@@ -48,19 +54,34 @@ public:
             RowID base_rowid = memory_indexer_->GetBaseRowId();
             u32 doc_count = memory_indexer_->GetDocCount();
             if (row_id >= base_rowid && row_id < base_rowid + doc_count) {
-                return memory_indexer_->GetColumnLength(row_id - base_rowid);
+                u32 column_length = memory_indexer_->GetColumnLength(row_id - base_rowid);
+                return quantized_norm_ ? NormToColumnLength(ColumnLengthToNorm(column_length)) : column_length;
             }
         }
         return SeekFile(row_id);
     }
 
+    bool quantized_norm() const { return quantized_norm_; }
+
+    // Only with quantized norms, indexes the norm tables of BM25 without decoding the length
+    inline u8 GetColumnNorm(RowID row_id) {
+        if (row_id >= current_chunk_base_rowid_ && row_id < current_chunk_base_rowid_ + current_chunk_row_count_) [[likely]] {
+            assert(column_norms_ != nullptr);
+            return column_norms_[row_id - current_chunk_base_rowid_];
+        }
+        // A decoded length is encoded back to the same norm
+        return ColumnLengthToNorm(GetColumnLength(row_id));
+    }
+
 private:
     u32 SeekFile(RowID row_id);
     UniquePtr<FileSystem> file_system_;
     const String &index_dir_;
     const Vector<SharedPtr<ChunkIndexEntry>> &chunk_index_entries_; // must in ascending order
     SharedPtr<MemoryIndexer> memory_indexer_;
+    const bool quantized_norm_;
     const u32 *column_lengths_{nullptr};
+    const u8 *column_norms_{nullptr};
     RowID current_chunk_base_rowid_{(u64)0};
     u32 current_chunk_row_count_{0};
     BufferHandle current_chunk_buffer_handle_{};
@@ -75,6 +96,8 @@ public:
     FullTextColumnLengthReader *GetColumnLengthReader(u32 scorer_column_idx) { return column_length_vector_[scorer_column_idx].get(); }
 
     inline u32 GetColumnLength(u32 scorer_column_idx, RowID row_id) { return column_length_vector_[scorer_column_idx]->GetColumnLength(row_id); }
+
+    inline u8 GetColumnNorm(u32 scorer_column_idx, RowID row_id) { return column_length_vector_[scorer_column_idx]->GetColumnNorm(row_id); }
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -14,6 +14,7 @@ import phrase_doc_iterator;
 import blockmax_term_doc_iterator;
 import column_length_io;
 import third_party;
+import bm25_ranker;
 
 namespace infinity {
 
@@ -238,6 +239,9 @@ void BlockMaxPhraseDocIterator::InitBM25Info(u64 total_df, float avg_column_len,
     float smooth_idf = std::log(1.0F + (total_df - estimate_doc_freq_ + 0.5F) / (estimate_doc_freq_ + 0.5F));
     bm25_common_score_ = weight_ * smooth_idf * (k1 + 1.0F);
     bm25_score_upper_bound_ = bm25_common_score_ / (1.0F + k1 * b / avg_column_len);
+    if (column_length_reader_->quantized_norm()) {
+        BM25Ranker::BuildNormTable(avg_column_len_, norm_table_);
+    }
 
     for (SizeT i = 0; i < pos_iters_.size(); ++i) {
         TermInitBM25Info(i, total_df, avg_column_len, column_length_reader);
@@ -246,8 +250,14 @@ void BlockMaxPhraseDocIterator::InitBM25Info(u64 total_df, float avg_column_len,
 
 float BlockMaxPhraseDocIterator::BM25Score() {
     auto tf = current_phrase_freq_;
-    auto doc_len = column_length_reader_->GetColumnLength(doc_id_);
-    return bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * doc_len / avg_column_len_));
+    return bm25_common_score_ * tf / (tf + LengthNorm(column_length_reader_, doc_id_));
+}
+
+float BlockMaxPhraseDocIterator::LengthNorm(FullTextColumnLengthReader *column_length_reader, RowID doc_id) const {
+    if (!norm_table_.empty()) {
+        return norm_table_[column_length_reader->GetColumnNorm(doc_id)];
+    }
+    return BM25Ranker::LengthNorm(avg_column_len_, column_length_reader->GetColumnLength(doc_id));
 }
 
 float BlockMaxPhraseDocIterator::BlockMaxBM25Score() {
@@ -330,15 +340,13 @@ Tuple<bool, float, RowID> BlockMaxPhraseDocIterator::TermSeekInBlockRange(u32 te
 float BlockMaxPhraseDocIterator::TermBM25Score(u32 term_id) {
     // bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
     auto tf = pos_iters_[term_id]->GetCurrentTF();
-    auto doc_len = term_column_length_reader_[term_id]->GetColumnLength(term_doc_id_[term_id]);
-    return term_bm25_common_score_[term_id] * tf / (tf + k1 * (1.0F - b + b * doc_len / avg_column_len_));
+    return term_bm25_common_score_[term_id] * tf / (tf + LengthNorm(term_column_length_reader_[term_id], term_doc_id_[term_id]));
 }
 
 float BlockMaxPhraseDocIterator::TermBM25Score(infinity::u32 term_id, infinity::tf_t phrase_freq) {
     // bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
     auto tf = phrase_freq;
-    auto doc_len = term_column_length_reader_[term_id]->GetColumnLength(term_doc_id_[term_id]);
-    return term_bm25_common_score_[term_id] * tf / (tf + k1 * (1.0F - b + b * doc_len / avg_column_len_));
+    return term_bm25_common_score_[term_id] * tf / (tf + LengthNorm(term_column_length_reader_[term_id], term_doc_id_[term_id]));
 }
 
 void BlockMaxPhraseDocIterator::TermInitBM25Info(u32 term_id, u64 total_df, float avg_column_len, FullTextColumnLengthReader *column_length_reader) {
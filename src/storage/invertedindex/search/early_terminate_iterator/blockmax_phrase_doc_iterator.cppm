@@ -98,6 +98,9 @@ private:
     bool TermNotPartCheckExist(u32 term_id, RowID doc_id);
 
     void SeekDoc(RowID doc_id, RowID seek_end);
+
+    // k1 * (1 - b + b * column_len / avg_column_len) of the document
+    float LengthNorm(FullTextColumnLengthReader *column_length_reader, RowID doc_id) const;
 private:
     float avg_column_len_ = 0;
     Vector<UniquePtr<PostingIterator>> pos_iters_{};
@@ -105,6 +108,7 @@ private:
     u64 current_phrase_freq_{0};
     Set<RowID> all_doc_ids_{};
     FullTextColumnLengthReader* column_length_reader_{nullptr};
+    Vector<float> norm_table_; // LengthNorm of every byte norm, only for the columns with quantized norms
     u32 estimate_doc_freq_{0};
     float weight_ = 1.0f;
     float bm25_common_score_ = 0.0f;
@@ -30,6 +30,7 @@ import posting_iterator;
 import column_length_io;
 import infinity_exception;
 import logger;
+import bm25_ranker;
 
 namespace infinity {
 
@@ -125,6 +126,9 @@ void BlockMaxTermDocIterator::InitBM25Info(u64 total_df, float avg_column_len, F
     f1 = k1 * (1.0F - b);
     f2 = k1 * b / avg_column_len_;
     f3 = f2 * std::numeric_limits<u16>::max();
+    if (column_length_reader_->quantized_norm()) {
+        BM25Ranker::BuildNormTable(avg_column_len_, norm_table_);
+    }
     OStringStream oss;
     oss << "BlockMaxTermDocIterator: " << *column_name_ptr_ << " " << *term_ptr_ << " bm25_common_score: " << bm25_common_score_
         << " bm25_score_upper_bound: " << bm25_score_upper_bound_ << " avg_column_len: " << avg_column_len_ << " f1: " << f1 << " f2: " << f2 << '\n';
@@ -145,8 +149,6 @@ float BlockMaxTermDocIterator::BlockMaxBM25Score() {
     }
 }
 
-Pair<tf_t, u32> BlockMaxTermDocIterator::GetScoreData() { return {iter_.GetCurrentTF(), column_length_reader_->GetColumnLength(doc_id_)}; }
-
 // weight included
 float BlockMaxTermDocIterator::BM25Score() {
     ++access_score_cnt_;
@@ -156,8 +158,9 @@ float BlockMaxTermDocIterator::BM25Score() {
     calc_score_cnt_++;
     prev_calc_score_doc_id_ = doc_id_;
     // bm25_common_score_ * tf / (tf + k1 * (1.0F - b + b * column_len / avg_column_len));
-    const auto [tf, doc_len] = GetScoreData();
-    const float p = f1 + f2 * doc_len;
+    const tf_t tf = iter_.GetCurrentTF();
+    const float p =
+        norm_table_.empty() ? f1 + f2 * column_length_reader_->GetColumnLength(doc_id_) : norm_table_[column_length_reader_->GetColumnNorm(doc_id_)];
     bm25_score_cache_ = bm25_common_score_ * tf / (tf + p);
     return bm25_score_cache_;
 }
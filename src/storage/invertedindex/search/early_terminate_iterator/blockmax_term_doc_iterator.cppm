@@ -74,8 +74,6 @@ public:
     const String *column_name_ptr_ = nullptr;
 
 private:
-    Pair<tf_t, u32> GetScoreData();
-
     // similar to TermDocIterator
     PostingIterator iter_; // initialized in constructor and InitPostingIterator() function
     float weight_ = 1.0f;  // changed in MultiplyWeight()
@@ -84,6 +82,7 @@ private:
     float f1 = 0.0f;
     float f2 = 0.0f;
     float f3 = 0.0f;
+    Vector<float> norm_table_; // f1 + f2 * column_len of every byte norm, only for the columns with quantized norms
     float avg_column_len_ = 0;
     FullTextColumnLengthReader *column_length_reader_ = nullptr;
     float bm25_common_score_ = 0; // include: weight * smooth_idf * (k1 + 1.0F)
@@ -39,6 +39,10 @@ u32 Scorer::GetOrSetColumnIndex(u64 column_id) {
         column_index_map_[column_id] = column_counter_;
         column_ids_.push_back(column_id);
         column_length_reader_.AppendColumnLength(index_reader_, column_ids_, avg_column_length_);
+        Vector<float> &norm_table = norm_tables_.emplace_back();
+        if (column_length_reader_.GetColumnLengthReader(column_counter_)->quantized_norm()) {
+            BM25Ranker::BuildNormTable(avg_column_length_.back(), norm_table);
+        }
         return column_counter_++;
     } else {
         return iter->second;
@@ -49,6 +53,14 @@ void Scorer::AddDocIterator(DocIterator *iter, u64 column_id) {
     u32 column_index = GetOrSetColumnIndex(column_id);
     iterators_.resize(std::max<u32>(column_index + 1, iterators_.size()));
     iterators_[column_index].push_back(iter);
+    idfs_.resize(iterators_.size());
+    u64 df = 0;
+    if (iter->GetType() == DocIteratorType::kTermIterator) {
+        df = static_cast<TermDocIterator *>(iter)->GetDF();
+    } else if (iter->GetType() == DocIteratorType::kPhraseIterator) {
+        df = static_cast<PhraseDocIterator *>(iter)->GetEstimateDF();
+    }
+    idfs_[column_index].push_back(BM25Ranker::IDF(total_df_, df));
 }
 
 void Scorer::AddBlockMaxDocIterator(BlockMaxTermDocIterator *iter, u64 column_id) {
@@ -68,19 +80,21 @@ void Scorer::AddBlockMaxPhraseDocIterator(BlockMaxPhraseDocIterator *iter, u64 c
 float Scorer::Score(RowID doc_id) {
     float score = 0.0F;
     for (u32 i = 0; i < column_counter_; i++) {
-        BM25Ranker ranker(total_df_);
-        float avg_column_length = avg_column_length_[i];
-        u32 column_len = column_length_reader_.GetColumnLength(i, doc_id);
+        BM25Ranker ranker;
         Vector<DocIterator *> &column_iters = iterators_[i];
         if (column_iters.empty()) {
             continue;
         }
+        const Vector<float> &column_idfs = idfs_[i];
+        const Vector<float> &norm_table = norm_tables_[i];
+        const float length_norm = norm_table.empty() ? BM25Ranker::LengthNorm(avg_column_length_[i], column_length_reader_.GetColumnLength(i, doc_id))
+                                                     : norm_table[column_length_reader_.GetColumnNorm(i, doc_id)];
         if (column_iters[0]->GetType() == DocIteratorType::kTermIterator) {
             TermColumnMatchData column_match_data;
             for (u32 j = 0; j < column_iters.size(); j++) {
                 TermDocIterator* term_iter = dynamic_cast<TermDocIterator*>(column_iters[j]);
                 if (term_iter->GetTermMatchData(column_match_data, doc_id)) {
-                    ranker.AddTermParam(column_match_data.tf_, term_iter->GetDF(), avg_column_length, column_len, term_iter->GetWeight());
+                    ranker.AddTermParam(column_match_data.tf_, column_idfs[j], length_norm, term_iter->GetWeight());
                 }
             }
         } else if (column_iters[0]->GetType() == DocIteratorType::kPhraseIterator) {
@@ -88,11 +102,7 @@ float Scorer::Score(RowID doc_id) {
                 PhraseColumnMatchData column_match_data;
                 PhraseDocIterator* phrase_iter = dynamic_cast<PhraseDocIterator*>(column_iters[j]);
                 if (phrase_iter->GetPhraseMatchData(column_match_data, doc_id)) {
-                    ranker.AddPhraseParam(column_match_data.tf_,
-                                          phrase_iter->GetEstimateDF(),
-                                          avg_column_length,
-                                          column_len,
-                                          phrase_iter->GetWeight());
+                    ranker.AddPhraseParam(column_match_data.tf_, column_idfs[j], length_norm, phrase_iter->GetWeight());
                 }
             }
         }
@@ -68,9 +68,12 @@ private:
     FlatHashMap<u64, u32, Hash> column_index_map_;
     Vector<u64> column_ids_;
     Vector<Vector<DocIterator *>> iterators_;
+    Vector<Vector<float>> idfs_; // of iterators_
     Vector<Vector<BlockMaxTermDocIterator *>> block_max_term_iterators_;
     Vector<Vector<BlockMaxPhraseDocIterator *>> block_max_phrase_iterators_;
     Vector<float> avg_column_length_;
+    // Of the columns with quantized norms, empty for the others
+    Vector<Vector<float>> norm_tables_;
     ColumnLengthReader column_length_reader_;
     IndexReader *index_reader_ = nullptr;
 };
@@ -16,6 +16,16 @@ SegmentTermPosting::SegmentTermPosting(const String &index_dir, const String &ba
     column_index_iterator_ = MakeShared<ColumnIndexIterator>(index_dir, base_name, flag);
 }
 
+SegmentTermPosting::SegmentTermPosting(const String &index_dir,
+                                       const String &base_name,
+                                       RowID base_row_id,
+                                       optionflag_t flag,
+                                       const String &min_term,
+                                       const String &max_term)
+    : base_row_id_(base_row_id) {
+    column_index_iterator_ = MakeShared<ColumnIndexIterator>(index_dir, base_name, flag, min_term, max_term);
+}
+
 bool SegmentTermPosting::HasNext() {
     if (column_index_iterator_->Next(term_, posting_decoder_)) {
         return true;
@@ -37,6 +47,22 @@ SegmentTermPostingQueue::SegmentTermPostingQueue(const String &index_dir,
     }
 }
 
+SegmentTermPostingQueue::SegmentTermPostingQueue(const String &index_dir,
+                                                 const Vector<String> &base_names,
+                                                 const Vector<RowID> &base_rowids,
+                                                 optionflag_t flag,
+                                                 const String &min_term,
+                                                 const String &max_term)
+    : index_dir_(index_dir), base_names_(base_names), base_rowids_(base_rowids) {
+    for (u32 i = 0; i < base_names.size(); ++i) {
+        SegmentTermPosting *segment_term_posting = new SegmentTermPosting(index_dir, base_names[i], base_rowids[i], flag, min_term, max_term);
+        if (segment_term_posting->HasNext()) {
+            segment_term_postings_.push(segment_term_posting);
+        } else
+            delete segment_term_posting;
+    }
+}
+
 SegmentTermPostingQueue::~SegmentTermPostingQueue() {
     while (!segment_term_postings_.empty()) {
         SegmentTermPosting *segment_term_posting = segment_term_postings_.top();
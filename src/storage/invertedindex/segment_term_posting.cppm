@@ -19,6 +19,13 @@ public:
 
     SegmentTermPosting(const String &index_dir, const String &base_name, RowID base_row_id, optionflag_t flag);
 
+    SegmentTermPosting(const String &index_dir,
+                       const String &base_name,
+                       RowID base_row_id,
+                       optionflag_t flag,
+                       const String &min_term,
+                       const String &max_term);
+
     RowID GetBaseRowId() const { return base_row_id_; }
 
     bool HasNext();
@@ -46,6 +53,14 @@ export class SegmentTermPostingQueue {
 public:
     SegmentTermPostingQueue(const String &index_dir, const Vector<String> &base_names, const Vector<RowID> &base_rowids, optionflag_t flag);
 
+    // Merge the terms in [min_term, max_term) only, an empty bound is unbounded.
+    SegmentTermPostingQueue(const String &index_dir,
+                            const Vector<String> &base_names,
+                            const Vector<RowID> &base_rowids,
+                            optionflag_t flag,
+                            const String &min_term,
+                            const String &max_term);
+
     ~SegmentTermPostingQueue();
 
     bool Empty() const { return segment_term_postings_.empty(); }
@@ -25,6 +25,7 @@ export module some_simd_functions;
 
 import stl;
 import hnsw_simd_func;
+import internal_types;
 
 namespace infinity {
 
@@ -133,4 +134,170 @@ export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension
 
 #endif
 
-} // namespace infinity
\ No newline at end of file
+// Distance between a f32 query and half precision data. The data is widened to f32 in registers,
+// so the accumulation keeps f32 precision while the memory traffic per vector is halved.
+
+template <typename HalfType>
+inline f32 HalfL2DistanceScalar(const f32 *vector1, const HalfType *vector2, u32 begin, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = begin; i < dimension; ++i) {
+        auto diff = vector1[i] - static_cast<f32>(vector2[i]);
+        distance += diff * diff;
+    }
+    return distance;
+}
+
+template <typename HalfType>
+inline f32 HalfIPDistanceScalar(const f32 *vector1, const HalfType *vector2, u32 begin, u32 dimension) {
+    f32 distance = 0;
+    for (u32 i = begin; i < dimension; ++i) {
+        distance += vector1[i] * static_cast<f32>(vector2[i]);
+    }
+    return distance;
+}
+
+#if defined(__AVX512F__)
+
+inline __m512 LoadF16x16(const Float16T *ptr) { return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr))); }
+
+inline __m512 LoadBF16x16(const BFloat16T *ptr) {
+    // bf16 is the upper half of a f32
+    __m512i widened = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)));
+    return _mm512_castsi512_ps(_mm512_slli_epi32(widened, 16));
+}
+
+template <typename HalfType, __m512 (*Load)(const HalfType *)>
+inline f32 HalfL2DistanceAVX512(const f32 *vector1, const HalfType *vector2, u32 dimension) {
+    u32 i = 0;
+    __m512 sum = _mm512_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        auto diff = _mm512_sub_ps(_mm512_loadu_ps(vector1 + i), Load(vector2 + i));
+        sum = _mm512_fmadd_ps(diff, diff, sum);
+    }
+    return _mm512_reduce_add_ps(sum) + HalfL2DistanceScalar(vector1, vector2, i, dimension);
+}
+
+template <typename HalfType, __m512 (*Load)(const HalfType *)>
+inline f32 HalfIPDistanceAVX512(const f32 *vector1, const HalfType *vector2, u32 dimension) {
+    u32 i = 0;
+    __m512 sum = _mm512_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        sum = _mm512_fmadd_ps(_mm512_loadu_ps(vector1 + i), Load(vector2 + i), sum);
+    }
+    return _mm512_reduce_add_ps(sum) + HalfIPDistanceScalar(vector1, vector2, i, dimension);
+}
+
+export f32 F16L2Distance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfL2DistanceAVX512<Float16T, LoadF16x16>(vector1, vector2, dimension);
+}
+
+export f32 F16IPDistance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfIPDistanceAVX512<Float16T, LoadF16x16>(vector1, vector2, dimension);
+}
+
+export f32 BF16L2Distance_simd(const f32 *vector1, const BFloat16T *vector2, u32 dimension) {
+    return HalfL2DistanceAVX512<BFloat16T, LoadBF16x16>(vector1, vector2, dimension);
+}
+
+export f32 BF16IPDistance_simd(const f32 *vector1, const BFloat16T *vector2, u32 dimension) {
+    return HalfIPDistanceAVX512<BFloat16T, LoadBF16x16>(vector1, vector2, dimension);
+}
+
+#elif defined(__AVX2__)
+
+#if defined(__F16C__)
+inline __m256 LoadF16x8(const Float16T *ptr) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr))); }
+#endif
+
+inline __m256 LoadBF16x8(const BFloat16T *ptr) {
+    // bf16 is the upper half of a f32
+    __m256i widened = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+    return _mm256_castsi256_ps(_mm256_slli_epi32(widened, 16));
+}
+
+template <typename HalfType, __m256 (*Load)(const HalfType *)>
+inline f32 HalfL2DistanceAVX2(const f32 *vector1, const HalfType *vector2, u32 dimension) {
+    u32 i = 0;
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        auto diff_1 = _mm256_sub_ps(_mm256_loadu_ps(vector1 + i), Load(vector2 + i));
+        auto diff_2 = _mm256_sub_ps(_mm256_loadu_ps(vector1 + i + 8), Load(vector2 + i + 8));
+        sum_1 = _mm256_add_ps(sum_1, _mm256_mul_ps(diff_1, diff_1));
+        sum_2 = _mm256_add_ps(sum_2, _mm256_mul_ps(diff_2, diff_2));
+    }
+    if (i + 8 <= dimension) {
+        auto diff = _mm256_sub_ps(_mm256_loadu_ps(vector1 + i), Load(vector2 + i));
+        sum_1 = _mm256_add_ps(sum_1, _mm256_mul_ps(diff, diff));
+        i += 8;
+    }
+    return calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2) + HalfL2DistanceScalar(vector1, vector2, i, dimension);
+}
+
+template <typename HalfType, __m256 (*Load)(const HalfType *)>
+inline f32 HalfIPDistanceAVX2(const f32 *vector1, const HalfType *vector2, u32 dimension) {
+    u32 i = 0;
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    for (; i + 16 <= dimension; i += 16) {
+        sum_1 = _mm256_add_ps(sum_1, _mm256_mul_ps(_mm256_loadu_ps(vector1 + i), Load(vector2 + i)));
+        sum_2 = _mm256_add_ps(sum_2, _mm256_mul_ps(_mm256_loadu_ps(vector1 + i + 8), Load(vector2 + i + 8)));
+    }
+    if (i + 8 <= dimension) {
+        sum_1 = _mm256_add_ps(sum_1, _mm256_mul_ps(_mm256_loadu_ps(vector1 + i), Load(vector2 + i)));
+        i += 8;
+    }
+    return calc_256_sum_8(sum_1) + calc_256_sum_8(sum_2) + HalfIPDistanceScalar(vector1, vector2, i, dimension);
+}
+
+#if defined(__F16C__)
+
+export f32 F16L2Distance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfL2DistanceAVX2<Float16T, LoadF16x8>(vector1, vector2, dimension);
+}
+
+export f32 F16IPDistance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfIPDistanceAVX2<Float16T, LoadF16x8>(vector1, vector2, dimension);
+}
+
+#else
+
+export f32 F16L2Distance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfL2DistanceScalar(vector1, vector2, 0, dimension);
+}
+
+export f32 F16IPDistance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfIPDistanceScalar(vector1, vector2, 0, dimension);
+}
+
+#endif
+
+export f32 BF16L2Distance_simd(const f32 *vector1, const BFloat16T *vector2, u32 dimension) {
+    return HalfL2DistanceAVX2<BFloat16T, LoadBF16x8>(vector1, vector2, dimension);
+}
+
+export f32 BF16IPDistance_simd(const f32 *vector1, const BFloat16T *vector2, u32 dimension) {
+    return HalfIPDistanceAVX2<BFloat16T, LoadBF16x8>(vector1, vector2, dimension);
+}
+
+#else
+
+export f32 F16L2Distance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfL2DistanceScalar(vector1, vector2, 0, dimension);
+}
+
+export f32 F16IPDistance_simd(const f32 *vector1, const Float16T *vector2, u32 dimension) {
+    return HalfIPDistanceScalar(vector1, vector2, 0, dimension);
+}
+
+export f32 BF16L2Distance_simd(const f32 *vector1, const BFloat16T *vector2, u32 dimension) {
+    return HalfL2DistanceScalar(vector1, vector2, 0, dimension);
+}
+
+export f32 BF16IPDistance_simd(const f32 *vector1, const BFloat16T *vector2, u32 dimension) {
+    return HalfIPDistanceScalar(vector1, vector2, 0, dimension);
+}
+
+#endif
+
+} // namespace infinity
@@ -16,6 +16,7 @@ module;
 #include <type_traits>
 import stl;
 import some_simd_functions;
+import internal_types;
 
 export module vector_distance;
 
@@ -24,6 +25,10 @@ export template <typename DiffType, typename ElemType1, typename ElemType2, type
 DiffType L2Distance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return L2Distance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, Float16T>) {
+        return F16L2Distance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, BFloat16T>) {
+        return BF16L2Distance_simd(vector1, vector2, dimension);
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
@@ -38,6 +43,10 @@ export template <typename DiffType, typename ElemType1, typename ElemType2, type
 DiffType IPDistance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return IPDistance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, Float16T>) {
+        return F16IPDistance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, BFloat16T>) {
+        return BF16IPDistance_simd(vector1, vector2, dimension);
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
@@ -137,6 +137,22 @@ public:
         return std::visit([&iter, &config](auto &&arg) { return arg->StoreData(std::move(iter), config); }, knn_hnsw_ptr_);
     }
 
+    // All of `srcs` must be created with the same IndexHnsw as this one
+    template <typename LabelMap>
+    bool Merge(const Vector<const AbstractHnsw *> &srcs, const LabelMap &label_map, SizeT vertex_num) {
+        return std::visit(
+            [&srcs, &label_map, vertex_num](auto &&arg) {
+                using T = std::decay_t<decltype(*arg)>;
+                Vector<const T *> src_hnsws;
+                src_hnsws.reserve(srcs.size());
+                for (const auto *src : srcs) {
+                    src_hnsws.push_back(std::get<T *>(src->knn_hnsw_ptr_));
+                }
+                return arg->Merge(src_hnsws, label_map, vertex_num);
+            },
+            knn_hnsw_ptr_);
+    }
+
     void Dump(std::ostream &os) const {
         std::visit([&os](auto &&arg) { arg->Dump(os); }, knn_hnsw_ptr_);
     }
@@ -190,6 +190,32 @@ public:
         AddVec(std::move(empty_iter));
     }
 
+    // Copies the vectors `src_vertices` of `src` to the end with the new labels, the vertices are not added to the graph.
+    // The vec store meta must be set before the first copy, see VecStoreMeta::InheritFrom.
+    Pair<SizeT, SizeT> CopyVec(const This &src, const Vector<Pair<VertexType, LabelType>> &src_vertices) {
+        SizeT cur_vec_num = this->cur_vec_num();
+        SizeT start_idx = cur_vec_num;
+        auto [chunk_num, last_chunk_size] = ChunkInfo(cur_vec_num);
+        bool same_codec = vec_store_meta_.CanCopyFrom(src.vec_store_meta_);
+        for (const auto &[src_i, label] : src_vertices) {
+            if (cur_vec_num == max_chunk_n_ * chunk_size_) {
+                break;
+            }
+            const auto &[src_inner, src_idx] = src.GetInner(src_i);
+            inners_[chunk_num - 1].CopyVec(last_chunk_size, src_inner, src_idx, label, vec_store_meta_, src.vec_store_meta_, same_codec);
+            ++cur_vec_num;
+            ++last_chunk_size;
+            if (last_chunk_size == chunk_size_ && cur_vec_num < max_chunk_n_ * chunk_size_) {
+                inners_[chunk_num++] = Inner::Make(chunk_size_, vec_store_meta_, graph_store_meta_);
+                last_chunk_size = 0;
+            }
+        }
+        cur_vec_num_.store(cur_vec_num);
+        return {start_idx, cur_vec_num};
+    }
+
+    VecStoreMeta &vec_store_meta_mut() { return vec_store_meta_; }
+
     typename VecStoreT::StoreType GetVec(SizeT vec_i) const {
         const auto &[inner, idx] = GetInner(vec_i);
         return inner.GetVec(idx, vec_store_meta_);
@@ -221,6 +247,11 @@ public:
         return inner.GetNeighborsMut(idx, layer_i, graph_store_meta_);
     }
 
+    i32 GetLayerN(VertexType vertex_i) const {
+        const auto &[inner, idx] = GetInner(vertex_i);
+        return inner.GetLayerN(idx, graph_store_meta_);
+    }
+
     Pair<i32, VertexType> GetEnterPoint() const { return graph_store_meta_.GetEnterPoint(); }
 
     Pair<i32, VertexType> TryUpdateEnterPoint(i32 layer, VertexType vertex_i) { return graph_store_meta_.TryUpdateEnterPoint(layer, vertex_i); }
@@ -373,6 +404,17 @@ public:
         return {insert_n, used_up};
     }
 
+    void CopyVec(VertexType vec_i,
+                 const This &src,
+                 VertexType src_i,
+                 LabelType label,
+                 const VecStoreMeta &meta,
+                 const VecStoreMeta &src_meta,
+                 bool same_codec) {
+        vec_store_inner_.CopyVec(vec_i, src.vec_store_inner_, src_i, meta, src_meta, same_codec);
+        labels_[vec_i] = label;
+    }
+
     typename VecStoreT::StoreType GetVec(VertexType vec_i, const VecStoreMeta &meta) const { return vec_store_inner_.GetVec(vec_i, meta); }
 
     void PrefetchVec(VertexType vec_i, const VecStoreMeta &meta) const { vec_store_inner_.Prefetch(vec_i, meta); }
@@ -387,6 +429,8 @@ public:
         return graph_store_inner_.GetNeighborsMut(vertex_i, layer_i, meta);
     }
 
+    i32 GetLayerN(VertexType vertex_i, const GraphStoreMeta &meta) const { return graph_store_inner_.GetLayerN(vertex_i, meta); }
+
     LabelType GetLabel(VertexType vec_i) const { return labels_[vec_i]; }
 
     std::shared_lock<std::shared_mutex> SharedLock(VertexType vec_i) const { return std::shared_lock<std::shared_mutex>(vertex_mutex_[vec_i]); }
@@ -231,6 +231,8 @@ public:
         return {vx->neighbors_, &vx->neighbor_n_};
     }
 
+    i32 GetLayerN(VertexType vertex_i, const GraphStoreMeta &meta) const { return GetLevel0(vertex_i, meta)->layer_n_; }
+
 private:
     const VertexL0 *GetLevel0(VertexType vertex_i, const GraphStoreMeta &meta) const {
         return reinterpret_cast<const VertexL0 *>(graph_.get() + vertex_i * meta.level0_size());
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <cassert>
 #include <ostream>
 
@@ -177,6 +178,23 @@ public:
         global_cache_ = LVQCache::MakeGlobalCache(mean_.get(), dim_);
     }
 
+    // The compressed data and the local cache depend on the mean, so they can only be copied between stores with the same mean
+    bool CanCopyFrom(const This &other) const { return dim_ == other.dim_ && std::equal(mean_.get(), mean_.get() + dim_, other.mean_.get()); }
+
+    // Takes the mean of `other` so that the vectors compressed by it can be copied without recompressing
+    void InheritFrom(const This &other) {
+        assert(dim_ == other.dim_);
+        std::copy(other.mean_.get(), other.mean_.get() + dim_, mean_.get());
+        global_cache_ = LVQCache::MakeGlobalCache(mean_.get(), dim_);
+    }
+
+    // Compresses the vector `src` compressed by `src_meta` again with the mean of this meta
+    void RecompressTo(const LVQData *src, const This &src_meta, LVQData *dest) const {
+        auto temp_decompress = MakeUnique<DataType[]>(dim_);
+        src_meta.DecompressTo(src, temp_decompress.get());
+        CompressTo(temp_decompress.get(), dest);
+    }
+
     SizeT dim() const { return dim_; }
     SizeT compress_data_size() const { return compress_data_size_; }
 
@@ -250,6 +268,15 @@ public:
         return reinterpret_cast<const LVQData *>(ptr_.get() + idx * meta.compress_data_size());
     }
 
+    // `same_mean` is meta.CanCopyFrom(src_meta), checked once by the caller instead of for every vector
+    void CopyVec(SizeT idx, const This &src, SizeT src_idx, const Meta &meta, const Meta &src_meta, bool same_mean) {
+        if (same_mean) {
+            std::memcpy(GetVecMut(idx, meta), src.GetVec(src_idx, src_meta), meta.compress_data_size());
+        } else {
+            meta.RecompressTo(src.GetVec(src_idx, src_meta), src_meta, GetVecMut(idx, meta));
+        }
+    }
+
     void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
 
 private:
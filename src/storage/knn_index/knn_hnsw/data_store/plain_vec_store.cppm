@@ -63,6 +63,11 @@ public:
 
     QueryType MakeQuery(const DataType *vec) const { return vec; }
 
+    // Plain vectors don't depend on the meta, so they can be copied from any store of the same dimension
+    bool CanCopyFrom(const This &other) const { return dim_ == other.dim_; }
+
+    void InheritFrom(const This &other) { assert(dim_ == other.dim_); }
+
     SizeT dim() const { return dim_; }
 
 private:
@@ -101,6 +106,10 @@ public:
 
     const DataType *GetVec(SizeT idx, const Meta &meta) const { return ptr_.get() + idx * meta.dim(); }
 
+    void CopyVec(SizeT idx, const This &src, SizeT src_idx, const Meta &meta, const Meta &src_meta, bool) {
+        SetVec(idx, src.GetVec(src_idx, src_meta), meta);
+    }
+
     void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
 
 private:
@@ -14,8 +14,11 @@
 
 module;
 
+#include <algorithm>
+#include <numeric>
 #include <ostream>
 #include <random>
+#include <vector>
 
 export module hnsw_alg;
 
@@ -54,6 +57,8 @@ public:
 
     constexpr static int prefetch_offset_ = 0;
     constexpr static int prefetch_step_ = 2;
+    // one of `stitch_stride_` vertices of layer 0 searches the whole merged graph when merging
+    constexpr static VertexType stitch_stride_ = 4;
 
 private:
     KnnHnsw(SizeT M, SizeT ef_construction, DataStore data_store, Distance distance, SizeT ef, SizeT random_seed)
@@ -283,6 +288,141 @@ private:
 
     LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
 
+    // Adds the vertices of `src` kept by `vertex_map` with their neighbors. The neighbors dropped from the list are replaced by their
+    // own neighbors, and the list is selected again with the heuristic.
+    void CopyGraph(const This &src, const Vector<VertexType> &vertex_map, bool update_enter_point) {
+        const DataStore &src_store = src.data_store_;
+        Vector<VertexType> candidate_vertices;
+        for (VertexType src_i = 0; src_i < VertexType(vertex_map.size()); ++src_i) {
+            VertexType vertex_i = vertex_map[src_i];
+            if (vertex_i == -1) {
+                continue;
+            }
+            i32 layer_n = src_store.GetLayerN(src_i);
+            data_store_.AddVertex(vertex_i, layer_n);
+            if (update_enter_point) {
+                data_store_.TryUpdateEnterPoint(layer_n, vertex_i);
+            }
+            for (i32 layer_i = 0; layer_i <= layer_n; ++layer_i) {
+                const auto [src_neighbors_p, src_neighbor_size] = src_store.GetNeighbors(src_i, layer_i);
+                auto [neighbors_p, neighbor_size_p] = data_store_.GetNeighborsMut(vertex_i, layer_i);
+                VertexListSize neighbor_size = 0;
+                candidate_vertices.clear();
+                for (VertexListSize i = 0; i < src_neighbor_size; ++i) {
+                    VertexType src_n_idx = src_neighbors_p[i];
+                    if (VertexType n_idx = vertex_map[src_n_idx]; n_idx != -1) {
+                        neighbors_p[neighbor_size++] = n_idx;
+                        continue;
+                    }
+                    const auto [dropped_neighbors_p, dropped_neighbor_size] = src_store.GetNeighbors(src_n_idx, layer_i);
+                    for (VertexListSize j = 0; j < dropped_neighbor_size; ++j) {
+                        VertexType n_idx = vertex_map[dropped_neighbors_p[j]];
+                        if (n_idx != -1 && n_idx != vertex_i) {
+                            candidate_vertices.push_back(n_idx);
+                        }
+                    }
+                }
+                *neighbor_size_p = neighbor_size;
+                if (neighbor_size == src_neighbor_size) {
+                    continue;
+                }
+                candidate_vertices.insert(candidate_vertices.end(), neighbors_p, neighbors_p + neighbor_size);
+                std::sort(candidate_vertices.begin(), candidate_vertices.end());
+                candidate_vertices.erase(std::unique(candidate_vertices.begin(), candidate_vertices.end()), candidate_vertices.end());
+
+                StoreType query = data_store_.GetVec(vertex_i);
+                Vector<PDV> candidates;
+                candidates.reserve(candidate_vertices.size());
+                for (VertexType n_idx : candidate_vertices) {
+                    candidates.emplace_back(distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta()), n_idx);
+                }
+                SizeT Mmax = layer_i == 0 ? data_store_.Mmax0() : data_store_.Mmax();
+                SelectNeighborsHeuristic(std::move(candidates), Mmax, neighbors_p, neighbor_size_p);
+            }
+        }
+    }
+
+    // Selects the neighbors of `vertex_i` in layer `layer_idx` again among the old ones and `candidates`, the new neighbors link back to it
+    void AddNeighborCandidates(VertexType vertex_i, i32 layer_idx, Vector<PDV> candidates) {
+        auto [neighbors_p, neighbor_size_p] = data_store_.GetNeighborsMut(vertex_i, layer_idx);
+        Vector<VertexType> old_neighbors(neighbors_p, neighbors_p + *neighbor_size_p);
+        std::erase_if(candidates, [&](const PDV &candidate) {
+            return candidate.second == vertex_i || std::find(old_neighbors.begin(), old_neighbors.end(), candidate.second) != old_neighbors.end();
+        });
+        if (candidates.empty()) {
+            return;
+        }
+        StoreType query = data_store_.GetVec(vertex_i);
+        for (VertexType n_idx : old_neighbors) {
+            candidates.emplace_back(distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta()), n_idx);
+        }
+        SizeT Mmax = layer_idx == 0 ? data_store_.Mmax0() : data_store_.Mmax();
+        SelectNeighborsHeuristic(std::move(candidates), Mmax, neighbors_p, neighbor_size_p);
+
+        Vector<VertexType> new_neighbors;
+        for (VertexListSize i = 0; i < *neighbor_size_p; ++i) {
+            VertexType n_idx = neighbors_p[i];
+            if (std::find(old_neighbors.begin(), old_neighbors.end(), n_idx) != old_neighbors.end()) {
+                continue;
+            }
+            const auto [n_neighbors_p, n_neighbor_size] = data_store_.GetNeighbors(n_idx, layer_idx);
+            if (std::find(n_neighbors_p, n_neighbors_p + n_neighbor_size, vertex_i) == n_neighbors_p + n_neighbor_size) {
+                new_neighbors.push_back(n_idx);
+            }
+        }
+        ConnectNeighbors(vertex_i, new_neighbors.data(), new_neighbors.size(), layer_idx);
+    }
+
+    // Connects the vertices [begin, end) copied from one graph to the rest of the merged graph.
+    // The vertices of the upper layers and one of `stitch_stride_` vertices of layer 0 search the merged graph like a vertex being built,
+    // the other vertices only search layer 0 around themselves.
+    void StitchGraph(VertexType begin, VertexType end) {
+        Vector<Pair<i32, VertexType>> search_vertices;
+        for (VertexType vertex_i = begin; vertex_i < end; ++vertex_i) {
+            i32 layer_n = data_store_.GetLayerN(vertex_i);
+            if (layer_n > 0 || (vertex_i - begin) % stitch_stride_ == 0) {
+                search_vertices.emplace_back(layer_n, vertex_i);
+            }
+        }
+        // Upper layers first, so that the later searches can descend into this graph
+        std::stable_sort(search_vertices.begin(), search_vertices.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+
+        for (const auto &[q_layer, vertex_i] : search_vertices) {
+            auto [max_layer, ep] = data_store_.GetEnterPoint();
+            StoreType query = data_store_.GetVec(vertex_i);
+            for (i32 cur_layer = max_layer; cur_layer > q_layer; --cur_layer) {
+                ep = SearchLayerNearest<false>(ep, query, cur_layer);
+            }
+            for (i32 cur_layer = std::min(q_layer, max_layer); cur_layer >= 0; --cur_layer) {
+                auto [result_n, d_ptr, v_ptr] = SearchLayer<false>(ep, query, cur_layer, ef_construction_, None);
+                Vector<PDV> candidates(result_n);
+                for (SizeT i = 0; i < result_n; ++i) {
+                    candidates[i] = {d_ptr[i], v_ptr[i]};
+                }
+                AddNeighborCandidates(vertex_i, cur_layer, std::move(candidates));
+                if (const auto [neighbors_p, neighbor_size] = data_store_.GetNeighbors(vertex_i, cur_layer); neighbor_size > 0) {
+                    ep = neighbors_p[0];
+                }
+            }
+            data_store_.TryUpdateEnterPoint(q_layer, vertex_i);
+        }
+
+        // The links of the searched vertices lead the others to the other graphs, so a narrower search from the vertex itself is enough
+        SizeT local_ef = std::max(M_, ef_construction_ / 2);
+        for (VertexType vertex_i = begin; vertex_i < end; ++vertex_i) {
+            if (data_store_.GetLayerN(vertex_i) > 0 || (vertex_i - begin) % stitch_stride_ == 0) {
+                continue;
+            }
+            StoreType query = data_store_.GetVec(vertex_i);
+            auto [result_n, d_ptr, v_ptr] = SearchLayer<false>(vertex_i, query, 0, local_ef, None);
+            Vector<PDV> candidates(result_n);
+            for (SizeT i = 0; i < result_n; ++i) {
+                candidates[i] = {d_ptr[i], v_ptr[i]};
+            }
+            AddNeighborCandidates(vertex_i, 0, std::move(candidates));
+        }
+    }
+
     template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
     Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const DataType *q, SizeT k, const Filter &filter) const {
         auto query = data_store_.MakeQuery(q);
@@ -322,6 +462,68 @@ public:
 
     void Optimize() { data_store_.Optimize(); }
 
+    // Merges the graphs of `srcs` into this empty index instead of inserting their vectors again. `label_map(src_idx, label)` returns the
+    // label in this index of a vertex of `srcs[src_idx]`, or None if the vertex is dropped.
+    // The largest source is copied as the backbone, the others are copied and stitched to it with a limited number of searches. With LVQ
+    // the index takes the mean of the backbone, the vectors of sources with the same mean are copied without recompressing.
+    // Returns false without modifying the index if the sources are built with other parameters or don't keep exactly `vertex_num` vertices.
+    template <typename LabelMap>
+    bool Merge(const Vector<const This *> &srcs, const LabelMap &label_map, SizeT vertex_num) {
+        if (data_store_.cur_vec_num() != 0) {
+            return false;
+        }
+        Vector<Vector<Pair<VertexType, LabelType>>> kept_vertices(srcs.size());
+        SizeT kept_num = 0;
+        for (SizeT src_idx = 0; src_idx < srcs.size(); ++src_idx) {
+            const DataStore &src_store = srcs[src_idx]->data_store_;
+            if (src_store.dim() != data_store_.dim() || src_store.Mmax0() != data_store_.Mmax0() || src_store.Mmax() != data_store_.Mmax()) {
+                return false;
+            }
+            SizeT src_vec_num = src_store.cur_vec_num();
+            for (VertexType src_i = 0; src_i < VertexType(src_vec_num); ++src_i) {
+                if (Optional<LabelType> label = label_map(src_idx, src_store.GetLabel(src_i)); label.has_value()) {
+                    kept_vertices[src_idx].emplace_back(src_i, *label);
+                }
+            }
+            kept_num += kept_vertices[src_idx].size();
+        }
+        if (kept_num != vertex_num) {
+            return false;
+        }
+        if (kept_num == 0) {
+            return true;
+        }
+
+        Vector<SizeT> order(srcs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](SizeT a, SizeT b) { return kept_vertices[a].size() > kept_vertices[b].size(); });
+        data_store_.vec_store_meta_mut().InheritFrom(srcs[order[0]]->data_store_.vec_store_meta());
+
+        Vector<Pair<VertexType, VertexType>> ranges(srcs.size());
+        Vector<Vector<VertexType>> vertex_maps(srcs.size());
+        for (SizeT src_idx : order) {
+            const auto &kept = kept_vertices[src_idx];
+            auto [start_i, end_i] = data_store_.CopyVec(srcs[src_idx]->data_store_, kept);
+            if (end_i - start_i != kept.size()) {
+                String error_message = "Merged hnsw index exceeds the capacity.";
+                UnrecoverableError(error_message);
+            }
+            ranges[src_idx] = {VertexType(start_i), VertexType(end_i)};
+            vertex_maps[src_idx].assign(srcs[src_idx]->data_store_.cur_vec_num(), -1);
+            for (SizeT i = 0; i < kept.size(); ++i) {
+                vertex_maps[src_idx][kept[i].first] = VertexType(start_i + i);
+            }
+        }
+        for (SizeT src_idx : order) {
+            CopyGraph(*srcs[src_idx], vertex_maps[src_idx], src_idx == order[0]);
+        }
+        for (SizeT i = 1; i < order.size(); ++i) {
+            const auto &[begin, end] = ranges[order[i]];
+            StitchGraph(begin, end);
+        }
+        return true;
+    }
+
     Pair<VertexType, VertexType>
     StoreDataRaw(const DataType *query, SizeT insert_n, LabelType offset = 0, const HnswInsertConfig &config = kDefaultHnswInsertConfig) {
         return StoreData(DenseVectorIter<DataType, LabelType>(query, data_store_.dim(), insert_n, offset), config);
@@ -0,0 +1,309 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+#include <cstring>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <simde/x86/avx2.h>
+#define __SSE__
+#endif
+
+export module maxsim_simd_funcs;
+
+import stl;
+
+namespace infinity {
+
+// MaxSim(Q, T) = sum over query embeddings q of max over target embeddings t of <q, t>.
+// The kernels below never build the |Q| x |T| similarity matrix: targets are walked in blocks that fit in L1,
+// every block is scored against all query embeddings and only the running max of each query embedding is kept.
+
+// Target embeddings in one cache block, 64 float embeddings of dimension 128 take 32KB
+constexpr u32 MAXSIM_TARGET_BLOCK_BYTES = 32 * 1024;
+
+// Per thread buffer of the running max of each query embedding, reused by all rows scored on this thread
+export f32 *MaxSimScratch(u32 query_embedding_num) {
+    static thread_local Vector<f32> scratch;
+    if (scratch.size() < query_embedding_num) {
+        scratch.resize(query_embedding_num);
+    }
+    return scratch.data();
+}
+
+inline u32 TargetBlockSize(u32 target_embedding_bytes) { return std::max<u32>(4, MAXSIM_TARGET_BLOCK_BYTES / std::max<u32>(1, target_embedding_bytes)); }
+
+inline f32 SumOfMax(const f32 *max_scores, u32 query_embedding_num) {
+    f32 maxsim_score = 0.0f;
+    for (u32 i = 0; i < query_embedding_num; ++i) {
+        maxsim_score += max_scores[i];
+    }
+    return maxsim_score;
+}
+
+// float x float
+
+#if defined(__AVX2__)
+
+inline f32 HorizontalSum(__m256 x) {
+    const __m128 sum_quad = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+    const __m128 sum_dual = _mm_add_ps(sum_quad, _mm_movehl_ps(sum_quad, sum_quad));
+    const __m128 sum = _mm_add_ss(sum_dual, _mm_shuffle_ps(sum_dual, sum_dual, 0x1));
+    return _mm_cvtss_f32(sum);
+}
+
+// 1 query embedding against 4 target embeddings, the query chunk is loaded once for 4 FMAs
+inline void IPF32Block1x4(const f32 *q, const f32 *t, u32 dim, f32 *out) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    __m256 acc2 = _mm256_setzero_ps();
+    __m256 acc3 = _mm256_setzero_ps();
+    const f32 *t0 = t, *t1 = t + dim, *t2 = t + 2 * dim, *t3 = t + 3 * dim;
+    u32 k = 0;
+    for (; k + 8 <= dim; k += 8) {
+        const __m256 vq = _mm256_loadu_ps(q + k);
+        acc0 = _mm256_fmadd_ps(vq, _mm256_loadu_ps(t0 + k), acc0);
+        acc1 = _mm256_fmadd_ps(vq, _mm256_loadu_ps(t1 + k), acc1);
+        acc2 = _mm256_fmadd_ps(vq, _mm256_loadu_ps(t2 + k), acc2);
+        acc3 = _mm256_fmadd_ps(vq, _mm256_loadu_ps(t3 + k), acc3);
+    }
+    out[0] = HorizontalSum(acc0);
+    out[1] = HorizontalSum(acc1);
+    out[2] = HorizontalSum(acc2);
+    out[3] = HorizontalSum(acc3);
+    for (; k < dim; ++k) {
+        out[0] += q[k] * t0[k];
+        out[1] += q[k] * t1[k];
+        out[2] += q[k] * t2[k];
+        out[3] += q[k] * t3[k];
+    }
+}
+
+inline f32 IPF32(const f32 *q, const f32 *t, u32 dim) {
+    __m256 acc = _mm256_setzero_ps();
+    u32 k = 0;
+    for (; k + 8 <= dim; k += 8) {
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(q + k), _mm256_loadu_ps(t + k), acc);
+    }
+    f32 res = HorizontalSum(acc);
+    for (; k < dim; ++k) {
+        res += q[k] * t[k];
+    }
+    return res;
+}
+
+#else
+
+inline void IPF32Block1x4(const f32 *q, const f32 *t, u32 dim, f32 *out) {
+    f32 acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+    const f32 *t0 = t, *t1 = t + dim, *t2 = t + 2 * dim, *t3 = t + 3 * dim;
+    for (u32 k = 0; k < dim; ++k) {
+        acc0 += q[k] * t0[k];
+        acc1 += q[k] * t1[k];
+        acc2 += q[k] * t2[k];
+        acc3 += q[k] * t3[k];
+    }
+    out[0] = acc0;
+    out[1] = acc1;
+    out[2] = acc2;
+    out[3] = acc3;
+}
+
+inline f32 IPF32(const f32 *q, const f32 *t, u32 dim) {
+    f32 res = 0.0f;
+    for (u32 k = 0; k < dim; ++k) {
+        res += q[k] * t[k];
+    }
+    return res;
+}
+
+#endif
+
+export f32 MaxSimF32(const f32 *query, const f32 *target, u32 query_embedding_num, u32 target_embedding_num, u32 dim) {
+    f32 *max_scores = MaxSimScratch(query_embedding_num);
+    std::fill_n(max_scores, query_embedding_num, std::numeric_limits<f32>::lowest());
+    const u32 block_size = TargetBlockSize(dim * sizeof(f32));
+    for (u32 block_start = 0; block_start < target_embedding_num; block_start += block_size) {
+        const u32 block_end = std::min(block_start + block_size, target_embedding_num);
+        for (u32 i = 0; i < query_embedding_num; ++i) {
+            const f32 *q = query + i * dim;
+            f32 max_score_i = max_scores[i];
+            u32 j = block_start;
+            for (; j + 4 <= block_end; j += 4) {
+                f32 scores[4];
+                IPF32Block1x4(q, target + j * dim, dim, scores);
+                max_score_i = std::max({max_score_i, scores[0], scores[1], scores[2], scores[3]});
+            }
+            for (; j < block_end; ++j) {
+                max_score_i = std::max(max_score_i, IPF32(q, target + j * dim, dim));
+            }
+            max_scores[i] = max_score_i;
+        }
+    }
+    return SumOfMax(max_scores, query_embedding_num);
+}
+
+// int8 x int8
+
+#if defined(__AVX2__)
+
+inline i32 IPI8(const i8 *q, const i8 *t, u32 dim) {
+    __m256i acc = _mm256_setzero_si256();
+    u32 k = 0;
+    for (; k + 16 <= dim; k += 16) {
+        const __m256i vq = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(q + k)));
+        const __m256i vt = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(t + k)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(vq, vt));
+    }
+    const __m128i sum_quad = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    const __m128i sum_dual = _mm_add_epi32(sum_quad, _mm_unpackhi_epi64(sum_quad, sum_quad));
+    i32 res = _mm_cvtsi128_si32(_mm_add_epi32(sum_dual, _mm_shuffle_epi32(sum_dual, 0x1)));
+    for (; k < dim; ++k) {
+        res += static_cast<i32>(q[k]) * static_cast<i32>(t[k]);
+    }
+    return res;
+}
+
+#else
+
+inline i32 IPI8(const i8 *q, const i8 *t, u32 dim) {
+    i32 res = 0;
+    for (u32 k = 0; k < dim; ++k) {
+        res += static_cast<i32>(q[k]) * static_cast<i32>(t[k]);
+    }
+    return res;
+}
+
+#endif
+
+export f32 MaxSimI8(const i8 *query, const i8 *target, u32 query_embedding_num, u32 target_embedding_num, u32 dim) {
+    f32 *max_scores = MaxSimScratch(query_embedding_num);
+    std::fill_n(max_scores, query_embedding_num, std::numeric_limits<f32>::lowest());
+    const u32 block_size = TargetBlockSize(dim);
+    for (u32 block_start = 0; block_start < target_embedding_num; block_start += block_size) {
+        const u32 block_end = std::min(block_start + block_size, target_embedding_num);
+        for (u32 i = 0; i < query_embedding_num; ++i) {
+            const i8 *q = query + i * dim;
+            i32 max_score_i = std::numeric_limits<i32>::lowest();
+            for (u32 j = block_start; j < block_end; ++j) {
+                max_score_i = std::max(max_score_i, IPI8(q, target + j * dim, dim));
+            }
+            max_scores[i] = std::max(max_scores[i], static_cast<f32>(max_score_i));
+        }
+    }
+    return SumOfMax(max_scores, query_embedding_num);
+}
+
+// bit x bit, the score of two embeddings is the number of bits set in both
+
+inline u32 AndPopcount(const u8 *q, const u8 *t, u32 bytes) {
+    u32 res = 0;
+    u32 k = 0;
+    for (; k + sizeof(u64) <= bytes; k += sizeof(u64)) {
+        u64 q_word, t_word;
+        std::memcpy(&q_word, q + k, sizeof(u64));
+        std::memcpy(&t_word, t + k, sizeof(u64));
+        res += std::popcount(q_word & t_word);
+    }
+    for (; k < bytes; ++k) {
+        res += std::popcount(static_cast<u8>(q[k] & t[k]));
+    }
+    return res;
+}
+
+export f32 MaxSimBit(const u8 *query, const u8 *target, u32 query_embedding_num, u32 target_embedding_num, u32 dim) {
+    const u32 bytes = dim / 8;
+    f32 maxsim_score = 0.0f;
+    for (u32 i = 0; i < query_embedding_num; ++i) {
+        const u8 *q = query + i * bytes;
+        u32 max_score_i = 0;
+        for (u32 j = 0; j < target_embedding_num && max_score_i < dim; ++j) {
+            max_score_i = std::max(max_score_i, AndPopcount(q, target + j * bytes, bytes));
+        }
+        maxsim_score += max_score_i;
+    }
+    return maxsim_score;
+}
+
+// Sum of the elements of dense whose bit is set in bits, only the set bits are visited
+template <typename DenseT>
+inline f32 MaskedSum(const DenseT *dense, const u8 *bits, u32 bytes) {
+    f32 res = 0.0f;
+    for (u32 k = 0; k < bytes; ++k) {
+        for (u32 byte = bits[k]; byte != 0; byte &= byte - 1) {
+            res += static_cast<f32>(dense[k * 8 + std::countr_zero(byte)]);
+        }
+    }
+    return res;
+}
+
+// dense query x bit target
+export template <typename QueryElemT>
+f32 MaxSimDenseBit(const QueryElemT *query, const u8 *target, u32 query_embedding_num, u32 target_embedding_num, u32 dim) {
+    const u32 bytes = dim / 8;
+    f32 maxsim_score = 0.0f;
+    for (u32 i = 0; i < query_embedding_num; ++i) {
+        f32 max_score_i = std::numeric_limits<f32>::lowest();
+        for (u32 j = 0; j < target_embedding_num; ++j) {
+            max_score_i = std::max(max_score_i, MaskedSum(query + i * dim, target + j * bytes, bytes));
+        }
+        maxsim_score += max_score_i;
+    }
+    return maxsim_score;
+}
+
+// bit query x dense target
+export template <typename TensorElemT>
+f32 MaxSimBitDense(const u8 *query, const TensorElemT *target, u32 query_embedding_num, u32 target_embedding_num, u32 dim) {
+    const u32 bytes = dim / 8;
+    f32 maxsim_score = 0.0f;
+    for (u32 i = 0; i < query_embedding_num; ++i) {
+        f32 max_score_i = std::numeric_limits<f32>::lowest();
+        for (u32 j = 0; j < target_embedding_num; ++j) {
+            max_score_i = std::max(max_score_i, MaskedSum(target + j * dim, query + i * bytes, bytes));
+        }
+        maxsim_score += max_score_i;
+    }
+    return maxsim_score;
+}
+
+// Other element type pairs, converted to float element by element without any allocation
+export template <typename QueryElemT, typename TensorElemT>
+f32 MaxSimGeneric(const QueryElemT *query, const TensorElemT *target, u32 query_embedding_num, u32 target_embedding_num, u32 dim) {
+    f32 *max_scores = MaxSimScratch(query_embedding_num);
+    std::fill_n(max_scores, query_embedding_num, std::numeric_limits<f32>::lowest());
+    const u32 block_size = TargetBlockSize(dim * sizeof(TensorElemT));
+    for (u32 block_start = 0; block_start < target_embedding_num; block_start += block_size) {
+        const u32 block_end = std::min(block_start + block_size, target_embedding_num);
+        for (u32 i = 0; i < query_embedding_num; ++i) {
+            const QueryElemT *q = query + i * dim;
+            f32 max_score_i = max_scores[i];
+            for (u32 j = block_start; j < block_end; ++j) {
+                const TensorElemT *t = target + j * dim;
+                f32 score_ij = 0.0f;
+                for (u32 k = 0; k < dim; ++k) {
+                    score_ij += static_cast<f32>(q[k]) * static_cast<f32>(t[k]);
+                }
+                max_score_i = std::max(max_score_i, score_ij);
+            }
+            max_scores[i] = max_score_i;
+        }
+    }
+    return SumOfMax(max_scores, query_embedding_num);
+}
+
+} // namespace infinity
@@ -39,7 +39,7 @@ class MergeKnn final : public MergeKnnBase {
 
 public:
     explicit MergeKnn(u64 query_count, u64 topk)
-        : total_count_(0), query_count_(query_count), topk_(topk), idx_array_(MakeUniqueForOverwrite<RowID[]>(topk * query_count)),
+        : total_counts_(query_count), query_count_(query_count), topk_(topk), idx_array_(MakeUniqueForOverwrite<RowID[]>(topk * query_count)),
           distance_array_(MakeUniqueForOverwrite<DataType[]>(topk * query_count)) {
         result_handler_ = MakeUnique<ResultHandler>(query_count, topk, this->distance_array_.get(), this->idx_array_.get());
     }
@@ -47,9 +47,28 @@ public:
     ~MergeKnn() final = default;
 
 public:
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
-
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
+    // ColumnDataType differs from DataType when the column stores a narrower element, e.g. f16 data searched with a f32 query
+    template <typename ColumnDataType = DataType>
+    void Search(const DataType *query,
+                const ColumnDataType *data,
+                u32 dim,
+                DataType (*dist_f)(const DataType *, const ColumnDataType *, SizeT),
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id);
+
+    template <typename ColumnDataType = DataType>
+    void Search(const DataType *query,
+                const ColumnDataType *data,
+                u32 dim,
+                DataType (*dist_f)(const DataType *, const ColumnDataType *, SizeT),
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id,
+                Bitmask &bitmask);
+
+    // dist_matrix holds the distances of all queries to the rows of one block, query major, computed in one batch
+    void Search(const DataType *dist_matrix, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
 
     void Search(const DataType *dist, const RowID *row_ids, u16 count);
 
@@ -69,10 +88,11 @@ public:
 
     RowID *GetIDsByIdx(u64 idx) const;
 
-    i64 total_count() const { return total_count_; }
+    // the number of candidates seen by a query, the queries of a batch see different candidates when their filtered searches differ
+    i64 total_count(u64 query_id) const { return total_counts_[query_id]; }
 
 private:
-    i64 total_count_{};
+    Vector<i64> total_counts_{};
     bool begin_{false};
     u64 query_count_{};
     i64 topk_{};
@@ -84,12 +104,19 @@ private:
 };
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id) {
-    this->total_count_ += row_cnt;
+template <typename ColumnDataType>
+void MergeKnn<DataType, C>::Search(const DataType *query,
+                                   const ColumnDataType *data,
+                                   u32 dim,
+                                   DataType (*dist_f)(const DataType *, const ColumnDataType *, SizeT),
+                                   u16 row_cnt,
+                                   u32 segment_id,
+                                   u16 block_id) {
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
+        this->total_counts_[i] += row_cnt;
         const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ColumnDataType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             auto dist = dist_f(x_i, y_j, dim);
             result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
@@ -98,10 +125,11 @@ void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data,
 }
 
 template <typename DataType, template <typename, typename> typename C>
+template <typename ColumnDataType>
 void MergeKnn<DataType, C>::Search(const DataType *query,
-                                   const DataType *data,
+                                   const ColumnDataType *data,
                                    u32 dim,
-                                   DistFunc dist_f,
+                                   DataType (*dist_f)(const DataType *, const ColumnDataType *, SizeT),
                                    u16 row_cnt,
                                    u32 segment_id,
                                    u16 block_id,
@@ -113,12 +141,10 @@ void MergeKnn<DataType, C>::Search(const DataType *query,
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
         const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ColumnDataType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             if (bitmask.IsTrue(j)) {
-                if (i == 0) {
-                    ++this->total_count_;
-                }
+                ++this->total_counts_[i];
                 auto dist = dist_f(x_i, y_j, dim);
                 result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
             }
@@ -126,10 +152,25 @@ void MergeKnn<DataType, C>::Search(const DataType *query,
     }
 }
 
+template <typename DataType, template <typename, typename> typename C>
+void MergeKnn<DataType, C>::Search(const DataType *dist_matrix, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask) {
+    u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    bool all_true = bitmask.IsAllTrue();
+    for (u64 i = 0; i < this->query_count_; ++i) {
+        const DataType *dist_i = dist_matrix + i * row_cnt;
+        for (u16 j = 0; j < row_cnt; ++j) {
+            if (all_true || bitmask.IsTrue(j)) {
+                ++this->total_counts_[i];
+                result_handler_->AddResult(i, dist_i[j], RowID(segment_id, segment_offset_start + j));
+            }
+        }
+    }
+}
+
 template <typename DataType, template <typename, typename> typename C>
 void MergeKnn<DataType, C>::Search(const DataType *dist, const RowID *row_ids, u16 count) {
-    this->total_count_ += count;
     for (u64 i = 0; i < this->query_count_; ++i) {
+        this->total_counts_[i] += count;
         const DataType *d = dist + i * topk_;
         const RowID *r = row_ids + i * topk_;
         for (u16 j = 0; j < count; j++) {
@@ -140,9 +181,7 @@ void MergeKnn<DataType, C>::Search(const DataType *dist, const RowID *row_ids, u
 
 template <typename DataType, template <typename, typename> typename C>
 void MergeKnn<DataType, C>::Search(SizeT query_id, const DataType *dist, const RowID *row_ids, u16 count) {
-    if (query_id == 0) {
-        this->total_count_ += count;
-    }
+    this->total_counts_[query_id] += count;
     for (u16 j = 0; j < count; j++) {
         result_handler_->AddResult(query_id, dist[j], row_ids[j]);
     }
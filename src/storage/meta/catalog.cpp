@@ -14,7 +14,10 @@
 
 module;
 
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <thread>
 #include <vector>
 
@@ -54,6 +57,8 @@ import block_column_entry;
 import segment_index_entry;
 import chunk_index_entry;
 import log_file;
+import crc;
+import infinity_context;
 
 namespace infinity {
 
@@ -112,6 +117,8 @@ Catalog::Catalog(SharedPtr<String> data_dir)
 }
 
 Catalog::~Catalog() {
+    // Waits for the memory index recovery, it works on the entries of the catalog
+    mem_index_recover_pool_.reset();
     bool expected = true;
     bool changed = running_.compare_exchange_strong(expected, false);
     if (!changed) {
@@ -404,6 +411,8 @@ Status Catalog::RollbackWrite(TableEntry *table_entry, TxnTimeStamp commit_ts, c
 
 SegmentID Catalog::GetNextSegmentID(TableEntry *table_entry) { return table_entry->GetNextSegmentID(); }
 
+SegmentID Catalog::ReserveSegmentIDs(TableEntry *table_entry, SizeT count) { return table_entry->ReserveSegmentIDs(count); }
+
 void Catalog::AddSegment(TableEntry *table_entry, SharedPtr<SegmentEntry> &segment_entry) {
     table_entry->segment_map_.emplace(segment_entry->segment_id(), std::move(segment_entry));
     // ATTENTION: focusing on the segment id
@@ -452,7 +461,7 @@ Tuple<SpecialFunction *, Status> Catalog::GetSpecialFunctionByNameNoExcept(Catal
     return {catalog->special_functions_[function_name].get(), Status::OK()};
 }
 
-nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts, const TableMetaSerializer &table_meta_serializer) {
     nlohmann::json json_res;
     Vector<DBMeta *> databases;
     {
@@ -468,7 +477,7 @@ nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts) {
     }
 
     for (auto &db_meta : databases) {
-        json_res["databases"].emplace_back(db_meta->Serialize(max_commit_ts));
+        json_res["databases"].emplace_back(db_meta->Serialize(max_commit_ts, table_meta_serializer));
     }
     return json_res;
 }
@@ -901,6 +910,35 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
     }
 }
 
+namespace {
+
+// Full catalog file: the table meta sections, then the header section, then the footer.
+// The header is the catalog json in which every table meta is replaced by the index of its section.
+// Every section is MessagePack, with its offset, size and CRC32 in the header.
+constexpr u32 CATALOG_FILE_MAGIC_NUMBER = 0x474c5443; // "CTLG"
+constexpr u32 CATALOG_FILE_VERSION = 1;
+
+struct CatalogFileFooter {
+    u64 header_offset_{};
+    u64 header_size_{};
+    u32 header_checksum_{};
+    u32 version_{};
+    u32 magic_number_{};
+    u32 reserved_{};
+};
+
+u32 SectionChecksum(const u8 *data, SizeT size) { return CRC32IEEE::makeCRC(reinterpret_cast<const unsigned char *>(data), size); }
+
+void CheckSection(const String &catalog_path, const Vector<u8> &file_data, u64 offset, u64 size, u32 checksum) {
+    if (offset > file_data.size() || size > file_data.size() - offset || SectionChecksum(file_data.data() + offset, size) != checksum) {
+        Status status = Status::CatalogCorrupted(catalog_path);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+}
+
+} // namespace
+
 UniquePtr<Catalog> Catalog::LoadFromFile(const FullCatalogFileInfo &full_ckp_info, BufferManager *buffer_mgr) {
     const auto &catalog_path = full_ckp_info.path_;
 
@@ -911,19 +949,89 @@ UniquePtr<Catalog> Catalog::LoadFromFile(const FullCatalogFileInfo &full_ckp_inf
         UnrecoverableError(status.message());
     }
     SizeT file_size = fs.GetFileSize(*catalog_file_handler);
-    String json_str(file_size, 0);
-    SizeT n_bytes = catalog_file_handler->Read(json_str.data(), file_size);
+    Vector<u8> file_data(file_size);
+    SizeT n_bytes = catalog_file_handler->Read(file_data.data(), file_size);
     if (file_size != n_bytes) {
         Status status = Status::CatalogCorrupted(catalog_path);
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
 
-    nlohmann::json catalog_json = nlohmann::json::parse(json_str);
-    return Deserialize(catalog_json, buffer_mgr);
+    if (catalog_path.ends_with(".json")) {
+        // written before the binary format
+        nlohmann::json catalog_json = nlohmann::json::parse(file_data.begin(), file_data.end());
+        return Deserialize(catalog_json, buffer_mgr);
+    }
+
+    CatalogFileFooter footer;
+    if (file_size < sizeof(footer)) {
+        Status status = Status::CatalogCorrupted(catalog_path);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    std::memcpy(&footer, file_data.data() + file_size - sizeof(footer), sizeof(footer));
+    if (footer.magic_number_ != CATALOG_FILE_MAGIC_NUMBER || footer.version_ > CATALOG_FILE_VERSION) {
+        Status status = Status::CatalogCorrupted(catalog_path);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    CheckSection(catalog_path, file_data, footer.header_offset_, footer.header_size_, footer.header_checksum_);
+    auto header_begin = file_data.begin() + footer.header_offset_;
+    nlohmann::json catalog_json = nlohmann::json::from_msgpack(header_begin, header_begin + footer.header_size_);
+    const nlohmann::json &sections_json = catalog_json["sections"];
+
+    // The table metas are decoded and deserialized in parallel once the catalog with all its db entries is built
+    Vector<Pair<const nlohmann::json *, DBEntry *>> table_meta_jsons;
+    auto table_meta_loader = [&](const nlohmann::json &table_meta_json, DBEntry *db_entry) {
+        table_meta_jsons.emplace_back(&table_meta_json, db_entry);
+    };
+    UniquePtr<Catalog> catalog = Deserialize(catalog_json, buffer_mgr, table_meta_loader);
+
+    i64 cpu_limit = InfinityContext::instance().config()->CPULimit();
+    ThreadPool thread_pool(static_cast<int>(std::max(cpu_limit, i64(1))));
+    std::mutex table_meta_map_mutex;
+    Vector<std::future<void>> table_meta_futures;
+    // The tasks write into the db entries of the catalog, they must be finished before the catalog is destroyed by an exception
+    DeferFn wait_table_meta_tasks([&] {
+        for (auto &table_meta_future : table_meta_futures) {
+            if (table_meta_future.valid()) {
+                table_meta_future.wait();
+            }
+        }
+    });
+    for (const auto &[table_meta_json, db_entry] : table_meta_jsons) {
+        SizeT section_idx = (*table_meta_json)["section"];
+        const nlohmann::json &section_json = sections_json.at(section_idx);
+        u64 offset = section_json[0], size = section_json[1];
+        u32 checksum = section_json[2];
+        table_meta_futures.emplace_back(thread_pool.push([&, db_entry, offset, size, checksum](int) {
+            CheckSection(catalog_path, file_data, offset, size, checksum);
+            auto section_begin = file_data.begin() + offset;
+            nlohmann::json section_table_json = nlohmann::json::from_msgpack(section_begin, section_begin + size);
+            UniquePtr<TableMeta> table_meta = TableMeta::Deserialize(section_table_json, db_entry, buffer_mgr);
+            std::scoped_lock lock(table_meta_map_mutex);
+            db_entry->table_meta_map().emplace(*table_meta->table_name_, std::move(table_meta));
+        }));
+    }
+
+    std::exception_ptr exception;
+    for (auto &table_meta_future : table_meta_futures) {
+        try {
+            table_meta_future.get();
+        } catch (...) {
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    LOG_INFO(fmt::format("Loaded {} tables from full catalog file: {}", table_meta_futures.size(), catalog_path));
+    return catalog;
 }
 
-UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr) {
+UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr, const TableMetaLoader &table_meta_loader) {
     SharedPtr<String> data_dir = MakeShared<String>(catalog_json["data_dir"]);
 
     // FIXME: new catalog need a scheduler, current we use nullptr to represent it.
@@ -932,7 +1040,7 @@ UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, Buff
     catalog->full_ckp_commit_ts_ = catalog_json["full_ckp_commit_ts"];
     if (catalog_json.contains("databases")) {
         for (const auto &db_json : catalog_json["databases"]) {
-            UniquePtr<DBMeta> db_meta = DBMeta::Deserialize(db_json, buffer_mgr);
+            UniquePtr<DBMeta> db_meta = DBMeta::Deserialize(db_json, buffer_mgr, table_meta_loader);
             catalog->db_meta_map().emplace(*db_meta->db_name(), std::move(db_meta));
         }
     }
@@ -943,13 +1051,13 @@ void Catalog::SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_catalog_p
     full_catalog_path = fmt::format("{}/{}", *catalog_dir_, CatalogFile::FullCheckpoingFilename(max_commit_ts));
     String catalog_tmp_path = fmt::format("{}/{}", *catalog_dir_, CatalogFile::TempFullCheckpointFilename(max_commit_ts));
 
-    // Serialize catalog to string
+    // Runs on the full checkpoint thread of the background processor, the delta entries of the commits are added meanwhile.
+    // A table is only locked while it's serialized, its section is written after. The checkpoint txn commits once the file
+    // is durable: the WAL checkpoint command must not point at a file which isn't written yet.
+    std::scoped_lock lock(full_ckp_mutex_);
     full_ckp_commit_ts_ = max_commit_ts;
-    nlohmann::json catalog_json = Serialize(max_commit_ts);
-    String catalog_str = catalog_json.dump();
 
     // Save catalog to tmp file.
-    // FIXME: Temp implementation, will be replaced by async task.
     LocalFileSystem fs;
 
     u8 fileflags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
@@ -960,21 +1068,105 @@ void Catalog::SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_catalog_p
         UnrecoverableError(status.message());
     }
 
-    SizeT n_bytes = catalog_file_handler->Write(catalog_str.data(), catalog_str.size());
-    if (n_bytes != catalog_str.size()) {
-        Status status = Status::DataCorrupted(catalog_tmp_path);
-        LOG_ERROR(status.message());
-        RecoverableError(status);
+    u64 file_offset = 0;
+    nlohmann::json sections_json = nlohmann::json::array();
+    auto write_data = [&](const void *data, SizeT size) {
+        SizeT n_bytes = catalog_file_handler->Write(data, size);
+        if (n_bytes != size) {
+            Status status = Status::DataCorrupted(catalog_tmp_path);
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        file_offset += size;
+    };
+
+    // An unchanged table isn't serialized again, its section is copied from the last full checkpoint file.
+    // The file is still there: it's only recycled after this checkpoint is written.
+    UniquePtr<FileHandler> last_file_handler;
+    bool last_file_opened = false;
+    auto read_last_section = [&](const TableCheckpointSection &section, Vector<u8> &data) {
+        if (!last_file_opened) {
+            last_file_opened = true;
+            auto [file_handler, open_status] = fs.OpenFile(last_full_ckp_path_, FileFlags::READ_FLAG, FileLockType::kReadLock);
+            if (open_status.ok()) {
+                last_file_handler = std::move(file_handler);
+            } else {
+                LOG_WARN(fmt::format("Can't reuse the tables of the last full checkpoint: {}", open_status.message()));
+            }
+        }
+        if (last_file_handler.get() == nullptr) {
+            return false;
+        }
+        data.resize(section.size_);
+        fs.Seek(*last_file_handler, section.offset_);
+        return last_file_handler->Read(data.data(), section.size_) == static_cast<i64>(section.size_) &&
+               SectionChecksum(data.data(), data.size()) == section.checksum_;
+    };
+
+    // Each table is written as soon as it's serialized or copied
+    u64 cleanup_epoch = cleanup_epoch_.load();
+    HashMap<TableMeta *, TableCheckpointSection> table_sections;
+    SizeT reused_count = 0;
+    auto table_meta_serializer = [&](TableMeta *table_meta) {
+        String table_encode = TableEntry::EncodeIndex(*table_meta->table_name_, table_meta);
+        auto [change_sequence, change_commit_ts] = global_catalog_delta_entry_->GetTableChange(table_encode);
+        TableCheckpointSection table_section;
+        Vector<u8> section_data;
+        auto iter = table_sections_.find(table_meta);
+        if (iter != table_sections_.end() && iter->second.table_encode_ == table_encode && iter->second.change_sequence_ == change_sequence &&
+            change_commit_ts <= iter->second.max_commit_ts_ && iter->second.cleanup_epoch_ == cleanup_epoch &&
+            read_last_section(iter->second, section_data)) {
+            table_section = iter->second;
+            ++reused_count;
+        } else {
+            table_section.table_encode_ = std::move(table_encode);
+            table_section.change_sequence_ = change_sequence;
+            table_section.max_commit_ts_ = max_commit_ts;
+            table_section.cleanup_epoch_ = cleanup_epoch;
+            section_data = nlohmann::json::to_msgpack(table_meta->Serialize(max_commit_ts));
+            table_section.checksum_ = SectionChecksum(section_data.data(), section_data.size());
+        }
+        table_section.offset_ = file_offset;
+        table_section.size_ = section_data.size();
+
+        nlohmann::json table_meta_json;
+        table_meta_json["section"] = sections_json.size();
+        sections_json.push_back({table_section.offset_, table_section.size_, table_section.checksum_});
+        write_data(section_data.data(), section_data.size());
+        table_sections.emplace(table_meta, std::move(table_section));
+        return table_meta_json;
+    };
+    nlohmann::json catalog_json = Serialize(max_commit_ts, table_meta_serializer);
+    catalog_json["sections"] = std::move(sections_json);
+    if (last_file_handler.get() != nullptr) {
+        last_file_handler->Close();
     }
+
+    Vector<u8> header_data = nlohmann::json::to_msgpack(catalog_json);
+    CatalogFileFooter footer{file_offset,
+                             header_data.size(),
+                             SectionChecksum(header_data.data(), header_data.size()),
+                             CATALOG_FILE_VERSION,
+                             CATALOG_FILE_MAGIC_NUMBER,
+                             0};
+    write_data(header_data.data(), header_data.size());
+    write_data(&footer, sizeof(footer));
     catalog_file_handler->Sync();
     catalog_file_handler->Close();
 
     // Rename temp file to regular catalog file
     catalog_file_handler->Rename(catalog_tmp_path, full_catalog_path);
+    // Tables dropped since the last full checkpoint are forgotten
+    table_sections_ = std::move(table_sections);
+    last_full_ckp_path_ = full_catalog_path;
 
     global_catalog_delta_entry_->InitFullCheckpointTs(max_commit_ts);
 
-    LOG_DEBUG(fmt::format("Saved catalog to: {}", full_catalog_path));
+    LOG_DEBUG(fmt::format("Saved catalog to: {}, size: {}, {}/{} tables reused from the last full checkpoint",
+                          full_catalog_path,
+                          file_offset,
+                          reused_count,
+                          table_sections_.size()));
 }
 
 // called by bg_task
@@ -1011,6 +1203,8 @@ bool Catalog::SaveDeltaCatalog(TxnTimeStamp max_commit_ts, String &delta_catalog
         }
     }
 
+    global_catalog_delta_entry_->RecordFlushedEntry(flush_delta_entry.get());
+
     // Save the global catalog delta entry to disk.
     auto exp_size = flush_delta_entry->GetSizeInBytes();
     Vector<char> buf(exp_size);
@@ -1048,7 +1242,18 @@ void Catalog::AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry, i64 wal_si
 
 void Catalog::ReplayDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry) { global_catalog_delta_entry_->ReplayDeltaEntry(std::move(delta_entry)); }
 
-void Catalog::PickCleanup(CleanupScanner *scanner) { db_meta_map_.PickCleanup(scanner); }
+void Catalog::PickCleanup(CleanupScanner *scanner) {
+    if (mem_index_recovering_count_.load() > 0) {
+        // The recovery tasks keep pointers to the entries of their tables, dropped entries are cleaned up by a later scan
+        return;
+    }
+    SizeT picked_count = scanner->entry_count();
+    db_meta_map_.PickCleanup(scanner);
+    if (scanner->entry_count() != picked_count) {
+        // The picked entries are gone from the catalog, the serialized tables of the last full checkpoint can't be reused
+        ++cleanup_epoch_;
+    }
+}
 
 void Catalog::MemIndexCommit() {
     auto db_meta_map_guard = db_meta_map_.GetMetaMap();
@@ -1074,13 +1279,42 @@ void Catalog::MemIndexCommitLoop() {
 }
 
 void Catalog::MemIndexRecover(BufferManager *buffer_manager) {
-    auto db_meta_map_guard = db_meta_map_.GetMetaMap();
-    for (auto &[_, db_meta] : *db_meta_map_guard) {
-        auto [db_entry, status] = db_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
-        if (status.ok()) {
-            db_entry->MemIndexRecover(buffer_manager);
+    Vector<TableEntry *> table_entries;
+    {
+        auto db_meta_map_guard = db_meta_map_.GetMetaMap();
+        for (auto &[_, db_meta] : *db_meta_map_guard) {
+            auto [db_entry, status] = db_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
+            if (!status.ok()) {
+                continue;
+            }
+            auto table_meta_map_guard = db_entry->table_meta_map_.GetMetaMap();
+            for (auto &[_, table_meta] : *table_meta_map_guard) {
+                auto [table_entry, table_status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
+                if (table_status.ok()) {
+                    table_entries.push_back(table_entry);
+                }
+            }
         }
     }
+    // Only the tables with indexes are recovered. They're marked before the queries are served, so their index scans fall back to
+    // scanning the blocks and their writes wait until the recovery is done, see TableEntry::MemIndexReady
+    std::erase_if(table_entries, [](TableEntry *table_entry) { return !table_entry->SetMemIndexRecovering(); });
+    if (table_entries.empty()) {
+        return;
+    }
+
+    // The memory indexes of different tables are independent, recover them concurrently in the background
+    mem_index_recovering_count_ = table_entries.size();
+    mem_index_recover_pool_ =
+        MakeUnique<ThreadPool>(static_cast<int>(std::min<SizeT>(table_entries.size(), std::max(1u, std::thread::hardware_concurrency()))));
+    for (TableEntry *table_entry : table_entries) {
+        mem_index_recover_pool_->push([this, table_entry, buffer_manager](int) {
+            table_entry->MemIndexRecover(buffer_manager);
+            // The plans prepared while the table was recovered don't use its indexes, plan them again
+            IncreaseCatalogVersion();
+            --mem_index_recovering_count_;
+        });
+    }
 }
 
 Tuple<TxnTimeStamp, i64> Catalog::GetCheckpointState() const { return global_catalog_delta_entry_->GetCheckpointState(); }
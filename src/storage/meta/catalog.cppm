@@ -33,6 +33,7 @@ import txn_store;
 import data_access_state;
 import extra_ddl_info;
 import db_entry;
+import table_meta;
 import table_entry;
 import table_index_entry;
 import segment_entry;
@@ -201,6 +202,8 @@ public:
 
     static SegmentID GetNextSegmentID(TableEntry *table_entry);
 
+    static SegmentID ReserveSegmentIDs(TableEntry *table_entry, SizeT count);
+
     // This not add row count
     static void AddSegment(TableEntry *table_entry, SharedPtr<SegmentEntry> &segment_entry);
 
@@ -216,8 +219,9 @@ public:
 
 public:
     // Serialization and Deserialization
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, const TableMetaSerializer &table_meta_serializer = nullptr);
 
+    // Writes the binary full catalog file. Tables unchanged since the last full checkpoint reuse their serialized sections.
     void SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_path);
 
     bool SaveDeltaCatalog(TxnTimeStamp max_commit_ts, String &delta_path);
@@ -234,7 +238,8 @@ public:
     SizeT GetDeltaLogCount() const;
 
 private:
-    static UniquePtr<Catalog> Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr);
+    static UniquePtr<Catalog>
+    Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr, const TableMetaLoader &table_meta_loader = nullptr);
 
     static UniquePtr<CatalogDeltaEntry> LoadFromFileDelta(const DeltaCatalogFileInfo &delta_ckp_info);
 
@@ -266,6 +271,12 @@ public:
 
     TransactionID next_txn_id() const { return next_txn_id_; }
 
+    // Increased before and after a transaction creating or dropping a database, a table or an index commits.
+    // A plan bound while the version is unchanged sees the same schema
+    u64 catalog_version() const { return catalog_version_; }
+
+    void IncreaseCatalogVersion() { ++catalog_version_; }
+
 public:
     SharedPtr<String> data_dir_{};
     SharedPtr<String> catalog_dir_{};
@@ -277,6 +288,25 @@ public:
 private:
     TxnTimeStamp full_ckp_commit_ts_{};
 
+    // Where a table meta is in the last full checkpoint file, along with the state of the table it was serialized in
+    struct TableCheckpointSection {
+        String table_encode_{};
+        u64 change_sequence_{};
+        TxnTimeStamp max_commit_ts_{};
+        u64 cleanup_epoch_{};
+        u64 offset_{};
+        u64 size_{};
+        u32 checksum_{};
+    };
+
+    std::mutex full_ckp_mutex_{};
+    // The sections of table_sections_ are in this file, it's only recycled after the next full checkpoint is written
+    String last_full_ckp_path_{};
+    HashMap<TableMeta *, TableCheckpointSection> table_sections_{};
+    // Increased whenever cleanup removes entries from the catalog
+    Atomic<u64> cleanup_epoch_{};
+    Atomic<u64> catalog_version_{};
+
 public:
     // Currently, these function or function set can't be changed and also will not be persistent.
     HashMap<String, SharedPtr<FunctionSet>> function_sets_{};
@@ -291,6 +321,8 @@ private: // TODO: remove this
 
     Atomic<bool> running_{};
     Thread mem_index_commit_thread_{};
+    UniquePtr<ThreadPool> mem_index_recover_pool_{};
+    Atomic<SizeT> mem_index_recovering_count_{};
 
     void MemIndexCommit();
 
@@ -37,6 +37,8 @@ public:
 
     TxnTimeStamp visible_ts() const { return visible_ts_; }
 
+    SizeT entry_count() const { return entries_.size(); }
+
     static void CleanupDir(const String &dir);
 
 private:
@@ -47,9 +47,10 @@ public:
 
     SharedPtr<String> ToString();
 
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, const TableMetaSerializer &table_meta_serializer = nullptr);
 
-    static UniquePtr<DBMeta> Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr);
+    static UniquePtr<DBMeta>
+    Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr, const TableMetaLoader &table_meta_loader = nullptr);
 
     SharedPtr<String> db_name() const { return db_name_; }
 
@@ -38,6 +38,7 @@ import buffer_obj;
 import buffer_handle;
 import infinity_exception;
 import index_defines;
+import column_length_norm;
 import local_file_system;
 import secondary_index_file_worker;
 import column_def;
@@ -64,6 +65,12 @@ ChunkIndexEntry::ChunkIndexEntry(ChunkID chunk_id, SegmentIndexEntry *segment_in
     : BaseEntry(EntryType::kChunkIndex, false, ChunkIndexEntry::EncodeIndex(chunk_id, segment_index_entry)), chunk_id_(chunk_id),
       segment_index_entry_(segment_index_entry), base_name_(base_name), base_rowid_(base_rowid), row_count_(row_count){};
 
+ChunkIndexEntry::~ChunkIndexEntry() {
+    if (column_norms_buffer_mgr_ != nullptr) {
+        column_norms_buffer_mgr_->FreeExtraSpace(row_count_);
+    }
+}
+
 UniquePtr<IndexFileWorker> ChunkIndexEntry::CreateFileWorker(const IndexBase *index_base,
                                                              const SharedPtr<String> &index_dir,
                                                              CreateIndexParam *param,
@@ -192,6 +199,23 @@ u64 ChunkIndexEntry::GetColumnLengthSum() const {
     return column_length_sum;
 }
 
+const u8 *ChunkIndexEntry::GetColumnNorms() {
+    std::scoped_lock lock(column_norms_mutex_);
+    if (column_norms_.get() == nullptr) {
+        BufferHandle buffer_handle = buffer_obj_->Load();
+        const u32 *column_lengths = (const u32 *)buffer_handle.GetData();
+        BufferManager *buffer_mgr = buffer_obj_->buffer_mgr();
+        buffer_mgr->RequestExtraSpace(row_count_);
+        auto column_norms = MakeUniqueForOverwrite<u8[]>(row_count_);
+        for (SizeT i = 0; i < row_count_; i++) {
+            column_norms[i] = ColumnLengthToNorm(column_lengths[i]);
+        }
+        column_norms_ = std::move(column_norms);
+        column_norms_buffer_mgr_ = buffer_mgr;
+    }
+    return column_norms_.get();
+}
+
 BufferHandle ChunkIndexEntry::GetIndex() { return buffer_obj_->Load(); }
 
 nlohmann::json ChunkIndexEntry::Serialize() {
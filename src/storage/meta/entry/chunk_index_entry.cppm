@@ -47,6 +47,8 @@ public:
 
     ChunkIndexEntry(ChunkID chunk_id, SegmentIndexEntry *segment_index_entry, const String &base_name, RowID base_rowid, u32 row_count);
 
+    ~ChunkIndexEntry() override;
+
     static UniquePtr<IndexFileWorker> CreateFileWorker(const IndexBase *index_base,
                                                        const SharedPtr<String> &index_dir,
                                                        CreateIndexParam *param,
@@ -89,6 +91,10 @@ public:
     // Only for fulltext
     u64 GetColumnLengthSum() const;
 
+    // Only for fulltext. Byte quantized column lengths of the rows, built on first use and kept in memory with the chunk.
+    // The memory is charged to the buffer manager of the chunk until the chunk is destroyed.
+    const u8 *GetColumnNorms();
+
     inline u32 GetPartNum() const { return (row_count_ + 8191) / 8192; }
 
     inline u32 GetPartRowCount(const u32 part_id) const { return std::min<u32>(8192, row_count_ - part_id * 8192); }
@@ -141,6 +147,10 @@ public:
 private:
     BufferObj *buffer_obj_{};
     Vector<BufferObj *> part_buffer_objs_;
+    std::mutex column_norms_mutex_;
+    UniquePtr<u8[]> column_norms_;
+    // The buffer objects may be cleaned up before the chunk is destroyed, so the manager is kept to free the charged memory
+    BufferManager *column_norms_buffer_mgr_{};
 };
 
 } // namespace infinity
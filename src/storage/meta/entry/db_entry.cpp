@@ -238,7 +238,7 @@ SharedPtr<String> DBEntry::ToString() {
     return res;
 }
 
-nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts, const TableMetaSerializer &table_meta_serializer) {
     nlohmann::json json_res;
 
     Vector<TableMeta *> table_metas;
@@ -259,12 +259,17 @@ nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts) {
         }
     }
     for (TableMeta *table_meta : table_metas) {
-        json_res["tables"].emplace_back(table_meta->Serialize(max_commit_ts));
+        if (table_meta_serializer) {
+            json_res["tables"].emplace_back(table_meta_serializer(table_meta));
+        } else {
+            json_res["tables"].emplace_back(table_meta->Serialize(max_commit_ts));
+        }
     }
     return json_res;
 }
 
-UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr) {
+UniquePtr<DBEntry>
+DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr, const TableMetaLoader &table_meta_loader) {
     nlohmann::json json_res;
 
     bool deleted = db_entry_json["deleted"];
@@ -283,6 +288,10 @@ UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBM
 
     if (db_entry_json.contains("tables")) {
         for (const auto &table_meta_json : db_entry_json["tables"]) {
+            if (table_meta_loader) {
+                table_meta_loader(table_meta_json, res.get());
+                continue;
+            }
             UniquePtr<TableMeta> table_meta = TableMeta::Deserialize(table_meta_json, res.get(), buffer_mgr);
             res->table_meta_map().emplace(*table_meta->table_name_, std::move(table_meta));
         }
@@ -322,14 +331,4 @@ void DBEntry::MemIndexCommit() {
     }
 }
 
-void DBEntry::MemIndexRecover(BufferManager *buffer_manager) {
-    auto table_meta_map_guard = table_meta_map_.GetMetaMap();
-    for (auto &[_, table_meta] : *table_meta_map_guard) {
-        auto [table_entry, status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
-        if (status.ok()) {
-            table_entry->MemIndexRecover(buffer_manager);
-        }
-    }
-}
-
 } // namespace infinity
@@ -37,6 +37,12 @@ namespace infinity {
 class TxnManager;
 class Txn;
 class DBMeta;
+class DBEntry;
+
+// The binary catalog checkpoint keeps each table meta in a section of its own. The serializer returns what takes the place
+// of the table meta in the db entry json, the loader restores the table metas of a db entry from it.
+export using TableMetaSerializer = std::function<nlohmann::json(TableMeta *table_meta)>;
+export using TableMetaLoader = std::function<void(const nlohmann::json &table_meta_json, DBEntry *db_entry)>;
 
 export class DBEntry final : public BaseEntry, public EntryInterface {
     friend struct Catalog;
@@ -72,9 +78,12 @@ public:
 public:
     SharedPtr<String> ToString();
 
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, const TableMetaSerializer &table_meta_serializer = nullptr);
 
-    static UniquePtr<DBEntry> Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr);
+    static UniquePtr<DBEntry> Deserialize(const nlohmann::json &db_entry_json,
+                                          DBMeta *db_meta,
+                                          BufferManager *buffer_mgr,
+                                          const TableMetaLoader &table_meta_loader = nullptr);
 
     [[nodiscard]] const SharedPtr<String> &db_name_ptr() const { return db_name_; }
 
@@ -149,6 +158,5 @@ public:
     void Cleanup() override;
 
     void MemIndexCommit();
-    void MemIndexRecover(BufferManager *buffer_manager);
 };
 } // namespace infinity
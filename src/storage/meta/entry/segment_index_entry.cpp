@@ -16,6 +16,7 @@ module;
 
 #include <cassert>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 module segment_index_entry;
@@ -187,6 +188,8 @@ Vector<UniquePtr<IndexFileWorker>> SegmentIndexEntry::CreateFileWorkers(SharedPt
             auto create_annivfflat_param = static_cast<CreateAnnIVFFlatParam *>(param);
             auto elem_type = ((EmbeddingInfo *)(column_def->type()->type_info().get()))->Type();
             switch (elem_type) {
+                case kElemFloat16:
+                case kElemBFloat16:
                 case kElemFloat: {
                     file_worker =
                         MakeUnique<AnnIVFFlatIndexFileWorker<f32>>(index_dir, file_name, index_base, column_def, create_annivfflat_param->row_count_);
@@ -294,12 +297,29 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
 
             BlockColumnEntry *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
             SizeT row_cnt = 0;
+            auto InsertMemIndex = [&](auto &&iter) {
+                AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter));
+                row_cnt = end_i;
+            };
             switch (embedding_info->Type()) {
                 case kElemFloat: {
-                    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
                     MemIndexInserterIter<f32> iter(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
-                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter));
-                    row_cnt = end_i;
+                    InsertMemIndex(iter);
+                    break;
+                }
+                case kElemFloat16: {
+                    ConvertedColumnIterator<f32, MemIndexInserterIter<Float16T>> iter(
+                        MemIndexInserterIter<Float16T>(block_offset, block_column_entry, buffer_manager, row_offset, row_count),
+                        embedding_info->Dimension());
+                    InsertMemIndex(iter);
+                    break;
+                }
+                case kElemBFloat16: {
+                    ConvertedColumnIterator<f32, MemIndexInserterIter<BFloat16T>> iter(
+                        MemIndexInserterIter<BFloat16T>(block_offset, block_column_entry, buffer_manager, row_offset, row_count),
+                        embedding_info->Dimension());
+                    InsertMemIndex(iter);
                     break;
                 }
                 default: {
@@ -468,35 +488,58 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             RowID base_rowid(segment_entry->segment_id(), 0);
             SharedPtr<ChunkIndexEntry> chunk_index_entry = CreateChunkIndexEntry(column_def, base_rowid, buffer_mgr);
             this->AddChunkIndexEntry(chunk_index_entry);
+            if (config.merge_source_ != nullptr && MergeHnsw(chunk_index_entry.get(), segment_entry, *config.merge_source_, txn)) {
+                hnsw_merged_ = true;
+                break;
+            }
             BufferHandle buffer_handle = chunk_index_entry->GetIndex();
 
-            switch (embedding_info->Type()) {
-                case kElemFloat: {
-                    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
-                    auto InsertHnswInner = [&](auto &iter) {
-                        HnswInsertConfig insert_config;
-                        insert_config.optimize_ = true;
-                        SegmentOffset start_i, end_i;
-                        if (!config.prepare_) {
-                            // Single thread insert
-                            std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
-                        } else {
-                            // Multi thread insert data, write file in the physical create index finish stage.
-                            std::tie(start_i, end_i) = abstract_hnsw.StoreData(std::move(iter), insert_config);
-                        }
-                        LOG_TRACE(fmt::format("Insert index: {} - {}", start_i, end_i));
-                        return end_i - start_i;
-                    };
-                    SegmentOffset row_count = 0;
-                    if (config.check_ts_) {
-                        OneColumnIterator<float> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
-                        row_count = InsertHnswInner(iter);
+            auto PopulateHnsw = [&]<typename ColumnDataType>() {
+                AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                auto InsertHnswInner = [&](auto &iter) {
+                    HnswInsertConfig insert_config;
+                    insert_config.optimize_ = true;
+                    SegmentOffset start_i, end_i;
+                    if (!config.prepare_) {
+                        // Single thread insert
+                        std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
                     } else {
-                        // Not check ts in uncommitted segment when compact segment
-                        OneColumnIterator<float, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
-                        row_count = InsertHnswInner(iter);
+                        // Multi thread insert data, write file in the physical create index finish stage.
+                        std::tie(start_i, end_i) = abstract_hnsw.StoreData(std::move(iter), insert_config);
                     }
-                    chunk_index_entry->SetRowCount(row_count);
+                    LOG_TRACE(fmt::format("Insert index: {} - {}", start_i, end_i));
+                    return end_i - start_i;
+                };
+                auto InsertHnswColumn = [&](auto &&column_iter) {
+                    if constexpr (std::is_same_v<ColumnDataType, f32>) {
+                        return InsertHnswInner(column_iter);
+                    } else {
+                        using ColumnIter = std::decay_t<decltype(column_iter)>;
+                        ConvertedColumnIterator<f32, ColumnIter> iter(std::move(column_iter), embedding_info->Dimension());
+                        return InsertHnswInner(iter);
+                    }
+                };
+                SegmentOffset row_count = 0;
+                if (config.check_ts_) {
+                    row_count = InsertHnswColumn(OneColumnIterator<ColumnDataType>(segment_entry, buffer_mgr, column_def->id(), begin_ts));
+                } else {
+                    // Not check ts in uncommitted segment when compact segment
+                    row_count =
+                        InsertHnswColumn(OneColumnIterator<ColumnDataType, false>(segment_entry, buffer_mgr, column_def->id(), begin_ts));
+                }
+                chunk_index_entry->SetRowCount(row_count);
+            };
+            switch (embedding_info->Type()) {
+                case kElemFloat: {
+                    PopulateHnsw.template operator()<f32>();
+                    break;
+                }
+                case kElemFloat16: {
+                    PopulateHnsw.template operator()<Float16T>();
+                    break;
+                }
+                case kElemBFloat16: {
+                    PopulateHnsw.template operator()<BFloat16T>();
                     break;
                 }
                 default: {
@@ -540,13 +583,71 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
     max_ts_ = ts;
 }
 
-Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts) {
+bool SegmentIndexEntry::MergeHnsw(ChunkIndexEntry *chunk_index_entry,
+                                  const SegmentEntry *segment_entry,
+                                  const IndexMergeSource &merge_source,
+                                  Txn *txn) {
+    const auto *index_hnsw = static_cast<const IndexHnsw *>(table_index_entry_->index_base());
+    // Every chunk and the memory index of the old segments is a source graph
+    Vector<SegmentID> src_segment_ids;
+    Vector<SharedPtr<ChunkIndexEntry>> src_chunks;
+    {
+        SegmentIndexesGuard segment_index_guard = table_index_entry_->GetSegmentIndexesGuard();
+        for (const auto *old_segment : merge_source.old_segments_) {
+            auto iter = segment_index_guard.index_by_segment_.find(old_segment->segment_id());
+            if (iter == segment_index_guard.index_by_segment_.end()) {
+                return false;
+            }
+            auto [chunk_index_entries, memory_hnsw_indexer] = iter->second->GetHnswIndexSnapshot();
+            for (auto &chunk_index_entry : chunk_index_entries) {
+                if (chunk_index_entry->CheckVisibleByTS(txn->BeginTS())) {
+                    src_segment_ids.push_back(old_segment->segment_id());
+                    src_chunks.push_back(std::move(chunk_index_entry));
+                }
+            }
+            if (memory_hnsw_indexer.get() != nullptr) {
+                src_segment_ids.push_back(old_segment->segment_id());
+                src_chunks.push_back(std::move(memory_hnsw_indexer));
+            }
+        }
+    }
+
+    Vector<BufferHandle> src_handles;
+    Vector<AbstractHnsw<f32, SegmentOffset>> src_hnsws;
+    for (const auto &src_chunk : src_chunks) {
+        src_handles.push_back(src_chunk->GetIndex());
+        src_hnsws.emplace_back(src_handles.back().GetDataMut(), index_hnsw);
+    }
+    Vector<const AbstractHnsw<f32, SegmentOffset> *> src_hnsw_ptrs;
+    for (const auto &src_hnsw : src_hnsws) {
+        src_hnsw_ptrs.push_back(&src_hnsw);
+    }
+
+    BufferHandle buffer_handle = chunk_index_entry->GetIndex();
+    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+    auto label_map = [&](SizeT src_idx, SegmentOffset label) { return merge_source.new_offset_(src_segment_ids[src_idx], label); };
+    SegmentOffset row_count = segment_entry->row_count();
+    if (!abstract_hnsw.Merge(src_hnsw_ptrs, label_map, row_count)) {
+        LOG_INFO(fmt::format("Hnsw indexes of the compacted segments don't cover segment {}, build the index from the column",
+                             segment_entry->segment_id()));
+        return false;
+    }
+    chunk_index_entry->SetRowCount(row_count);
+    LOG_TRACE(fmt::format("Merge {} hnsw indexes into segment {}", src_hnsws.size(), segment_entry->segment_id()));
+    return true;
+}
+
+Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
+                                             Txn *txn,
+                                             bool prepare,
+                                             bool check_ts,
+                                             const IndexMergeSource *merge_source) {
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto *buffer_mgr = txn->buffer_mgr();
     const IndexBase *index_base = table_index_entry_->index_base();
     const ColumnDef *column_def = table_index_entry_->column_def().get();
 
-    PopulateEntireConfig populate_entire_config{.prepare_ = prepare, .check_ts_ = check_ts};
+    PopulateEntireConfig populate_entire_config{.prepare_ = prepare, .check_ts_ = check_ts, .merge_source_ = merge_source};
     switch (index_base->index_type_) {
         case IndexType::kIVFFlat: {
             if (column_def->type()->type() != LogicalType::kEmbedding) {
@@ -559,18 +660,36 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
             u32 dimension = embedding_info->Dimension();
             u32 full_row_count = segment_entry->row_count();
             BufferHandle buffer_handle = GetIndex();
-            switch (embedding_info->Type()) {
-                case kElemFloat: {
-                    auto annivfflat_index = reinterpret_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut());
-                    // TODO: How to select training data?
-                    if (check_ts) {
-                        OneColumnIterator<float> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
-                        annivfflat_index->BuildIndex(iter, dimension, full_row_count);
+            auto annivfflat_index = reinterpret_cast<AnnIVFFlatIndexData<f32> *>(buffer_handle.GetDataMut());
+            auto BuildIVFIndex = [&]<typename ColumnDataType>() {
+                auto BuildIVFIndexInner = [&](auto &&column_iter) {
+                    if constexpr (std::is_same_v<ColumnDataType, f32>) {
+                        annivfflat_index->BuildIndex(column_iter, dimension, full_row_count);
                     } else {
-                        // Not check ts in uncommitted segment when compact segment
-                        OneColumnIterator<float, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        using ColumnIter = std::decay_t<decltype(column_iter)>;
+                        ConvertedColumnIterator<f32, ColumnIter> iter(std::move(column_iter), dimension);
                         annivfflat_index->BuildIndex(iter, dimension, full_row_count);
                     }
+                };
+                // TODO: How to select training data?
+                if (check_ts) {
+                    BuildIVFIndexInner(OneColumnIterator<ColumnDataType>(segment_entry, buffer_mgr, column_def->id(), begin_ts));
+                } else {
+                    // Not check ts in uncommitted segment when compact segment
+                    BuildIVFIndexInner(OneColumnIterator<ColumnDataType, false>(segment_entry, buffer_mgr, column_def->id(), begin_ts));
+                }
+            };
+            switch (embedding_info->Type()) {
+                case kElemFloat: {
+                    BuildIVFIndex.template operator()<f32>();
+                    break;
+                }
+                case kElemFloat16: {
+                    BuildIVFIndex.template operator()<Float16T>();
+                    break;
+                }
+                case kElemBFloat16: {
+                    BuildIVFIndex.template operator()<BFloat16T>();
                     break;
                 }
                 default: {
@@ -608,6 +727,9 @@ Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
     const ColumnDef *column_def = table_index_entry_->column_def().get();
     switch (index_base->index_type_) {
         case IndexType::kHnsw: {
+            if (hnsw_merged_) {
+                break;
+            }
             auto *index_hnsw = static_cast<const IndexHnsw *>(index_base);
             if (column_def->type()->type() != LogicalType::kEmbedding) {
                 String error_message = "HNSW supports embedding type.";
@@ -626,6 +748,8 @@ Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
                 BufferHandle buffer_handle = chunk_index_entry->GetIndex();
 
                 switch (embedding_info->Type()) {
+                    case kElemFloat16:
+                    case kElemBFloat16:
                     case kElemFloat: {
                         AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
                         while (true) {
@@ -809,18 +933,35 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
             SharedPtr<ChunkIndexEntry> merged_chunk_index_entry = CreateChunkIndexEntry(column_def, base_rowid, buffer_mgr);
             BufferHandle buffer_handle = merged_chunk_index_entry->GetIndex();
 
+            auto RebuildHnsw = [&](auto &&iter) {
+                AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                HnswInsertConfig insert_config;
+                insert_config.optimize_ = true;
+                auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                if (end_i - start_i != row_count) {
+                    String error_message = "Rebuild HNSW index failed.";
+                    LOG_CRITICAL(error_message);
+                    UnrecoverableError(error_message);
+                }
+            };
             switch (embedding_info->Type()) {
                 case kElemFloat: {
-                    AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
                     OneColumnIterator<float, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
-                    HnswInsertConfig insert_config;
-                    insert_config.optimize_ = true;
-                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
-                    if (end_i - start_i != row_count) {
-                        String error_message = "Rebuild HNSW index failed.";
-                        LOG_CRITICAL(error_message);
-                        UnrecoverableError(error_message);
-                    }
+                    RebuildHnsw(iter);
+                    break;
+                }
+                case kElemFloat16: {
+                    ConvertedColumnIterator<f32, OneColumnIterator<Float16T>> iter(
+                        OneColumnIterator<Float16T>(segment_entry, buffer_mgr, column_def->id(), begin_ts),
+                        embedding_info->Dimension());
+                    RebuildHnsw(iter);
+                    break;
+                }
+                case kElemBFloat16: {
+                    ConvertedColumnIterator<f32, OneColumnIterator<BFloat16T>> iter(
+                        OneColumnIterator<BFloat16T>(segment_entry, buffer_mgr, column_def->id(), begin_ts),
+                        embedding_info->Dimension());
+                    RebuildHnsw(iter);
                     break;
                 }
                 default: {
@@ -15,6 +15,7 @@
 module;
 
 #include <cassert>
+#include <functional>
 
 export module segment_index_entry;
 
@@ -46,9 +47,17 @@ struct SegmentEntry;
 struct TableEntry;
 class SecondaryIndexInMem;
 
+// The segments compacted into the segment being indexed, so that their indexes can be merged instead of rebuilt.
+// `new_offset_` maps a row of an old segment to its offset in the new segment, or None if the row is not moved.
+export struct IndexMergeSource {
+    Vector<SegmentEntry *> old_segments_{};
+    std::function<Optional<SegmentOffset>(SegmentID, SegmentOffset)> new_offset_{};
+};
+
 export struct PopulateEntireConfig {
     bool prepare_;
     bool check_ts_;
+    const IndexMergeSource *merge_source_{};
 };
 
 export class SegmentIndexEntry : public BaseEntry, public EntryInterface {
@@ -127,7 +136,11 @@ public:
 
     u32 MemIndexRowCount();
 
-    Status CreateIndexPrepare(const SegmentEntry *segment_entry, Txn *txn, bool prepare, bool check_ts);
+    Status CreateIndexPrepare(const SegmentEntry *segment_entry,
+                              Txn *txn,
+                              bool prepare,
+                              bool check_ts,
+                              const IndexMergeSource *merge_source = nullptr);
 
     Status CreateIndexDo(atomic_u64 &create_index_idx);
 
@@ -225,6 +238,10 @@ private:
 
     ChunkID GetNextChunkID() { return next_chunk_id_++; }
 
+    // Merges the hnsw indexes of the old segments of `merge_source` into `chunk_index_entry`.
+    // Returns false if they don't cover exactly the rows of `segment_entry`, then the index is built from the column.
+    bool MergeHnsw(ChunkIndexEntry *chunk_index_entry, const SegmentEntry *segment_entry, const IndexMergeSource &merge_source, Txn *txn);
+
 private:
     BufferManager *buffer_manager_{};
     TableIndexEntry *table_index_entry_;
@@ -245,6 +262,8 @@ private:
     SharedPtr<MemoryIndexer> memory_indexer_{};
     SharedPtr<SecondaryIndexInMem> memory_secondary_index_{};
 
+    bool hnsw_merged_{}; // the hnsw index is merged in the prepare stage, CreateIndexDo has nothing to build
+
     u64 ft_column_len_sum_{}; // increase only
     u32 ft_column_len_cnt_{}; // increase only
 };
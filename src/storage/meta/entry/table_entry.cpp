@@ -273,7 +273,10 @@ void TableEntry::AddSegmentReplayWal(SharedPtr<SegmentEntry> new_segment) {
     if (compaction_alg_.get() != nullptr) {
         compaction_alg_->AddSegment(new_segment.get());
     }
-    next_segment_id_++;
+    // segment ids reserved by an import may be left unused, the replayed ids aren't always consecutive
+    if (segment_id >= next_segment_id_) {
+        next_segment_id_ = segment_id + 1;
+    }
 }
 
 void TableEntry::AddSegmentReplay(SharedPtr<SegmentEntry> new_segment) {
@@ -616,6 +619,14 @@ Status TableEntry::CommitWrite(TransactionID txn_id,
     return Status::OK();
 }
 
+void TableEntry::IncreaseDataVersion(TxnTimeStamp commit_ts) {
+    TxnTimeStamp data_commit_ts = data_commit_ts_.load();
+    while (data_commit_ts < commit_ts && !data_commit_ts_.compare_exchange_weak(data_commit_ts, commit_ts)) {
+    }
+    // Increased after the commit ts so that a reader seeing the new version also sees the new commit ts
+    ++data_version_;
+}
+
 Status TableEntry::RollbackWrite(TxnTimeStamp commit_ts, const Vector<TxnSegmentStore> &segment_stores) {
     for (auto &segment_store : segment_stores) {
         auto *segment_entry = segment_store.segment_entry_;
@@ -722,6 +733,10 @@ void TableEntry::MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *tx
 }
 
 void TableEntry::MemIndexDump(Txn *txn, bool spill) {
+    if (!MemIndexReady()) {
+        // A dump would split the recovered rows of a memory index
+        return;
+    }
     TxnTableStore *txn_table_store = txn->GetTxnTableStore(this);
     auto index_meta_map_guard = index_meta_map_.GetMetaMap();
     for (auto &[_, table_index_meta] : *index_meta_map_guard) {
@@ -748,7 +763,44 @@ void TableEntry::MemIndexCommit() {
     }
 }
 
+bool TableEntry::SetMemIndexRecovering() {
+    auto index_meta_map_guard = index_meta_map_.GetMetaMap();
+    if ((*index_meta_map_guard).empty()) {
+        return false;
+    }
+    mem_index_ready_ = false;
+    return true;
+}
+
 void TableEntry::MemIndexRecover(BufferManager *buffer_manager) {
+    bool failed = false;
+    try {
+        MemIndexRecoverInner(buffer_manager);
+    } catch (const std::exception &e) {
+        LOG_CRITICAL(fmt::format("Table {}.{} MemIndex recovery failed: {}", *GetDBName(), *table_name_, e.what()));
+        failed = true;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mem_index_recover_mutex_);
+        mem_index_recover_failed_ = failed;
+        mem_index_ready_ = !failed;
+    }
+    mem_index_recover_cv_.notify_all();
+}
+
+Status TableEntry::WaitMemIndexReady() {
+    if (mem_index_ready_.load()) {
+        return Status::OK();
+    }
+    std::unique_lock<std::mutex> lock(mem_index_recover_mutex_);
+    mem_index_recover_cv_.wait(lock, [this] { return mem_index_ready_.load() || mem_index_recover_failed_; });
+    if (mem_index_recover_failed_) {
+        return Status::UnexpectedError(fmt::format("Table {}.{} MemIndex recovery failed", *GetDBName(), *table_name_));
+    }
+    return Status::OK();
+}
+
+void TableEntry::MemIndexRecoverInner(BufferManager *buffer_manager) {
     auto index_meta_map_guard = index_meta_map_.GetMetaMap();
     for (auto &[index_name, table_index_meta] : *index_meta_map_guard) {
         auto [table_index_entry, status] = table_index_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
@@ -824,6 +876,11 @@ void TableEntry::MemIndexRecover(BufferManager *buffer_manager) {
 }
 
 void TableEntry::OptimizeIndex(Txn *txn) {
+    if (!MemIndexReady()) {
+        // The memory indexes are still recovered, the next optimize does it
+        LOG_INFO(fmt::format("Table {}.{} MemIndex is recovering, skip optimizing its indexes.", *GetDBName(), *table_name_));
+        return;
+    }
     TxnTableStore *txn_table_store = txn->GetTxnTableStore(this);
     auto index_meta_map_guard = index_meta_map_.GetMetaMap();
     for (auto &[_, table_index_meta] : *index_meta_map_guard) {
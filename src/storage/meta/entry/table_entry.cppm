@@ -169,8 +169,17 @@ public:
 
     Status RollbackWrite(TxnTimeStamp commit_ts, const Vector<TxnSegmentStore> &segment_stores);
 
+    // Called when a write txn starts committing to the table (commit_ts = 0) and when it finishes.
+    void IncreaseDataVersion(TxnTimeStamp commit_ts = 0);
+
+    // Data version and the latest commit ts of the table, the table data is unchanged as long as the version is
+    Pair<u64, TxnTimeStamp> GetDataVersion() const { return {data_version_.load(), data_commit_ts_.load()}; }
+
     SegmentID GetNextSegmentID() { return next_segment_id_++; }
 
+    // Reserves count consecutive segment ids, returns the first one
+    SegmentID ReserveSegmentIDs(SizeT count) { return next_segment_id_.fetch_add(count); }
+
     SegmentID next_segment_id() const { return next_segment_id_; }
 
     static SharedPtr<String> DetermineTableDir(const String &parent_dir, const String &table_name) {
@@ -186,9 +195,18 @@ public:
     // User shall invoke this reguarly to populate recently inserted rows into the fulltext index. Noop for other types of index.
     void MemIndexCommit();
 
-    // Invoked once at init stage to recovery memory index.
+    // Invoked once at init stage to recovery memory index. It runs in the background, see Catalog::MemIndexRecover.
     void MemIndexRecover(BufferManager *buffer_manager);
 
+    // Marks the memory indexes as being recovered before the recovery is scheduled, returns false if the table has no index
+    bool SetMemIndexRecovering();
+
+    // Whether the memory indexes hold all the rows of the table. Until then, the index scans of the table fall back to scanning the blocks.
+    bool MemIndexReady() const { return mem_index_ready_.load(); }
+
+    // The writes of the table wait for the recovery, so their rows are inserted into the memory indexes after the recovered ones
+    Status WaitMemIndexReady();
+
     void OptimizeIndex(Txn *txn);
 
 public:
@@ -275,6 +293,16 @@ private:
     // for full text search cache
     TableIndexReaderCache fulltext_column_index_cache_;
 
+    // for query result cache
+    Atomic<u64> data_version_{};
+    Atomic<TxnTimeStamp> data_commit_ts_{};
+
+    // for the memory index recovery, see SetMemIndexRecovering
+    Atomic<bool> mem_index_ready_{true};
+    bool mem_index_recover_failed_{};
+    std::mutex mem_index_recover_mutex_{};
+    std::condition_variable mem_index_recover_cv_{};
+
 public:
     // set nullptr to close auto compaction
     void SetCompactionAlg(UniquePtr<CompactionAlg> compaction_alg) { compaction_alg_ = std::move(compaction_alg); }
@@ -294,6 +322,8 @@ private:
 private: // TODO: remove it
     void MemIndexInsertInner(TableIndexEntry *table_index_entry, Txn *txn, SegmentID seg_id, Vector<AppendRange> &append_ranges);
 
+    void MemIndexRecoverInner(BufferManager *buffer_manager);
+
 public: // TODO: remove it?
     HashMap<String, UniquePtr<TableIndexMeta>> &index_meta_map() { return index_meta_map_.meta_map_; }
 
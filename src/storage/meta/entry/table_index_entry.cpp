@@ -290,8 +290,12 @@ SharedPtr<SegmentIndexEntry> TableIndexEntry::PopulateEntirely(SegmentEntry *seg
     return segment_index_entry;
 }
 
-Tuple<Vector<SegmentIndexEntry *>, Status>
-TableIndexEntry::CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prepare, bool is_replay, bool check_ts) {
+Tuple<Vector<SegmentIndexEntry *>, Status> TableIndexEntry::CreateIndexPrepare(BaseTableRef *table_ref,
+                                                                               Txn *txn,
+                                                                               bool prepare,
+                                                                               bool is_replay,
+                                                                               bool check_ts,
+                                                                               const HashMap<SegmentID, IndexMergeSource> *merge_sources) {
     TableEntry *table_entry = table_ref->table_entry_ptr_;
     auto &block_index = table_ref->block_index_;
     if (table_ref->index_index_.get() == nullptr) {
@@ -306,7 +310,13 @@ TableIndexEntry::CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prep
         auto *segment_entry = segment_info.segment_entry_;
         SharedPtr<SegmentIndexEntry> segment_index_entry = SegmentIndexEntry::NewIndexEntry(this, segment_id, txn, create_index_param.get());
         if (!is_replay) {
-            segment_index_entry->CreateIndexPrepare(segment_entry, txn, prepare, check_ts);
+            const IndexMergeSource *merge_source = nullptr;
+            if (merge_sources != nullptr) {
+                if (auto iter = merge_sources->find(segment_id); iter != merge_sources->end()) {
+                    merge_source = &iter->second;
+                }
+            }
+            segment_index_entry->CreateIndexPrepare(segment_entry, txn, prepare, check_ts, merge_source);
         }
         std::unique_lock w_lock(rw_locker_);
         index_by_segment_.emplace(segment_id, segment_index_entry);
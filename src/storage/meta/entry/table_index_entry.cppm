@@ -120,8 +120,12 @@ public:
     // Populate index entirely for the segment
     SharedPtr<SegmentIndexEntry> PopulateEntirely(SegmentEntry *segment_entry, Txn *txn, const PopulateEntireConfig &config);
 
-    Tuple<Vector<SegmentIndexEntry *>, Status>
-    CreateIndexPrepare(BaseTableRef *table_ref, Txn *txn, bool prepare, bool is_replay, bool check_ts = true);
+    Tuple<Vector<SegmentIndexEntry *>, Status> CreateIndexPrepare(BaseTableRef *table_ref,
+                                                                  Txn *txn,
+                                                                  bool prepare,
+                                                                  bool is_replay,
+                                                                  bool check_ts = true,
+                                                                  const HashMap<SegmentID, IndexMergeSource> *merge_sources = nullptr);
 
     Status CreateIndexDo(BaseTableRef *table_ref, HashMap<SegmentID, atomic_u64> &create_index_idxes, Txn *txn);
 
@@ -114,4 +114,27 @@ private:
     SegmentIter<CheckTS> segment_iter_;
 };
 
-} // namespace infinity
\ No newline at end of file
+// Widens the elements of a column iterator to DataType, so a half precision column can feed an index built on f32.
+// The returned pointer is valid until the next call of Next().
+export template <typename DataType, typename Iterator>
+class ConvertedColumnIterator {
+public:
+    ConvertedColumnIterator(Iterator &&iter, SizeT dimension) : iter_(std::move(iter)), buffer_(dimension) {}
+
+    Optional<Pair<const DataType *, SegmentOffset>> Next() {
+        if (auto ret = iter_.Next(); ret) {
+            auto [vec, offset] = *ret;
+            for (SizeT i = 0; i < buffer_.size(); ++i) {
+                buffer_[i] = static_cast<DataType>(vec[i]);
+            }
+            return std::make_pair(static_cast<const DataType *>(buffer_.data()), offset);
+        }
+        return None;
+    }
+
+private:
+    Iterator iter_;
+    Vector<DataType> buffer_;
+};
+
+} // namespace infinity
@@ -102,6 +102,7 @@ TableMeta::GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, Txn *txn)
     table_info->table_entry_dir_ = table_entry->TableEntryDir();
     table_info->column_count_ = table_entry->ColumnCount();
     table_info->row_count_ = table_entry->row_count();
+    table_info->index_ready_ = table_entry->MemIndexReady();
 
     SharedPtr<BlockIndex> segment_index = table_entry->GetBlockIndex(txn);
     table_info->segment_count_ = segment_index->SegmentCount();
@@ -0,0 +1,194 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <bit>
+
+module result_cache;
+
+import stl;
+import data_table;
+import data_block;
+import column_vector;
+import vector_buffer;
+import fix_heap;
+import logical_node_type;
+import third_party;
+
+namespace infinity {
+
+FrequencySketch::FrequencySketch(SizeT width) {
+    width = std::bit_ceil(width);
+    width_mask_ = width - 1;
+    sample_size_ = 10 * width;
+    counters_.resize(kDepth * width);
+}
+
+SizeT FrequencySketch::Index(u64 hash, SizeT row) const {
+    // splitmix64 finalizer seeded with the row, so each row maps the key independently
+    u64 h = hash + (row + 1) * 0x9E3779B97F4A7C15ULL;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return row * (width_mask_ + 1) + (h & width_mask_);
+}
+
+void FrequencySketch::Increment(u64 hash) {
+    for (SizeT row = 0; row < kDepth; ++row) {
+        u8 &counter = counters_[Index(hash, row)];
+        if (counter < kMaxCount) {
+            ++counter;
+        }
+    }
+    if (++access_count_ >= sample_size_) {
+        Reset();
+    }
+}
+
+u32 FrequencySketch::Frequency(u64 hash) const {
+    u32 frequency = kMaxCount;
+    for (SizeT row = 0; row < kDepth; ++row) {
+        frequency = std::min<u32>(frequency, counters_[Index(hash, row)]);
+    }
+    return frequency;
+}
+
+void FrequencySketch::Reset() {
+    for (u8 &counter : counters_) {
+        counter >>= 1;
+    }
+    access_count_ /= 2;
+}
+
+ResultCache::ResultCache(SizeT memory_limit) : memory_limit_(memory_limit), sketch_(1024 * 16) {}
+
+String ResultCache::MakeKey(const String &db_name, const String &table_name, const String &query_text) {
+    return fmt::format("{}.{}:{}", db_name, table_name, query_text);
+}
+
+bool ResultCache::Get(const String &key,
+                      TxnTimeStamp table_create_ts,
+                      u64 data_version,
+                      SharedPtr<DataTable> &result_table,
+                      LogicalNodeType &root_operator_type) {
+    ++lookup_count_;
+    u64 hash = Hash<String>{}(key);
+    std::scoped_lock lock(mutex_);
+    sketch_.Increment(hash);
+    auto map_iter = entry_map_.find(key);
+    if (map_iter == entry_map_.end()) {
+        return false;
+    }
+    auto iter = map_iter->second;
+    if (iter->table_create_ts_ != table_create_ts || iter->data_version_ != data_version) {
+        // The table was written or recreated since the result was computed
+        Erase(iter);
+        return false;
+    }
+    lru_list_.splice(lru_list_.begin(), lru_list_, iter);
+    result_table = iter->result_table_;
+    root_operator_type = iter->root_operator_type_;
+    ++hit_count_;
+    return true;
+}
+
+void ResultCache::Put(const String &key,
+                      TxnTimeStamp table_create_ts,
+                      u64 data_version,
+                      SharedPtr<DataTable> result_table,
+                      LogicalNodeType root_operator_type) {
+    SizeT memory = EstimateMemory(result_table.get()) + key.size() + sizeof(Entry);
+    if (memory > memory_limit_) {
+        return;
+    }
+    u64 hash = Hash<String>{}(key);
+    std::scoped_lock lock(mutex_);
+    if (auto map_iter = entry_map_.find(key); map_iter != entry_map_.end()) {
+        Erase(map_iter->second);
+    }
+
+    // Admit the new entry only if it's requested more often than every entry it evicts
+    u32 frequency = sketch_.Frequency(hash);
+    SizeT evict_memory = 0;
+    auto victim = lru_list_.end();
+    while (memory_usage_ - evict_memory + memory > memory_limit_ && victim != lru_list_.begin()) {
+        --victim;
+        if (sketch_.Frequency(Hash<String>{}(victim->key_)) >= frequency) {
+            return;
+        }
+        evict_memory += victim->memory_;
+    }
+    while (victim != lru_list_.end()) {
+        Erase(victim++);
+    }
+
+    lru_list_.push_front(Entry{key, table_create_ts, data_version, std::move(result_table), root_operator_type, memory});
+    entry_map_.emplace(key, lru_list_.begin());
+    memory_usage_ += memory;
+}
+
+SizeT ResultCache::memory_usage() {
+    std::scoped_lock lock(mutex_);
+    return memory_usage_;
+}
+
+SizeT ResultCache::entry_count() {
+    std::scoped_lock lock(mutex_);
+    return lru_list_.size();
+}
+
+void ResultCache::Erase(List<Entry>::iterator iter) {
+    memory_usage_ -= iter->memory_;
+    entry_map_.erase(iter->key_);
+    lru_list_.erase(iter);
+}
+
+void ResultCache::InvalidateTable(const String &db_name, const String &table_name) { ErasePrefix(fmt::format("{}.{}:", db_name, table_name)); }
+
+void ResultCache::InvalidateDatabase(const String &db_name) { ErasePrefix(fmt::format("{}.", db_name)); }
+
+void ResultCache::ErasePrefix(const String &key_prefix) {
+    std::scoped_lock lock(mutex_);
+    for (auto iter = lru_list_.begin(); iter != lru_list_.end();) {
+        if (iter->key_.starts_with(key_prefix)) {
+            Erase(iter++);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+SizeT ResultCache::EstimateMemory(DataTable *result_table) {
+    SizeT memory = 0;
+    for (SizeT block_idx = 0; block_idx < result_table->DataBlockCount(); ++block_idx) {
+        const SharedPtr<DataBlock> &data_block = result_table->GetDataBlockById(block_idx);
+        for (const auto &column_vector : data_block->column_vectors) {
+            memory += column_vector->data_type_size_ * column_vector->capacity();
+            const VectorBuffer *buffer = column_vector->buffer_.get();
+            if (buffer == nullptr) {
+                continue;
+            }
+            if (buffer->fix_heap_mgr_.get() != nullptr) {
+                memory += buffer->fix_heap_mgr_->total_mem();
+            }
+            if (buffer->fix_heap_mgr_1_.get() != nullptr) {
+                memory += buffer->fix_heap_mgr_1_->total_mem();
+            }
+        }
+    }
+    return memory;
+}
+
+} // namespace infinity
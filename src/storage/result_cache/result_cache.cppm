@@ -0,0 +1,110 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module result_cache;
+
+import stl;
+import data_table;
+import logical_node_type;
+
+namespace infinity {
+
+// Count-min sketch with 4 bit counters, the frequency estimator of TinyLFU.
+// All counters are halved once the number of recorded accesses reaches sample_size_, so old popularity fades out.
+export class FrequencySketch {
+public:
+    explicit FrequencySketch(SizeT width);
+
+    void Increment(u64 hash);
+
+    [[nodiscard]] u32 Frequency(u64 hash) const;
+
+private:
+    [[nodiscard]] SizeT Index(u64 hash, SizeT row) const;
+
+    void Reset();
+
+    static constexpr SizeT kDepth = 4;
+    static constexpr u8 kMaxCount = 15;
+
+    SizeT width_mask_{};
+    SizeT sample_size_{};
+    SizeT access_count_{};
+    Vector<u8> counters_{};
+};
+
+// Caches the result tables of single table searches.
+// An entry is valid for the table and the data version it was computed against; a lookup with another version drops it.
+// The table is identified by its create timestamp, a table dropped and created again with the same name has a new one.
+// Entries are evicted in LRU order when the memory limit is reached. A new entry is only admitted if it's more frequently
+// requested than the entries it would evict (TinyLFU), so one-off queries can't flush the popular ones.
+export class ResultCache {
+public:
+    explicit ResultCache(SizeT memory_limit);
+
+    [[nodiscard]] inline bool Enabled() const { return memory_limit_ > 0; }
+
+    // The key of a query on a table, the keys of a table share a prefix so that they are invalidated together
+    static String MakeKey(const String &db_name, const String &table_name, const String &query_text);
+
+    bool Get(const String &key, TxnTimeStamp table_create_ts, u64 data_version, SharedPtr<DataTable> &result_table, LogicalNodeType &root_operator_type);
+
+    void Put(const String &key, TxnTimeStamp table_create_ts, u64 data_version, SharedPtr<DataTable> result_table, LogicalNodeType root_operator_type);
+
+    void InvalidateTable(const String &db_name, const String &table_name);
+
+    void InvalidateDatabase(const String &db_name);
+
+    [[nodiscard]] inline SizeT memory_limit() const { return memory_limit_; }
+
+    [[nodiscard]] SizeT memory_usage();
+
+    [[nodiscard]] SizeT entry_count();
+
+    [[nodiscard]] inline u64 hit_count() const { return hit_count_; }
+
+    [[nodiscard]] inline u64 lookup_count() const { return lookup_count_; }
+
+    static SizeT EstimateMemory(DataTable *result_table);
+
+private:
+    struct Entry {
+        String key_{};
+        TxnTimeStamp table_create_ts_{};
+        u64 data_version_{};
+        SharedPtr<DataTable> result_table_{};
+        LogicalNodeType root_operator_type_{LogicalNodeType::kInvalid};
+        SizeT memory_{};
+    };
+
+    void Erase(List<Entry>::iterator iter);
+
+    void ErasePrefix(const String &key_prefix);
+
+    const SizeT memory_limit_{};
+
+    std::mutex mutex_{};
+    SizeT memory_usage_{};
+    // front is the most recently used
+    List<Entry> lru_list_{};
+    HashMap<String, List<Entry>::iterator> entry_map_{};
+    FrequencySketch sketch_;
+
+    Atomic<u64> hit_count_{};
+    Atomic<u64> lookup_count_{};
+};
+
+} // namespace infinity
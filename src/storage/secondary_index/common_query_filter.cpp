@@ -120,6 +120,10 @@ void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
 
 CommonQueryFilter::CommonQueryFilter(SharedPtr<BaseExpression> original_filter, SharedPtr<BaseTableRef> base_table_ref, TxnTimeStamp begin_ts)
     : begin_ts_(begin_ts), original_filter_(std::move(original_filter)), base_table_ref_(std::move(base_table_ref)) {
+    InitTasks();
+}
+
+void CommonQueryFilter::InitTasks() {
     const auto &segment_index = base_table_ref_->block_index_->segment_block_index_;
     if (segment_index.empty()) {
         finish_build_.test_and_set(std::memory_order_release);
@@ -132,6 +136,24 @@ CommonQueryFilter::CommonQueryFilter(SharedPtr<BaseExpression> original_filter,
     }
 }
 
+void CommonQueryFilter::ResetForPreparedPlan(TxnTimeStamp begin_ts) {
+    begin_ts_ = begin_ts;
+    if (finish_build_fast_rough_filter_) {
+        fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(fast_rough_filter_source_);
+    }
+    if (secondary_index_filter_qualified_) {
+        filter_execute_command_ = BuildSecondaryIndexScanCommand(secondary_index_filter_qualified_);
+    }
+    finish_build_.clear(std::memory_order_relaxed);
+    filter_result_.clear();
+    filter_result_count_ = 0;
+    tasks_.clear();
+    total_task_num_ = 0;
+    begin_task_num_ = 0;
+    end_task_num_ = 0;
+    InitTasks();
+}
+
 void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
     auto *buffer_mgr = txn->buffer_mgr();
     TxnTimeStamp begin_ts = txn->BeginTS();
@@ -169,6 +191,14 @@ void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
         for (auto *block_entry = block_entry_iter.Next(); block_entry != nullptr and segment_row_count_real < segment_row_count;
              block_entry = block_entry_iter.Next()) {
             auto row_count = block_entry->row_count();
+            if (!fast_rough_filter_evaluator_->Evaluate(begin_ts, *block_entry->GetFastRoughFilter())) {
+                // no row of this block passes the filter, skip reading it
+                for (SizeT i = 0; i < row_count; ++i) {
+                    bitmask.SetFalse(segment_row_count_real + i);
+                }
+                segment_row_count_real += row_count;
+                continue;
+            }
             db_for_filter->Reset(row_count);
             ReadDataBlock(db_for_filter, buffer_mgr, row_count, block_entry, base_table_ref_->column_ids_);
             bool_column->Initialize(ColumnVectorType::kCompactBit, row_count);
@@ -219,12 +249,60 @@ void CommonQueryFilter::BuildFilter(u32 task_id, Txn *txn) {
     }
 }
 
-void CommonQueryFilter::TryApplyFastRoughFilterOptimizer() {
+bool CommonQueryFilter::BlockFilterResult(SegmentID segment_id, BlockID block_id, SizeT row_count, Bitmask &bitmask) const {
+    auto it = filter_result_.find(segment_id);
+    if (it == filter_result_.end() || row_count == 0) {
+        return false;
+    }
+    const std::variant<Vector<u32>, Bitmask> &filter_result = it->second;
+    bitmask.Initialize(std::bit_ceil(row_count));
+    const u32 block_start_offset = block_id * DEFAULT_BLOCK_CAPACITY;
+    const u32 block_end_offset = block_start_offset + row_count;
+    if (std::holds_alternative<Vector<u32>>(filter_result)) {
+        const Vector<u32> &filter_result_vector = std::get<Vector<u32>>(filter_result);
+        const auto it1 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_start_offset);
+        const auto it2 = std::lower_bound(filter_result_vector.begin(), filter_result_vector.end(), block_end_offset);
+        if (it1 == it2) {
+            return false;
+        }
+        bitmask.SetAllFalse();
+        for (auto iter = it1; iter < it2; ++iter) {
+            bitmask.SetTrue(*iter - block_start_offset);
+        }
+        return true;
+    }
+    const u64 *filter_data = std::get<Bitmask>(filter_result).GetData();
+    if (filter_data == nullptr) {
+        // all rows of the segment pass the filter
+        return true;
+    }
+    bitmask.SetAllFalse();
+    u64 *data = bitmask.GetData();
+    const u32 u64_start_offset = block_start_offset / BitmaskBuffer::UNIT_BITS;
+    const u32 u64_end_offset = (block_end_offset - 1) / BitmaskBuffer::UNIT_BITS;
+    const u32 tail_bits = block_end_offset % BitmaskBuffer::UNIT_BITS;
+    u64 any_row = 0;
+    for (u32 i = u64_start_offset; i <= u64_end_offset; ++i) {
+        u64 unit = filter_data[i];
+        data[i - u64_start_offset] = unit;
+        if (i == u64_end_offset && tail_bits != 0) {
+            // the bits after the last row of the block aren't rows of it
+            unit &= (u64(1) << tail_bits) - 1;
+        }
+        any_row |= unit;
+    }
+    return any_row != 0;
+}
+
+void CommonQueryFilter::TryApplyFastRoughFilterOptimizer(bool keep_source) {
     if (finish_build_fast_rough_filter_) {
         return;
     }
     finish_build_fast_rough_filter_ = true;
     fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(original_filter_);
+    if (keep_source) {
+        fast_rough_filter_source_ = FilterExpressionPushDown::CopyFilterExpression(original_filter_);
+    }
 }
 
 void CommonQueryFilter::TryApplySecondaryIndexFilterOptimizer(QueryContext *query_context) {
@@ -35,6 +35,8 @@ export struct CommonQueryFilter {
     // 1. minmax and bloom filter
     bool finish_build_fast_rough_filter_ = false;
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
+    // kept by a prepared plan only, see FilterExpressionPushDown::CopyFilterExpression
+    SharedPtr<BaseExpression> fast_rough_filter_source_;
     // 2. filter for datablocks
     SharedPtr<BaseExpression> filter_leftover_;
     // 3. secondary index filter
@@ -86,10 +88,20 @@ export struct CommonQueryFilter {
         return finish_build_.test(std::memory_order_acquire);
     }
 
-    void TryApplyFastRoughFilterOptimizer();
+    // Fills bitmask with the rows of the block which pass the filter.
+    // Returns false if the block can be skipped: its segment was pruned, or none of its rows passes the filter.
+    bool BlockFilterResult(SegmentID segment_id, BlockID block_id, SizeT row_count, Bitmask &bitmask) const;
+
+    void TryApplyFastRoughFilterOptimizer(bool keep_source = false);
     void TryApplySecondaryIndexFilterOptimizer(QueryContext *query_context);
 
+    // A prepared plan is executed again, by another txn and maybe with other parameters: the filters built from the values are
+    // built again and the filter result of the last txn is dropped. The block index of the table is already the one of this txn.
+    void ResetForPreparedPlan(TxnTimeStamp begin_ts);
+
 private:
+    void InitTasks();
+
     void BuildFilter(u32 task_id, Txn *txn);
 };
 
@@ -14,7 +14,9 @@
 
 module;
 
+#include <algorithm>
 #include <concepts>
+#include <numeric>
 #include <vector>
 
 module secondary_index_data;
@@ -34,9 +36,8 @@ import buffer_handle;
 
 namespace infinity {
 
-template <typename RawValueType>
+template <typename OrderedKeyType>
 struct SecondaryIndexChunkDataReader {
-    using OrderedKeyType = ConvertToOrderedType<RawValueType>;
     static constexpr u32 PairSize = sizeof(OrderedKeyType) + sizeof(SegmentOffset);
     ChunkIndexEntry *chunk_index_;
     BufferHandle current_handle_;
@@ -71,7 +72,7 @@ struct SecondaryIndexChunkDataReader {
 template <typename RawValueType>
 struct SecondaryIndexChunkMerger {
     using OrderedKeyType = ConvertToOrderedType<RawValueType>;
-    Vector<SecondaryIndexChunkDataReader<RawValueType>> readers_;
+    Vector<SecondaryIndexChunkDataReader<OrderedKeyType>> readers_;
     std::priority_queue<Tuple<OrderedKeyType, u32, u32>, Vector<Tuple<OrderedKeyType, u32, u32>>, std::greater<Tuple<OrderedKeyType, u32, u32>>> pq_;
     explicit SecondaryIndexChunkMerger(const Vector<ChunkIndexEntry *> &old_chunks) {
         readers_.reserve(old_chunks.size());
@@ -103,6 +104,115 @@ struct SecondaryIndexChunkMerger {
     }
 };
 
+// write the sorted pairs into the parts of the chunk, and build the pgm index on the keys
+template <typename OrderedKeyType>
+void OutputPairsAndBuildPGM(const OrderedKeyType *key,
+                            const SegmentOffset *offset,
+                            const u32 chunk_row_count,
+                            SharedPtr<ChunkIndexEntry> &chunk_index,
+                            SecondaryPGMIndex *pgm_index) {
+    constexpr u32 PairSize = sizeof(OrderedKeyType) + sizeof(SegmentOffset);
+    const u32 part_num = chunk_index->GetPartNum();
+    for (u32 part_id = 0; part_id < part_num; ++part_id) {
+        const u32 part_row_count = chunk_index->GetPartRowCount(part_id);
+        const u32 part_offset = part_id * 8192;
+        BufferHandle handle = chunk_index->GetIndexPartAt(part_id);
+        auto data_ptr = static_cast<char *>(handle.GetDataMut());
+        for (u32 j = 0; j < part_row_count; ++j) {
+            const u32 index = part_offset + j;
+            std::memcpy(data_ptr + j * PairSize, key + index, sizeof(OrderedKeyType));
+            std::memcpy(data_ptr + j * PairSize + sizeof(OrderedKeyType), offset + index, sizeof(SegmentOffset));
+        }
+    }
+    pgm_index->BuildIndex(chunk_row_count, key);
+}
+
+template <typename OrderedKeyType>
+void SecondaryIndexData::BuildValueBitmaps(const OrderedKeyType *key, const SegmentOffset *offset) {
+    Vector<u32> begin_positions;
+    for (u32 i = 0; i < chunk_row_count_; ++i) {
+        if (i == 0 or key[i] != key[i - 1]) {
+            if (begin_positions.size() == SECONDARY_INDEX_BITMAP_MAX_DISTINCT_KEYS) {
+                // high cardinality, the pairs are enough
+                return;
+            }
+            begin_positions.push_back(i);
+        }
+    }
+    begin_positions.push_back(chunk_row_count_);
+    const u32 value_count = begin_positions.size() - 1;
+    value_bitmaps_.clear();
+    value_bitmaps_.reserve(value_count);
+    for (u32 i = 0; i < value_count; ++i) {
+        Roaring &bitmap = value_bitmaps_.emplace_back();
+        bitmap.addMany(begin_positions[i + 1] - begin_positions[i], offset + begin_positions[i]);
+        bitmap.runOptimize();
+        bitmap.shrinkToFit();
+    }
+    value_begin_positions_ = std::move(begin_positions);
+}
+
+void SecondaryIndexData::UnionValueBitmaps(const u32 begin_pos, const u32 end_pos, Roaring &result) const {
+    if (begin_pos >= end_pos) {
+        return;
+    }
+    const auto begin_iter = std::lower_bound(value_begin_positions_.begin(), value_begin_positions_.end(), begin_pos);
+    const auto end_iter = std::lower_bound(begin_iter, value_begin_positions_.end(), end_pos);
+    if (end_iter == value_begin_positions_.end() or *begin_iter != begin_pos or *end_iter != end_pos) {
+        String error_message = fmt::format("UnionValueBitmaps(): range [{}, {}) is not aligned with the keys.", begin_pos, end_pos);
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    Vector<const Roaring *> bitmaps;
+    bitmaps.reserve(end_iter - begin_iter);
+    for (auto value_id = begin_iter - value_begin_positions_.begin(); value_id < end_iter - value_begin_positions_.begin(); ++value_id) {
+        bitmaps.push_back(&value_bitmaps_[value_id]);
+    }
+    result |= Roaring::fastunion(bitmaps.size(), bitmaps.data());
+}
+
+// u32 bitmap count, then if the count is not 0: the begin positions, the serialized size of each bitmap, and the serialized bitmaps
+void SecondaryIndexData::SaveValueBitmaps(FileHandler &file_handler) const {
+    const u32 bitmap_count = value_bitmaps_.size();
+    file_handler.Write(&bitmap_count, sizeof(bitmap_count));
+    if (bitmap_count == 0) {
+        return;
+    }
+    file_handler.Write(value_begin_positions_.data(), value_begin_positions_.size() * sizeof(u32));
+    Vector<u32> bitmap_sizes;
+    bitmap_sizes.reserve(bitmap_count);
+    for (const auto &bitmap : value_bitmaps_) {
+        bitmap_sizes.push_back(bitmap.getSizeInBytes());
+    }
+    String buffer(std::accumulate(bitmap_sizes.begin(), bitmap_sizes.end(), SizeT(0)), '\0');
+    for (SizeT buffer_offset = 0; const auto &bitmap : value_bitmaps_) {
+        buffer_offset += bitmap.write(buffer.data() + buffer_offset);
+    }
+    file_handler.Write(bitmap_sizes.data(), bitmap_sizes.size() * sizeof(u32));
+    file_handler.Write(buffer.data(), buffer.size());
+}
+
+void SecondaryIndexData::ReadValueBitmaps(FileHandler &file_handler) {
+    u32 bitmap_count = 0;
+    file_handler.Read(&bitmap_count, sizeof(bitmap_count));
+    value_begin_positions_.clear();
+    value_bitmaps_.clear();
+    if (bitmap_count == 0) {
+        return;
+    }
+    value_begin_positions_.resize(bitmap_count + 1);
+    file_handler.Read(value_begin_positions_.data(), value_begin_positions_.size() * sizeof(u32));
+    Vector<u32> bitmap_sizes(bitmap_count);
+    file_handler.Read(bitmap_sizes.data(), bitmap_sizes.size() * sizeof(u32));
+    String buffer(std::accumulate(bitmap_sizes.begin(), bitmap_sizes.end(), SizeT(0)), '\0');
+    file_handler.Read(buffer.data(), buffer.size());
+    value_bitmaps_.reserve(bitmap_count);
+    for (SizeT buffer_offset = 0; const u32 bitmap_size : bitmap_sizes) {
+        value_bitmaps_.push_back(Roaring::readSafe(buffer.data() + buffer_offset, bitmap_size));
+        buffer_offset += bitmap_size;
+    }
+}
+
 template <typename RawValueType>
 class SecondaryIndexDataT final : public SecondaryIndexData {
     using OrderedKeyType = ConvertToOrderedType<RawValueType>;
@@ -133,9 +243,13 @@ public:
             UnrecoverableError(error_message);
         }
         pgm_index_->SaveIndex(file_handler);
+        SaveValueBitmaps(file_handler);
     }
 
-    void ReadIndexInner(FileHandler &file_handler) override { pgm_index_->LoadIndex(file_handler); }
+    void ReadIndexInner(FileHandler &file_handler) override {
+        pgm_index_->LoadIndex(file_handler);
+        ReadValueBitmaps(file_handler);
+    }
 
     void InsertData(void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) override {
         if (!need_save_) {
@@ -192,22 +306,213 @@ public:
     }
 
     void OutputAndBuild(SharedPtr<ChunkIndexEntry> &chunk_index) {
-        const u32 part_num = chunk_index->GetPartNum();
-        for (u32 part_id = 0; part_id < part_num; ++part_id) {
-            const u32 part_row_count = chunk_index->GetPartRowCount(part_id);
-            const u32 part_offset = part_id * 8192;
-            BufferHandle handle = chunk_index->GetIndexPartAt(part_id);
-            auto data_ptr = static_cast<char *>(handle.GetDataMut());
-            for (u32 j = 0; j < part_row_count; ++j) {
-                const u32 index = part_offset + j;
-                std::memcpy(data_ptr + j * PairSize, key_.get() + index, sizeof(OrderedKeyType));
-                std::memcpy(data_ptr + j * PairSize + sizeof(OrderedKeyType), offset_.get() + index, sizeof(SegmentOffset));
+        OutputPairsAndBuildPGM(key_.get(), offset_.get(), chunk_row_count_, chunk_index, pgm_index_.get());
+        BuildValueBitmaps(key_.get(), offset_.get());
+    }
+};
+
+// sorted distinct strings of a chunk, the string of ordinal i is data_[offsets_[i], offsets_[i + 1])
+class SecondaryIndexTermDictionary {
+    Vector<u64> offsets_{0};
+    String data_;
+
+public:
+    [[nodiscard]] inline u32 TermCount() const { return offsets_.size() - 1; }
+
+    [[nodiscard]] inline std::string_view Term(const u32 ordinal) const {
+        return std::string_view(data_).substr(offsets_[ordinal], offsets_[ordinal + 1] - offsets_[ordinal]);
+    }
+
+    // must be called in ascending order of the terms
+    inline void AddTerm(const std::string_view term) {
+        data_.append(term);
+        offsets_.push_back(data_.size());
+    }
+
+    // the first ordinal whose term is not less than key
+    [[nodiscard]] u32 LowerBound(const std::string_view key) const {
+        u32 begin = 0;
+        u32 end = TermCount();
+        while (begin < end) {
+            const u32 middle = begin + (end - begin) / 2;
+            if (Term(middle) < key) {
+                begin = middle + 1;
+            } else {
+                end = middle;
             }
         }
-        pgm_index_->BuildIndex(chunk_row_count_, key_.get());
+        return begin;
+    }
+
+    void Save(FileHandler &file_handler) const {
+        const u32 term_count = TermCount();
+        file_handler.Write(&term_count, sizeof(term_count));
+        file_handler.Write(offsets_.data(), offsets_.size() * sizeof(u64));
+        file_handler.Write(data_.data(), data_.size());
+    }
+
+    void Load(FileHandler &file_handler) {
+        u32 term_count = 0;
+        file_handler.Read(&term_count, sizeof(term_count));
+        offsets_.resize(term_count + 1);
+        file_handler.Read(offsets_.data(), offsets_.size() * sizeof(u64));
+        data_.resize(offsets_.back());
+        file_handler.Read(data_.data(), data_.size());
     }
 };
 
+// VARCHAR index: the keys are the ordinals of the strings in the dictionary of the chunk, so the pairs keep the order of the strings,
+// and a range of strings is searched as the range of ordinals between its bounds in the dictionary.
+class SecondaryIndexDataVarchar final : public SecondaryIndexData {
+    using OrderedKeyType = ConvertToOrderedType<VarcharT>;
+    // only for build and save
+    bool need_save_ = false;
+    UniquePtr<OrderedKeyType[]> key_;
+    UniquePtr<SegmentOffset[]> offset_;
+    // will always be loaded
+    SecondaryIndexTermDictionary dictionary_;
+
+public:
+    static constexpr u32 PairSize = sizeof(OrderedKeyType) + sizeof(SegmentOffset);
+
+    SecondaryIndexDataVarchar(const u32 chunk_row_count, const bool allocate) : SecondaryIndexData(chunk_row_count) {
+        pgm_index_ = GenerateSecondaryPGMIndex<OrderedKeyType>();
+        if (allocate) {
+            need_save_ = true;
+            LOG_TRACE(fmt::format("SecondaryIndexDataVarchar(): Allocate space for chunk_row_count_: {}", chunk_row_count_));
+            key_ = MakeUnique<OrderedKeyType[]>(chunk_row_count_);
+            offset_ = MakeUnique<SegmentOffset[]>(chunk_row_count_);
+        }
+    }
+
+    [[nodiscard]] const SecondaryIndexTermDictionary &dictionary() const { return dictionary_; }
+
+    Pair<u32, u32> SearchDictionary(const std::string_view begin_key, const Optional<std::string_view> end_key) const override {
+        const u32 begin = dictionary_.LowerBound(begin_key);
+        const u32 end = end_key.has_value() ? dictionary_.LowerBound(*end_key) : dictionary_.TermCount();
+        return {begin, end};
+    }
+
+    void SaveIndexInner(FileHandler &file_handler) const override {
+        if (!need_save_) {
+            String error_message = "SaveIndexInner(): error: SecondaryIndexDataVarchar is not allocated.";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        pgm_index_->SaveIndex(file_handler);
+        dictionary_.Save(file_handler);
+        SaveValueBitmaps(file_handler);
+    }
+
+    void ReadIndexInner(FileHandler &file_handler) override {
+        pgm_index_->LoadIndex(file_handler);
+        dictionary_.Load(file_handler);
+        ReadValueBitmaps(file_handler);
+    }
+
+    void InsertData(void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) override {
+        if (!need_save_) {
+            String error_message = "InsertData(): error: SecondaryIndexDataVarchar is not allocated.";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        auto map_ptr = static_cast<MultiMap<String, u32> *>(ptr);
+        if (!map_ptr) {
+            String error_message = "InsertData(): error: map_ptr type error.";
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        if (map_ptr->size() != chunk_row_count_) {
+            String error_message = fmt::format("InsertData(): error: map size: {} != chunk_row_count_: {}", map_ptr->size(), chunk_row_count_);
+            LOG_CRITICAL(error_message);
+            UnrecoverableError(error_message);
+        }
+        u32 i = 0;
+        for (const auto &[key, offset] : *map_ptr) {
+            AppendPair(i++, key, offset);
+        }
+        OutputPairsAndBuildPGM(key_.get(), offset_.get(), chunk_row_count_, chunk_index, pgm_index_.get());
+        BuildValueBitmaps(key_.get(), offset_.get());
+    }
+
+    void InsertMergeData(Vector<ChunkIndexEntry *> &old_chunks, SharedPtr<ChunkIndexEntry> &merged_chunk_index_entry) override;
+
+private:
+    // pairs are appended in the order of (string, offset)
+    inline void AppendPair(const u32 i, const std::string_view term, const SegmentOffset offset) {
+        const u32 term_count = dictionary_.TermCount();
+        if (term_count == 0 or dictionary_.Term(term_count - 1) != term) {
+            dictionary_.AddTerm(term);
+        }
+        key_[i] = dictionary_.TermCount() - 1;
+        offset_[i] = offset;
+    }
+};
+
+// merge the pairs of the old chunks in the order of (string, offset)
+// the handles keep the dictionaries of the old chunks loaded
+struct SecondaryIndexChunkVarcharMerger {
+    using OrderedKeyType = ConvertToOrderedType<VarcharT>;
+    Vector<BufferHandle> index_handles_;
+    Vector<SecondaryIndexChunkDataReader<OrderedKeyType>> readers_;
+    std::priority_queue<Tuple<std::string_view, u32, u32>, Vector<Tuple<std::string_view, u32, u32>>, std::greater<Tuple<std::string_view, u32, u32>>>
+        pq_;
+    explicit SecondaryIndexChunkVarcharMerger(const Vector<ChunkIndexEntry *> &old_chunks) {
+        index_handles_.reserve(old_chunks.size());
+        readers_.reserve(old_chunks.size());
+        for (ChunkIndexEntry *chunk : old_chunks) {
+            index_handles_.emplace_back(chunk->GetIndex());
+            readers_.emplace_back(chunk);
+        }
+        for (u32 i = 0; i < readers_.size(); ++i) {
+            PushNext(i);
+        }
+    }
+    bool GetNextDataPair(std::string_view &out_term, u32 &out_offset) {
+        if (pq_.empty()) {
+            return false;
+        }
+        const auto [term, offset, reader_id] = pq_.top();
+        out_term = term;
+        out_offset = offset;
+        pq_.pop();
+        PushNext(reader_id);
+        return true;
+    }
+
+private:
+    void PushNext(const u32 reader_id) {
+        OrderedKeyType ordinal = {};
+        u32 offset = 0;
+        if (readers_[reader_id].GetNextDataPair(ordinal, offset)) {
+            const auto *index = static_cast<const SecondaryIndexDataVarchar *>(index_handles_[reader_id].GetData());
+            pq_.emplace(index->dictionary().Term(ordinal), offset, reader_id);
+        }
+    }
+};
+
+void SecondaryIndexDataVarchar::InsertMergeData(Vector<ChunkIndexEntry *> &old_chunks, SharedPtr<ChunkIndexEntry> &merged_chunk_index_entry) {
+    if (!need_save_) {
+        String error_message = "InsertMergeData(): error: SecondaryIndexDataVarchar is not allocated.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    SecondaryIndexChunkVarcharMerger merger(old_chunks);
+    std::string_view term;
+    u32 offset = 0;
+    u32 i = 0;
+    while (merger.GetNextDataPair(term, offset)) {
+        AppendPair(i++, term, offset);
+    }
+    if (i != chunk_row_count_) {
+        String error_message = fmt::format("InsertMergeData(): error: i: {} != chunk_row_count_: {}", i, chunk_row_count_);
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+    }
+    OutputPairsAndBuildPGM(key_.get(), offset_.get(), chunk_row_count_, merged_chunk_index_entry, pgm_index_.get());
+    BuildValueBitmaps(key_.get(), offset_.get());
+}
+
 SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type, const u32 chunk_row_count, const bool allocate) {
     if (!(data_type->CanBuildSecondaryIndex())) {
         String error_message = fmt::format("Cannot build secondary index on data type: {}", data_type->ToString());
@@ -246,6 +551,9 @@ SecondaryIndexData *GetSecondaryIndexData(const SharedPtr<DataType> &data_type,
         case LogicalType::kTimestamp: {
             return new SecondaryIndexDataT<TimestampT>(chunk_row_count, allocate);
         }
+        case LogicalType::kVarchar: {
+            return new SecondaryIndexDataVarchar(chunk_row_count, allocate);
+        }
         default: {
             String error_message = fmt::format("Need to add secondary index support for data type: {}", data_type->ToString());
             LOG_CRITICAL(error_message);
@@ -293,6 +601,9 @@ u32 GetSecondaryIndexDataPairSize(const SharedPtr<DataType> &data_type) {
         case LogicalType::kTimestamp: {
             return SecondaryIndexDataT<TimestampT>::PairSize;
         }
+        case LogicalType::kVarchar: {
+            return SecondaryIndexDataVarchar::PairSize;
+        }
         default: {
             String error_message = fmt::format("Need to add secondary index support for data type: {}", data_type->ToString());
             LOG_CRITICAL(error_message);
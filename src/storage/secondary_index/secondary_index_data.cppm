@@ -63,8 +63,14 @@ struct ConvertToOrdered<T> {
     using type = i64;
 };
 
+// VARCHAR keys are stored as the ordinals of the strings in the sorted dictionary of each chunk
+template <>
+struct ConvertToOrdered<VarcharT> {
+    using type = u32;
+};
+
 export template <typename T>
-    requires KeepOrderedSelf<T> or ConvertToOrderedI32<T> or ConvertToOrderedI64<T>
+    requires KeepOrderedSelf<T> or ConvertToOrderedI32<T> or ConvertToOrderedI64<T> or IsAnyOf<T, VarcharT>
 using ConvertToOrderedType = ConvertToOrdered<T>::type;
 
 export template <typename RawValueType>
@@ -116,6 +122,19 @@ protected:
     // pgm index
     // will always be loaded
     UniquePtr<SecondaryPGMIndex> pgm_index_;
+    // bitmap index, only for chunks with at most SECONDARY_INDEX_BITMAP_MAX_DISTINCT_KEYS distinct keys
+    // the pairs of the i-th distinct key are [value_begin_positions_[i], value_begin_positions_[i + 1]), their offsets are value_bitmaps_[i]
+    // will always be loaded
+    Vector<u32> value_begin_positions_;
+    Vector<Roaring> value_bitmaps_;
+
+    // pairs are sorted by (key, offset), the bitmaps are built only if the chunk has few distinct keys
+    template <typename OrderedKeyType>
+    void BuildValueBitmaps(const OrderedKeyType *key, const SegmentOffset *offset);
+
+    void SaveValueBitmaps(FileHandler &file_handler) const;
+
+    void ReadValueBitmaps(FileHandler &file_handler);
 
 public:
     explicit SecondaryIndexData(u32 chunk_row_count) : chunk_row_count_(chunk_row_count) {}
@@ -133,6 +152,19 @@ public:
 
     [[nodiscard]] inline u32 GetChunkRowCount() const { return chunk_row_count_; }
 
+    [[nodiscard]] inline bool HasValueBitmaps() const { return !value_bitmaps_.empty(); }
+
+    // adds the offsets of the pairs [begin_pos, end_pos) to result, the range must start and end at key boundaries
+    void UnionValueBitmaps(u32 begin_pos, u32 end_pos, Roaring &result) const;
+
+    // only for VARCHAR index: the ordinals [begin, end) of the dictionary strings in [begin_key, end_key), or in [begin_key, +inf) without end_key
+    [[nodiscard]] virtual Pair<u32, u32> SearchDictionary(std::string_view begin_key, Optional<std::string_view> end_key) const {
+        String error_message = "SearchDictionary(): the index has no dictionary.";
+        LOG_CRITICAL(error_message);
+        UnrecoverableError(error_message);
+        return {};
+    }
+
     virtual void SaveIndexInner(FileHandler &file_handler) const = 0;
 
     virtual void ReadIndexInner(FileHandler &file_handler) = 0;
@@ -33,10 +33,35 @@ import secondary_index_data;
 import chunk_index_entry;
 import segment_index_entry;
 import buffer_handle;
+import column_vector;
 import logger;
 
 namespace infinity {
 
+template <typename Iterator>
+Pair<u32, std::variant<Vector<u32>, Bitmask>> CollectRangeResult(const u32 segment_row_count, const Iterator begin, const Iterator end) {
+    const u32 result_size = std::distance(begin, end);
+    Pair<u32, std::variant<Vector<u32>, Bitmask>> result_var;
+    result_var.first = result_size;
+    // use array or bitmask for result
+    // use array when result_size <= 1024 or size of array (u32 type) <= size of bitmask
+    if (result_size <= 1024 or result_size <= std::bit_ceil(segment_row_count) / 32) {
+        auto &result = result_var.second.emplace<Vector<u32>>();
+        result.reserve(result_size);
+        for (auto it = begin; it != end; ++it) {
+            result.push_back(it->second);
+        }
+    } else {
+        auto &result = result_var.second.emplace<Bitmask>();
+        result.Initialize(segment_row_count);
+        result.SetAllFalse();
+        for (auto it = begin; it != end; ++it) {
+            result.SetTrue(it->second);
+        }
+    }
+    return result_var;
+}
+
 template <typename RawValueType>
 class SecondaryIndexInMemT final : public SecondaryIndexInMem {
     using KeyType = ConvertToOrderedType<RawValueType>;
@@ -84,26 +109,47 @@ private:
         std::shared_lock lock(map_mutex_);
         const auto begin = in_mem_secondary_index_.lower_bound(b);
         const auto end = in_mem_secondary_index_.upper_bound(e);
-        const u32 result_size = std::distance(begin, end);
-        Pair<u32, std::variant<Vector<u32>, Bitmask>> result_var;
-        result_var.first = result_size;
-        // use array or bitmask for result
-        // use array when result_size <= 1024 or size of array (u32 type) <= size of bitmask
-        if (result_size <= 1024 or result_size <= std::bit_ceil(segment_row_count) / 32) {
-            auto &result = result_var.second.emplace<Vector<u32>>();
-            result.reserve(result_size);
-            for (auto it = begin; it != end; ++it) {
-                result.push_back(it->second);
-            }
-        } else {
-            auto &result = result_var.second.emplace<Bitmask>();
-            result.Initialize(segment_row_count);
-            result.SetAllFalse();
-            for (auto it = begin; it != end; ++it) {
-                result.SetTrue(it->second);
-            }
+        return CollectRangeResult(segment_row_count, begin, end);
+    }
+};
+
+// RangeQuery input: tuple<u32 segment_row_count, string_view begin, Optional<string_view> end>, for the strings in [begin, end), or in [begin, +inf)
+class SecondaryIndexInMemVarchar final : public SecondaryIndexInMem {
+    const RowID begin_row_id_;
+    const u32 max_size_;
+    std::shared_mutex map_mutex_;
+    MultiMap<String, u32> in_mem_secondary_index_;
+
+public:
+    explicit SecondaryIndexInMemVarchar(const RowID begin_row_id, const u32 max_size) : begin_row_id_(begin_row_id), max_size_(max_size) {}
+    u32 GetRowCount() const override { return in_mem_secondary_index_.size(); }
+    void Insert(const u16 block_id, BlockColumnEntry *block_column_entry, BufferManager *buffer_manager, u32 row_offset, u32 row_count) override {
+        ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_manager);
+        VarcharColumnReader reader(column_vector);
+        const SegmentOffset block_offset = block_id * DEFAULT_BLOCK_CAPACITY;
+        std::unique_lock lock(map_mutex_);
+        for (u32 i = row_offset; i < row_offset + row_count; ++i) {
+            in_mem_secondary_index_.emplace(reader.GetString(reader[i]), block_offset + i);
+        }
+    }
+    SharedPtr<ChunkIndexEntry> Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr) override {
+        std::shared_lock lock(map_mutex_);
+        u32 row_count = GetRowCount();
+        auto new_chunk_index_entry = segment_index_entry->CreateSecondaryIndexChunkIndexEntry(begin_row_id_, row_count, buffer_mgr);
+        BufferHandle handle = new_chunk_index_entry->GetIndex();
+        auto data_ptr = static_cast<SecondaryIndexData *>(handle.GetDataMut());
+        data_ptr->InsertData(&in_mem_secondary_index_, new_chunk_index_entry);
+        return new_chunk_index_entry;
+    }
+    Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQuery(const void *input) override {
+        const auto &[segment_row_count, b, e] = *static_cast<const std::tuple<u32, std::string_view, Optional<std::string_view>> *>(input);
+        if (e.has_value() and *e <= b) {
+            return {0, Vector<u32>()};
         }
-        return result_var;
+        std::shared_lock lock(map_mutex_);
+        const auto begin = in_mem_secondary_index_.lower_bound(String(b));
+        const auto end = e.has_value() ? in_mem_secondary_index_.lower_bound(String(*e)) : in_mem_secondary_index_.end();
+        return CollectRangeResult(segment_row_count, begin, end);
     }
 };
 
@@ -144,6 +190,9 @@ SharedPtr<SecondaryIndexInMem> SecondaryIndexInMem::NewSecondaryIndexInMem(const
         case LogicalType::kTimestamp: {
             return MakeShared<SecondaryIndexInMemT<TimestampT>>(begin_row_id, max_size);
         }
+        case LogicalType::kVarchar: {
+            return MakeShared<SecondaryIndexInMemVarchar>(begin_row_id, max_size);
+        }
         default: {
             return nullptr;
         }
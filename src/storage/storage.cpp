@@ -43,6 +43,7 @@ import bg_task;
 import periodic_trigger_thread;
 import periodic_trigger;
 import log_file;
+import result_cache;
 
 import query_context;
 import infinity_context;
@@ -57,6 +58,8 @@ void Storage::Init() {
                                             MakeShared<String>(config_ptr_->DataDir()),
                                             MakeShared<String>(config_ptr_->TempDir()));
 
+    result_cache_ = MakeUnique<ResultCache>(config_ptr_->ResultCacheSize());
+
     // Construct wal manager
     wal_mgr_ = MakeUnique<WalManager>(this,
                                       config_ptr_->WALDir(),
@@ -88,7 +91,13 @@ void Storage::Init() {
     bool enable_optimize = optimize_interval.count() > 0;
 
     if (enable_compaction || enable_optimize) {
-        compact_processor_ = MakeUnique<CompactionProcessor>(new_catalog_.get(), txn_mgr_.get());
+        // Compaction and index optimize never take more than `compact_cpu_limit` percent of the cores the queries run on
+        i64 cpu_budget = std::max(config_ptr_->CPULimit() * config_ptr_->CompactCPULimit() / 100, i64(1));
+        SizeT compact_worker_count = std::min(config_ptr_->CompactWorkerCount(), cpu_budget);
+        compact_processor_ = MakeUnique<CompactionProcessor>(new_catalog_.get(),
+                                                             txn_mgr_.get(),
+                                                             compact_worker_count,
+                                                             config_ptr_->CompactTableConcurrency());
     } else {
         LOG_WARN("Compact interval is not set, auto compact is disable");
     }
@@ -97,6 +106,7 @@ void Storage::Init() {
     // start WalManager after TxnManager since it depends on TxnManager.
     wal_mgr_->Start();
 
+    // The memory indexes are recovered in the background, the queries are served meanwhile
     new_catalog_->MemIndexRecover(buffer_mgr_.get());
 
     bg_processor_->Start();
@@ -167,6 +177,7 @@ void Storage::UnInit() {
     }
     bg_processor_.reset();
     wal_mgr_.reset();
+    result_cache_.reset();
     new_catalog_.reset();
     buffer_mgr_.reset();
     config_ptr_ = nullptr;
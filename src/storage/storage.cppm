@@ -24,6 +24,7 @@ import background_process;
 import compaction_process;
 import periodic_trigger_thread;
 import log_file;
+import result_cache;
 
 export module storage;
 
@@ -45,6 +46,8 @@ public:
 
     [[nodiscard]] inline CompactionProcessor *compaction_processor() const noexcept { return compact_processor_.get(); }
 
+    [[nodiscard]] inline ResultCache *result_cache() const noexcept { return result_cache_.get(); }
+
     void Init();
 
     void UnInit();
@@ -64,6 +67,7 @@ private:
     UniquePtr<BGTaskProcessor> bg_processor_{};
     UniquePtr<CompactionProcessor> compact_processor_{};
     UniquePtr<PeriodicTriggerThread> periodic_trigger_thread_{};
+    UniquePtr<ResultCache> result_cache_{};
 };
 
 } // namespace infinity
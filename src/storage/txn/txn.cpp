@@ -80,6 +80,7 @@ Status Txn::Import(TableEntry *table_entry, SharedPtr<SegmentEntry> segment_entr
     const String &table_name = *table_entry->GetTableName();
 
     this->CheckTxn(db_name);
+    WaitMemIndexReady(table_entry);
 
     // build WalCmd
     WalSegmentInfo segment_info(segment_entry.get());
@@ -96,6 +97,7 @@ Status Txn::Append(TableEntry *table_entry, const SharedPtr<DataBlock> &input_bl
     const String &table_name = *table_entry->GetTableName();
 
     this->CheckTxn(db_name);
+    WaitMemIndexReady(table_entry);
     TxnTableStore *table_store = this->GetTxnTableStore(table_entry);
 
     wal_entry_->cmds_.push_back(MakeShared<WalCmdAppend>(db_name, table_name, input_block));
@@ -151,6 +153,16 @@ void Txn::CheckTxn(const String &db_name) {
     }
 }
 
+void Txn::WaitMemIndexReady(TableEntry *table_entry) {
+    // The memory indexes of the table may still be recovered after the startup, the rows written by this txn are inserted after the
+    // recovered ones at commit
+    Status status = table_entry->WaitMemIndexReady();
+    if (!status.ok()) {
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+}
+
 // Database OPs
 Status Txn::CreateDatabase(const String &db_name, ConflictType conflict_type) {
     this->CheckTxnStatus();
@@ -272,10 +284,13 @@ Tuple<SharedPtr<TableIndexInfo>, Status> Txn::GetTableIndexInfo(const String &db
     return catalog_->GetTableIndexInfo(db_name, table_name, index_name, txn_id_, begin_ts);
 }
 
-Pair<Vector<SegmentIndexEntry *>, Status>
-Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts) {
+Pair<Vector<SegmentIndexEntry *>, Status> Txn::CreateIndexPrepare(TableIndexEntry *table_index_entry,
+                                                                  BaseTableRef *table_ref,
+                                                                  bool prepare,
+                                                                  bool check_ts,
+                                                                  const HashMap<SegmentID, IndexMergeSource> *merge_sources) {
     auto *table_entry = table_ref->table_entry_ptr_;
-    auto [segment_index_entries, status] = table_index_entry->CreateIndexPrepare(table_ref, this, prepare, false, check_ts);
+    auto [segment_index_entries, status] = table_index_entry->CreateIndexPrepare(table_ref, this, prepare, false, check_ts, merge_sources);
     if (!status.ok()) {
         return {segment_index_entries, status};
     }
@@ -415,6 +430,12 @@ TxnTimeStamp Txn::Commit() {
         return commit_ts;
     }
 
+    if (ChangesCatalog()) {
+        // Invalidate the prepared plans before the commit ts is taken, so a txn beginning after the commit ts reads the new version.
+        // See QueryContext::QueryStatement
+        catalog_->IncreaseCatalogVersion();
+    }
+
     // register commit ts in wal manager here, define the commit sequence
     TxnTimeStamp commit_ts = txn_mgr_->GetCommitTimeStampW(this);
     // LOG_INFO(fmt::format("Txn: {} is committing, committing ts: {}", txn_id_, commit_ts));
@@ -462,6 +483,11 @@ void Txn::CommitBottom() {
 
     txn_store_.CommitBottom(txn_id_, commit_ts);
 
+    if (ChangesCatalog()) {
+        // Invalidate the prepared plans bound while the schema change was committing, see Txn::Commit
+        catalog_->IncreaseCatalogVersion();
+    }
+
     txn_store_.AddDeltaOp(local_catalog_delta_ops_entry_.get(), txn_mgr_);
 
     // Don't need to write empty CatalogDeltaEntry (read-only transactions).
@@ -476,6 +502,29 @@ void Txn::CommitBottom() {
     LOG_TRACE(fmt::format("Txn bottom: {} is finished.", txn_id_));
 }
 
+bool Txn::ChangesCatalog() const {
+    if (wal_entry_.get() == nullptr) {
+        return false;
+    }
+    for (const auto &cmd : wal_entry_->cmds_) {
+        switch (cmd->GetType()) {
+            case WalCommandType::CREATE_DATABASE:
+            case WalCommandType::DROP_DATABASE:
+            case WalCommandType::CREATE_TABLE:
+            case WalCommandType::DROP_TABLE:
+            case WalCommandType::ALTER_INFO:
+            case WalCommandType::CREATE_INDEX:
+            case WalCommandType::DROP_INDEX: {
+                return true;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+    return false;
+}
+
 void Txn::CancelCommitBottom() {
     txn_context_.SetTxnRollbacked();
     std::unique_lock<std::mutex> lk(lock_);
@@ -61,6 +61,7 @@ class CatalogDeltaOperation;
 class BaseTableRef;
 enum class CompactStatementType;
 struct SegmentIndexEntry;
+struct IndexMergeSource;
 
 export class Txn {
 public:
@@ -137,8 +138,12 @@ public:
 
     Tuple<SharedPtr<TableIndexInfo>, Status> GetTableIndexInfo(const String &db_name, const String &table_name, const String &index_name);
 
-    Pair<Vector<SegmentIndexEntry *>, Status>
-    CreateIndexPrepare(TableIndexEntry *table_index_entry, BaseTableRef *table_ref, bool prepare, bool check_ts = true);
+    // `merge_sources` maps the segments created by compaction to the segments they replace, so their indexes can be merged
+    Pair<Vector<SegmentIndexEntry *>, Status> CreateIndexPrepare(TableIndexEntry *table_index_entry,
+                                                                 BaseTableRef *table_ref,
+                                                                 bool prepare,
+                                                                 bool check_ts = true,
+                                                                 const HashMap<SegmentID, IndexMergeSource> *merge_sources = nullptr);
 
     Status CreateIndexDo(BaseTableRef *table_ref, const String &index_name, HashMap<SegmentID, atomic_u64> &create_index_idxes);
 
@@ -213,8 +218,13 @@ public:
 private:
     void CheckTxnStatus();
 
+    // Whether the transaction creates or drops a database, a table or an index
+    bool ChangesCatalog() const;
+
     void CheckTxn(const String &db_name);
 
+    void WaitMemIndexReady(TableEntry *table_entry);
+
 private:
     TxnStore txn_store_; // this has this ptr, so txn cannot be moved.
 
@@ -325,6 +325,9 @@ void TxnTableStore::PrepareCommit1() {
 
 // TODO: remove commit_ts
 void TxnTableStore::PrepareCommit(TransactionID txn_id, TxnTimeStamp commit_ts, BufferManager *buffer_mgr) {
+    // Invalidate the cached query results of the table before any change gets visible
+    table_entry_->IncreaseDataVersion();
+
     // Init append state
     append_state_ = MakeUnique<AppendState>(this->blocks_);
 
@@ -367,6 +370,7 @@ void TxnTableStore::Commit(TransactionID txn_id, TxnTimeStamp commit_ts) const {
     for (auto [table_index_entry, ptr_seq_n] : txn_indexes_) {
         table_index_entry->Commit(commit_ts);
     }
+    table_entry_->IncreaseDataVersion(commit_ts);
 }
 
 void TxnTableStore::MaintainCompactionAlg() const {
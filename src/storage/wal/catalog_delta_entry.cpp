@@ -1031,7 +1031,11 @@ String CatalogDeltaEntry::ToString() const {
 
 void CatalogDeltaEntry::AddOperation(UniquePtr<CatalogDeltaOperation> operation) { operations_.emplace_back(std::move(operation)); }
 
-void GlobalCatalogDeltaEntry::InitFullCheckpointTs(TxnTimeStamp last_full_ckp_ts) { last_full_ckp_ts_ = last_full_ckp_ts; }
+void GlobalCatalogDeltaEntry::InitFullCheckpointTs(TxnTimeStamp last_full_ckp_ts) {
+    // The full checkpoint thread sets it while the delta entries are added
+    std::lock_guard<std::mutex> lock(catalog_delta_locker_);
+    last_full_ckp_ts_ = last_full_ckp_ts;
+}
 
 void GlobalCatalogDeltaEntry::AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry, i64 wal_size) {
     // {
@@ -1112,6 +1116,35 @@ SizeT GlobalCatalogDeltaEntry::OpSize() const {
     return delta_ops_.size();
 }
 
+void GlobalCatalogDeltaEntry::RecordFlushedEntry(CatalogDeltaEntry *flush_delta_entry) {
+    std::lock_guard<std::mutex> lock(catalog_delta_locker_);
+    for (const auto &op : flush_delta_entry->operations()) {
+        RecordTableChange(op.get());
+    }
+}
+
+Pair<u64, TxnTimeStamp> GlobalCatalogDeltaEntry::GetTableChange(const String &table_encode) const {
+    std::lock_guard<std::mutex> lock(catalog_delta_locker_);
+    auto iter = table_changes_.find(table_encode);
+    if (iter == table_changes_.end()) {
+        return {0, 0};
+    }
+    return iter->second;
+}
+
+void GlobalCatalogDeltaEntry::RecordTableChange(const CatalogDeltaOperation *op) {
+    // encode is "#db#table#...", the operations on the db itself have no table part
+    const String &encode = *op->encode_;
+    SizeT table_pos = encode.find('#', 1);
+    if (table_pos == String::npos) {
+        return;
+    }
+    String table_encode = encode.substr(0, encode.find('#', table_pos + 1));
+    auto &[change_sequence, max_commit_ts] = table_changes_[table_encode];
+    change_sequence = ++change_sequence_;
+    max_commit_ts = std::max(max_commit_ts, op->commit_ts_);
+}
+
 // background process AddDeltaOp call this.
 void GlobalCatalogDeltaEntry::AddDeltaEntryInner(CatalogDeltaEntry *delta_entry) {
     TxnTimeStamp max_commit_ts = delta_entry->commit_ts();
@@ -1128,6 +1161,7 @@ void GlobalCatalogDeltaEntry::AddDeltaEntryInner(CatalogDeltaEntry *delta_entry)
     max_commit_ts_ = max_commit_ts;
 
     for (auto &new_op : delta_entry->operations()) {
+        RecordTableChange(new_op.get());
         if (new_op->type_ == CatalogDeltaOpType::ADD_SEGMENT_ENTRY) {
             auto *add_segment_op = static_cast<AddSegmentEntryOp *>(new_op.get());
             if (add_segment_op->status_ == SegmentStatus::kDeprecated) {
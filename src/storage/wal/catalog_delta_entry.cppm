@@ -381,11 +381,20 @@ public:
 
     SizeT OpSize() const;
 
+    // Marks the tables of the flushed operations changed, the flush updates the checkpointed state of their blocks and indexes
+    void RecordFlushedEntry(CatalogDeltaEntry *flush_delta_entry);
+
+    // Returns the sequence number of the last change to the table and the max commit ts of the operations on it.
+    // The full checkpoint reuses a serialized table as long as neither moved.
+    Pair<u64, TxnTimeStamp> GetTableChange(const String &table_encode) const;
+
 private:
     void AddDeltaEntryInner(CatalogDeltaEntry *delta_entry);
 
     void PruneOpWithSamePrefix(const String &prefix);
 
+    void RecordTableChange(const CatalogDeltaOperation *op);
+
 private:
     u64 last_sequence_{0};
     std::priority_queue<u64, Vector<u64>, std::greater<u64>> sequence_heap_;
@@ -398,6 +407,10 @@ private:
     TxnTimeStamp last_full_ckp_ts_{0};
     i64 wal_size_{};
 
+    u64 change_sequence_{0};
+    // table encode -> (sequence number of the last change, max commit ts of the operations)
+    HashMap<String, Pair<u64, TxnTimeStamp>> table_changes_;
+
     mutable std::mutex catalog_delta_locker_{};
 };
 
@@ -14,8 +14,10 @@
 
 module;
 
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <thread>
 
 import stl;
@@ -517,6 +519,43 @@ i64 WalManager::ReplayWalFile() {
     std::reverse(replay_entries.begin(), replay_entries.end());
     TransactionID last_txn_id = 0;
 
+    // Entries of different tables are replayed concurrently, the entries of one table in commit order.
+    // An entry changing the databases or tables, or writing more than one table, is replayed alone after all the entries before it.
+    ThreadPool replay_thread_pool(static_cast<int>(std::max(1u, std::thread::hardware_concurrency())));
+    Vector<String> pending_tables;
+    HashMap<String, Vector<const WalEntry *>> pending_entries;
+    auto replay_pending_entries = [&] {
+        if (pending_tables.size() == 1) {
+            for (const WalEntry *entry : pending_entries[pending_tables[0]]) {
+                ReplayWalEntry(*entry);
+            }
+        } else if (!pending_tables.empty()) {
+            Vector<std::future<void>> replay_futures;
+            for (const String &table_key : pending_tables) {
+                replay_futures.emplace_back(replay_thread_pool.push([this, &table_entries = pending_entries[table_key]](int) {
+                    for (const WalEntry *entry : table_entries) {
+                        ReplayWalEntry(*entry);
+                    }
+                }));
+            }
+            std::exception_ptr exception;
+            for (auto &replay_future : replay_futures) {
+                try {
+                    replay_future.get();
+                } catch (...) {
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+        pending_tables.clear();
+        pending_entries.clear();
+    };
+
     for (SizeT replay_count = 0; replay_count < replay_entries.size(); ++replay_count) {
         if (replay_entries[replay_count]->commit_ts_ < max_commit_ts) {
             String error_message = "Wal Replay: Commit ts should be greater than max commit ts";
@@ -527,8 +566,19 @@ i64 WalManager::ReplayWalFile() {
         last_txn_id = replay_entries[replay_count]->txn_id_;
 
         LOG_TRACE(replay_entries[replay_count]->ToString());
-        ReplayWalEntry(*replay_entries[replay_count]);
+        Optional<String> table_key = ReplayTableKey(*replay_entries[replay_count]);
+        if (!table_key.has_value()) {
+            replay_pending_entries();
+            ReplayWalEntry(*replay_entries[replay_count]);
+            continue;
+        }
+        auto &table_entries = pending_entries[*table_key];
+        if (table_entries.empty()) {
+            pending_tables.push_back(*table_key);
+        }
+        table_entries.push_back(replay_entries[replay_count].get());
     }
+    replay_pending_entries();
 
     LOG_INFO(fmt::format("System start ts: {}, lastest txn id: {}", system_start_ts, last_txn_id));
     storage_->catalog()->next_txn_id_ = last_txn_id;
@@ -539,6 +589,64 @@ i64 WalManager::ReplayWalFile() {
     return system_start_ts;
 }
 
+Optional<String> WalManager::ReplayTableKey(const WalEntry &entry) {
+    Optional<String> table_key;
+    auto add_table = [&](const String &db_name, const String &table_name) {
+        String key = fmt::format("{}.{}", db_name, table_name);
+        if (table_key.has_value() && *table_key != key) {
+            return false;
+        }
+        table_key = std::move(key);
+        return true;
+    };
+    for (const auto &cmd : entry.cmds_) {
+        bool single_table = true;
+        switch (cmd->GetType()) {
+            case WalCommandType::CREATE_INDEX: {
+                const auto *create_index_cmd = static_cast<const WalCmdCreateIndex *>(cmd.get());
+                single_table = add_table(create_index_cmd->db_name_, create_index_cmd->table_name_);
+                break;
+            }
+            case WalCommandType::DROP_INDEX: {
+                const auto *drop_index_cmd = static_cast<const WalCmdDropIndex *>(cmd.get());
+                single_table = add_table(drop_index_cmd->db_name_, drop_index_cmd->table_name_);
+                break;
+            }
+            case WalCommandType::IMPORT: {
+                const auto *import_cmd = static_cast<const WalCmdImport *>(cmd.get());
+                single_table = add_table(import_cmd->db_name_, import_cmd->table_name_);
+                break;
+            }
+            case WalCommandType::APPEND: {
+                const auto *append_cmd = static_cast<const WalCmdAppend *>(cmd.get());
+                single_table = add_table(append_cmd->db_name_, append_cmd->table_name_);
+                break;
+            }
+            case WalCommandType::DELETE: {
+                const auto *delete_cmd = static_cast<const WalCmdDelete *>(cmd.get());
+                single_table = add_table(delete_cmd->db_name_, delete_cmd->table_name_);
+                break;
+            }
+            case WalCommandType::COMPACT: {
+                const auto *compact_cmd = static_cast<const WalCmdCompact *>(cmd.get());
+                single_table = add_table(compact_cmd->db_name_, compact_cmd->table_name_);
+                break;
+            }
+            case WalCommandType::CHECKPOINT: {
+                break;
+            }
+            default: {
+                // create / drop database or table
+                return None;
+            }
+        }
+        if (!single_table) {
+            return None;
+        }
+    }
+    return table_key;
+}
+
 void WalManager::ReplayWalEntry(const WalEntry &entry) {
     for (const auto &cmd : entry.cmds_) {
         LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), entry.commit_ts_));
@@ -80,6 +80,9 @@ private:
 
     void SetLastCkpWalSize(i64 wal_size);
 
+    // The table all the commands of the entry write, None if the entry writes more than one table or changes the catalog structure
+    static Optional<String> ReplayTableKey(const WalEntry &entry);
+
     void WalCmdCreateDatabaseReplay(const WalCmdCreateDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdDropDatabaseReplay(const WalCmdDropDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdCreateTableReplay(const WalCmdCreateTable &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
@@ -127,7 +130,7 @@ private:
     i64 last_ckp_wal_size_{};
     Atomic<bool> checkpoint_in_progress_{false};
 
-    // Only Checkpoint/Cleanup thread access following members
+    // Only Checkpoint/Cleanup thread access following members, a full checkpoint runs on its own thread but never along with another checkpoint
     TxnTimeStamp last_ckp_ts_{};
     TxnTimeStamp last_full_ckp_ts_{};
 };
@@ -0,0 +1,205 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import third_party;
+import base_expression;
+import value_expression;
+import reference_expression;
+import in_expression;
+import case_expression;
+import column_vector;
+import expression_state;
+import expression_evaluator;
+import in_value_set;
+import value;
+import data_block;
+import default_values;
+import logical_type;
+import internal_types;
+import data_type;
+
+using namespace infinity;
+
+class InCaseExpressionTest : public BaseTest {
+protected:
+    static SharedPtr<ColumnVector> Evaluate(const SharedPtr<BaseExpression> &expr, const SharedPtr<DataBlock> &input_data_block) {
+        SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
+        SharedPtr<ColumnVector> output = ColumnVector::Make(MakeShared<DataType>(expr->Type()));
+        output->Initialize();
+        ExpressionEvaluator expr_evaluator;
+        expr_evaluator.Init(input_data_block.get());
+        expr_evaluator.Execute(expr, expr_state, output);
+        return output;
+    }
+
+    static SharedPtr<InExpression> MakeBigIntIn(InType in_type, const Vector<SharedPtr<BaseExpression>> &values) {
+        SharedPtr<ReferenceExpression> col_expr = ReferenceExpression::Make(DataType(LogicalType::kBigInt), "t1", "c1", String(), 0);
+        return MakeShared<InExpression>(in_type, col_expr, values);
+    }
+};
+
+TEST_F(InCaseExpressionTest, in_value_set) {
+    SharedPtr<DataType> bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+    auto make_values = [&](SizeT value_count) {
+        Vector<SharedPtr<ColumnVector>> values;
+        for (SizeT i = 0; i < value_count; ++i) {
+            auto value = ColumnVector::Make(bigint_type);
+            value->Initialize(ColumnVectorType::kConstant);
+            value->AppendValue(Value::MakeBigInt(i * 2));
+            values.emplace_back(value);
+        }
+        return values;
+    };
+    auto short_set = InValueSet::Make(*bigint_type, make_values(InValueSet::kSortedProbeLimit));
+    EXPECT_FALSE(short_set->UseHash());
+    auto long_set = InValueSet::Make(*bigint_type, make_values(InValueSet::kSortedProbeLimit + 1));
+    EXPECT_TRUE(long_set->UseHash());
+
+    Vector<SharedPtr<ColumnVector>> duplicated_values = make_values(4);
+    SharedPtr<ColumnVector> duplicated_value = duplicated_values[0];
+    duplicated_values.emplace_back(duplicated_value);
+    EXPECT_EQ(InValueSet::Make(*bigint_type, duplicated_values)->size(), 4u);
+
+    EXPECT_EQ(InValueSet::Make(DataType(LogicalType::kBoolean), {}).get(), nullptr);
+}
+
+TEST_F(InCaseExpressionTest, in_bigint) {
+    SharedPtr<DataType> bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    auto column = ColumnVector::Make(bigint_type);
+    column->Initialize();
+    for (SizeT i = 0; i < row_count; ++i) {
+        column->AppendValue(Value::MakeBigInt(i));
+    }
+    SharedPtr<DataBlock> input_data_block = DataBlock::Make();
+    input_data_block->Init(Vector<SharedPtr<ColumnVector>>{column});
+
+    // short list, probed by binary search
+    {
+        Vector<SharedPtr<BaseExpression>> values;
+        for (i64 v : {7, 3, 5, 3}) {
+            values.emplace_back(MakeShared<ValueExpression>(Value::MakeBigInt(v)));
+        }
+        for (InType in_type : {InType::kIn, InType::kNotIn}) {
+            auto output = Evaluate(MakeBigIntIn(in_type, values), input_data_block);
+            EXPECT_EQ(output->Size(), row_count);
+            for (SizeT i = 0; i < row_count; ++i) {
+                bool expected = i == 3 || i == 5 || i == 7;
+                EXPECT_EQ(output->GetValue(i).GetValue<BooleanT>(), in_type == InType::kIn ? expected : !expected);
+            }
+        }
+    }
+    // long list, probed by hashing
+    {
+        Vector<SharedPtr<BaseExpression>> values;
+        for (i64 v = 0; v < 1000; v += 10) {
+            values.emplace_back(MakeShared<ValueExpression>(Value::MakeBigInt(v)));
+        }
+        auto output = Evaluate(MakeBigIntIn(InType::kIn, values), input_data_block);
+        for (SizeT i = 0; i < row_count; ++i) {
+            EXPECT_EQ(output->GetValue(i).GetValue<BooleanT>(), i < 1000 && i % 10 == 0);
+        }
+    }
+    // a NULL in the list makes the rows that aren't found null
+    {
+        Vector<SharedPtr<BaseExpression>> values;
+        values.emplace_back(MakeShared<ValueExpression>(Value::MakeBigInt(3)));
+        values.emplace_back(MakeShared<ValueExpression>(Value::MakeNull()));
+        auto output = Evaluate(MakeBigIntIn(InType::kIn, values), input_data_block);
+        for (SizeT i = 0; i < row_count; ++i) {
+            EXPECT_EQ(output->nulls_ptr_->IsTrue(i), i == 3);
+        }
+        EXPECT_TRUE(output->GetValue(3).GetValue<BooleanT>());
+    }
+}
+
+TEST_F(InCaseExpressionTest, in_varchar) {
+    SharedPtr<DataType> varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    auto column = ColumnVector::Make(varchar_type);
+    column->Initialize();
+    for (SizeT i = 0; i < row_count; ++i) {
+        // long strings are stored in the heap
+        column->AppendValue(Value::MakeVarchar(fmt::format("tenant_{}_with_a_long_suffix", i % 100)));
+    }
+    SharedPtr<DataBlock> input_data_block = DataBlock::Make();
+    input_data_block->Init(Vector<SharedPtr<ColumnVector>>{column});
+
+    Vector<SharedPtr<BaseExpression>> values;
+    values.emplace_back(MakeShared<ValueExpression>(Value::MakeVarchar("tenant_1_with_a_long_suffix")));
+    values.emplace_back(MakeShared<ValueExpression>(Value::MakeVarchar("tenant_42_with_a_long_suffix")));
+    values.emplace_back(MakeShared<ValueExpression>(Value::MakeVarchar("tenant_42")));
+    SharedPtr<ReferenceExpression> col_expr = ReferenceExpression::Make(*varchar_type, "t1", "c1", String(), 0);
+    auto output = Evaluate(MakeShared<InExpression>(InType::kIn, col_expr, values), input_data_block);
+    for (SizeT i = 0; i < row_count; ++i) {
+        EXPECT_EQ(output->GetValue(i).GetValue<BooleanT>(), i % 100 == 1 || i % 100 == 42);
+    }
+}
+
+TEST_F(InCaseExpressionTest, case_when) {
+    SharedPtr<DataType> bool_type = MakeShared<DataType>(LogicalType::kBoolean);
+    SharedPtr<DataType> bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    auto c1 = ColumnVector::Make(bool_type);
+    auto c2 = ColumnVector::Make(bool_type);
+    auto c3 = ColumnVector::Make(bigint_type);
+    c1->Initialize();
+    c2->Initialize();
+    c3->Initialize();
+    for (SizeT i = 0; i < row_count; ++i) {
+        c1->AppendValue(Value::MakeBool(i % 3 == 0));
+        c2->AppendValue(Value::MakeBool(i % 2 == 0));
+        c3->AppendValue(Value::MakeBigInt(i));
+    }
+    SharedPtr<DataBlock> input_data_block = DataBlock::Make();
+    input_data_block->Init(Vector<SharedPtr<ColumnVector>>{c1, c2, c3});
+
+    auto c1_expr = ReferenceExpression::Make(*bool_type, "t1", "c1", String(), 0);
+    auto c2_expr = ReferenceExpression::Make(*bool_type, "t1", "c2", String(), 1);
+    auto c3_expr = ReferenceExpression::Make(*bigint_type, "t1", "c3", String(), 2);
+
+    // CASE WHEN c1 THEN c3 WHEN c2 THEN 100 ELSE -1 END
+    {
+        auto case_expr = MakeShared<CaseExpression>();
+        case_expr->AddCaseCheck(c1_expr, c3_expr);
+        case_expr->AddCaseCheck(c2_expr, MakeShared<ValueExpression>(Value::MakeBigInt(100)));
+        case_expr->AddElseExpr(MakeShared<ValueExpression>(Value::MakeBigInt(-1)));
+        case_expr->SetReturnType(*bigint_type);
+
+        auto output = Evaluate(case_expr, input_data_block);
+        EXPECT_EQ(output->Size(), row_count);
+        for (SizeT i = 0; i < row_count; ++i) {
+            i64 expected = i % 3 == 0 ? i64(i) : (i % 2 == 0 ? 100 : -1);
+            EXPECT_EQ(output->GetValue(i).GetValue<BigIntT>(), expected);
+        }
+    }
+    // CASE WHEN c2 THEN c3 END, the other rows are null
+    {
+        auto case_expr = MakeShared<CaseExpression>();
+        case_expr->AddCaseCheck(c2_expr, c3_expr);
+        case_expr->AddElseExpr(MakeShared<ValueExpression>(Value::MakeNull()));
+        case_expr->SetReturnType(*bigint_type);
+
+        auto output = Evaluate(case_expr, input_data_block);
+        for (SizeT i = 0; i < row_count; ++i) {
+            EXPECT_EQ(output->nulls_ptr_->IsTrue(i), i % 2 == 0);
+            if (i % 2 == 0) {
+                EXPECT_EQ(output->GetValue(i).GetValue<BigIntT>(), i64(i));
+            }
+        }
+    }
+}
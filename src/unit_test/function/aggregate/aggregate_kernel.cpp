@@ -0,0 +1,133 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import bitmask;
+import aggregate_kernel;
+
+using namespace infinity;
+
+class AggregateKernelTest : public BaseTest {};
+
+TEST_F(AggregateKernelTest, batch_kernels) {
+    SizeT count = 1000;
+    Vector<i32> input(count);
+    for (SizeT i = 0; i < count; ++i) {
+        input[i] = i % 2 == 0 ? i32(i) : -i32(i);
+    }
+    Vector<u32> selection;
+    for (u32 i = 0; i < count; i += 7) {
+        selection.push_back(i);
+    }
+
+    i64 sum = 0;
+    i32 min_value = std::numeric_limits<i32>::max();
+    i32 max_value = std::numeric_limits<i32>::min();
+    for (i32 v : input) {
+        sum += v;
+        min_value = std::min(min_value, v);
+        max_value = std::max(max_value, v);
+    }
+    EXPECT_EQ(BatchSum<i64>(input.data(), count, nullptr), sum);
+    EXPECT_EQ(BatchMin(input.data(), count, nullptr, std::numeric_limits<i32>::max()), min_value);
+    EXPECT_EQ(BatchMax(input.data(), count, nullptr, std::numeric_limits<i32>::min()), max_value);
+
+    sum = 0;
+    min_value = std::numeric_limits<i32>::max();
+    max_value = std::numeric_limits<i32>::min();
+    for (u32 row : selection) {
+        sum += input[row];
+        min_value = std::min(min_value, input[row]);
+        max_value = std::max(max_value, input[row]);
+    }
+    EXPECT_EQ(BatchSum<i64>(input.data(), selection.size(), selection.data()), sum);
+    EXPECT_EQ(BatchMin(input.data(), selection.size(), selection.data(), std::numeric_limits<i32>::max()), min_value);
+    EXPECT_EQ(BatchMax(input.data(), selection.size(), selection.data(), std::numeric_limits<i32>::min()), max_value);
+
+    // the floating point kernel keeps several partial sums, the tail after the last full round is added separately
+    Vector<f32> float_input(count + 3);
+    f64 float_sum = 0;
+    for (SizeT i = 0; i < float_input.size(); ++i) {
+        float_input[i] = f32(i) / 4;
+        float_sum += float_input[i];
+    }
+    EXPECT_DOUBLE_EQ(BatchSum<f64>(float_input.data(), float_input.size(), nullptr), float_sum);
+}
+
+TEST_F(AggregateKernelTest, scatter_kernels) {
+    SizeT count = 1000;
+    SizeT group_count = 10;
+    Vector<i64> input(count);
+    Vector<u32> group_ids(count);
+    for (SizeT i = 0; i < count; ++i) {
+        input[i] = i;
+        group_ids[i] = (i * 3) % group_count;
+    }
+    Vector<u32> selection;
+    for (u32 i = 1; i < count; i += 2) {
+        selection.push_back(i);
+    }
+
+    Vector<i64> sums(group_count), counts(group_count), expected_sums(group_count), expected_counts(group_count);
+    Vector<i64> mins(group_count, std::numeric_limits<i64>::max()), maxs(group_count, std::numeric_limits<i64>::min());
+    ScatterSum(sums.data(), group_ids.data(), input.data(), selection.size(), selection.data());
+    ScatterCount(counts.data(), group_ids.data(), selection.size(), selection.data());
+    ScatterMin(mins.data(), group_ids.data(), input.data(), selection.size(), selection.data());
+    ScatterMax(maxs.data(), group_ids.data(), input.data(), selection.size(), selection.data());
+    Vector<i64> expected_mins(group_count, std::numeric_limits<i64>::max()), expected_maxs(group_count, std::numeric_limits<i64>::min());
+    for (u32 row : selection) {
+        u32 group_id = group_ids[row];
+        expected_sums[group_id] += input[row];
+        ++expected_counts[group_id];
+        expected_mins[group_id] = std::min(expected_mins[group_id], input[row]);
+        expected_maxs[group_id] = std::max(expected_maxs[group_id], input[row]);
+    }
+    EXPECT_EQ(sums, expected_sums);
+    EXPECT_EQ(counts, expected_counts);
+    EXPECT_EQ(mins, expected_mins);
+    EXPECT_EQ(maxs, expected_maxs);
+
+    Vector<i64> all_sums(group_count);
+    ScatterSum(all_sums.data(), group_ids.data(), input.data(), count, nullptr);
+    i64 total = 0;
+    for (i64 group_sum : all_sums) {
+        total += group_sum;
+    }
+    EXPECT_EQ(total, i64(count * (count - 1) / 2));
+}
+
+TEST_F(AggregateKernelTest, valid_selection) {
+    SizeT row_count = 200;
+    auto nulls = Bitmask::Make(256);
+    Vector<u32> selection(row_count);
+    EXPECT_EQ(BuildValidSelection(*nulls, row_count, selection.data()), row_count);
+
+    nulls->SetAllTrue();
+    for (SizeT i = 0; i < row_count; i += 5) {
+        nulls->SetFalse(i);
+    }
+    // the rows after row_count are ignored
+    nulls->SetFalse(row_count + 1);
+    SizeT valid_count = BuildValidSelection(*nulls, row_count, selection.data());
+    EXPECT_EQ(valid_count, row_count - row_count / 5);
+    for (SizeT i = 0; i < valid_count; ++i) {
+        EXPECT_NE(selection[i] % 5, 0u);
+        EXPECT_LT(selection[i], row_count);
+        if (i > 0) {
+            EXPECT_LT(selection[i - 1], selection[i]);
+        }
+    }
+}
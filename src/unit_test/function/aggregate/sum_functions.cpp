@@ -263,3 +263,46 @@ TEST_F(SumFunctionTest, avg_func) {
         EXPECT_THROW(aggregate_function_set->GetMostMatchFunction(col_expr_ptr), RecoverableException);
     }
 }
+
+TEST_F(SumFunctionTest, sum_with_nulls) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+
+    RegisterSumFunction(catalog_ptr);
+
+    SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), "sum");
+    SharedPtr<AggregateFunctionSet> aggregate_function_set = std::static_pointer_cast<AggregateFunctionSet>(function_set);
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kBigInt);
+    SharedPtr<ColumnExpression> col_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0);
+    AggregateFunction func = aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(data_type);
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+
+    DataBlock data_block;
+    data_block.Init(column_types);
+
+    i64 sum = 0;
+    for (SizeT i = 0; i < row_count; ++i) {
+        data_block.AppendValue(0, Value::MakeBigInt(static_cast<BigIntT>(i)));
+        if (i % 3 != 0) {
+            sum += static_cast<BigIntT>(i);
+        }
+    }
+    data_block.Finalize();
+    // the rows 0, 3, 6, ... are null and must not be summed
+    for (SizeT i = 0; i < row_count; i += 3) {
+        data_block.column_vectors[0]->nulls_ptr_->SetFalse(i);
+    }
+
+    auto data_state = func.InitState();
+    func.init_func_(data_state.get());
+    func.update_func_(data_state.get(), data_block.column_vectors[0]);
+    BigIntT result = *(BigIntT *)func.finalize_func_(data_state.get());
+
+    EXPECT_EQ(sum, result);
+}
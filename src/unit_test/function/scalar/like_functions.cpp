@@ -0,0 +1,145 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import infinity_exception;
+
+import global_resource_usage;
+import third_party;
+
+import logger;
+import stl;
+import infinity_context;
+import catalog;
+import like;
+import scalar_function;
+import scalar_function_set;
+import function_set;
+import function;
+import column_expression;
+import value;
+import default_values;
+import data_block;
+import base_expression;
+import column_vector;
+import logical_type;
+import internal_types;
+import data_type;
+
+using namespace infinity;
+
+class LikeFunctionsTest : public BaseTest {};
+
+TEST_F(LikeFunctionsTest, like_matcher) {
+    EXPECT_EQ(LikeMatcher("abc").kind(), LikeMatcherKind::kExact);
+    EXPECT_EQ(LikeMatcher("abc%").kind(), LikeMatcherKind::kPrefix);
+    EXPECT_EQ(LikeMatcher("%abc").kind(), LikeMatcherKind::kSuffix);
+    EXPECT_EQ(LikeMatcher("%abc%").kind(), LikeMatcherKind::kContains);
+    EXPECT_EQ(LikeMatcher("a_c").kind(), LikeMatcherKind::kGeneral);
+    EXPECT_EQ(LikeMatcher("a%b%c").kind(), LikeMatcherKind::kGeneral);
+
+    EXPECT_EQ(LikeMatcher("abc%").LiteralPrefix(), "abc");
+    EXPECT_EQ(LikeMatcher("ab_d%").LiteralPrefix(), "ab");
+    EXPECT_EQ(LikeMatcher("%abc").LiteralPrefix(), "");
+
+    Vector<Tuple<String, String, bool>> cases = {
+        {"abc", "abc", true},
+        {"abc", "abcd", false},
+        {"abc", "abc%", true},
+        {"abcdef", "abc%", true},
+        {"ab", "abc%", false},
+        {"xxabc", "%abc", true},
+        {"xxabcx", "%abc", false},
+        {"the quick brown fox jumps over the lazy dog", "%lazy%", true},
+        {"the quick brown fox jumps over the lazy dog", "%lazy cat%", false},
+        {"abc", "a_c", true},
+        {"abbc", "a_c", false},
+        {"axxbyyc", "a%b%c", true},
+        {"axxcyyb", "a%b%c", false},
+        {"abc", "a%b%c", true},
+        {"ab", "a%%b", true},
+        {"aba", "a%ba", true},
+        {"ab", "a%ba", false},
+        {"abba", "a%ba", true},
+        {"", "%", true},
+        {"", "", true},
+        {"a", "", false},
+        {"the quick brown fox", "%q_ick%f_x", true},
+        {"the quick brown fox", "%q_ick%f_y", false},
+    };
+    for (const auto &[str, pattern, expected] : cases) {
+        EXPECT_EQ(LikeMatcher(pattern).Match(str), expected) << str << " like " << pattern;
+    }
+}
+
+TEST_F(LikeFunctionsTest, simd_find) {
+    String str;
+    for (SizeT i = 0; i < 200; ++i) {
+        str += static_cast<char>('a' + i % 7);
+    }
+    for (SizeT len = 1; len < 20; ++len) {
+        for (SizeT start = 0; start + len <= str.size(); start += 13) {
+            String needle = str.substr(start, len);
+            EXPECT_EQ(SIMDFind(str, needle), str.find(needle));
+        }
+    }
+    EXPECT_EQ(SIMDFind(str, "xyz"), std::string_view::npos);
+    EXPECT_EQ(SIMDFind(str + "xyz", "xyz"), str.size());
+}
+
+TEST_F(LikeFunctionsTest, like_func) {
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+
+    RegisterLikeFunction(catalog_ptr);
+    RegisterNotLikeFunction(catalog_ptr);
+
+    SharedPtr<DataType> varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    SharedPtr<DataType> result_type = MakeShared<DataType>(LogicalType::kBoolean);
+    SharedPtr<ColumnExpression> col1_expr_ptr = MakeShared<ColumnExpression>(*varchar_type, "t1", 1, "c1", 0, 0);
+    SharedPtr<ColumnExpression> col2_expr_ptr = MakeShared<ColumnExpression>(*varchar_type, "t1", 1, "c2", 1, 0);
+    Vector<SharedPtr<BaseExpression>> inputs{col1_expr_ptr, col2_expr_ptr};
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    auto column = ColumnVector::Make(varchar_type);
+    column->Initialize();
+    for (SizeT i = 0; i < row_count; ++i) {
+        // long strings are stored in the heap, behind their 5 bytes prefix
+        column->AppendValue(Value::MakeVarchar(fmt::format("{}_tenant_{}_some_long_suffix", i % 3 == 0 ? "prod" : "test", i)));
+    }
+    auto pattern = ColumnVector::Make(varchar_type);
+    pattern->Initialize(ColumnVectorType::kConstant);
+    pattern->AppendValue(Value::MakeVarchar("prod_tenant_%1_some%"));
+
+    DataBlock data_block;
+    data_block.Init(Vector<SharedPtr<ColumnVector>>{column, pattern});
+
+    for (const String op : {"like", "not_like"}) {
+        SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), op);
+        EXPECT_EQ(function_set->type_, FunctionType::kScalar);
+        SharedPtr<ScalarFunctionSet> scalar_function_set = std::static_pointer_cast<ScalarFunctionSet>(function_set);
+        ScalarFunction func = scalar_function_set->GetMostMatchFunction(inputs);
+
+        SharedPtr<ColumnVector> result = MakeShared<ColumnVector>(result_type);
+        result->Initialize();
+        func.function_(data_block, result);
+
+        for (SizeT i = 0; i < row_count; ++i) {
+            Value v = result->GetValue(i);
+            EXPECT_EQ(v.type_.type(), LogicalType::kBoolean);
+            bool expected = i % 3 == 0 && i % 10 == 1;
+            EXPECT_EQ(v.value_.boolean, op == "like" ? expected : !expected);
+        }
+    }
+}
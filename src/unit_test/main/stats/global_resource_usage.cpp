@@ -38,42 +38,78 @@ TEST_F(GlobalResourceUsageTest, usage_test) {
 
     // Object count
 #ifdef INFINITY_DEBUG
-    GlobalResourceUsage::IncrObjectCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetObjectCount(), 1);
 
-    GlobalResourceUsage::IncrObjectCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetObjectCount(), 2);
 
-    GlobalResourceUsage::DecrObjectCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::DecrObjectCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetObjectCount(), 1);
 
-    GlobalResourceUsage::DecrObjectCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::DecrObjectCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetObjectCount(), 0);
 
-    GlobalResourceUsage::DecrObjectCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::DecrObjectCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetObjectCount(), -1);
 
-    GlobalResourceUsage::IncrObjectCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::IncrObjectCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetObjectCount(), 0);
 
     // Raw memory count
-    GlobalResourceUsage::IncrRawMemCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::IncrRawMemCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(), 1);
 
-    GlobalResourceUsage::IncrRawMemCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::IncrRawMemCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(), 2);
 
-    GlobalResourceUsage::DecrRawMemCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::DecrRawMemCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(), 1);
 
-    GlobalResourceUsage::DecrRawMemCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::DecrRawMemCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(), 0);
 
-    GlobalResourceUsage::DecrRawMemCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::DecrRawMemCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(), -1);
 
-    GlobalResourceUsage::IncrRawMemCount("GlobalResourceUsageTest");
+    GlobalResourceUsage::IncrRawMemCount(ResourceCounter::kValue);
     EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(), 0);
 #endif
 
-}
\ No newline at end of file
+}
+
+TEST_F(GlobalResourceUsageTest, multithread_test) {
+    using namespace infinity;
+
+#ifdef INFINITY_DEBUG
+    constexpr i64 thread_count = 8;
+    constexpr i64 loop_count = 10000;
+    Vector<Thread> threads;
+    for (i64 i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            for (i64 j = 0; j < loop_count; ++j) {
+                GlobalResourceUsage::IncrObjectCount(ResourceCounter::kColumnVector);
+                GlobalResourceUsage::IncrRawMemCount(ResourceCounter::kAllocator);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    // the counts of the exited threads are kept
+    EXPECT_EQ(GlobalResourceUsage::GetObjectCount(ResourceCounter::kColumnVector), thread_count * loop_count);
+    EXPECT_EQ(GlobalResourceUsage::GetObjectCount(ResourceCounter::kBitmask), 0);
+    EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(ResourceCounter::kAllocator), thread_count * loop_count);
+
+    // the objects are released by another thread than the one which created them
+    Thread release_thread([&] {
+        for (i64 j = 0; j < thread_count * loop_count; ++j) {
+            GlobalResourceUsage::DecrObjectCount(ResourceCounter::kColumnVector);
+            GlobalResourceUsage::DecrRawMemCount(ResourceCounter::kAllocator);
+        }
+    });
+    release_thread.join();
+    EXPECT_EQ(GlobalResourceUsage::GetObjectCount(), 0);
+    EXPECT_EQ(GlobalResourceUsage::GetRawMemoryCount(), 0);
+#endif
+}
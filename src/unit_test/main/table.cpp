@@ -33,6 +33,7 @@ import knn_expr;
 import column_def;
 import explain_statement;
 import data_type;
+import insert_statement;
 
 class InfinityTableTest : public BaseTest {};
 
@@ -147,3 +148,111 @@ TEST_F(InfinityTableTest, test1) {
     infinity->LocalDisconnect();
     Infinity::LocalUnInit();
 }
+
+TEST_F(InfinityTableTest, insert_columns) {
+    using namespace infinity;
+
+    String path = GetHomeDir();
+    RemoveDbDirs();
+    Infinity::LocalInit(path);
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    {
+        QueryResult create_result = infinity->Query("create table columnar_table (c1 embedding(float, 4), c2 integer, c3 varchar);");
+        EXPECT_TRUE(create_result.IsOk());
+
+        // more rows than a block holds
+        constexpr SizeT row_count = 10000;
+        auto *column_data = new Vector<InsertColumnData>(3);
+        {
+            InsertColumnData &column = (*column_data)[0];
+            column.column_name_ = "c1";
+            column.data_type_ = MakeShared<DataType>(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, 4));
+            column.row_count_ = row_count;
+            column.data_.resize(row_count * 4 * sizeof(f32));
+            auto *values = reinterpret_cast<f32 *>(column.data_.data());
+            for (SizeT i = 0; i < row_count * 4; ++i) {
+                values[i] = static_cast<f32>(i);
+            }
+        }
+        {
+            // cast to the column type
+            InsertColumnData &column = (*column_data)[1];
+            column.column_name_ = "c2";
+            column.data_type_ = MakeShared<DataType>(LogicalType::kBigInt);
+            column.row_count_ = row_count;
+            column.data_.resize(row_count * sizeof(i64));
+            auto *values = reinterpret_cast<i64 *>(column.data_.data());
+            for (SizeT i = 0; i < row_count; ++i) {
+                values[i] = i;
+            }
+        }
+        {
+            InsertColumnData &column = (*column_data)[2];
+            column.column_name_ = "c3";
+            column.data_type_ = MakeShared<DataType>(LogicalType::kVarchar);
+            column.row_count_ = row_count;
+            column.varchar_offsets_.push_back(0);
+            for (SizeT i = 0; i < row_count; ++i) {
+                String value = fmt::format("a long enough varchar value {}", i);
+                column.data_.insert(column.data_.end(), value.begin(), value.end());
+                column.varchar_offsets_.push_back(column.data_.size());
+            }
+        }
+        QueryResult insert_result = infinity->InsertColumns("default_db", "columnar_table", column_data);
+        EXPECT_TRUE(insert_result.IsOk());
+
+        QueryResult count_result = infinity->Query("select count(*) from columnar_table;");
+        EXPECT_TRUE(count_result.IsOk());
+        EXPECT_EQ(count_result.result_table_->GetDataBlockById(0)->GetValue(0, 0).value_.big_int, i64(row_count));
+
+        QueryResult select_result = infinity->Query("select c1, c3 from columnar_table where c2 = 9000;");
+        EXPECT_TRUE(select_result.IsOk());
+        SizeT select_row_count = 0;
+        for (SizeT block_idx = 0; block_idx < select_result.result_table_->DataBlockCount(); ++block_idx) {
+            SharedPtr<DataBlock> data_block = select_result.result_table_->GetDataBlockById(block_idx);
+            for (SizeT row_idx = 0; row_idx < data_block->row_count(); ++row_idx, ++select_row_count) {
+                Value embedding_value = data_block->GetValue(0, row_idx);
+                EXPECT_EQ(reinterpret_cast<const f32 *>(embedding_value.GetEmbedding().data())[1], 9000.0f * 4 + 1);
+                EXPECT_EQ(data_block->GetValue(1, row_idx).GetVarchar(), "a long enough varchar value 9000");
+            }
+        }
+        EXPECT_EQ(select_row_count, 1u);
+    }
+    {
+        // the buffer doesn't hold row_count values
+        auto *column_data = new Vector<InsertColumnData>(1);
+        InsertColumnData &column = (*column_data)[0];
+        column.column_name_ = "c2";
+        column.data_type_ = MakeShared<DataType>(LogicalType::kInteger);
+        column.row_count_ = 2;
+        column.data_.resize(sizeof(i32));
+        QueryResult insert_result = infinity->InsertColumns("default_db", "columnar_table", column_data);
+        EXPECT_FALSE(insert_result.IsOk());
+    }
+    {
+        // the varchar offsets decrease, or point past the buffer
+        for (const Vector<u32> &offsets : {Vector<u32>{0, 3, 2, 3}, Vector<u32>{0, 8, 3, 3}}) {
+            auto *column_data = new Vector<InsertColumnData>(3);
+            (*column_data)[0].column_name_ = "c1";
+            (*column_data)[0].data_type_ = MakeShared<DataType>(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, 4));
+            (*column_data)[0].row_count_ = 3;
+            (*column_data)[0].data_.resize(3 * 4 * sizeof(f32));
+            (*column_data)[1].column_name_ = "c2";
+            (*column_data)[1].data_type_ = MakeShared<DataType>(LogicalType::kInteger);
+            (*column_data)[1].row_count_ = 3;
+            (*column_data)[1].data_.resize(3 * sizeof(i32));
+            InsertColumnData &column = (*column_data)[2];
+            column.column_name_ = "c3";
+            column.data_type_ = MakeShared<DataType>(LogicalType::kVarchar);
+            column.row_count_ = 3;
+            column.data_ = {'a', 'b', 'c'};
+            column.varchar_offsets_ = offsets;
+            QueryResult insert_result = infinity->InsertColumns("default_db", "columnar_table", column_data);
+            EXPECT_FALSE(insert_result.IsOk());
+        }
+    }
+
+    infinity->LocalDisconnect();
+    Infinity::LocalUnInit();
+}
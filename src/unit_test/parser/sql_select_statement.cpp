@@ -1520,4 +1520,34 @@ TEST_F(SelectStatementParsingTest, good_search_test) {
     EXPECT_EQ(select_statement->where_expr_->type_, ParsedExprType::kFunction);
 
     result->Reset();
-}
\ No newline at end of file
+}
+TEST_F(SelectStatementParsingTest, batch_knn_test) {
+    using namespace infinity;
+    SharedPtr<SQLParser> parser = MakeShared<SQLParser>();
+    SharedPtr<ParserResult> result = MakeShared<ParserResult>();
+
+    {
+        String input_sql = "SELECT b FROM t1 SEARCH MATCH VECTOR (c1, [[1.0, 2.0], [3.0, 4.0], [5, 6]], 'float', 'l2', 3);";
+        parser->Parse(input_sql, result.get());
+        EXPECT_TRUE(result->error_message_.empty());
+
+        auto *select_statement = (SelectStatement *)(result->statements_ptr_->at(0));
+        auto *search_expr = (SearchExpr *)(select_statement->search_expr_);
+        auto *knn_expr = (KnnExpr *)(search_expr->knn_exprs_[0]);
+        EXPECT_EQ(knn_expr->query_count_, 3);
+        EXPECT_EQ(knn_expr->dimension_, 2);
+        EXPECT_EQ(knn_expr->embedding_data_type_, EmbeddingDataType::kElemFloat);
+        Vector<f32> expected = {1, 2, 3, 4, 5, 6};
+        for (SizeT i = 0; i < expected.size(); ++i) {
+            EXPECT_FLOAT_EQ(((f32 *)knn_expr->embedding_data_ptr_)[i], expected[i]);
+        }
+        result->Reset();
+    }
+    {
+        // query embeddings of a batch must have the same dimension
+        String input_sql = "SELECT b FROM t1 SEARCH MATCH VECTOR (c1, [[1, 2], [3]], 'float', 'l2', 3);";
+        parser->Parse(input_sql, result.get());
+        EXPECT_FALSE(result->error_message_.empty());
+        result->Reset();
+    }
+}
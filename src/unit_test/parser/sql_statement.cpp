@@ -43,6 +43,9 @@ import drop_index_info;
 import table_reference;
 import parser_result;
 import statement_common;
+import prepare_statement;
+import execute_statement;
+import parsed_expr;
 
 class StatementParsingTest : public BaseTest {};
 
@@ -530,3 +533,52 @@ TEST_F(StatementParsingTest, good_test1) {
         result->Reset();
     }
 }
+
+TEST_F(StatementParsingTest, prepare_execute_test) {
+    using namespace infinity;
+    SharedPtr<SQLParser> parser = MakeShared<SQLParser>();
+    SharedPtr<ParserResult> result = MakeShared<ParserResult>();
+
+    {
+        String input_sql = "PREPARE q1 AS SELECT a FROM t1 WHERE b > ? AND c = ?;";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        EXPECT_FALSE(result->statements_ptr_ == nullptr);
+
+        BaseStatement *statement = (*result->statements_ptr_)[0];
+        EXPECT_EQ(statement->type_, StatementType::kPrepare);
+        auto *prepare_statement = (PrepareStatement *)(statement);
+        EXPECT_EQ(prepare_statement->name_, "q1");
+        EXPECT_EQ(prepare_statement->parameter_count_, 2u);
+        EXPECT_EQ(prepare_statement->statement_->type_, StatementType::kSelect);
+
+        result->Reset();
+    }
+
+    {
+        String input_sql = "PREPARE q2 AS SELECT * FROM t1 SEARCH MATCH VECTOR (c1, ?, 'float', 'l2', 3);";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        auto *prepare_statement = (PrepareStatement *)((*result->statements_ptr_)[0]);
+        EXPECT_EQ(prepare_statement->parameter_count_, 1u);
+
+        result->Reset();
+    }
+
+    {
+        String input_sql = "EXECUTE q1 (1, 'abc');";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        BaseStatement *statement = (*result->statements_ptr_)[0];
+        EXPECT_EQ(statement->type_, StatementType::kExecute);
+        auto *execute_statement = (ExecuteStatement *)(statement);
+        EXPECT_EQ(execute_statement->name_, "q1");
+        EXPECT_EQ(execute_statement->parameters_->size(), 2u);
+        EXPECT_EQ((*execute_statement->parameters_)[0]->type_, ParsedExprType::kConstant);
+
+        result->Reset();
+    }
+}
@@ -42,6 +42,7 @@ import data_type;
 import segment_entry;
 import block_entry;
 import compaction_process;
+import bg_task;
 import compilation_config;
 import logger;
 import third_party;
@@ -655,4 +656,61 @@ TEST_F(CompactTaskTest, compact_not_exist_table) {
         });
         EXPECT_EQ(commit_ts, 0u);
     }
-}
\ No newline at end of file
+}
+
+class CompactWorkerTest : public CompactTaskTest {
+protected:
+    void SetUp() override {
+        auto config_path = std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_compact_workers.toml");
+
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        RemoveDbDirs();
+        infinity::InfinityContext::instance().Init(config_path);
+    }
+};
+
+TEST_F(CompactWorkerTest, compact_tables_concurrently) {
+    Storage *storage = infinity::InfinityContext::instance().storage();
+    BufferManager *buffer_mgr = storage->buffer_manager();
+    TxnManager *txn_mgr = storage->txn_manager();
+    CompactionProcessor *compaction_processor = storage->compaction_processor();
+
+    Vector<String> table_names{"tbl1", "tbl2", "tbl3"};
+    Vector<SizeT> segment_sizes(4, DEFAULT_BLOCK_CAPACITY);
+    for (const String &table_name : table_names) {
+        Vector<SharedPtr<ColumnDef>> columns;
+        std::set<ConstraintType> constraints;
+        columns.emplace_back(MakeShared<ColumnDef>(0, MakeShared<DataType>(DataType(LogicalType::kTinyInt)), "tiny_int_col", constraints));
+        auto table_def = MakeUnique<TableDef>(MakeShared<String>("default_db"), MakeShared<String>(table_name), columns);
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+        Status status = txn->CreateTable("default_db", std::move(table_def), ConflictType::kIgnore);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+
+        this->AddSegments(txn_mgr, table_name, segment_sizes, buffer_mgr);
+    }
+
+    compaction_processor->Submit(MakeShared<NotifyCompactTask>());
+    for (int i = 0; i < 1000 && compaction_processor->RunningTaskCount() > 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(compaction_processor->RunningTaskCount(), 0u);
+
+    auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("check table"));
+    TxnTimeStamp begin_ts = txn->BeginTS();
+    for (const String &table_name : table_names) {
+        auto [table_entry, status] = txn->GetTableByName("default_db", table_name);
+        ASSERT_NE(table_entry, nullptr);
+        for (SizeT i = 0; i < segment_sizes.size(); ++i) {
+            auto segment_entry = table_entry->GetSegmentByID(i, begin_ts);
+            ASSERT_NE(segment_entry, nullptr);
+            EXPECT_EQ(segment_entry->status(), SegmentStatus::kDeprecated);
+        }
+        auto compact_segment = table_entry->GetSegmentByID(segment_sizes.size(), begin_ts);
+        ASSERT_NE(compact_segment, nullptr);
+        EXPECT_EQ(compact_segment->actual_row_count(), segment_sizes.size() * DEFAULT_BLOCK_CAPACITY);
+    }
+    txn_mgr->CommitTxn(txn);
+}
@@ -85,7 +85,8 @@ protected:
                             const Vector<String>& base_names,
                             const Vector<RowID>& base_row_ids,
                             const String &dst_base_name,
-                            const Vector<ExpectedPosting> &expected_postings);
+                            const Vector<ExpectedPosting> &expected_postings,
+                            SizeT partition_count = 0);
 
     void GenerateParagraphs(u32 term_num, u32 row_num, u32 word_num, Vector<String>& paragraphs, Vector<ExpectedPosting>& expected_postings);
     void GenerateTerms(Vector<String>& terms, u32 term_num);
@@ -139,8 +140,9 @@ void ColumnIndexMergerTest::MergeAndCheckIndex(const String& index_dir,
                                                const Vector<String>& base_names,
                                                const Vector<RowID>& base_row_ids,
                                                const String &dst_base_name,
-                                               const Vector<ExpectedPosting> &expected_postings) {
-    auto column_index_merger = MakeShared<ColumnIndexMerger>(index_dir, flag_);
+                                               const Vector<ExpectedPosting> &expected_postings,
+                                               SizeT partition_count) {
+    auto column_index_merger = MakeShared<ColumnIndexMerger>(index_dir, flag_, partition_count);
     column_index_merger->Merge(base_names, base_row_ids, dst_base_name);
 
     auto fake_segment_index_entry_1 = SegmentIndexEntry::CreateFakeEntry(index_dir);
@@ -441,6 +443,31 @@ TEST_F(ColumnIndexMergerTest, GeneratePargraphsMergeTest1) {
     MergeAndCheckIndex(index_dir, base_names, base_row_ids, dst_base_name, expected_postings);
 }
 
+TEST_F(ColumnIndexMergerTest, PartitionedMergeTest) {
+    using namespace infinity;
+    Vector<String> paragraphs;
+    Vector<ExpectedPosting> expected_postings;
+
+    u32 term_num = 500;
+    u32 row_num = 60;
+    u32 word_num_pre_row = 50;
+
+    GenerateParagraphs(term_num, row_num, word_num_pre_row, paragraphs, expected_postings);
+    const String index_dir = GetTmpDir();
+
+    Vector<String> base_names = {"chunk1", "chunk2", "chunk3"};
+    Vector<RowID> base_row_ids = {RowID{0U, 0U}, RowID{0U, 20U}, RowID{0U, 45U}};
+    Vector<u32> row_offsets = {0, 20, 45};
+    Vector<u32> row_counts = {20, 25, 15};
+
+    CreateIndex(paragraphs, index_dir, base_names, base_row_ids, row_offsets, row_counts);
+    // more partitions than the merge threads, and more than there are distinct split terms
+    for (SizeT partition_count : {2, 3, 16, 64}) {
+        String dst_base_name = "merged_index_" + std::to_string(partition_count);
+        MergeAndCheckIndex(index_dir, base_names, base_row_ids, dst_base_name, expected_postings, partition_count);
+    }
+}
+
 // #define LOCAL_MERGER_TEST
 #ifdef LOCAL_MERGER_TEST
 TEST_F(ColumnIndexMergerTest, GeneratePargraphsMergeTest2) {
@@ -0,0 +1,54 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+import stl;
+
+import column_length_norm;
+
+using namespace infinity;
+
+class ColumnLengthNormTest : public BaseTest {};
+
+TEST_F(ColumnLengthNormTest, ExactShortLengths) {
+    for (u32 column_length = 0; column_length < 24; ++column_length) {
+        ASSERT_EQ(ColumnLengthToNorm(column_length), column_length);
+        ASSERT_EQ(NormToColumnLength(column_length), column_length);
+    }
+}
+
+TEST_F(ColumnLengthNormTest, Monotonic) {
+    for (u32 norm = 0; norm < 255; ++norm) {
+        ASSERT_LT(NormToColumnLength(norm), NormToColumnLength(norm + 1));
+    }
+    for (u32 column_length = 0; column_length < 100000; ++column_length) {
+        ASSERT_LE(ColumnLengthToNorm(column_length), ColumnLengthToNorm(column_length + 1));
+    }
+}
+
+TEST_F(ColumnLengthNormTest, RoundUp) {
+    for (u32 column_length = 0; column_length < 1000000; column_length += 7) {
+        u32 decoded = NormToColumnLength(ColumnLengthToNorm(column_length));
+        ASSERT_GE(decoded, column_length);
+        ASSERT_LE(decoded - column_length, column_length / 8 + 1);
+    }
+    ASSERT_EQ(ColumnLengthToNorm(std::numeric_limits<u32>::max()), 255);
+}
+
+TEST_F(ColumnLengthNormTest, RoundTrip) {
+    // the readers encode a decoded length again to index the norm tables of BM25
+    for (u32 norm = 0; norm < 256; ++norm) {
+        ASSERT_EQ(ColumnLengthToNorm(NormToColumnLength(norm)), norm);
+    }
+}
@@ -189,3 +189,21 @@ TEST_F(MemoryIndexerTest, SpillLoadTest) {
         }
     }
 }
+
+TEST_F(MemoryIndexerTest, PartitionedDump) {
+    for (bool offline : {false, true}) {
+        String chunk_name = offline ? "chunk_offline" : "chunk_online";
+        auto fake_segment_index_entry_1 = SegmentIndexEntry::CreateFakeEntry(GetTmpDir());
+        MemoryIndexer indexer1(GetTmpDir(), chunk_name, RowID(0U, 0U), flag_, "standard");
+        indexer1.SetDumpPartitionCount(3);
+        indexer1.Insert(column_, 0, 2, offline);
+        indexer1.Insert(column_, 2, 3, offline);
+        indexer1.Dump(offline);
+        fake_segment_index_entry_1->AddFtChunkIndexEntry(chunk_name, RowID(0U, 0U).ToUint64(), 5U);
+
+        Map<SegmentID, SharedPtr<SegmentIndexEntry>> index_by_segment = {{0, fake_segment_index_entry_1}};
+        ColumnIndexReader reader;
+        reader.Open(flag_, GetTmpDir(), std::move(index_by_segment));
+        Check(reader);
+    }
+}
@@ -96,3 +96,45 @@ TEST_F(PostingWriterTest, test1) {
         }
     }
 }
+
+TEST_F(PostingWriterTest, StreamVByteCodec) {
+    optionflag_t flag = SetPostingCodec(OPTION_FLAG_ALL, PostingCodec::kStreamVByte);
+    ASSERT_EQ(GetPostingCodec(flag), PostingCodec::kStreamVByte);
+    PostingFormat posting_format(flag);
+    // spans several compressed blocks of doc ids and positions
+    const u32 doc_count = 1000;
+    VectorWithLock<u32> column_length_array(doc_count * 3, 10);
+    {
+        SharedPtr<PostingWriter> posting = MakeShared<PostingWriter>(posting_format, column_length_array);
+        for (u32 i = 0; i < doc_count; ++i) {
+            for (u32 j = 0; j <= i % 4; ++j) {
+                posting->AddPosition(j * 2);
+            }
+            posting->EndDocument(i * 3, 0);
+        }
+        SharedPtr<FileWriter> file_writer = MakeShared<FileWriter>(fs_, file_, 128000);
+        TermMeta term_meta(posting->GetDF(), posting->GetTotalTF());
+        posting->Dump(file_writer, term_meta, true);
+        file_writer->Sync();
+    }
+    {
+        SharedPtr<PostingWriter> posting = MakeShared<PostingWriter>(posting_format, column_length_array);
+        SharedPtr<FileReader> file_reader = MakeShared<FileReader>(fs_, file_, 128000);
+        posting->Load(file_reader);
+
+        SharedPtr<Vector<SegmentPosting>> seg_postings = MakeShared<Vector<SegmentPosting>>();
+        SegmentPosting seg_posting;
+        RowID base_row_id = 0;
+        seg_posting.Init(base_row_id, posting);
+        seg_postings->push_back(seg_posting);
+        PostingIterator iter(flag);
+        iter.Init(seg_postings, 0);
+        for (u32 i = 0; i < doc_count; ++i) {
+            RowID doc_id = iter.SeekDoc(i * 3);
+            ASSERT_EQ(doc_id, i * 3);
+            ASSERT_EQ(iter.GetCurrentTF(), i % 4 + 1);
+        }
+        RowID doc_id = iter.SeekDoc(doc_count * 3);
+        ASSERT_EQ(doc_id, INVALID_ROWID);
+    }
+}
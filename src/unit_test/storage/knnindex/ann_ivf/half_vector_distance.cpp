@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import vector_distance;
+import internal_types;
+
+using namespace infinity;
+
+class HalfVectorDistanceTest : public BaseTest {};
+
+template <typename HalfType>
+void CheckHalfDistance() {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<float> dist(-1, 1);
+    // cover the 16-lane loop, the 8-lane step and the scalar tail
+    for (SizeT dim : {1, 7, 8, 15, 16, 17, 100, 128, 129}) {
+        Vector<f32> query(dim);
+        Vector<HalfType> data(dim);
+        for (SizeT i = 0; i < dim; ++i) {
+            query[i] = dist(rng);
+            data[i] = HalfType(dist(rng));
+        }
+        f32 l2_expect = 0, ip_expect = 0;
+        for (SizeT i = 0; i < dim; ++i) {
+            f32 v = static_cast<f32>(data[i]);
+            l2_expect += (query[i] - v) * (query[i] - v);
+            ip_expect += query[i] * v;
+        }
+        f32 l2 = L2Distance<f32, f32, HalfType, SizeT>(query.data(), data.data(), dim);
+        f32 ip = IPDistance<f32, f32, HalfType, SizeT>(query.data(), data.data(), dim);
+        EXPECT_NEAR(l2, l2_expect, 1e-4 * dim);
+        EXPECT_NEAR(ip, ip_expect, 1e-4 * dim);
+    }
+}
+
+TEST_F(HalfVectorDistanceTest, float16) { CheckHalfDistance<Float16T>(); }
+
+TEST_F(HalfVectorDistanceTest, bfloat16) { CheckHalfDistance<BFloat16T>(); }
@@ -231,6 +231,66 @@ public:
             t.join();
         }
     }
+
+    template <typename Hnsw>
+    void TestMerge() {
+        int dim = 16;
+        int M = 8;
+        int ef_construction = 200;
+        int chunk_size = 128;
+        int max_chunk_n = 10;
+        int element_size = max_chunk_n * chunk_size;
+        int half_size = element_size / 2;
+
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+
+        HnswInsertConfig config;
+        config.optimize_ = true;
+        auto hnsw_index1 = Hnsw::Make(chunk_size, max_chunk_n / 2, dim, M, ef_construction);
+        hnsw_index1.InsertVecsRaw(data.get(), half_size, 0, config);
+        auto hnsw_index2 = Hnsw::Make(chunk_size, max_chunk_n / 2, dim, M, ef_construction);
+        hnsw_index2.InsertVecsRaw(data.get() + half_size * dim, half_size, half_size, config);
+
+        // every 5th vector is deleted
+        auto IsDeleted = [](LabelT label) { return label % 5 == 0; };
+        auto label_map = [&](SizeT, LabelT label) -> Optional<LabelT> {
+            if (IsDeleted(label)) {
+                return None;
+            }
+            return label;
+        };
+        SizeT kept_num = element_size - (element_size + 4) / 5;
+
+        auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+        EXPECT_FALSE(hnsw_index.Merge(Vector<const Hnsw *>{&hnsw_index1, &hnsw_index2}, label_map, kept_num + 1));
+        EXPECT_EQ(hnsw_index.GetVertexNum(), 0u);
+        EXPECT_TRUE(hnsw_index.Merge(Vector<const Hnsw *>{&hnsw_index1, &hnsw_index2}, label_map, kept_num));
+        EXPECT_EQ(hnsw_index.GetVertexNum(), kept_num);
+        hnsw_index.Check();
+
+        hnsw_index.SetEf(10);
+        int correct = 0;
+        for (int i = 0; i < element_size; ++i) {
+            if (IsDeleted(i)) {
+                continue;
+            }
+            const float *query = data.get() + i * dim;
+            auto result = hnsw_index.KnnSearchSorted(query, 1);
+            EXPECT_FALSE(IsDeleted(result[0].second));
+            if (result[0].second == (LabelT)i) {
+                ++correct;
+            }
+        }
+        float correct_rate = float(correct) / kept_num;
+        EXPECT_GE(correct_rate, 0.95);
+    }
 };
 
 TEST_F(HnswAlgTest, test1) {
@@ -253,3 +313,13 @@ TEST_F(HnswAlgTest, test4) {
     using Hnsw = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT>;
     TestParallel<Hnsw>();
 }
+
+TEST_F(HnswAlgTest, test5) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
+    TestMerge<Hnsw>();
+}
+
+TEST_F(HnswAlgTest, test6) {
+    using Hnsw = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT>;
+    TestMerge<Hnsw>();
+}
@@ -0,0 +1,103 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import maxsim_simd_funcs;
+
+using namespace infinity;
+
+class MaxSimSimdFuncsTest : public BaseTest {};
+
+template <typename QueryT, typename TargetT>
+f32 MaxSimExpect(const QueryT *query, const TargetT *target, u32 query_num, u32 target_num, u32 dim) {
+    f32 maxsim_score = 0.0f;
+    for (u32 i = 0; i < query_num; ++i) {
+        f32 max_score_i = std::numeric_limits<f32>::lowest();
+        for (u32 j = 0; j < target_num; ++j) {
+            f32 score_ij = 0.0f;
+            for (u32 k = 0; k < dim; ++k) {
+                score_ij += static_cast<f32>(query[i * dim + k]) * static_cast<f32>(target[j * dim + k]);
+            }
+            max_score_i = std::max(max_score_i, score_ij);
+        }
+        maxsim_score += max_score_i;
+    }
+    return maxsim_score;
+}
+
+// dimensions cover the 8 lane loop and the scalar tail, target counts cover the 4 target block and the cache block tail
+TEST_F(MaxSimSimdFuncsTest, float_and_int8) {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<f32> dist(-1, 1);
+    for (u32 dim : {1, 7, 16, 33, 128}) {
+        for (u32 query_num : {1, 5, 32}) {
+            for (u32 target_num : {1, 3, 4, 9, 300}) {
+                Vector<f32> query(query_num * dim), target(target_num * dim);
+                Vector<i8> query_i8(query_num * dim), target_i8(target_num * dim);
+                for (u32 i = 0; i < query_num * dim; ++i) {
+                    query[i] = dist(rng);
+                    query_i8[i] = static_cast<i8>(dist(rng) * 127);
+                }
+                for (u32 i = 0; i < target_num * dim; ++i) {
+                    target[i] = dist(rng);
+                    target_i8[i] = static_cast<i8>(dist(rng) * 127);
+                }
+                EXPECT_NEAR(MaxSimF32(query.data(), target.data(), query_num, target_num, dim),
+                            MaxSimExpect(query.data(), target.data(), query_num, target_num, dim),
+                            1e-4 * query_num * dim);
+                EXPECT_EQ(MaxSimI8(query_i8.data(), target_i8.data(), query_num, target_num, dim),
+                          MaxSimExpect(query_i8.data(), target_i8.data(), query_num, target_num, dim));
+                EXPECT_NEAR(MaxSimGeneric(query_i8.data(), target.data(), query_num, target_num, dim),
+                            MaxSimExpect(query_i8.data(), target.data(), query_num, target_num, dim),
+                            1e-2 * query_num * dim);
+            }
+        }
+    }
+}
+
+TEST_F(MaxSimSimdFuncsTest, bit) {
+    std::default_random_engine rng;
+    std::uniform_real_distribution<f32> dist(-1, 1);
+    std::uniform_int_distribution<u32> byte_dist(0, 255);
+    for (u32 dim : {8, 24, 64, 128}) {
+        const u32 query_num = 7, target_num = 13, bytes = dim / 8;
+        Vector<u8> query_bits(query_num * bytes), target_bits(target_num * bytes);
+        for (auto &byte : query_bits) {
+            byte = byte_dist(rng);
+        }
+        for (auto &byte : target_bits) {
+            byte = byte_dist(rng);
+        }
+        Vector<f32> query_unpacked(query_num * dim), target_unpacked(target_num * dim), query(query_num * dim), target(target_num * dim);
+        for (u32 i = 0; i < query_num * dim; ++i) {
+            query_unpacked[i] = (query_bits[i / 8] >> (i % 8)) & 1;
+            query[i] = dist(rng);
+        }
+        for (u32 i = 0; i < target_num * dim; ++i) {
+            target_unpacked[i] = (target_bits[i / 8] >> (i % 8)) & 1;
+            target[i] = dist(rng);
+        }
+        EXPECT_EQ(MaxSimBit(query_bits.data(), target_bits.data(), query_num, target_num, dim),
+                  MaxSimExpect(query_unpacked.data(), target_unpacked.data(), query_num, target_num, dim));
+        EXPECT_NEAR(MaxSimDenseBit(query.data(), target_bits.data(), query_num, target_num, dim),
+                    MaxSimExpect(query.data(), target_unpacked.data(), query_num, target_num, dim),
+                    1e-4 * query_num * dim);
+        EXPECT_NEAR(MaxSimBitDense(query_bits.data(), target.data(), query_num, target_num, dim),
+                    MaxSimExpect(query_unpacked.data(), target.data(), query_num, target_num, dim),
+                    1e-4 * query_num * dim);
+    }
+}
@@ -0,0 +1,129 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import result_cache;
+import data_table;
+import data_block;
+import table_def;
+import column_def;
+import data_type;
+import logical_type;
+import logical_node_type;
+
+using namespace infinity;
+
+class ResultCacheTest : public BaseTest {
+protected:
+    static SharedPtr<DataTable> MakeResult() {
+        SharedPtr<DataType> column_type = MakeShared<DataType>(LogicalType::kBigInt);
+        Vector<SharedPtr<ColumnDef>> columns{MakeShared<ColumnDef>(0, column_type, "c1", std::set<ConstraintType>())};
+        SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("result"), columns);
+        SharedPtr<DataTable> result_table = DataTable::Make(table_def, TableType::kResult);
+        SharedPtr<DataBlock> data_block = DataBlock::Make();
+        data_block->Init(Vector<SharedPtr<DataType>>{column_type});
+        data_block->Finalize();
+        result_table->Append(data_block);
+        return result_table;
+    }
+
+    // The create timestamps of a table and of a table created again with the same name
+    TxnTimeStamp table1_ = 100;
+    TxnTimeStamp table2_ = 200;
+};
+
+TEST_F(ResultCacheTest, version_check) {
+    ResultCache result_cache(1024 * 1024 * 1024);
+    SharedPtr<DataTable> result_table;
+    LogicalNodeType root_operator_type{};
+    EXPECT_FALSE(result_cache.Get("q1", table1_, 1, result_table, root_operator_type));
+
+    SharedPtr<DataTable> expect_table = MakeResult();
+    result_cache.Put("q1", table1_, 1, expect_table, LogicalNodeType::kProjection);
+    EXPECT_TRUE(result_cache.Get("q1", table1_, 1, result_table, root_operator_type));
+    EXPECT_EQ(result_table.get(), expect_table.get());
+    EXPECT_EQ(root_operator_type, LogicalNodeType::kProjection);
+
+    // a recreated table
+    EXPECT_FALSE(result_cache.Get("q1", table2_, 1, result_table, root_operator_type));
+    EXPECT_EQ(result_cache.entry_count(), 0u);
+
+    // a write to the table invalidates the entry
+    result_cache.Put("q1", table1_, 1, expect_table, LogicalNodeType::kProjection);
+    EXPECT_FALSE(result_cache.Get("q1", table1_, 2, result_table, root_operator_type));
+    EXPECT_EQ(result_cache.entry_count(), 0u);
+    EXPECT_EQ(result_cache.memory_usage(), 0u);
+
+    EXPECT_EQ(result_cache.hit_count(), 1u);
+    EXPECT_EQ(result_cache.lookup_count(), 4u);
+}
+
+TEST_F(ResultCacheTest, invalidate) {
+    ResultCache result_cache(1024 * 1024 * 1024);
+    SharedPtr<DataTable> result_table;
+    LogicalNodeType root_operator_type{};
+    String key1 = ResultCache::MakeKey("db1", "t1", "q1");
+    String key2 = ResultCache::MakeKey("db1", "t10", "q1");
+    String key3 = ResultCache::MakeKey("db2", "t1", "q1");
+    for (const String &key : {key1, key2, key3}) {
+        result_cache.Put(key, table1_, 1, MakeResult(), LogicalNodeType::kProjection);
+    }
+    EXPECT_EQ(result_cache.entry_count(), 3u);
+
+    // dropping a table doesn't touch a table whose name it prefixes
+    result_cache.InvalidateTable("db1", "t1");
+    EXPECT_FALSE(result_cache.Get(key1, table1_, 1, result_table, root_operator_type));
+    EXPECT_TRUE(result_cache.Get(key2, table1_, 1, result_table, root_operator_type));
+    EXPECT_TRUE(result_cache.Get(key3, table1_, 1, result_table, root_operator_type));
+
+    result_cache.InvalidateDatabase("db1");
+    EXPECT_FALSE(result_cache.Get(key2, table1_, 1, result_table, root_operator_type));
+    EXPECT_TRUE(result_cache.Get(key3, table1_, 1, result_table, root_operator_type));
+    EXPECT_EQ(result_cache.entry_count(), 1u);
+}
+
+TEST_F(ResultCacheTest, admission) {
+    SizeT result_memory = ResultCache::EstimateMemory(MakeResult().get());
+    // room for two results
+    ResultCache result_cache(result_memory * 5 / 2);
+    SharedPtr<DataTable> result_table;
+    LogicalNodeType root_operator_type{};
+
+    for (const String &key : {"hot1", "hot2"}) {
+        for (SizeT i = 0; i < 5; ++i) {
+            result_cache.Get(key, table1_, 1, result_table, root_operator_type);
+        }
+        result_cache.Put(key, table1_, 1, MakeResult(), LogicalNodeType::kProjection);
+    }
+    EXPECT_EQ(result_cache.entry_count(), 2u);
+
+    // a one-off query doesn't evict the popular ones
+    EXPECT_FALSE(result_cache.Get("cold", table1_, 1, result_table, root_operator_type));
+    result_cache.Put("cold", table1_, 1, MakeResult(), LogicalNodeType::kProjection);
+    EXPECT_TRUE(result_cache.Get("hot1", table1_, 1, result_table, root_operator_type));
+    EXPECT_TRUE(result_cache.Get("hot2", table1_, 1, result_table, root_operator_type));
+    EXPECT_FALSE(result_cache.Get("cold", table1_, 1, result_table, root_operator_type));
+
+    // once it gets more popular than the least recently used entry, it's admitted
+    for (SizeT i = 0; i < 10; ++i) {
+        result_cache.Get("warm", table1_, 1, result_table, root_operator_type);
+    }
+    result_cache.Put("warm", table1_, 1, MakeResult(), LogicalNodeType::kProjection);
+    EXPECT_TRUE(result_cache.Get("warm", table1_, 1, result_table, root_operator_type));
+    EXPECT_FALSE(result_cache.Get("hot1", table1_, 1, result_table, root_operator_type));
+    EXPECT_TRUE(result_cache.Get("hot2", table1_, 1, result_table, root_operator_type));
+    EXPECT_LE(result_cache.memory_usage(), result_cache.memory_limit());
+}
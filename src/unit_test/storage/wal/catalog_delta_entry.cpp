@@ -515,4 +515,45 @@ TEST_F(CatalogDeltaEntryTest, ComplicateMergeEntries) {
             EXPECT_EQ(merged_entry->operations().size(), 1u);
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_F(CatalogDeltaEntryTest, TableChange) {
+    auto global_catalog_delta_entry = std::make_unique<GlobalCatalogDeltaEntry>();
+    auto AddOp = [&]<typename OpType>(CatalogDeltaEntry *delta_entry, const String &encode, TxnTimeStamp commit_ts) {
+        auto op = MakeUnique<OpType>();
+        op->encode_ = MakeUnique<String>(encode);
+        op->merge_flag_ = MergeFlag::kUpdate;
+        op->commit_ts_ = commit_ts;
+        delta_entry->operations().push_back(std::move(op));
+    };
+    const String table1 = "#db_test#table1";
+    const String table2 = "#db_test#table2";
+    EXPECT_EQ(global_catalog_delta_entry->GetTableChange(table1), (Pair<u64, TxnTimeStamp>{0, 0}));
+    {
+        auto delta_entry = std::make_unique<CatalogDeltaEntry>();
+        delta_entry->set_txn_ids({1});
+        delta_entry->set_commit_ts(1);
+        AddOp.operator()<AddDBEntryOp>(delta_entry.get(), "#db_test", 1);
+        AddOp.operator()<AddSegmentEntryOp>(delta_entry.get(), table1 + "#0", 1);
+        AddOp.operator()<AddBlockEntryOp>(delta_entry.get(), table2 + "#0#0", 1);
+        global_catalog_delta_entry->ReplayDeltaEntry(std::move(delta_entry));
+    }
+    auto [table1_seq, table1_ts] = global_catalog_delta_entry->GetTableChange(table1);
+    auto [table2_seq, table2_ts] = global_catalog_delta_entry->GetTableChange(table2);
+    EXPECT_EQ(table1_ts, 1u);
+    EXPECT_EQ(table2_ts, 1u);
+    EXPECT_NE(table1_seq, table2_seq);
+    {
+        auto delta_entry = std::make_unique<CatalogDeltaEntry>();
+        delta_entry->set_txn_ids({2});
+        delta_entry->set_commit_ts(2);
+        AddOp.operator()<AddTableEntryOp>(delta_entry.get(), table2, 2);
+        global_catalog_delta_entry->ReplayDeltaEntry(std::move(delta_entry));
+    }
+    // the flush of the picked operations is another change to the tables
+    auto flush_entry = global_catalog_delta_entry->PickFlushEntry(2);
+    global_catalog_delta_entry->RecordFlushedEntry(flush_entry.get());
+    EXPECT_GT(global_catalog_delta_entry->GetTableChange(table1).first, table1_seq);
+    EXPECT_GT(global_catalog_delta_entry->GetTableChange(table2).first, table2_seq);
+    EXPECT_EQ(global_catalog_delta_entry->GetTableChange(table2).second, 2u);
+}
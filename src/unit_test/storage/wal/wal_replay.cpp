@@ -466,6 +466,88 @@ TEST_F(WalReplayTest, wal_replay_append) {
     }
 }
 
+// Appends to different tables are replayed concurrently, each table in commit order
+TEST_F(WalReplayTest, wal_replay_append_tables) {
+    constexpr SizeT kAppendCount = 8;
+    const Vector<String> table_names{"tbl1", "tbl2", "tbl3"};
+    Vector<SharedPtr<ColumnDef>> columns{
+        MakeShared<ColumnDef>(0, MakeShared<DataType>(DataType(LogicalType::kBigInt)), "big_int_col", std::set<ConstraintType>())};
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+
+        for (const String &table_name : table_names) {
+            auto table_def = MakeUnique<TableDef>(MakeShared<String>("default_db"), MakeShared<String>(table_name), columns);
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+            Status status = txn->CreateTable("default_db", std::move(table_def), ConflictType::kIgnore);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+        for (SizeT i = 0; i < kAppendCount; ++i) {
+            for (SizeT table_idx = 0; table_idx < table_names.size(); ++table_idx) {
+                auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+                SharedPtr<DataBlock> input_block = MakeShared<DataBlock>();
+                input_block->Init(Vector<SharedPtr<DataType>>{MakeShared<DataType>(LogicalType::kBigInt)}, 1);
+                input_block->AppendValue(0, Value::MakeBigInt(static_cast<i64>(i * table_names.size() + table_idx)));
+                input_block->Finalize();
+                auto [table_entry, status] = txn->GetTableByName("default_db", table_names[table_idx]);
+                EXPECT_TRUE(status.ok());
+                txn->Append(table_entry, input_block);
+                txn_mgr->CommitTxn(txn);
+            }
+        }
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+    // Restart the db instance
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("check table"));
+            TxnTimeStamp begin_ts = txn->BeginTS();
+            for (SizeT table_idx = 0; table_idx < table_names.size(); ++table_idx) {
+                auto [table_entry, status] = txn->GetTableByName("default_db", table_names[table_idx]);
+                EXPECT_TRUE(status.ok());
+
+                auto segment_entry = table_entry->GetSegmentByID(0, begin_ts);
+                EXPECT_NE(segment_entry, nullptr);
+                EXPECT_EQ(segment_entry->row_count(), kAppendCount);
+
+                auto *block_entry = segment_entry->GetBlockEntryByID(0).get();
+                EXPECT_EQ(block_entry->row_count(), kAppendCount);
+                ColumnVector col0 = block_entry->GetColumnBlockEntry(0)->GetColumnVector(storage->buffer_manager());
+                for (SizeT i = 0; i < kAppendCount; ++i) {
+                    EXPECT_EQ(col0.GetValue(i).GetValue<BigIntT>(), static_cast<i64>(i * table_names.size() + table_idx));
+                }
+            }
+            txn_mgr->CommitTxn(txn);
+        }
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+}
+
 TEST_F(WalReplayTest, wal_replay_import) {
     {
 #ifdef INFINITY_DEBUG
@@ -989,6 +1071,10 @@ TEST_F(WalReplayTest, wal_replay_create_index_hnsw) {
             EXPECT_EQ(table_index_meta->index_entry_list().size(), 1u);
             auto table_index_entry_front = static_cast<TableIndexEntry *>(table_index_meta->index_entry_list().front().get());
             EXPECT_EQ(*table_index_entry_front->index_base()->index_name_, "hnsw_index");
+
+            // The memory index is recovered in the background, the table is ready once it's done
+            EXPECT_TRUE(table_entry->WaitMemIndexReady().ok());
+            EXPECT_TRUE(table_entry->MemIndexReady());
             txn_mgr->CommitTxn(txn);
         }
 
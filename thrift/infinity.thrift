@@ -57,6 +57,8 @@ ElementInt32,
 ElementInt64,
 ElementFloat32,
 ElementFloat64,
+ElementFloat16,
+ElementBFloat16,
 }
 
 struct EmbeddingType {
@@ -156,6 +158,7 @@ struct KnnExpr {
 4: KnnDistanceType distance_type,
 5: i64 topn,
 6: list<InitParameter> opt_params = [],
+7: i64 query_count = 1,
 }
 
 struct MatchTensorExpr {
@@ -249,6 +252,15 @@ struct ColumnField {
 3: string column_name,
 }
 
+// Values of one column packed back to back in the layout of data_type, see InsertColumnData
+struct InsertColumn {
+1: string column_name,
+2: DataType data_type,
+3: i64 row_count,
+4: binary data,
+5: list<i32> varchar_offsets = [],
+}
+
 struct ImportOption {
 1:  string delimiter,
 2:  bool copy_from,
@@ -435,6 +447,7 @@ struct InsertRequest {
 3:  list<string> column_names = [],
 4:  list<Field> fields = [],
 5:  i64 session_id,
+6:  list<InsertColumn> columns = [],
 }
 
 struct ImportRequest{
@@ -592,6 +605,18 @@ struct ShowBlockColumnResponse {
 8: string extra_file_names,
 }
 
+struct PrepareRequest {
+1: i64 session_id,
+2: string statement_name,
+3: string statement,
+}
+
+struct ExecuteRequest {
+1: i64 session_id,
+2: string statement_name,
+3: list<ConstantExpr> parameters = [],
+}
+
 // Service
 service InfinityService {
 CommonResponse Connect(1:ConnectRequest request),
@@ -632,4 +657,7 @@ CommonResponse CreateIndex(1:CreateIndexRequest request),
 CommonResponse DropIndex(1:DropIndexRequest request),
 ShowIndexResponse ShowIndex(1:ShowIndexRequest request),
 
+CommonResponse Prepare(1:PrepareRequest request),
+SelectResponse Execute(1:ExecuteRequest request),
+
 }
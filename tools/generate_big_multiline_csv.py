@@ -0,0 +1,158 @@
+# generate 'test/sql/dml/import/test_import_big_multiline_csv.slt' & 'test/data/csv/big_multiline.csv'
+
+import argparse
+import os
+
+# the CSV import splits files into ranges of at least this size, see DEFAULT_IMPORT_RANGE_SIZE
+import_range_size = 64 * 1024 * 1024
+line_n = 20
+
+
+def row_c1(i: int) -> int:
+    # six digits, every row has the same length
+    return 100000 + i
+
+
+def row_c2(i: int) -> str:
+    lines = [
+        'row {} line {:02d}, "quoted" {}'.format(row_c1(i), j, "x" * 24)
+        for j in range(line_n)
+    ]
+    return "\n".join(lines)
+
+
+def csv_row(i: int) -> str:
+    return '{},"{}"\n'.format(row_c1(i), row_c2(i).replace('"', '""'))
+
+
+def range_end_rows(row_n: int, row_size: int, range_count: int):
+    # the rows which end the ranges, replaying the split of the import
+    file_size = row_n * row_size
+    range_size = file_size // range_count
+    rows = []
+    range_begin = 0
+    for _ in range(range_count - 1):
+        split_point = range_begin + range_size
+        row = split_point // row_size
+        rows.append((row, split_point % row_size))
+        range_begin = (row + 1) * row_size
+    return rows
+
+
+def generate(generate_if_exists: bool, copy_dir: str):
+    csv_dir = "./test/data/csv"
+    slt_dir = "./test/sql/dml/import"
+
+    table_name = "big_multiline_csv_table"
+    csv_filename = "big_multiline.csv"
+    csv_path = csv_dir + "/" + csv_filename
+    slt_path = slt_dir + "/test_import_big_multiline_csv.slt"
+    copy_path = copy_dir + "/" + csv_filename
+
+    os.makedirs(csv_dir, exist_ok=True)
+    os.makedirs(slt_dir, exist_ok=True)
+    if os.path.exists(csv_path) and os.path.exists(slt_path) and not generate_if_exists:
+        print(
+            "File {} and {} already existed. Skip Generating.".format(
+                slt_path, csv_path
+            )
+        )
+        return
+
+    row_size = len(csv_row(0))
+    # the offset of the last line break inside the quoted cell of a row
+    last_inner_break = csv_row(0).rfind("\n", 0, row_size - 1)
+
+    # about 3 ranges, pick the row count whose split points fall before a line break inside a quoted cell,
+    # for 2 and 3 ranges, so the first line break after each split point doesn't end the row
+    row_n = 3 * import_range_size // row_size + 1
+    while True:
+        end_rows = range_end_rows(row_n, row_size, 2) + range_end_rows(row_n, row_size, 3)
+        if all(offset < last_inner_break for _, offset in end_rows):
+            break
+        row_n += 1
+    check_rows = sorted(
+        set([0, row_n - 1] + [row + d for row, _ in end_rows for d in (-1, 0, 1)])
+    )
+
+    with open(csv_path, "w") as csv_file:
+        for i in range(row_n):
+            csv_file.write(csv_row(i))
+
+    with open(slt_path, "w") as slt_file:
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "CREATE TABLE {} ( c1 INT, c2 VARCHAR);\n".format(table_name)
+        )
+        slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH ( DELIMITER ',' );\n".format(table_name, copy_path)
+        )
+        slt_file.write("\n")
+
+        slt_file.write("query I\n")
+        slt_file.write("SELECT count(*) FROM {};\n".format(table_name))
+        slt_file.write("----\n")
+        slt_file.write("{}\n".format(row_n))
+        slt_file.write("\n")
+
+        slt_file.write("query I\n")
+        slt_file.write("SELECT sum(c1) FROM {};\n".format(table_name))
+        slt_file.write("----\n")
+        slt_file.write("{}\n".format(sum(row_c1(i) for i in range(row_n))))
+        slt_file.write("\n")
+
+        # the segments of the ranges follow the file order, so do the row ids
+        order_rows = sorted(set(check_rows + list(range(0, row_n, 1000))))
+        slt_file.write("query I\n")
+        slt_file.write(
+            "SELECT c1 FROM {} WHERE c1 % 1000 = 0 OR c1 IN ({}) ORDER BY ROW_ID();\n".format(
+                table_name, ", ".join(str(row_c1(i)) for i in check_rows)
+            )
+        )
+        slt_file.write("----\n")
+        for i in order_rows:
+            slt_file.write("{}\n".format(row_c1(i)))
+        slt_file.write("\n")
+
+        # the rows around the range ends keep their whole multi-line cell
+        for i in check_rows:
+            slt_file.write("query I\n")
+            slt_file.write(
+                "SELECT c1 FROM {} WHERE c2 = '{}';\n".format(table_name, row_c2(i))
+            )
+            slt_file.write("----\n")
+            slt_file.write("{}\n".format(row_c1(i)))
+            slt_file.write("\n")
+
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE {};\n".format(table_name))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Generate a CSV file of multi-line quoted cells split into import ranges"
+    )
+
+    parser.add_argument(
+        "-g",
+        "--generate",
+        type=bool,
+        default=False,
+        dest="generate_if_exists",
+    )
+    parser.add_argument(
+        "-c",
+        "--copy",
+        type=str,
+        default="/var/infinity/test_data",
+        dest="copy_dir",
+    )
+    args = parser.parse_args()
+    generate(args.generate_if_exists, args.copy_dir)